@@ -0,0 +1,97 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: bench_main.cc
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Integral micro-benchmarks.
+//
+//   BenchSuite [--lmax 2] [--time 0.05] [--filter eri] [--input mol.json] [--output bench.json]
+//   BenchSuite --compare reference.json current.json [--tol 0.1]
+//
+// Results are written as JSON; --compare reports kernels whose throughput dropped by more than tol
+// and returns a nonzero exit status if there are any.
+
+#include <bagel_config.h>
+#include <src/global.h>
+#include <src/util/string.h>
+#include <src/util/parallel/resources.h>
+#include <src/integral/rys/rootkernel.h>
+#include <src/benchimpl/benchmark.h>
+#include <src/benchimpl/bench_integral.cc>
+
+using namespace std;
+using namespace bagel;
+
+int main(int argc, char** argv) {
+
+  static_variables();
+  print_header();
+
+  int lmax = 2;
+  double min_time = 0.05;
+  double tol = 0.1;
+  string filter, input, output = "bench.json";
+  vector<string> compare;
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const string arg = argv[i];
+      auto next = [&]() { if (++i == argc) throw runtime_error(arg + " requires an argument"); return string(argv[i]); };
+      if (arg == "--lmax")         lmax = lexical_cast<int>(next());
+      else if (arg == "--time")    min_time = lexical_cast<double>(next());
+      else if (arg == "--filter")  filter = next();
+      else if (arg == "--input")   input = next();
+      else if (arg == "--output")  output = next();
+      else if (arg == "--tol")     tol = lexical_cast<double>(next());
+      else if (arg == "--compare") { compare.push_back(next()); compare.push_back(next()); }
+      else throw runtime_error("unknown option " + arg);
+    }
+    if (lmax < 0 || lmax >= ANG_HRR_END/2)
+      throw runtime_error("--lmax should be between 0 and " + to_string(ANG_HRR_END/2-1));
+
+    if (!compare.empty()) {
+      const int nregress = Benchmark::compare(compare[0], compare[1], tol);
+      print_footer();
+      return nregress == 0 ? 0 : 1;
+    }
+
+    Benchmark bench(min_time, 3, filter);
+    Benchmark::print_header();
+    bench::bench_eri(bench, lmax);
+    bench::bench_eri3(bench, lmax);
+    bench::bench_nai(bench, lmax);
+    bench::bench_transform(bench);
+    if (!input.empty())
+      bench::bench_df(bench, input);
+
+    bench.write(output, {{"version", PACKAGE_VERSION}, {"threads", to_string(resources__->max_num_threads())},
+                         {"rys_simd", to_string(rys_root::simd_level())}, {"lmax", to_string(lmax)}});
+    cout << endl << "  * results written to " << output << endl;
+
+  } catch (const exception& e) {
+    cout << "  ERROR: EXCEPTION RAISED:  " << e.what() << endl;
+    return 1;
+  }
+
+  print_footer();
+  return 0;
+}
@@ -0,0 +1,221 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: bench_integral.cc
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <src/integral/rys/eribatch.h>
+#include <src/integral/rys/gradbatch.h>
+#include <src/integral/rys/naibatch.h>
+#include <src/integral/rys/smalleribatch.h>
+#include <src/integral/carsphlist.h>
+#include <src/integral/hrrlist.h>
+#include <src/wfn/geometry.h>
+
+namespace bagel {
+namespace bench {
+
+// contraction patterns: (number of primitives, number of contracted functions, general contraction or not)
+struct Contraction {
+  std::string name;
+  int nprim;
+  int ncont;
+};
+static const std::vector<Contraction> patterns = {{"1p1c", 1, 1}, {"6p1c", 6, 1}, {"4p2c", 4, 2}};
+
+static const std::array<std::array<double,3>,4> centers = {{{{0.0, 0.0, 0.0}}, {{0.0, 0.0, 1.4}}, {{1.2, 0.5, 0.3}}, {{1.0, 1.5, -0.4}}}};
+
+static const std::string lname = "spdfghi";
+
+
+std::shared_ptr<const Shell> make_shell(const int l, const Contraction& c, const int center) {
+  std::vector<double> exponents;
+  for (int i = 0; i != c.nprim; ++i)
+    exponents.push_back(0.15 * std::pow(3.0, c.nprim-i-1));
+  std::vector<std::vector<double>> contractions;
+  std::vector<std::pair<int,int>> ranges;
+  for (int j = 0; j != c.ncont; ++j) {
+    std::vector<double> coeff(c.nprim);
+    for (int i = 0; i != c.nprim; ++i)
+      coeff[i] = 1.0 / (1.0 + std::abs(i - j*(c.nprim-1.0)/std::max(c.ncont-1, 1)));
+    contractions.push_back(coeff);
+    ranges.push_back({0, c.nprim});
+  }
+  return std::make_shared<const Shell>(true, centers[center], l, exponents, contractions, ranges);
+}
+
+
+std::vector<std::array<int,4>> quartet_classes(const int lmax) {
+  std::vector<std::array<int,2>> pairs;
+  for (int a = 0; a <= lmax; ++a)
+    for (int b = 0; b <= a; ++b)
+      pairs.push_back({{a, b}});
+  std::vector<std::array<int,4>> out;
+  for (int i = 0; i != pairs.size(); ++i)
+    for (int j = 0; j <= i; ++j)
+      out.push_back({{pairs[i][0], pairs[i][1], pairs[j][0], pairs[j][1]}});
+  return out;
+}
+
+
+std::string class_name(const std::vector<int>& l) {
+  std::string out = "(";
+  for (int i = 0; i != l.size(); ++i)
+    out += (l.size() > 2 && i == l.size()/2 ? std::string("|") : std::string()) + lname[l[i]];
+  return out + ")";
+}
+
+
+size_t nbasis(const std::vector<std::shared_ptr<const Shell>>& shells) {
+  size_t out = 1;
+  for (auto& i : shells) out *= i->nbasis();
+  return out;
+}
+
+
+void bench_eri(Benchmark& bench, const int lmax) {
+  auto stack = resources__->get();
+  for (auto& c : patterns) {
+    for (auto& q : quartet_classes(lmax)) {
+      const std::array<std::shared_ptr<const Shell>,4> shells = {{make_shell(q[0], c, 0), make_shell(q[1], c, 1), make_shell(q[2], c, 2), make_shell(q[3], c, 3)}};
+      const std::string cname = class_name({q[0], q[1], q[2], q[3]});
+      const size_t n = nbasis({shells.begin(), shells.end()});
+      bench.run("eri", cname, c.name, n, [&]() { ERIBatch eri(shells, 1.0, 0.0, true, stack); eri.compute(); });
+      bench.run("grad", cname, c.name, 12*nbasis({shells[0]->cartesian_shell(), shells[1]->cartesian_shell(), shells[2]->cartesian_shell(), shells[3]->cartesian_shell()}),
+                [&]() { GradBatch grad(shells, 1.0, 0.0, true, stack); grad.compute(); });
+    }
+  }
+  resources__->release(stack);
+}
+
+
+// three-index integrals (aux|b1 b2) as they are computed in DFDist_ints
+void bench_eri3(Benchmark& bench, const int lmax) {
+  auto stack = resources__->get();
+  auto dummy = std::make_shared<const Shell>(true);
+  for (auto& c : patterns) {
+    for (int a = 0; a <= lmax+1; ++a) {
+      for (int b1 = 0; b1 <= lmax; ++b1) {
+        for (int b2 = 0; b2 <= b1; ++b2) {
+          const std::array<std::shared_ptr<const Shell>,4> shells = {{dummy, make_shell(a, c, 0), make_shell(b1, c, 1), make_shell(b2, c, 2)}};
+          const std::string cname = class_name({a, b1, b2});
+          const size_t n = nbasis({shells[1], shells[2], shells[3]});
+          bench.run("eri3", cname, c.name, n, [&]() { ERIBatch eri(shells, 2.0, 0.0, true, stack); eri.compute(); });
+
+          if (!bench.enabled("smalleri3")) continue;
+          auto s1 = std::make_shared<Shell>(*shells[2]);
+          auto s2 = std::make_shared<Shell>(*shells[3]);
+          s1->init_relativistic();
+          s2->init_relativistic();
+          const std::array<std::shared_ptr<const Shell>,4> small = {{dummy, shells[1], s1, s2}};
+          bench.run("smalleri3", cname, c.name, 6*n, [&]() { SmallERIBatch eri(small, 0.0); eri.compute(); });
+        }
+      }
+    }
+  }
+  resources__->release(stack);
+}
+
+
+void bench_nai(Benchmark& bench, const int lmax) {
+  std::vector<std::shared_ptr<const Atom>> atoms;
+  for (int i = 0; i != 4; ++i)
+    atoms.push_back(std::make_shared<const Atom>(true, "C", centers[i], 6.0));
+  auto mol = std::make_shared<const Molecule>(atoms, std::vector<std::shared_ptr<const Atom>>());
+
+  auto stack = resources__->get();
+  for (auto& c : patterns) {
+    for (int a = 0; a <= lmax; ++a) {
+      for (int b = 0; b <= a; ++b) {
+        const std::array<std::shared_ptr<const Shell>,2> shells = {{make_shell(a, c, 0), make_shell(b, c, 1)}};
+        bench.run("nai", class_name({a, b}), c.name, nbasis({shells[0], shells[1]}), [&]() { NAIBatch nai(shells, mol, stack); nai.compute(); });
+      }
+    }
+  }
+  resources__->release(stack);
+}
+
+
+// generated transforms in src/integral; nloop is chosen to be representative of a contracted quartet
+void bench_transform(Benchmark& bench) {
+  static const CarSphList carsphlist;
+  static const HRRList hrr;
+  const int nloop = 256;
+  auto ncart = [](const int l) { return (l+1)*(l+2)/2; };
+  const std::array<double,3> AB = {{0.1, -0.4, 1.4}};
+
+  const int lmax = ANG_HRR_END-1;
+  for (int a = 0; a != lmax; ++a) {
+    for (int b = 0; b <= a; ++b) {
+      const size_t in = ncart(a)*ncart(b);
+      const size_t out = (2*a+1)*(2*b+1);
+      std::vector<double> source(nloop*in, 0.5), target(nloop*in);
+      bench.run("carsph", class_name({a, b}), "-", nloop*out, [&]() { carsphlist.carsphfunc_call(a*ANG_HRR_END+b, nloop, source.data(), target.data()); });
+    }
+  }
+  for (int a = 1; a != lmax; ++a) {
+    for (int b = 1; b <= a; ++b) {
+      size_t in = 0;
+      for (int l = a; l <= a+b; ++l) in += ncart(l);
+      const size_t out = ncart(a)*ncart(b);
+      std::vector<double> source(nloop*in, 0.5), target(nloop*out);
+      bench.run("hrr", class_name({a, b}), "-", nloop*out, [&]() { hrr.hrrfunc_call(a*ANG_HRR_END+b, nloop, source.data(), AB, target.data()); });
+    }
+  }
+}
+
+
+// full three-index build on a real molecule; the geometry is read from the first molecule block of the input
+void bench_df(Benchmark& bench, const std::string& input) {
+  if (!bench.enabled("dfdist") && !bench.enabled("dftransform")) return;
+  auto idata = std::make_shared<const PTree>(input);
+  auto keys = idata->get_child("bagel");
+  std::shared_ptr<const PTree> mol;
+  for (auto& i : *keys)
+    if (to_lower(i->get<std::string>("title", "")) == "molecule") {
+      mol = i;
+      break;
+    }
+  if (!mol) throw std::runtime_error("benchmark input does not have a molecule block");
+  auto geom = std::make_shared<const Geometry>(mol);
+  const std::string name = geom->basisfile() + "/" + geom->auxfile();
+  bench.run("dfdist", name, std::to_string(geom->nbasis()) + "x" + std::to_string(geom->naux()), geom->nbasis()*geom->nbasis()*geom->naux(),
+            [&]() { geom->form_fit<DFDist_ints<ERIBatch>>(geom->overlap_thresh(), true); });
+
+  // MO transformation with (nbasis/4, nbasis) orbitals, as in MP2
+  if (bench.enabled("dftransform")) {
+    std::shared_ptr<const DFDist> df = geom->df();
+    const int nbasis = geom->nbasis();
+    const int nocc = std::max(nbasis/4, 1);
+    Matrix ocoeff(nbasis, nocc);
+    Matrix vcoeff(nbasis, nbasis);
+    for (int i = 0; i != nbasis; ++i) {
+      vcoeff(i, i) = 1.0;
+      if (i < nocc) ocoeff(i, i) = 1.0;
+    }
+    const std::string size = std::to_string(nocc) + "x" + std::to_string(nbasis);
+    bench.run("dftransform", "2step", size, nocc*nbasis*df->naux(), [&]() { df->compute_half_transform(ocoeff)->compute_second_transform(vcoeff); });
+    bench.run("dftransform", "fused", size, nocc*nbasis*df->naux(), [&]() { df->compute_full_transform(ocoeff, vcoeff); });
+  }
+}
+
+}
+}
@@ -0,0 +1,152 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: benchmark.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef __SRC_BENCHIMPL_BENCHMARK_H
+#define __SRC_BENCHIMPL_BENCHMARK_H
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <src/util/input/input.h>
+
+namespace bagel {
+
+// One timed kernel. "count" is the number of integrals (or transformed elements) produced per call.
+struct BenchResult {
+  std::string kernel;
+  std::string shell_class;
+  std::string pattern;
+  size_t count;
+  size_t ncall;
+  double seconds;
+
+  BenchResult(const std::string& k, const std::string& c, const std::string& p, const size_t n, const size_t nc, const double s)
+    : kernel(k), shell_class(c), pattern(p), count(n), ncall(nc), seconds(s) { }
+
+  std::string key() const { return kernel + "/" + shell_class + "/" + pattern; }
+  double rate() const { return count * ncall / seconds; }
+};
+
+
+class Benchmark {
+  protected:
+    std::vector<BenchResult> results_;
+    // minimum wall time of each sample and the number of samples (best one is reported)
+    double min_time_;
+    int nsample_;
+    std::string filter_;
+
+  public:
+    Benchmark(const double t = 0.05, const int ns = 3, const std::string filter = "") : min_time_(t), nsample_(ns), filter_(filter) { }
+
+    bool enabled(const std::string& kernel) const { return filter_.empty() || kernel.find(filter_) != std::string::npos; }
+
+    // calls func repeatedly; the number of calls per sample is doubled until a sample takes at least min_time_
+    void run(const std::string& kernel, const std::string& shell_class, const std::string& pattern, const size_t count, std::function<void()> func) {
+      if (!enabled(kernel)) return;
+      func();
+      size_t ncall = 1;
+      double best = 0.0;
+      for (int s = 0; s != nsample_; ++s) {
+        double elapsed;
+        while (true) {
+          auto start = std::chrono::steady_clock::now();
+          for (size_t i = 0; i != ncall; ++i)
+            func();
+          elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+          if (elapsed >= min_time_ || s != 0) break;
+          ncall *= 2;
+        }
+        if (s == 0 || elapsed < best) best = elapsed;
+      }
+      results_.emplace_back(kernel, shell_class, pattern, count, ncall, best);
+      const BenchResult& r = results_.back();
+      std::cout << "  " << std::left << std::setw(14) << kernel << std::setw(12) << shell_class << std::setw(10) << pattern << std::right
+                << std::setw(12) << count << std::setw(14) << std::scientific << std::setprecision(4) << r.rate()
+                << std::setw(14) << std::fixed << std::setprecision(3) << best/ncall*1.0e6 << std::endl;
+    }
+
+    static void print_header() {
+      std::cout << "  " << std::left << std::setw(14) << "kernel" << std::setw(12) << "class" << std::setw(10) << "pattern" << std::right
+                << std::setw(12) << "ints/call" << std::setw(14) << "ints/sec" << std::setw(14) << "usec/call" << std::endl;
+    }
+
+    const std::vector<BenchResult>& results() const { return results_; }
+
+    // machine-readable output that can be read back by PTree (and by compare below)
+    void write(const std::string& filename, const std::map<std::string, std::string>& info) const {
+      std::ofstream fs(filename);
+      if (!fs.is_open()) throw std::runtime_error("could not open " + filename);
+      fs << "{" << std::endl;
+      for (auto& i : info)
+        fs << "  \"" << i.first << "\" : \"" << i.second << "\"," << std::endl;
+      fs << "  \"results\" : [" << std::endl;
+      for (auto i = results_.begin(); i != results_.end(); ++i) {
+        fs << "    { \"kernel\" : \"" << i->kernel << "\", \"class\" : \"" << i->shell_class << "\", \"pattern\" : \"" << i->pattern << "\", "
+           << "\"count\" : " << i->count << ", \"ncall\" : " << i->ncall << ", "
+           << "\"seconds\" : " << std::scientific << std::setprecision(6) << i->seconds << ", \"rate\" : " << i->rate() << " }"
+           << (i+1 == results_.end() ? "" : ",") << std::endl;
+      }
+      fs << "  ]" << std::endl << "}" << std::endl;
+    }
+
+    // compares two result files; returns the number of kernels that slowed down by more than tol (fraction)
+    static int compare(const std::string& reference, const std::string& current, const double tol) {
+      auto read = [](const std::string& file) {
+        std::map<std::string, double> out;
+        auto tree = std::make_shared<const PTree>(file);
+        auto results = tree->get_child("results");
+        for (auto& i : *results)
+          out.emplace(i->get<std::string>("kernel") + "/" + i->get<std::string>("class") + "/" + i->get<std::string>("pattern"), i->get<double>("rate"));
+        return out;
+      };
+      const std::map<std::string, double> ref = read(reference);
+      const std::map<std::string, double> cur = read(current);
+
+      int nregress = 0;
+      std::cout << "  " << std::left << std::setw(40) << "kernel/class/pattern" << std::right << std::setw(14) << "reference" << std::setw(14) << "current"
+                << std::setw(10) << "ratio" << std::endl;
+      for (auto& i : cur) {
+        auto iter = ref.find(i.first);
+        if (iter == ref.end()) continue;
+        const double ratio = i.second / iter->second;
+        const bool slow = ratio < 1.0 - tol;
+        nregress += slow ? 1 : 0;
+        std::cout << "  " << std::left << std::setw(40) << i.first << std::right << std::scientific << std::setprecision(4)
+                  << std::setw(14) << iter->second << std::setw(14) << i.second << std::fixed << std::setprecision(3) << std::setw(10) << ratio
+                  << (slow ? "  <-- slower" : "") << std::endl;
+      }
+      std::cout << std::endl << "  " << nregress << " kernel(s) slower than the reference by more than " << std::setprecision(0) << tol*100 << "%" << std::endl;
+      return nregress;
+    }
+};
+
+}
+
+#endif
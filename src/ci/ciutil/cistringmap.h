@@ -96,6 +96,30 @@ class StringMap {
 };
 
 
+// Structure-of-arrays copy of a list of DetMap's (in the same order), used in the innermost loops of the sigma formation
+class DetMapSoA {
+  protected:
+    std::vector<int> target_;
+    std::vector<int> source_;
+    std::vector<double> sign_;
+
+  public:
+    DetMapSoA() { }
+    DetMapSoA(const std::vector<DetMap>& o) : target_(o.size()), source_(o.size()), sign_(o.size()) {
+      for (size_t i = 0; i != o.size(); ++i) {
+        target_[i] = o[i].target;
+        source_[i] = o[i].source;
+        sign_[i] = o[i].sign;
+      }
+    }
+
+    int size() const { return target_.size(); }
+    const int* target() const { return target_.data(); }
+    const int* source() const { return source_.data(); }
+    const double* sign() const { return sign_.data(); }
+};
+
+
 template <class StringType>
 class DetMapBlock_base {
   protected:
@@ -0,0 +1,81 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: ci/ciutil/moints.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_CI_CIUTIL_MOINTS_H
+#define __SRC_CI_CIUTIL_MOINTS_H
+
+#include <cassert>
+#include <functional>
+#include <src/util/taskqueue.h>
+
+namespace bagel {
+
+// Reorders the two-electron integrals (ij|kl), given as a matrix with rows i+n*j and columns k+n*l, into the layouts
+// used by the sigma kernels. The columns of the output are filled in parallel, one task per group of n or fewer columns.
+
+// (ij|kl) with j <= i and l <= k, pair-packed as mo2e(kl, ij) = buf2e(l+k*n, j+i*n) with kl = l+k(k+1)/2 and ij = j+i(i+1)/2 (Knowles-Handy)
+template<class MatType>
+std::shared_ptr<MatType> pack_mo2e(const MatType& buf2e, const int n) {
+  const size_t nij = n*(n+1)/2;
+  const size_t nn = n*n;
+  assert(buf2e.ndim() == nn && buf2e.mdim() == nn);
+  auto out = std::make_shared<MatType>(nij, nij, true);
+  TaskQueue<std::function<void(void)>> tq(n);
+  for (int i = 0; i != n; ++i)
+    tq.emplace_back([&, i] {
+      for (int j = 0; j <= i; ++j) {
+        const int ij = j+((i*(i+1))>>1);
+        int kl = 0;
+        for (int k = 0; k != n; ++k)
+          for (int l = 0; l <= k; ++l, ++kl)
+            out->element(kl, ij) = buf2e.element(l+k*n, j+i*n);
+      }
+    });
+  tq.compute();
+  return out;
+}
+
+// <ij|kl> = (ik|jl) with rows i+n*j and columns k+n*l (Harrison-Zarrabian)
+template<class MatType>
+std::shared_ptr<MatType> sort_mo2e(const MatType& buf2e, const int n) {
+  const size_t nn = n*n;
+  assert(buf2e.ndim() == nn && buf2e.mdim() == nn);
+  auto out = std::make_shared<MatType>(nn, nn, true);
+  TaskQueue<std::function<void(void)>> tq(n);
+  for (int l = 0; l != n; ++l)
+    tq.emplace_back([&, l] {
+      for (int k = 0; k != n; ++k) {
+        auto* target = out->element_ptr(0, k+n*l);
+        for (int j = 0; j != n; ++j)
+          std::copy_n(buf2e.element_ptr(n*k, j+n*l), n, target+n*j);
+      }
+    });
+  tq.compute();
+  return out;
+}
+
+}
+
+#endif
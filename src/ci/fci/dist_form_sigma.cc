@@ -32,6 +32,7 @@ using namespace std;
 using namespace bagel;
 
 vector<shared_ptr<DistCivec>> FormSigmaDistFCI::operator()(const vector<shared_ptr<DistCivec>>& ccvec, shared_ptr<const MOFile> jop, const vector<int>& conv) const {
+  Profiler::Region region("DistFCI::form_sigma");
   const int nstate = ccvec.size();
 
   vector<shared_ptr<DistCivec>> sigmavec;
@@ -82,22 +83,30 @@ void FormSigmaDistFCI::sigma_ab(shared_ptr<const DistCivec> cc, shared_ptr<DistC
   const int rank = mpi__->rank();
   const int size = mpi__->size();
 
-  list<shared_ptr<DistABTask>> tasks;
-
   // shamelessly statically distributing across processes
-  for (size_t a = 0; a != int_det->lena(); ++a) {
-    if (a%size != rank) continue;
+  vector<size_t> astrings;
+  for (size_t a = 0; a != int_det->lena(); ++a)
+    if (a%size == rank)
+      astrings.push_back(a);
 
-    const bitset<nbit__> astring = int_det->string_bits_a(a);
-    tasks.push_back(make_shared<DistABTask>(astring, base_det, int_det, jop, cc, sigma));
-  }
+  // tasks fetch their data upon construction; nprefetch_ tasks are kept in flight so that communication overlaps with computation
+  list<shared_ptr<DistABTask>> tasks;
+  auto next = astrings.begin();
+  auto issue = [&]() {
+    for ( ; next != astrings.end() && tasks.size() < static_cast<size_t>(nprefetch_); ++next)
+      tasks.push_back(make_shared<DistABTask>(int_det->string_bits_a(*next), base_det, int_det, jop, cc, sigma));
+  };
+  issue();
 
   list<shared_ptr<RMATask<double>>> acctasks;
-  for (auto i = tasks.begin(); i != tasks.end(); ) {
-    (*i)->wait();
-    auto t = (*i)->compute();
+  while (!tasks.empty()) {
+    shared_ptr<DistABTask> task = tasks.front();
+    tasks.pop_front();
+    issue();
+
+    task->wait();
+    auto t = task->compute();
     acctasks.insert(acctasks.end(), t.begin(), t.end());
-    i = tasks.erase(i);
 
     for (auto j = acctasks.begin(); j != acctasks.end(); )
       j = (*j)->test() ? acctasks.erase(j) : ++j;
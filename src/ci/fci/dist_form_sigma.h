@@ -34,9 +34,11 @@ namespace bagel {
 class FormSigmaDistFCI {
   protected:
     std::shared_ptr<const Space_base> space_;
+    // maximum number of DistABTask's whose data are being fetched at a time
+    int nprefetch_;
 
   public:
-    FormSigmaDistFCI(std::shared_ptr<const Space_base> sp = nullptr) : space_(sp) {}
+    FormSigmaDistFCI(std::shared_ptr<const Space_base> sp = nullptr, const int nprefetch = 16) : space_(sp), nprefetch_(nprefetch) {}
 
     std::vector<std::shared_ptr<DistCivec>> operator()(const std::vector<std::shared_ptr<DistCivec>>& cc, std::shared_ptr<const MOFile> jop, const std::vector<int>& conv) const;
     std::shared_ptr<DistDvec> operator()(std::shared_ptr<const DistDvec> cc, std::shared_ptr<const MOFile> jop) const;
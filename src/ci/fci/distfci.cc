@@ -57,6 +57,7 @@ void DistFCI::common_init() {
 
   if (nstate_ < 0) nstate_ = idata_->get<int>("nstate", 1);
   nguess_ = idata_->get<int>("nguess", nstate_);
+  nprefetch_ = max(1, idata_->get<int>("nprefetch", nprefetch_));
 
   const shared_ptr<const PTree> iactive = idata_->get_child_optional("active");
   if (iactive) {
@@ -364,6 +365,7 @@ void DistFCI::const_denom() {
 
 
 void DistFCI::compute() {
+  Profiler::Region region("DistFCI::compute");
   Timer pdebug(3);
 
   // Creating an initial CI vector
@@ -389,7 +391,7 @@ void DistFCI::compute() {
   // 0 means not converged
   vector<int> conv(nstate_, 0);
 
-  FormSigmaDistFCI form_sigma(space_);
+  FormSigmaDistFCI form_sigma(space_, nprefetch_);
 
   for (int iter = 0; iter != max_iter_; ++iter) {
     Timer fcitime;
@@ -44,6 +44,9 @@ class DistFCI : public FCI_base {
     std::shared_ptr<DistCivec> denom_;
     std::shared_ptr<DavidsonDiag<DistCivec>> davidson_;
 
+    // number of alpha strings (or DistABTask's) whose remote data are requested ahead of computation
+    int nprefetch_ = 16;
+
   private:
     // serialization
     friend class boost::serialization::access;
@@ -99,34 +99,84 @@ tuple<shared_ptr<RDM<3>>, shared_ptr<RDM<4>>> DistFCI::rdm34_alpha(const int ist
 void DistFCI::sigma_2a1(shared_ptr<const DistCivec> cc, shared_ptr<DistDvec> d) const {
   assert(d->det() == cc->det());
   const int lb = cc->lenb();
-  for (int ip = 0; ip != d->ij(); ++ip) {
-    shared_ptr<DistCivec> tcc = d->data(ip);
+
+  // (ip, source, sign) for each alpha string of cc, so that each string is fetched only once
+  map<size_t, vector<tuple<int, size_t, int>>> work;
+  for (int ip = 0; ip != d->ij(); ++ip)
     for (auto& i : cc->det()->phia(ip))
-      if (tcc->is_local(i.source)) {
-        unique_ptr<double[]> source = cc->rma_get(i.target);
-        const double sign = static_cast<double>(i.sign);
-        blas::scale_n(sign, source.get(), lb);
-        tcc->rma_add(source, i.source);
-      }
+      if (d->data(ip)->is_local(i.source))
+        work[i.target].emplace_back(ip, i.source, i.sign);
+
+  // the next nprefetch_ alpha strings are being fetched while one is processed
+  list<pair<unique_ptr<double[]>, shared_ptr<RMATask<double>>>> requests;
+  auto next = work.begin();
+  auto issue = [&]() {
+    for ( ; next != work.end() && requests.size() < static_cast<size_t>(nprefetch_); ++next) {
+      unique_ptr<double[]> buf(new double[lb]);
+      shared_ptr<RMATask<double>> request = cc->rma_rget(buf.get(), next->first);
+      requests.emplace_back(move(buf), request);
+    }
+  };
+  issue();
+
+  list<shared_ptr<RMATask<double>>> acctasks;
+  for (auto& w : work) {
+    requests.front().second->wait();
+    unique_ptr<double[]> source = move(requests.front().first);
+    requests.pop_front();
+    issue();
+
+    for (auto& i : w.second) {
+      unique_ptr<double[]> target(new double[lb]);
+      transform(source.get(), source.get()+lb, target.get(), [&i](const double& a) { return get<2>(i)*a; });
+      acctasks.push_back(d->data(get<0>(i))->rma_radd(move(target), get<1>(i)));
+    }
+    for (auto j = acctasks.begin(); j != acctasks.end(); )
+      j = (*j)->test() ? acctasks.erase(j) : ++j;
   }
+
+  for (auto& i : acctasks)
+    i->wait();
 }
 
 // calculate <I|b+b|0>
 void DistFCI::sigma_2a2(shared_ptr<const DistCivec> cc, shared_ptr<DistDvec> d) const {
   assert(d->det() == cc->det());
   const int lb = cc->lenb();
-  for (int i = 0; i != cc->lena(); ++i) {
-    if (!cc->is_local(i)) continue;
-    unique_ptr<double[]> source = cc->rma_get(i);
-    unique_ptr<double[]> target(new double[lb]);
+
+  // local alpha strings are read ahead in the same way as in sigma_2a1
+  list<pair<unique_ptr<double[]>, shared_ptr<RMATask<double>>>> requests;
+  size_t next = cc->astart();
+  auto issue = [&]() {
+    for ( ; next != cc->aend() && requests.size() < static_cast<size_t>(nprefetch_); ++next) {
+      unique_ptr<double[]> buf(new double[lb]);
+      shared_ptr<RMATask<double>> request = cc->rma_rget(buf.get(), next);
+      requests.emplace_back(move(buf), request);
+    }
+  };
+  issue();
+
+  list<shared_ptr<RMATask<double>>> acctasks;
+  for (size_t i = cc->astart(); i != cc->aend(); ++i) {
+    requests.front().second->wait();
+    unique_ptr<double[]> source = move(requests.front().first);
+    requests.pop_front();
+    issue();
+
     for (int ip = 0; ip != d->ij(); ++ip) {
+      unique_ptr<double[]> target(new double[lb]);
       fill_n(target.get(), lb, 0.0);
       for (auto& iter : cc->det()->phib(ip))
         target[iter.source] += iter.sign * source[iter.target];
       assert(d->data(ip)->is_local(i));
-      d->data(ip)->rma_add(target, i);
+      acctasks.push_back(d->data(ip)->rma_radd(move(target), i));
     }
+    for (auto j = acctasks.begin(); j != acctasks.end(); )
+      j = (*j)->test() ? acctasks.erase(j) : ++j;
   }
+
+  for (auto& i : acctasks)
+    i->wait();
 }
 
 
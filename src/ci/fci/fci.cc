@@ -99,6 +99,8 @@ void FCI::common_init() {
   thresh_ = idata_->get<double>("thresh_fci", thresh_);
   print_thresh_ = idata_->get<double>("print_thresh", 0.05);
   restart_ = idata_->get<bool>("restart", false);
+  mixed_precision_ = idata_->get<bool>("mixed_precision", false) ? max(thresh_, idata_->get<double>("mixed_precision_switch", 1.0e-6)) : 0.0;
+  davidson_scratch_ = idata_->get<bool>("davidson_scratch", false);
 
   if (nstate_ < 0) nstate_ = idata_->get<int>("nstate", 1);
   nguess_ = idata_->get<int>("nguess", nstate_);
@@ -297,6 +299,7 @@ shared_ptr<const CIWfn> FCI::conv_to_ciwfn() const {
 
 
 void FCI::compute() {
+  Profiler::Region region("FCI::compute");
   Timer pdebug(3);
 
   if (!restarted_) {
@@ -312,6 +315,8 @@ void FCI::compute() {
 
     // Davidson utility
     davidson_ = make_shared<DavidsonDiag<Civec>>(nstate_, davidson_subspace_);
+    davidson_->set_mixed_precision(mixed_precision_);
+    davidson_->set_scratch(davidson_scratch_);
   }
 
   // nuclear energy retrieved from geometry
@@ -354,7 +359,11 @@ void FCI::compute() {
     }
     pdebug.tick_print("error");
 
-    if (!*min_element(conv.begin(), conv.end())) {
+    if (davidson_->restart()) {
+      // the subspace is rebuilt in double precision from the current solutions
+      cc_ = make_shared<Dvec>(CASDvec(davidson_->civec()));
+      fill(conv.begin(), conv.end(), 0);
+    } else if (!*min_element(conv.begin(), conv.end())) {
       // denominator scaling
       for (int ist = 0; ist != nstate_; ++ist) {
         if (conv[ist]) continue;
@@ -37,6 +37,10 @@ class FCI : public FCI_base {
     std::shared_ptr<DavidsonDiag<Civec>> davidson_;
 
     bool dipoles_;
+    // residual norm below which the Davidson subspace is stored in double precision (0 if always)
+    double mixed_precision_;
+    // if true, the Davidson subspace is stored in scratch files
+    bool davidson_scratch_;
 
   private:
     // serialization
@@ -39,6 +39,7 @@ static const bool tprint = false;
 /* Implementing the method as described by Harrison and Zarrabian */
 shared_ptr<Dvec> HarrisonZarrabian::form_sigma(shared_ptr<const Dvec> ccvec, shared_ptr<const MOFile> jop,
                      const vector<int>& conv) const { // d and e are scratch area for D and E intermediates
+  Profiler::Region region("HarrisonZarrabian::form_sigma");
   const int ij = norb_*norb_;
   assert(ccvec->ij() == nstate_);
 
@@ -158,19 +159,17 @@ void HarrisonZarrabian::sigma_2ab_3(shared_ptr<Civec> sigma, shared_ptr<Dvec> e)
   const int norb = norb_;
   const int lbt = base_det->lenb();
   const int lbs = int_det->lenb();
-  double* target_base = sigma->data();
-
-  for (int i = 0; i < norb; ++i) {
-    for (int j = 0; j < norb; ++j) {
-      const double* source_base = e->data(i*norb + j)->data();
-      for (auto& aiter : int_det->phiupa(i)) {
-        double *target = target_base + aiter.target*lbt;
-        const double *source = source_base + aiter.source*lbs;
-        for (auto& biter : int_det->phiupb(j)) {
-          const double sign = aiter.sign * biter.sign;
-          target[biter.target] += sign * source[biter.source];
-        }
-      }
-    }
-  }
+  const size_t lenab = int_det->lena() * int_det->lenb();
+
+  // excitation lists in the structure-of-arrays layout; alpha strings are sorted by the target so that the tasks do not share target rows
+  const HZAlphaUp aup(int_det, base_det->lena());
+  vector<DetMapSoA> bup;
+  for (int j = 0; j != norb; ++j)
+    bup.emplace_back(int_det->phiupb(j));
+
+  TaskQueue<HZTaskAB3<double>> tasks(base_det->lena());
+  for (size_t a = 0; a != base_det->lena(); ++a)
+    tasks.emplace_back(a, norb, lbs, lenab, aup, bup, e->data(), sigma->data() + a*lbt);
+
+  tasks.compute();
 }
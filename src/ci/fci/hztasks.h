@@ -25,10 +25,60 @@
 #ifndef __BAGEL_FCI_HZTASKS_H
 #define __BAGEL_FCI_HZTASKS_H
 
+#include <numeric>
 #include <src/util/f77.h>
 
 namespace bagel {
 
+// out[to[n]] += fac * sign[n] * in[from[n]]. The indices in "to" are distinct within a list of DetMap's so that the loop can be vectorized
+template<typename DataType>
+void hz_accumulate(const DataType fac, const int size, const int* const from, const int* const to, const double* const sign,
+                   const DataType* const in, DataType* const out) {
+#ifdef _OPENMP
+  #pragma omp simd
+#endif
+  for (int n = 0; n < size; ++n)
+    out[to[n]] += fac * sign[n] * in[from[n]];
+}
+
+
+// creation operators a^dagger_i on the (nelea-1) strings sorted by the target (nelea) strings, so that each target row is processed by one task
+class HZAlphaUp {
+  protected:
+    std::vector<size_t> offset_;
+    std::vector<int> orbital_;
+    std::vector<int> source_;
+    std::vector<double> sign_;
+
+  public:
+    HZAlphaUp(std::shared_ptr<const Determinants> int_det, const size_t lena) : offset_(lena+1, 0) {
+      const int norb = int_det->norb();
+      for (int i = 0; i != norb; ++i)
+        for (auto& a : int_det->phiupa(i))
+          ++offset_[a.target+1];
+      std::partial_sum(offset_.begin(), offset_.end(), offset_.begin());
+
+      orbital_.resize(offset_.back());
+      source_.resize(offset_.back());
+      sign_.resize(offset_.back());
+      std::vector<size_t> current(offset_.begin(), offset_.end()-1);
+      for (int i = 0; i != norb; ++i)
+        for (auto& a : int_det->phiupa(i)) {
+          const size_t n = current[a.target]++;
+          orbital_[n] = i;
+          source_[n] = a.source;
+          sign_[n] = a.sign;
+        }
+    }
+
+    size_t begin(const size_t target) const { return offset_[target]; }
+    size_t end(const size_t target) const { return offset_[target+1]; }
+    int orbital(const size_t n) const { return orbital_[n]; }
+    int source(const size_t n) const { return source_[n]; }
+    double sign(const size_t n) const { return sign_[n]; }
+};
+
+
 template<typename DataType>
 class HZTaskAA {
   protected:
@@ -110,13 +160,43 @@ class HZTaskAB1 {
 
     void compute() {
       const int lbt = det_->lenb();
+      const DetMapSoA bmap(det_->phiupb(l_));
 
       for (auto& aiter : det_->phiupa(k_)) {
         DataType* target = target_base_ + aiter.source*lbt;
         const DataType* source = source_base_ + aiter.target*lbs_;
-        for (auto& biter : det_->phiupb(l_)) {
-          const double sign = aiter.sign * biter.sign;
-          target[biter.source] += sign * source[biter.target];
+        hz_accumulate<DataType>(aiter.sign, bmap.size(), bmap.target(), bmap.source(), bmap.sign(), source, target);
+      }
+    }
+
+};
+
+
+// sigma(A,B) += sum_ij e_ij(A', B') for one target alpha string A, where A = a^dagger_i A' and B = a^dagger_j B'
+template<typename DataType>
+class HZTaskAB3 {
+  protected:
+    const size_t atarget_;
+    const int norb_;
+    const int lbs_;
+    const size_t lenab_;
+    const HZAlphaUp& aup_;
+    const std::vector<DetMapSoA>& bup_;
+    const DataType* const source_base_;
+    DataType* const target_;
+
+  public:
+    HZTaskAB3(const size_t atarget, const int norb, const int lbs, const size_t lenab, const HZAlphaUp& aup, const std::vector<DetMapSoA>& bup,
+              const DataType* const source_base, DataType* const target) :
+      atarget_(atarget), norb_(norb), lbs_(lbs), lenab_(lenab), aup_(aup), bup_(bup), source_base_(source_base), target_(target) {}
+
+    void compute() {
+      for (size_t n = aup_.begin(atarget_); n != aup_.end(atarget_); ++n) {
+        const int i = aup_.orbital(n);
+        const DataType* source_i = source_base_ + aup_.source(n)*lbs_;
+        for (int j = 0; j != norb_; ++j) {
+          const DetMapSoA& bmap = bup_[j];
+          hz_accumulate<DataType>(aup_.sign(n), bmap.size(), bmap.source(), bmap.target(), bmap.sign(), source_i + (i*norb_+j)*lenab_, target_);
         }
       }
     }
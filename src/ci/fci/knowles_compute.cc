@@ -34,6 +34,7 @@ using namespace bagel;
 
 shared_ptr<Dvec> KnowlesHandy::form_sigma(shared_ptr<const Dvec> ccvec, shared_ptr<const MOFile> jop,
                      const vector<int>& conv) const { // d and e are scratch area for D and E intermediates
+  Profiler::Region region("KnowlesHandy::form_sigma");
 
   const int ij = (norb_*(norb_+1))/2;
 
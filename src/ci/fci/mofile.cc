@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <cmath>
 #include <src/ci/fci/mofile.h>
+#include <src/ci/ciutil/moints.h>
 #include <src/scf/hf/fock.h>
 #include <src/util/f77.h>
 #include <src/util/prim_op.h>
@@ -83,27 +84,11 @@ void MOFile::init(const int nstart, const int nfence, const bool store) {
 
 void MOFile::compress_and_set(shared_ptr<const Matrix> buf1e, shared_ptr<const Matrix> buf2e) {
 
-  // mo2e is compressed in KH case, not in HZ case
   const int nocc = nocc_;
   sizeij_ = hz_ ? nocc*nocc : nocc*(nocc+1)/2;
-  mo2e_ = make_shared<Matrix>(sizeij_, sizeij_, true);
-
-  if (!hz_) {
-    int ij = 0;
-    for (int i = 0; i != nocc; ++i) {
-      for (int j = 0; j <= i; ++j, ++ij) {
-        int kl = 0;
-        for (int k = 0; k != nocc; ++k)
-          for (int l = 0; l <= k; ++l, ++kl)
-            mo2e(kl, ij) = buf2e->element(l+k*nocc, j+i*nocc);
-      }
-    }
-  } else {
-    // In this case, there is no compression (this is actually necessary)
-    // Is currently ordered like (ij|kl), should be ordered like (ik|jl), with the last index moving the fastest
-    // Equivalent to             <ik|jl> --> <ij|kl>
-    sort_indices<0,2,1,3,0,1,1,1>(buf2e->data(), mo2e_->data(), nocc_, nocc_, nocc_, nocc_);
-  }
+  // mo2e is compressed in KH case, not in HZ case
+  // In HZ case, it is ordered like (ik|jl) with the last index moving the fastest ( <ik|jl> --> <ij|kl> )
+  mo2e_ = hz_ ? sort_mo2e(*buf2e, nocc) : pack_mo2e(*buf2e, nocc);
 
   // h'kl = hkl - 0.5 sum_j (kj|jl)
   mo1e_ = make_shared<CSymMatrix>(nocc, true);
@@ -23,9 +23,10 @@
 //
 
 #include <map>
+#include <set>
+#include <unordered_map>
 #include <src/util/math/sparsematrix.h>
 #include <src/ci/ras/form_sigma.h>
-#include <src/ci/ras/sparse_ij.h>
 
 // toggle for timing print out.
 static const bool tprint = false;
@@ -222,6 +223,14 @@ void FormSigmaRAS::sigma_bb(const RASCivecView cc, RASCivecView sigma, const dou
   sigma.ax_plus_y(1.0, *sig_trans->transpose(sigma.det()));
 }
 
+shared_ptr<const Sparse_IJ> FormSigmaRAS::sparseij(shared_ptr<const RASDeterminants> det) const {
+  if (!sparseij_ || !(*sparse_det_ == *det)) {
+    sparseij_ = make_shared<const Sparse_IJ>(det->stringspaceb(), det->stringspaceb());
+    sparse_det_ = det;
+  }
+  return sparseij_;
+}
+
 void FormSigmaRAS::sigma_ab(const RASCivecView cc, RASCivecView sigma, const double* mo2e) const {
   assert(*cc.det() == *sigma.det());
   shared_ptr<const RASDeterminants> det = cc.det();
@@ -229,7 +238,7 @@ void FormSigmaRAS::sigma_ab(const RASCivecView cc, RASCivecView sigma, const dou
   const int norb = det->norb();
 
   // pre-compute all sparse F matrices
-  Sparse_IJ sparseij(det->stringspaceb(), det->stringspaceb());
+  shared_ptr<const Sparse_IJ> sparseij = this->sparseij(det);
 
   // figure out maximum block size
   const size_t max_ccblock_size = (*max_element(cc.blocks().begin(), cc.blocks().end(),
@@ -237,6 +246,17 @@ void FormSigmaRAS::sigma_ab(const RASCivecView cc, RASCivecView sigma, const dou
             return ( a ? a->size() : 0) < ( b ? b->size() : 0);
           }))->size();
 
+  // largest coefficient in each block, used for screening
+  unordered_map<const RASBlock<double>*, double> cmax;
+  if (thresh_ > 0.0)
+    for (auto& iblock : cc.blocks())
+      if (iblock) {
+        double m = 0.0;
+        for (size_t k = 0; k != iblock->size(); ++k)
+          m = max(m, fabs(iblock->data()[k]));
+        cmax.emplace(iblock.get(), m);
+      }
+
   // allocate some scratch space. these upperbounds may be overkill
   unique_ptr<double[]> cprime(new double[2*max_ccblock_size]);
   unique_ptr<double[]> V(new double[2*max_ccblock_size]);
@@ -244,6 +264,22 @@ void FormSigmaRAS::sigma_ab(const RASCivecView cc, RASCivecView sigma, const dou
   for (int i = 0, ij = 0; i < norb; ++i) {
     for (int j = 0; j <= i; ++j, ++ij) {
       const double* mo2e_ij = mo2e + i + norb*norb*j;
+
+      // largest integral (ij|kl) for each pair of beta spaces, computed when first needed
+      map<pair<int,int>, double> imax;
+      auto integral_max = [&](const int target_tag, const int source_tag) {
+        auto iter = imax.find({target_tag, source_tag});
+        if (iter == imax.end()) {
+          double m = 0.0;
+          for (auto& kl : sparseij->orbital_pairs(target_tag, source_tag))
+            m = max(m, fabs(mo2e_ij[norb*(kl.first + norb*norb*kl.second)]));
+          iter = imax.emplace(make_pair(target_tag, source_tag), m).first;
+        }
+        return iter->second;
+      };
+      // F depends only on ij and the beta spaces; it is filled once per ij and reused for all the alpha blocks
+      set<pair<int,int>> filled;
+
       for (auto& target_bspace : *det->stringspaceb()) {
         const size_t tlb = target_bspace->size();
         // looping over source_aspace
@@ -268,16 +304,21 @@ void FormSigmaRAS::sigma_ab(const RASCivecView cc, RASCivecView sigma, const dou
             const size_t slb = source_bspace->size();
 
             // F matrix in sparse format
-            const shared_ptr<SparseMatrix>& sparseF = sparseij.sparse_matrix(target_bspace->tag(), source_bspace->tag());
+            const shared_ptr<SparseMatrix>& sparseF = sparseij->sparse_matrix(target_bspace->tag(), source_bspace->tag());
 
             // if this assert fails, max_ccblock_size is not a good enough upper bound
             assert(max_ccblock_size >= max(slb, tlb) * reduced_phi.size());
 
             if (sparseF) {
+              if (thresh_ > 0.0 && integral_max(target_bspace->tag(), source_bspace->tag()) * cmax.at(source_block.get()) < thresh_)
+                continue;
+
               // fill in sparse matrix
-              sparseF->zero();
-              for (auto& iter : sparseij.sparse_data(target_bspace->tag(), source_bspace->tag()))
-                *iter.ptr += static_cast<double>(iter.sign) * mo2e_ij[norb*(iter.i + norb*norb*iter.j)];
+              if (filled.emplace(target_bspace->tag(), source_bspace->tag()).second) {
+                sparseF->zero();
+                for (auto& iter : sparseij->sparse_data(target_bspace->tag(), source_bspace->tag()))
+                  *iter.ptr += static_cast<double>(iter.sign) * mo2e_ij[norb*(iter.i + norb*norb*iter.j)];
+              }
 
               // gather to fill in C'
               fill_n(cprime.get(), slb * reduced_phi.size(), 0.0);
@@ -27,15 +27,24 @@
 
 #include <src/ci/ras/civector.h>
 #include <src/ci/fci/mofile.h>
+#include <src/ci/ras/sparse_ij.h>
 
 namespace bagel {
 
 class FormSigmaRAS {
   protected:
     int batchsize_;
+    // alpha-beta contributions of a block pair are skipped when max|(ij|kl)| * max|C| is below this threshold
+    double thresh_;
+
+    // beta excitation lists for the alpha-beta term; built once per determinant space and shared by the block pairs with the same hole/particle pattern
+    mutable std::shared_ptr<const RASDeterminants> sparse_det_;
+    mutable std::shared_ptr<const Sparse_IJ> sparseij_;
+
+    std::shared_ptr<const Sparse_IJ> sparseij(std::shared_ptr<const RASDeterminants> det) const;
 
   public:
-    FormSigmaRAS(const int b = 512) : batchsize_(b) {}
+    FormSigmaRAS(const int b = 512, const double thresh = 0.0) : batchsize_(b), thresh_(thresh) {}
 
     /// Applies Hamiltonian to cc using the provided MOFile, skipping the vectors marked as converged
     std::shared_ptr<RASDvec> operator()(std::shared_ptr<const RASDvec> ccvec, std::shared_ptr<const MOFile> jop, const std::vector<int>& conv) const;
@@ -45,8 +45,11 @@ void RASCI::common_init() {
   davidson_subspace_ = idata_->get<int>("davidson_subspace", 20);
   thresh_ = idata_->get<double>("thresh", 1.0e-8);
   print_thresh_ = idata_->get<double>("print_thresh", 0.05);
+  mixed_precision_ = idata_->get<bool>("mixed_precision", false) ? max(thresh_, idata_->get<double>("mixed_precision_switch", 1.0e-6)) : 0.0;
+  davidson_scratch_ = idata_->get<bool>("davidson_scratch", false);
 
   batchsize_ = idata_->get<int>("batchsize", 512);
+  sigma_thresh_ = idata_->get<double>("sigma_thresh", 0.0);
 
   nstate_ = idata_->get<int>("nstate", 1);
   nguess_ = idata_->get<int>("nguess", nstate_);
@@ -275,9 +278,11 @@ void RASCI::compute() {
 
   // Davidson utility
   DavidsonDiag<RASCivec> davidson(nstate_, davidson_subspace_);
+  davidson.set_mixed_precision(mixed_precision_);
+  davidson.set_scratch(davidson_scratch_);
 
   // Object in charge of forming sigma vector
-  FormSigmaRAS form_sigma(batchsize_);
+  FormSigmaRAS form_sigma(batchsize_, sigma_thresh_);
 
   // main iteration starts here
   cout << "  === RAS-CI iteration ===" << endl << endl;
@@ -317,7 +322,11 @@ void RASCI::compute() {
     }
     pdebug.tick_print("error");
 
-    if (!*min_element(conv.begin(), conv.end())) {
+    if (davidson.restart()) {
+      // the subspace is rebuilt in double precision from the current solutions
+      cc_ = make_shared<RASDvec>(davidson.civec());
+      fill(conv.begin(), conv.end(), 0);
+    } else if (!*min_element(conv.begin(), conv.end())) {
       // denominator scaling
       for (int ist = 0; ist != nstate_; ++ist) {
         if (conv[ist]) continue;
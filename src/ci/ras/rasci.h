@@ -44,9 +44,15 @@ class RASCI : public Method {
     // threshold for variants
     double thresh_;
     double print_thresh_;
+    // residual norm below which the Davidson subspace is stored in double precision (0 if always)
+    double mixed_precision_;
+    // if true, the Davidson subspace is stored in scratch files
+    bool davidson_scratch_;
 
     // algorithmic options
     int batchsize_;
+    // screening threshold for the alpha-beta part of the sigma vector (0 if not screened)
+    double sigma_thresh_;
 
     // numbers of electrons
     int nelea_;
@@ -83,6 +83,7 @@ Sparse_IJ::Sparse_IJ(shared_ptr<const CIStringSet<RASString>> source_stringspace
           return get<0>(a) < get<0>(b);
         });
 
+        set<pair<int, int>> orbitals;
         vector<SparseIJKey> sp;
         sp.reserve(sparse_keys.size());
         size_t last = get<0>(sparse_keys.front());
@@ -91,12 +92,15 @@ Sparse_IJ::Sparse_IJ(shared_ptr<const CIStringSet<RASString>> source_stringspace
           if (last != get<0>(dd))
             ++data;
           sp.emplace_back(d.i, d.j, d.sign, data);
+          orbitals.emplace(d.i, d.j);
           last = get<0>(dd);
         }
         data_.emplace(make_pair(target_space->tag(), source_space->tag()), make_tuple(sparse, move(sp)));
+        orbital_pairs_.emplace(make_pair(target_space->tag(), source_space->tag()), vector<pair<int, int>>(orbitals.begin(), orbitals.end()));
       }
       else {
         data_.emplace(make_pair(target_space->tag(), source_space->tag()), make_tuple(nullptr, vector<SparseIJKey>()));
+        orbital_pairs_.emplace(make_pair(target_space->tag(), source_space->tag()), vector<pair<int, int>>());
       }
       ++isource_space;
     }
@@ -43,6 +43,8 @@ class Sparse_IJ {
   };
   protected:
     std::map<std::pair<int, int>, std::tuple<std::shared_ptr<SparseMatrix>, std::vector<SparseIJKey>>> data_;
+    // distinct orbital pairs (i, j) that appear in each block pair; used for integral screening
+    std::map<std::pair<int, int>, std::vector<std::pair<int, int>>> orbital_pairs_;
 
   public:
     Sparse_IJ(std::shared_ptr<const CIStringSet<RASString>> source_stringspace, std::shared_ptr<const CIStringSet<RASString>> target_stringspace);
@@ -50,6 +52,7 @@ class Sparse_IJ {
     const std::tuple<std::shared_ptr<SparseMatrix>, std::vector<SparseIJKey>>& data(const int target_tag, const int source_tag) const { return data_.at({target_tag, source_tag}); }
     const std::shared_ptr<SparseMatrix>& sparse_matrix(const int target_tag, const int source_tag) const { return std::get<0>(data_.at({target_tag, source_tag})); }
     const std::vector<SparseIJKey>& sparse_data(const int target_tag, const int source_tag) const { return std::get<1>(data_.at({target_tag, source_tag})); }
+    const std::vector<std::pair<int, int>>& orbital_pairs(const int target_tag, const int source_tag) const { return orbital_pairs_.at({target_tag, source_tag}); }
 };
 
 }
@@ -44,6 +44,8 @@ ZHarrison::ZHarrison(shared_ptr<const PTree> idat, shared_ptr<const Geometry> g,
   thresh_ = idata_->get<double>("thresh", 1.0e-10);
   thresh_ = idata_->get<double>("thresh_fci", thresh_);
   print_thresh_ = idata_->get<double>("print_thresh", 0.05);
+  mixed_precision_ = idata_->get<bool>("mixed_precision", false) ? max(thresh_, idata_->get<double>("mixed_precision_switch", 1.0e-6)) : 0.0;
+  davidson_scratch_ = idata_->get<bool>("davidson_scratch", false);
   restart_ = idata_->get<bool>("restart", false);
 
   if (idata_->get<int>("nspin", -1) != -1 || idata_->get<int>("nstate", -1) != -1)
@@ -228,6 +230,8 @@ void ZHarrison::compute() {
 
     // Davidson utility
     davidson_ = make_shared<DavidsonDiag<RelZDvec, ZMatrix>>(nstate_, davidson_subspace_);
+    davidson_->set_mixed_precision(mixed_precision_);
+    davidson_->set_scratch(davidson_scratch_);
   }
 
   // nuclear energy retrieved from geometry
@@ -268,7 +272,11 @@ void ZHarrison::compute() {
     }
     pdebug.tick_print("error");
 
-    if (!*min_element(conv.begin(), conv.end())) {
+    if (davidson_->restart()) {
+      // the subspace is rebuilt in double precision from the current solutions
+      cc_ = make_shared<RelZDvec>(davidson_->civec());
+      fill(conv.begin(), conv.end(), 0);
+    } else if (!*min_element(conv.begin(), conv.end())) {
       // denominator scaling
 
       auto ctmp = errvec.front()->clone();
@@ -47,6 +47,10 @@ class ZHarrison : public Method {
     // threshold for variants
     double thresh_;
     double print_thresh_;
+    // residual norm below which the Davidson subspace is stored in double precision (0 if always)
+    double mixed_precision_;
+    // if true, the Davidson subspace is stored in scratch files
+    bool davidson_scratch_;
 
     // numbers of electrons
     int nele_;
@@ -24,6 +24,7 @@
 
 #include <src/util/prim_op.h>
 #include <src/ci/zfci/zmofile.h>
+#include <src/ci/ciutil/moints.h>
 
 using namespace std;
 using namespace bagel;
@@ -78,8 +79,7 @@ void ZMOFile::compress_and_set(shared_ptr<Kramers<2,ZMatrix>> buf1e, shared_ptr<
 
   // Harrison requires <ij|kl> = (ik|jl)
   for (auto& mat : *buf2e) {
-    shared_ptr<ZMatrix> tmp = mat.second->clone();
-    sort_indices<0,2,1,3,0,1,1,1>(mat.second->data(), tmp->data(), nocc_, nocc_, nocc_, nocc_);
+    shared_ptr<ZMatrix> tmp = sort_mo2e(*mat.second, nocc_);
     bitset<4> s = mat.first.tag();
     s[2] = mat.first.tag()[1];
     s[1] = mat.first.tag()[2];
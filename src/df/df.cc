@@ -155,6 +155,14 @@ shared_ptr<DFHalfDist> DFDist::compute_half_transform_swap(const MatView c) cons
 }
 
 
+shared_ptr<DFFullDist> DFDist::compute_full_transform(const MatView c1, const MatView c2) const {
+  auto out = make_shared<DFFullDist>(df_ ? df_ : shared_from_this(), c1.extent(1), c2.extent(1));
+  for (auto& i : block_)
+    out->add_block(i->transform_full(c1, c2));
+  return out;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -26,6 +26,7 @@
 #define __SRC_DF_DF_H
 
 #include <src/df/paralleldf.h>
+#include <src/df/dfsparsity.h>
 #include <src/molecule/atom.h>
 
 namespace bagel {
@@ -69,6 +70,11 @@ class DFDist : public ParallelDF {
     template<typename T, class = typename std::enable_if<btas::is_boxtensor<T>::value>::type>
     std::shared_ptr<DFHalfDist> compute_half_transform_swap(std::shared_ptr<T> c) const { return compute_half_transform_swap(*c); }
 
+    // equivalent to compute_half_transform(c1)->compute_second_transform(c2), but the half-transformed integrals are not stored
+    std::shared_ptr<DFFullDist> compute_full_transform(const MatView c1, const MatView c2) const;
+    template<typename T, typename U, class = typename std::enable_if<btas::is_boxtensor<T>::value && btas::is_boxtensor<U>::value>::type>
+    std::shared_ptr<DFFullDist> compute_full_transform(std::shared_ptr<T> c1, std::shared_ptr<U> c2) const { return compute_full_transform(*c1, *c2); }
+
     std::shared_ptr<DFDist> copy() const;
     std::shared_ptr<DFDist> clone() const;
 
@@ -90,7 +96,7 @@ class DFDist_ints : public DFDist {
                         const std::vector<std::shared_ptr<const Shell>>& b1shell,
                         const std::vector<std::shared_ptr<const Shell>>& b2shell,
                         const size_t asize, const size_t b1size, const size_t b2size,
-                        const size_t astart, const double thresh, const bool compute_inv) {
+                        const size_t astart, const double thresh, const bool compute_inv, std::shared_ptr<const DFSparsity> sparsity) {
       Timer time;
 
       // making a task list
@@ -103,19 +109,34 @@ class DFDist_ints : public DFDist {
       for (int i = 0; i != TBatch::Nblocks(); ++i) blk[i] = block_[i];
 
       int j2 = 0;
+      int s2 = 0;
       for (auto& i2 : b2shell) {
         int j1 = 0;
+        int s1 = 0;
         for (auto& i1 : b1shell) {
           if (TBatch::Nblocks() > 1 || j1 <= j2) {
-            int j0 = 0;
-            for (auto& i0 : ashell) {
-              tasks.emplace_back((std::array<std::shared_ptr<const Shell>,4>{{i3, i0, i1, i2}}), (std::array<int,3>{{j2, j1, j0}}), blk);
-              j0 += i0->nbasis();
+            if (!sparsity || sparsity->significant(s1, s2)) {
+              int j0 = 0;
+              for (auto& i0 : ashell) {
+                tasks.emplace_back((std::array<std::shared_ptr<const Shell>,4>{{i3, i0, i1, i2}}), (std::array<int,3>{{j2, j1, j0}}), blk);
+                j0 += i0->nbasis();
+              }
+            } else {
+              // negligible pairs are set to zero
+              for (auto& b : block_) {
+                for (int k = j2; k != j2+i2->nbasis(); ++k)
+                  std::fill_n(b->data()+asize*(j1+b1size*k), asize*i1->nbasis(), 0.0);
+                if (TBatch::Nblocks() == 1)
+                  for (int k = j1; k != j1+i1->nbasis(); ++k)
+                    std::fill_n(b->data()+asize*(j2+b1size*k), asize*i2->nbasis(), 0.0);
+              }
             }
           }
           j1 += i1->nbasis();
+          ++s1;
         }
         j2 += i2->nbasis();
+        ++s2;
       }
       time.tick_print("3-index ints prep");
       tasks.compute();
@@ -125,8 +146,10 @@ class DFDist_ints : public DFDist {
 
   public:
     DFDist_ints(const int nbas, const int naux, const std::vector<std::shared_ptr<const Atom>>& atoms, const std::vector<std::shared_ptr<const Atom>>& aux_atoms,
-                const double thr, const bool inverse, const double dum, const bool average = false, const std::shared_ptr<Matrix> data2 = nullptr, const bool serial = false)
+                const double thr, const bool inverse, const double dum, const bool average = false, const std::shared_ptr<Matrix> data2 = nullptr, const bool serial = false,
+                const double screen = 0.0)
       : DFDist(nbas, naux, nullptr, nullptr, nullptr, serial) {
+      Profiler::Region region("DFDist_ints");
 
       // 3index Integral is now made in DFBlock.
       std::vector<std::shared_ptr<const Shell>> ashell, b1shell, b2shell;
@@ -149,8 +172,18 @@ class DFDist_ints : public DFDist {
       for (int i = 0; i != TBatch::Nblocks(); ++i)
         block_.push_back(std::make_shared<DFBlock>(adist_shell, adist_averaged, asize, b1size, b2size, astart, 0, 0));
 
+      // shell pairs whose Schwarz bound is smaller than screen are skipped (and used later to skip zero blocks)
+      std::shared_ptr<const DFSparsity> sparsity;
+      if (screen > 0.0 && TBatch::Nblocks() == 1) {
+        sparsity = std::make_shared<const DFSparsity>(ashell, b1shell, b2shell, screen);
+        if (sparsity->fraction() < 1.0)
+          std::cout << "    * " << std::fixed << std::setprecision(1) << sparsity->fraction()*100.0 << "% of the AO pairs are significant in 3-index integrals" << std::endl;
+        else
+          sparsity.reset();
+      }
+
       // 3-index integrals
-      compute_3index(myashell, b1shell, b2shell, asize, b1size, b2size, astart, thr, inverse);
+      compute_3index(myashell, b1shell, b2shell, asize, b1size, b2size, astart, thr, inverse, sparsity);
 
       // 2-index integrals
       if (data2)
@@ -161,6 +194,10 @@ class DFDist_ints : public DFDist {
       // 3-index integrals, post process
       if (average)
         average_3index();
+
+      if (sparsity)
+        for (auto& i : block_)
+          i->set_sparsity(sparsity);
     }
 
 };
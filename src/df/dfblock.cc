@@ -23,17 +23,34 @@
 //
 
 #include <src/df/dfblock.h>
+#include <src/df/dfsparsity.h>
+#include <src/util/math/mappedmemory.h>
 
 using namespace bagel;
 using namespace std;
 using namespace btas;
 
+namespace {
+  // blocks backed by scratch files are streamed through memory in tiles of this many bytes
+  const size_t tile_bytes__ = 128LU << 20;
+
+  // size of the half-transformed buffer in transform_full, which should fit in the last-level cache
+  const size_t fused_tile_bytes__ = 4LU << 20;
+
+  // number of rows of length ld in a tile
+  size_t tile_rows(const size_t ld) { return max(tile_bytes__ / sizeof(double) / max(ld, size_t(1)), size_t(1)); }
+}
+
 // construction of a block from AO integrals
 DFBlock::DFBlock(shared_ptr<const StaticDist> adist_shell, shared_ptr<const StaticDist> adist,
              const size_t a, const size_t b1, const size_t b2, const int as, const int b1s, const int b2s, const bool averaged)
- : btas::Tensor3<double>(max(adist_shell->size(mpi__->rank()), max(adist->size(mpi__->rank()), a)), b1, b2),
-   adist_shell_(adist_shell), adist_(adist), averaged_(averaged), astart_(as), b1start_(b1s), b2start_(b2s) {
+ : adist_shell_(adist_shell), adist_(adist), averaged_(averaged), astart_(as), b1start_(b1s), b2start_(b2s) {
 
+  // large blocks are placed in scratch files if BAGEL_DF_SCRATCH is set
+  {
+    MappedMemory::Scope scope;
+    this->resize(btas::CRange<3>(max(adist_shell->size(mpi__->rank()), max(adist->size(mpi__->rank()), a)), b1, b2));
+  }
   assert(asize() == adist_shell->size(mpi__->rank()) || asize() == adist_->size(mpi__->rank()) || asize() == adist_->nele());
 
   // resize to the current size (moving the end pointer)
@@ -43,8 +60,12 @@ DFBlock::DFBlock(shared_ptr<const StaticDist> adist_shell, shared_ptr<const Stat
 
 
 DFBlock::DFBlock(const DFBlock& o)
- : btas::Tensor3<double>(max(o.adist_shell_->size(mpi__->rank()), max(o.adist_->size(mpi__->rank()), o.asize())), o.b1size(), o.b2size()),
-   adist_shell_(o.adist_shell_), adist_(o.adist_), averaged_(o.averaged_), astart_(o.astart_), b1start_(o.b1start_), b2start_(o.b2start_) {
+ : adist_shell_(o.adist_shell_), adist_(o.adist_), averaged_(o.averaged_), astart_(o.astart_), b1start_(o.b1start_), b2start_(o.b2start_), sparsity_(o.sparsity_) {
+
+  {
+    MappedMemory::Scope scope;
+    this->resize(btas::CRange<3>(max(o.adist_shell_->size(mpi__->rank()), max(o.adist_->size(mpi__->rank()), o.asize())), o.b1size(), o.b2size()));
+  }
 
   // resize to the current size
   const btas::CRange<3> range(o.asize(), o.b1size(), o.b2size());
@@ -61,12 +82,42 @@ shared_ptr<DFBlock> DFBlock::transform_second(const MatView cmat, const bool tra
   // so far I only consider the following case
   assert(b1start_ == 0);
   const int nocc = trans ? cmat.extent(0) : cmat.extent(1);
+  Profiler::Region region("DFBlock::transform_second");
+  Profiler::add_flop(2.0*asize()*b1size()*b2size()*nocc*(sparsity_ ? sparsity_->fraction() : 1.0));
   auto out = make_shared<DFBlock>(adist_shell_, adist_, asize(), nocc, b2size(), astart_, 0, b2start_, averaged_);
 
-  if (!trans)
+  if (sparsity_) {
+    // only the b1 functions that form significant pairs with the b2 function contribute
+    const size_t slab = asize()*b1size();
+    for (int s2 = 0; s2 != sparsity_->nb2shell(); ++s2) {
+      const vector<pair<int,int>>& ranges = sparsity_->b1ranges(s2);
+      for (int k = sparsity_->b2offset(s2); k != sparsity_->b2offset(s2)+sparsity_->b2size(s2); ++k) {
+        double* const target = out->data()+k*asize()*nocc;
+        if (ranges.empty())
+          fill_n(target, asize()*nocc, 0.0);
+        for (auto r = ranges.begin(); r != ranges.end(); ++r)
+          dgemm_("N", trans ? "T" : "N", asize(), nocc, r->second-r->first, 1.0, data()+r->first*asize()+k*slab, asize(),
+                 cmat.data()+(trans ? r->first*nocc : r->first), trans ? nocc : b1size(), r == ranges.begin() ? 0.0 : 1.0, target, asize());
+      }
+    }
+  } else if (MappedMemory::mapped(data())) {
+    // out-of-core: one (a, b1) slab at a time, reading ahead the next tile and dropping the consumed one
+    const size_t slab = asize()*b1size();
+    const size_t ntile = tile_rows(slab);
+    for (size_t k0 = 0; k0 < b2size(); k0 += ntile) {
+      const size_t k1 = min(k0+ntile, b2size());
+      if (k1 < b2size())
+        MappedMemory::prefetch(data()+k1*slab, min(ntile, b2size()-k1)*slab*sizeof(double));
+      for (size_t k = k0; k != k1; ++k)
+        dgemm_("N", trans ? "T" : "N", asize(), nocc, b1size(), 1.0, data()+k*slab, asize(), cmat.data(), trans ? nocc : b1size(),
+               0.0, out->data()+k*asize()*nocc, asize());
+      MappedMemory::release(data()+k0*slab, (k1-k0)*slab*sizeof(double));
+    }
+  } else if (!trans) {
     contract(1.0, *this, {0,3,2}, cmat, {3,1}, 0.0, *out, {0,1,2});
-  else
+  } else {
     contract(1.0, *this, {0,3,2}, cmat, {1,3}, 0.0, *out, {0,1,2});
+  }
 
   return out;
 }
@@ -79,13 +130,55 @@ shared_ptr<DFBlock> DFBlock::transform_third(const MatView cmat, const bool tran
   // so far I only consider the following case
   assert(b2start_ == 0);
   const int nocc = trans ? cmat.extent(0) : cmat.extent(1);
+  Profiler::Region region("DFBlock::transform_third");
+  Profiler::add_flop(2.0*asize()*b1size()*b2size()*nocc);
   auto out = make_shared<DFBlock>(adist_shell_, adist_, asize(), b1size(), nocc, astart_, b1start_, 0, averaged_);
 
-  if (!trans)
+  if (MappedMemory::mapped(data())) {
+    // out-of-core: tiles of rows of the combined (a, b1) index so that the input is read once
+    const size_t slab = asize()*b1size();
+    const size_t ntile = tile_rows(b2size()+nocc);
+    for (size_t r0 = 0; r0 < slab; r0 += ntile) {
+      const size_t r1 = min(r0+ntile, slab);
+      if (r1 < slab)
+        for (size_t k = 0; k != b2size(); ++k)
+          MappedMemory::prefetch(data()+r1+k*slab, min(ntile, slab-r1)*sizeof(double));
+      dgemm_("N", trans ? "T" : "N", r1-r0, nocc, b2size(), 1.0, data()+r0, slab, cmat.data(), trans ? nocc : b2size(),
+             0.0, out->data()+r0, slab);
+    }
+  } else if (!trans) {
     contract(1.0, *this, {0,1,3}, cmat, {3,2}, 0.0, *out, {0,1,2});
-  else  // trans -> back transform
+  } else { // trans -> back transform
     contract(1.0, *this, {0,1,3}, cmat, {2,3}, 0.0, *out, {0,1,2});
+  }
+
+  return out;
+}
+
 
+shared_ptr<DFBlock> DFBlock::transform_full(const MatView c1, const MatView c2) const {
+  assert(c1.extent(0) == b1size() && c2.extent(0) == b2size());
+  assert(c1.range().ordinal().contiguous() && c2.range().ordinal().contiguous());
+  assert(b1start_ == 0 && b2start_ == 0);
+  const size_t nocc1 = c1.extent(1);
+  const size_t nocc2 = c2.extent(1);
+  Profiler::Region region("DFBlock::transform_full");
+  Profiler::add_flop(2.0*asize()*b2size()*nocc1*(b1size()+nocc2));
+  auto out = make_shared<DFBlock>(adist_shell_, adist_, asize(), nocc1, nocc2, astart_, 0, 0, averaged_);
+
+  // tiles of the aux index are half transformed into a buffer that stays in cache, and immediately transformed again.
+  // The half-transformed quantity for the entire block is never formed.
+  const size_t ntile = min(asize(), max(fused_tile_bytes__ / sizeof(double) / max(nocc1*b2size(), size_t(1)), size_t(8)));
+  unique_ptr<double[]> half(new double[ntile*nocc1*b2size()]);
+  for (size_t a0 = 0; a0 < asize(); a0 += ntile) {
+    const size_t na = min(ntile, asize()-a0);
+    // half(a,i,k) = (a,j,k) c1(j,i)
+    for (size_t k = 0; k != b2size(); ++k)
+      dgemm_("N", "N", na, nocc1, b1size(), 1.0, data()+a0+k*asize()*b1size(), asize(), c1.data(), b1size(), 0.0, half.get()+k*na*nocc1, na);
+    // out(a,i,l) = half(a,i,k) c2(k,l)
+    for (size_t i = 0; i != nocc1; ++i)
+      dgemm_("N", "N", na, nocc2, b2size(), 1.0, half.get()+i*na, na*nocc1, c2.data(), b2size(), 0.0, out->data()+a0+i*asize(), asize()*nocc1);
+  }
   return out;
 }
 
@@ -134,6 +227,7 @@ shared_ptr<DFBlock> DFBlock::copy() const {
 void DFBlock::add_direct_product(const VecView a, const MatView b, const double fac) {
   assert(asize() == a.size() && b1size()*b2size() == b.size());
   dger_(asize(), b1size()*b2size(), fac, a.data(), 1, b.data(), 1, data(), asize());
+  sparsity_.reset();
 }
 
 
@@ -356,15 +450,48 @@ shared_ptr<DFBlock> DFBlock::apply_2RDM(const Tensor4<double>& rdm) const {
 
 shared_ptr<Matrix> DFBlock::form_2index(const shared_ptr<const DFBlock> o, const double a) const {
   if (asize() != o->asize() || (b1size() != o->b1size() && b2size() != o->b2size())) throw logic_error("illegal call of DFBlock::form_2index");
+  Profiler::Region region("DFBlock::form_2index");
+  Profiler::add_flop(2.0*asize()*b1size()*b2size()*(b1size() == o->b1size() ? o->b2size() : o->b1size()));
   shared_ptr<Matrix> target;
 
+  const bool stream = MappedMemory::mapped(data()) || MappedMemory::mapped(o->data());
+
   if (b1size() == o->b1size()) {
     target = make_shared<Matrix>(b2size(),o->b2size());
-    contract(a, *this, {2,3,0}, *o, {2,3,1}, 0.0, *target, {0,1});
+    if (stream) {
+      // out-of-core: accumulate over tiles of rows of the combined (a, b1) index
+      const size_t slab = asize()*b1size();
+      const size_t ntile = tile_rows(b2size()+o->b2size());
+      for (size_t r0 = 0; r0 < slab; r0 += ntile) {
+        const size_t r1 = min(r0+ntile, slab);
+        dgemm_("T", "N", b2size(), o->b2size(), r1-r0, a, data()+r0, slab, o->data()+r0, slab, r0 == 0 ? 0.0 : 1.0, target->data(), b2size());
+      }
+    } else {
+      contract(a, *this, {2,3,0}, *o, {2,3,1}, 0.0, *target, {0,1});
+    }
   } else {
     assert(b2size() == o->b2size());
     target = make_shared<Matrix>(b1size(),o->b1size());
-    contract(a, *this, {2,0,3}, *o, {2,1,3}, 0.0, *target, {0,1});
+    if (stream) {
+      // out-of-core: accumulate over b2, reading ahead the next tile and dropping the consumed one
+      const size_t slab = asize()*b1size();
+      const size_t oslab = asize()*o->b1size();
+      const size_t ntile = tile_rows(slab+oslab);
+      for (size_t k0 = 0; k0 < b2size(); k0 += ntile) {
+        const size_t k1 = min(k0+ntile, b2size());
+        if (k1 < b2size()) {
+          MappedMemory::prefetch(data()+k1*slab, min(ntile, b2size()-k1)*slab*sizeof(double));
+          MappedMemory::prefetch(o->data()+k1*oslab, min(ntile, b2size()-k1)*oslab*sizeof(double));
+        }
+        for (size_t k = k0; k != k1; ++k)
+          dgemm_("T", "N", b1size(), o->b1size(), asize(), a, data()+k*slab, asize(), o->data()+k*oslab, asize(),
+                 k == 0 ? 0.0 : 1.0, target->data(), b1size());
+        MappedMemory::release(data()+k0*slab, (k1-k0)*slab*sizeof(double));
+        MappedMemory::release(o->data()+k0*oslab, (k1-k0)*oslab*sizeof(double));
+      }
+    } else {
+      contract(a, *this, {2,0,3}, *o, {2,1,3}, 0.0, *target, {0,1});
+    }
   }
 
   return target;
@@ -373,8 +500,27 @@ shared_ptr<Matrix> DFBlock::form_2index(const shared_ptr<const DFBlock> o, const
 
 shared_ptr<Matrix> DFBlock::form_4index(const shared_ptr<const DFBlock> o, const double a) const {
   if (asize() != o->asize()) throw logic_error("illegal call of DFBlock::form_4index");
+  Profiler::Region region("DFBlock::form_4index");
+  Profiler::add_flop(2.0*asize()*b1size()*b2size()*o->b1size()*o->b2size()*(sparsity_ ? sparsity_->fraction() : (o->sparsity_ ? o->sparsity_->fraction() : 1.0)));
   auto target = make_shared<Matrix>(b1size()*b2size(), o->b1size()*o->b2size());
-  contract(a, group(*this,1,3), {1,0}, group(*o,1,3), {1,2}, 0.0, *target, {0,2});
+  if (sparsity_) {
+    // rows of negligible pairs are zero
+    for (int s2 = 0; s2 != sparsity_->nb2shell(); ++s2)
+      for (auto& r : sparsity_->b1ranges(s2))
+        for (int k = sparsity_->b2offset(s2); k != sparsity_->b2offset(s2)+sparsity_->b2size(s2); ++k)
+          dgemm_("T", "N", r.second-r.first, o->b1size()*o->b2size(), asize(), a, data()+asize()*(r.first+b1size()*k), asize(),
+                 o->data(), asize(), 0.0, target->element_ptr(r.first+b1size()*k, 0), b1size()*b2size());
+  } else if (o->sparsity_) {
+    // columns of negligible pairs are zero
+    const shared_ptr<const DFSparsity>& osp = o->sparsity_;
+    for (int s2 = 0; s2 != osp->nb2shell(); ++s2)
+      for (auto& r : osp->b1ranges(s2))
+        for (int k = osp->b2offset(s2); k != osp->b2offset(s2)+osp->b2size(s2); ++k)
+          dgemm_("T", "N", b1size()*b2size(), r.second-r.first, asize(), a, data(), asize(),
+                 o->data()+asize()*(r.first+o->b1size()*k), asize(), 0.0, target->element_ptr(0, r.first+o->b1size()*k), b1size()*b2size());
+  } else {
+    contract(a, group(*this,1,3), {1,0}, group(*o,1,3), {1,2}, 0.0, *target, {0,2});
+  }
   return target;
 }
 
@@ -410,6 +556,8 @@ shared_ptr<Matrix> DFBlock::form_4index_diagonal_part() const {
 
 shared_ptr<Matrix> DFBlock::form_aux_2index(const shared_ptr<const DFBlock> o, const double a) const {
   if (b1size() != o->b1size() || b2size() != o->b2size()) throw logic_error("illegal call of DFBlock::form_aux_2index");
+  Profiler::Region region("DFBlock::form_aux_2index");
+  Profiler::add_flop(2.0*asize()*o->asize()*b1size()*b2size());
   auto target = make_shared<Matrix>(asize(), o->asize());
   contract(a, *this, {0,2,3}, *o, {1,2,3}, 0.0, *target, {0,1});
   return target;
@@ -418,15 +566,46 @@ shared_ptr<Matrix> DFBlock::form_aux_2index(const shared_ptr<const DFBlock> o, c
 
 shared_ptr<VectorB> DFBlock::form_vec(const shared_ptr<const Matrix> den) const {
   auto out = make_shared<VectorB>(asize());
-  contract(1.0, group(*this,1,3), {0,1}, group(*den,0,2), {1}, 0.0, *out, {0});
+  if (sparsity_) {
+    for (int s2 = 0; s2 != sparsity_->nb2shell(); ++s2)
+      for (auto& r : sparsity_->b1ranges(s2))
+        for (int k = sparsity_->b2offset(s2); k != sparsity_->b2offset(s2)+sparsity_->b2size(s2); ++k)
+          dgemv_("N", asize(), r.second-r.first, 1.0, data()+asize()*(r.first+b1size()*k), asize(), den->element_ptr(r.first, k), 1, 1.0, out->data(), 1);
+  } else {
+    contract(1.0, group(*this,1,3), {0,1}, group(*den,0,2), {1}, 0.0, *out, {0});
+  }
   return out;
 }
 
 
 shared_ptr<Matrix> DFBlock::form_mat(const Tensor1<double>& fit) const {
   auto out = make_shared<Matrix>(b1size(), b2size());
-  auto outv = group(*out,0,2);
-  contract(1.0, group(*this,1,3), {1,0}, fit, {1}, 0.0, outv, {0});
+  if (sparsity_) {
+    for (int s2 = 0; s2 != sparsity_->nb2shell(); ++s2)
+      for (auto& r : sparsity_->b1ranges(s2))
+        for (int k = sparsity_->b2offset(s2); k != sparsity_->b2offset(s2)+sparsity_->b2size(s2); ++k)
+          dgemv_("T", asize(), r.second-r.first, 1.0, data()+asize()*(r.first+b1size()*k), asize(), fit.data(), 1, 0.0, out->element_ptr(r.first, k), 1);
+  } else {
+    auto outv = group(*out,0,2);
+    contract(1.0, group(*this,1,3), {1,0}, fit, {1}, 0.0, outv, {0});
+  }
+  return out;
+}
+
+
+shared_ptr<Matrix> DFBlock::form_mat(const Matrix& fit) const {
+  assert(fit.ndim() == asize());
+  const int nfit = fit.mdim();
+  auto out = make_shared<Matrix>(b1size()*b2size(), nfit);
+  if (sparsity_) {
+    for (int s2 = 0; s2 != sparsity_->nb2shell(); ++s2)
+      for (auto& r : sparsity_->b1ranges(s2))
+        for (int k = sparsity_->b2offset(s2); k != sparsity_->b2offset(s2)+sparsity_->b2size(s2); ++k)
+          dgemm_("T", "N", r.second-r.first, nfit, asize(), 1.0, data()+asize()*(r.first+b1size()*k), asize(), fit.data(), asize(),
+                 0.0, out->element_ptr(r.first+b1size()*k, 0), b1size()*b2size());
+  } else {
+    dgemm_("T", "N", b1size()*b2size(), nfit, asize(), 1.0, data(), asize(), fit.data(), asize(), 0.0, out->data(), b1size()*b2size());
+  }
   return out;
 }
 
@@ -435,6 +614,7 @@ void DFBlock::contrib_apply_J(const shared_ptr<const DFBlock> o, const shared_pt
   if (b1size() != o->b1size() || b2size() != o->b2size()) throw logic_error("illegal call of DFBlock::contrib_apply_J");
   assert(astart_ == 0 && o->astart_ == 0);
   contract(1.0, *d, {0,3}, *o, {3,1,2}, 1.0, *this, {0,1,2});
+  sparsity_.reset();
 }
 
 
@@ -465,14 +645,24 @@ shared_ptr<Tensor3<double>> DFBlock::get_block(const int ist, const int i, const
 }
 
 
+void DFBlock::set_sparsity(shared_ptr<const DFSparsity> o) {
+  assert(!o || (o->nbasis1() == b1size() && o->nbasis2() == b2size() && b1start_ == 0 && b2start_ == 0));
+  sparsity_ = o;
+}
+
+
 DFBlock& DFBlock::operator=(const DFBlock& o) {
-  btas::Tensor3<double>::operator=(o);
+  {
+    MappedMemory::Scope scope;
+    btas::Tensor3<double>::operator=(o);
+  }
   adist_shell_ = o.adist_shell_;
   adist_ = o.adist_;
   averaged_ = o.averaged_;
   astart_ = o.astart_;
   b1start_ = o.b1start_;
   b2start_ = o.b2start_;
+  sparsity_ = o.sparsity_;
   return *this;
 }
 
@@ -485,6 +675,7 @@ DFBlock& DFBlock::operator=(DFBlock&& o) {
   astart_ = o.astart_;
   b1start_ = o.b1start_;
   b2start_ = o.b2start_;
+  sparsity_ = o.sparsity_;
   return *this;
 }
 
@@ -503,24 +694,28 @@ void DFBlock::symmetrize() {
 void DFBlock::copy_block(shared_ptr<MatView> o, const int jdim, const size_t offset) {
   assert(o->size() == asize()*jdim);
   copy_n(o->data(), asize()*jdim, data()+offset);
+  sparsity_.reset();
 }
 
 
 void DFBlock::copy_block(MatView o, const int jdim, const size_t offset) {
   assert(o.size() == asize()*jdim);
   copy_n(o.data(), asize()*jdim, data()+offset);
+  sparsity_.reset();
 }
 
 
 void DFBlock::add_block(shared_ptr<MatView> o, const int jdim, const size_t offset, const double fac) {
   assert(o->size() == asize()*jdim);
   blas::ax_plus_y_n(fac, o->data(), asize()*jdim, data()+offset);
+  sparsity_.reset();
 }
 
 
 void DFBlock::add_block(MatView o, const int jdim, const size_t offset, const double fac) {
   assert(o.size() == asize()*jdim);
   blas::ax_plus_y_n(fac, o.data(), asize()*jdim, data()+offset);
+  sparsity_.reset();
 }
 
 
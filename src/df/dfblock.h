@@ -38,6 +38,8 @@
 
 namespace bagel {
 
+class DFSparsity;
+
 /*
     DFBlock is a slice of 3-index DF integrals. Distributed by the first index
 */
@@ -61,6 +63,9 @@ class DFBlock : public btas::Tensor3<double> {
     size_t b1start_;
     size_t b2start_;
 
+    // shell-pair sparsity of AO integrals (nullptr if the block is treated as dense)
+    std::shared_ptr<const DFSparsity> sparsity_;
+
   public:
 
     DFBlock() { }
@@ -86,15 +91,19 @@ class DFBlock : public btas::Tensor3<double> {
     // dist
     const std::shared_ptr<const StaticDist>& adist_now() const { return averaged_ ? adist_ : adist_shell_; }
 
+    // operations that may fill the negligible shell pairs drop the sparsity information
+    const std::shared_ptr<const DFSparsity>& sparsity() const { return sparsity_; }
+    void set_sparsity(std::shared_ptr<const DFSparsity> o);
+
 
     // some math functions
     DFBlock& operator=(const DFBlock& o);
     DFBlock& operator=(DFBlock&& o);
-    DFBlock& operator+=(const DFBlock& o) { btas::Tensor3<double>::operator+=(o); return *this; }
-    DFBlock& operator-=(const DFBlock& o) { btas::Tensor3<double>::operator-=(o); return *this; }
+    DFBlock& operator+=(const DFBlock& o) { btas::Tensor3<double>::operator+=(o); sparsity_.reset(); return *this; }
+    DFBlock& operator-=(const DFBlock& o) { btas::Tensor3<double>::operator-=(o); sparsity_.reset(); return *this; }
 
     template <typename ScaleType, class DType>
-    void ax_plus_y(const ScaleType a, const DType& o) { btas::axpy(a, o, *this); }
+    void ax_plus_y(const ScaleType a, const DType& o) { btas::axpy(a, o, *this); sparsity_.reset(); }
     template <typename ScaleType, class DType>
     void ax_plus_y(const ScaleType a, const std::shared_ptr<DType>& o) { ax_plus_y(a, *o); }
     template <typename ScaleType>
@@ -121,6 +130,8 @@ class DFBlock : public btas::Tensor3<double> {
 
     std::shared_ptr<DFBlock> transform_second(const MatView c, const bool trans = false) const;
     std::shared_ptr<DFBlock> transform_third(const MatView c, const bool trans = false) const;
+    // transform_second(c1) followed by transform_third(c2) without forming the intermediate
+    std::shared_ptr<DFBlock> transform_full(const MatView c1, const MatView c2) const;
 
     std::shared_ptr<DFBlock> merge_b1(std::shared_ptr<const DFBlock> o) const;
     std::shared_ptr<DFBlock> slice_b1(const int start, const int size) const;
@@ -149,6 +160,8 @@ class DFBlock : public btas::Tensor3<double> {
 
     std::shared_ptr<VectorB> form_vec(const std::shared_ptr<const Matrix> den) const;
     std::shared_ptr<Matrix> form_mat(const btas::Tensor1<double>& fit) const;
+    // the same as above for several fitting vectors at once; column i of the return value is form_mat of the i-th column of fit
+    std::shared_ptr<Matrix> form_mat(const Matrix& fit) const;
 
     void contrib_apply_J(const std::shared_ptr<const DFBlock> o, const std::shared_ptr<const Matrix> mat);
 
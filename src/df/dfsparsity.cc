@@ -0,0 +1,100 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: dfsparsity.cc
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <src/df/dfsparsity.h>
+#include <src/integral/rys/eribatch.h>
+#include <src/util/taskqueue.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+DFSparsity::DFSparsity(const vector<shared_ptr<const Shell>>& ashell, const vector<shared_ptr<const Shell>>& b1shell,
+                       const vector<shared_ptr<const Shell>>& b2shell, const double thresh) {
+  for (auto& i : b1shell) {
+    b1offset_.push_back(b1offset_.empty() ? 0 : b1offset_.back() + b1size_.back());
+    b1size_.push_back(i->nbasis());
+  }
+  for (auto& i : b2shell) {
+    b2offset_.push_back(b2offset_.empty() ? 0 : b2offset_.back() + b2size_.back());
+    b2size_.push_back(i->nbasis());
+  }
+  const int n1 = b1shell.size();
+  const int n2 = b2shell.size();
+  const bool symmetric = b1shell == b2shell;
+
+  // max_D sqrt((D|D)) and sqrt((b1 b2|b1 b2)) from ShellPair. Work is distributed over threads and processes, and then all-reduced
+  double amax = 0.0;
+  vector<double> schwarz(n1*n2, 0.0);
+  {
+    auto dummy = make_shared<const Shell>(ashell.front()->spherical());
+    vector<double> aschwarz(ashell.size(), 0.0);
+    TaskQueue<function<void(void)>> tasks(ashell.size() + n1*n2);
+    size_t u = 0;
+    for (int i = 0; i != ashell.size(); ++i) {
+      if (u++ % mpi__->size() != mpi__->rank()) continue;
+      tasks.emplace_back(
+        [&, i]() {
+          ERIBatch eri({{ashell[i], dummy, ashell[i], dummy}}, 0.0);
+          eri.compute();
+          for (int j = 0; j != eri.data_size(); ++j)
+            aschwarz[i] = max(aschwarz[i], sqrt(abs(eri.data()[j])));
+        }
+      );
+    }
+    for (int i2 = 0; i2 != n2; ++i2)
+      for (int i1 = 0; i1 != (symmetric ? i2+1 : n1); ++i1) {
+        if (u++ % mpi__->size() != mpi__->rank()) continue;
+        tasks.emplace_back(
+          [&, i1, i2]() {
+            ShellPair pair({{b1shell[i1], b2shell[i2]}}, {{b1offset_[i1], b2offset_[i2]}}, {i1, i2});
+            schwarz[i1+n1*i2] = pair.schwarz();
+            if (symmetric)
+              schwarz[i2+n1*i1] = pair.schwarz();
+          }
+        );
+      }
+    tasks.compute();
+    mpi__->allreduce(aschwarz.data(), aschwarz.size());
+    mpi__->allreduce(schwarz.data(), schwarz.size());
+    amax = *max_element(aschwarz.begin(), aschwarz.end());
+  }
+
+  significant_.resize(n1*n2);
+  b1ranges_.resize(n2);
+  size_t nsig = 0;
+  for (int i2 = 0; i2 != n2; ++i2)
+    for (int i1 = 0; i1 != n1; ++i1) {
+      const bool sig = schwarz[i1+n1*i2]*amax >= thresh;
+      significant_[i1+n1*i2] = sig;
+      if (!sig) continue;
+      nsig += b1size_[i1]*b2size_[i2];
+      vector<pair<int,int>>& ranges = b1ranges_[i2];
+      if (!ranges.empty() && ranges.back().second == b1offset_[i1])
+        ranges.back().second += b1size_[i1];
+      else
+        ranges.emplace_back(b1offset_[i1], b1offset_[i1]+b1size_[i1]);
+    }
+  fraction_ = static_cast<double>(nsig) / (nbasis1()*nbasis2());
+}
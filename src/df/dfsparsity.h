@@ -0,0 +1,77 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: dfsparsity.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_DF_DFSPARSITY_H
+#define __SRC_DF_DFSPARSITY_H
+
+#include <src/molecule/shellpair.h>
+
+namespace bagel {
+
+/*
+    Shell-pair sparsity of AO 3-index integrals (D|b1 b2). A pair is negligible when the Schwarz bound
+    sqrt((b1 b2|b1 b2)) * max_D sqrt((D|D)) is smaller than the threshold. The integrals of negligible
+    pairs are zero in the DFBlock, and the operations on DFBlock skip them.
+*/
+
+class DFSparsity {
+  protected:
+    // offsets and sizes of the shells
+    std::vector<int> b1offset_;
+    std::vector<int> b1size_;
+    std::vector<int> b2offset_;
+    std::vector<int> b2size_;
+
+    // significant_[s1 + nb1shell*s2]
+    std::vector<char> significant_;
+
+    // for each b2 shell, ranges [start, fence) of the b1 functions that belong to significant pairs (adjacent shells are merged)
+    std::vector<std::vector<std::pair<int,int>>> b1ranges_;
+
+    // fraction of the significant elements
+    double fraction_;
+
+  public:
+    DFSparsity(const std::vector<std::shared_ptr<const Shell>>& ashell, const std::vector<std::shared_ptr<const Shell>>& b1shell,
+               const std::vector<std::shared_ptr<const Shell>>& b2shell, const double thresh);
+
+    int nb1shell() const { return b1offset_.size(); }
+    int nb2shell() const { return b2offset_.size(); }
+    int b1offset(const int s) const { return b1offset_[s]; }
+    int b1size(const int s) const { return b1size_[s]; }
+    int b2offset(const int s) const { return b2offset_[s]; }
+    int b2size(const int s) const { return b2size_[s]; }
+    size_t nbasis1() const { return b1offset_.back() + b1size_.back(); }
+    size_t nbasis2() const { return b2offset_.back() + b2size_.back(); }
+
+    bool significant(const int s1, const int s2) const { return significant_[s1 + nb1shell()*s2]; }
+    const std::vector<std::pair<int,int>>& b1ranges(const int s2) const { return b1ranges_[s2]; }
+
+    double fraction() const { return fraction_; }
+};
+
+}
+
+#endif
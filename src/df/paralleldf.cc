@@ -134,6 +134,30 @@ shared_ptr<Matrix> ParallelDF::compute_Jop_from_cd(shared_ptr<const VectorB> tmp
 }
 
 
+vector<shared_ptr<Matrix>> ParallelDF::compute_Jop_from_cd(const vector<shared_ptr<const VectorB>>& cd) const {
+  if (block_.size() != 1) throw logic_error("compute_Jop so far assumes block_.size() == 1");
+  const size_t astart = block_[0]->astart();
+  const size_t asize = block_[0]->asize();
+  Matrix fit(asize, cd.size());
+  for (int i = 0; i != cd.size(); ++i)
+    copy_n(cd[i]->data()+astart, asize, fit.element_ptr(0, i));
+
+  shared_ptr<Matrix> tmp = block_[0]->form_mat(fit);
+  // all reduce
+  if (!serial_)
+    tmp->allreduce();
+
+  vector<shared_ptr<Matrix>> out;
+  const size_t b1size = block_[0]->b1size();
+  const size_t b2size = block_[0]->b2size();
+  for (int i = 0; i != cd.size(); ++i) {
+    out.push_back(make_shared<Matrix>(b1size, b2size));
+    copy_n(tmp->element_ptr(0, i), b1size*b2size, out.back()->data());
+  }
+  return out;
+}
+
+
 shared_ptr<VectorB> ParallelDF::compute_cd(const shared_ptr<const Matrix> den, shared_ptr<const Matrix> dat2, const int number_of_j) const {
   if (!dat2 && !data2_) throw logic_error("ParallelDF::compute_cd was called without 2-index integrals");
   if (!dat2) dat2 = data2_;
@@ -164,6 +188,7 @@ shared_ptr<Matrix> ParallelDF::compute_Jop(const shared_ptr<const Matrix> den) c
 
 
 shared_ptr<Matrix> ParallelDF::compute_Jop(const shared_ptr<const ParallelDF> o, const shared_ptr<const Matrix> den, const bool onlyonce) const {
+  Profiler::Region region("ParallelDF::compute_Jop");
   // first compute |E*) = d_rs (D|rs) J^{-1}_DE
   shared_ptr<const VectorB> tmp0 = o->compute_cd(den, data2_, onlyonce ? 1 : 2);
   // then compute J operator J_{rs} = |E*) (E|rs)
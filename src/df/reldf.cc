@@ -83,25 +83,42 @@ vector<shared_ptr<RelDFHalf>> RelDF::compute_half_transform(array<shared_ptr<con
 
 
 vector<shared_ptr<ZMatrix>> RelDF::compute_Jop(list<shared_ptr<const RelCDMatrix>>& cd) const {
+  return compute_Jop(vector<list<shared_ptr<const RelCDMatrix>>>{cd}).front();
+}
+
 
-  vector<shared_ptr<ZVectorB>> sum;
-  for (auto& b : basis_) {
-    sum.push_back(cd.front()->clone());
-    for (auto& i : cd) {
-      if(b->alpha_comp() == i->alpha_comp())
-        *sum.back() += *i;
+vector<vector<shared_ptr<ZMatrix>>> RelDF::compute_Jop(const vector<list<shared_ptr<const RelCDMatrix>>>& cds) const {
+
+  vector<vector<shared_ptr<ZVectorB>>> sums;
+  for (auto& cd : cds) {
+    assert(!cd.empty());
+    vector<shared_ptr<ZVectorB>> sum;
+    for (auto& b : basis_) {
+      sum.push_back(cd.front()->clone());
+      for (auto& i : cd) {
+        if(b->alpha_comp() == i->alpha_comp())
+          *sum.back() += *i;
+      }
     }
+    sums.push_back(sum);
   }
 
-  vector<shared_ptr<ZMatrix>> out;
+  vector<vector<shared_ptr<ZMatrix>>> out(cds.size());
 
   // real
   if (!get_imag()) {
-    for (auto& i : sum) {
-      shared_ptr<const Matrix> rdat = get_real()->compute_Jop_from_cd(i->get_real_part());
-      shared_ptr<const Matrix> idat = get_real()->compute_Jop_from_cd(i->get_imag_part());
-      out.push_back(make_shared<ZMatrix>(*rdat, *idat));
-    }
+    // real and imaginary parts of all the fitted densities are contracted at once
+    vector<shared_ptr<const VectorB>> fit;
+    for (auto& sum : sums)
+      for (auto& i : sum) {
+        fit.push_back(i->get_real_part());
+        fit.push_back(i->get_imag_part());
+      }
+    vector<shared_ptr<Matrix>> dat = get_real()->compute_Jop_from_cd(fit);
+    auto d = dat.begin();
+    for (auto& o : out)
+      for (int i = 0; i != basis_.size(); ++i, d += 2)
+        o.push_back(make_shared<ZMatrix>(**d, **(d+1)));
 
   // complex (GIAO)
   } else {
@@ -112,18 +129,22 @@ vector<shared_ptr<ZMatrix>> RelDF::compute_Jop(list<shared_ptr<const RelCDMatrix
       dfri->add_block(get_real()->block(i)->copy());
       dfri->block(i)->ax_plus_y(1.0, get_imag()->block(i));
     }
-    for (auto& i : sum) {
-      shared_ptr<const VectorB> cdr = i->get_real_part();
-      shared_ptr<const VectorB> cdi = i->get_imag_part();
-      auto cdri = make_shared<const VectorB> (*cdr + *cdi);
-
-      shared_ptr<Matrix> rdat = get_real()->compute_Jop_from_cd(cdr);
-      shared_ptr<Matrix> tmpdat = get_imag()->compute_Jop_from_cd(cdi);
-      shared_ptr<Matrix> idat = dfri->compute_Jop_from_cd(cdri);
-      *idat -= *rdat;
-      *idat -= *tmpdat;
-      *rdat -= *tmpdat;
-      out.push_back(make_shared<ZMatrix>(*rdat, *idat));
+    auto o = out.begin();
+    for (auto& sum : sums) {
+      for (auto& i : sum) {
+        shared_ptr<const VectorB> cdr = i->get_real_part();
+        shared_ptr<const VectorB> cdi = i->get_imag_part();
+        auto cdri = make_shared<const VectorB> (*cdr + *cdi);
+
+        shared_ptr<Matrix> rdat = get_real()->compute_Jop_from_cd(cdr);
+        shared_ptr<Matrix> tmpdat = get_imag()->compute_Jop_from_cd(cdi);
+        shared_ptr<Matrix> idat = dfri->compute_Jop_from_cd(cdri);
+        *idat -= *rdat;
+        *idat -= *tmpdat;
+        *rdat -= *tmpdat;
+        o->push_back(make_shared<ZMatrix>(*rdat, *idat));
+      }
+      ++o;
     }
   }
 
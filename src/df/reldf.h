@@ -73,6 +73,8 @@ class RelDF : public RelDFBase, public std::enable_shared_from_this<RelDF> {
                                std::array<std::shared_ptr<const Matrix>,4> i) const;
 
     std::vector<std::shared_ptr<ZMatrix>> compute_Jop(std::list<std::shared_ptr<const RelCDMatrix>>& cd) const;
+    // J operators from several sets of fitted densities, computed with one pass over the 3-index integrals
+    std::vector<std::vector<std::shared_ptr<ZMatrix>>> compute_Jop(const std::vector<std::list<std::shared_ptr<const RelCDMatrix>>>& cds) const;
 };
 
 }
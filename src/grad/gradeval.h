@@ -53,16 +53,20 @@ class GradEval : public GradEval_base {
     double energy_;
     std::vector<double> dipole_;
 
-    void init() {
+    // args are passed to the constructor of T after the input, geometry, and reference
+    template<typename... Args>
+    void init_task(Args&&... args) {
       if (geom_->external())
         throw std::logic_error("Gradients with external fields have not been implemented.");
       auto idata_out = std::make_shared<PTree>(*idata_);
-      task_ = std::make_shared<T>(idata_out, geom_, ref_);
+      task_ = std::make_shared<T>(idata_out, geom_, ref_, std::forward<Args>(args)...);
       task_->compute();
       ref_  = task_->conv_to_ref();
       geom_ = ref_->geom();
     }
 
+    void init() { init_task(); }
+
   public:
 
     // Constructor performs energy calculation
@@ -71,6 +75,13 @@ class GradEval : public GradEval_base {
       init();
     }
 
+    // Same as above with an additional argument to T (e.g., the grid points of the previous KS calculation)
+    template<typename Arg>
+    GradEval(std::shared_ptr<const PTree> idata, std::shared_ptr<const Geometry> geom, std::shared_ptr<const Reference> ref, Arg&& arg)
+      : GradEval_base(geom), idata_(idata), ref_(ref) {
+      init_task(std::forward<Arg>(arg));
+    }
+
     // computes effective density matrices and perform gradient contractions
     std::shared_ptr<GradFile> compute(const std::string jobtitle = "force", std::shared_ptr<const GradInfo> gradinfo = std::make_shared<const GradInfo>())
       { throw std::logic_error("Nuclear gradient for this method has not been implemented"); }
@@ -85,6 +96,7 @@ class GradEval : public GradEval_base {
     double dipole(int i) const { return dipole_[i]; }
 
     std::shared_ptr<const Reference> ref() const { return ref_; }
+    std::shared_ptr<const T> task() const { return task_; }
 };
 
 // specialization
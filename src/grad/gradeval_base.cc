@@ -27,6 +27,7 @@
 #include <src/util/taskqueue.h>
 #include <src/util/parallel/resources.h>
 #include <src/util/parallel/mpi_interface.h>
+#include <src/util/parallel/profiler.h>
 #include <array>
 
 using namespace std;
@@ -36,6 +37,7 @@ shared_ptr<GradFile> GradEval_base::contract_gradient(const shared_ptr<const Mat
                                                       const shared_ptr<const DFDist> o, const shared_ptr<const Matrix> o2,
                                                       const shared_ptr<const Matrix> v, const bool numerical,
                                                       const shared_ptr<const Geometry> g2, const shared_ptr<const DFDist> g2o, const shared_ptr<const Matrix> g2o2) {
+  Profiler::Region region("GradEval_base::contract_gradient");
   grad_->zero();
 
   if (!numerical) {
@@ -58,6 +60,7 @@ shared_ptr<GradFile> GradEval_base::contract_gradient(const shared_ptr<const Mat
       task.insert(task.end(), task0.begin(), task0.end());
     }
 
+    Profiler::Region tasks("integral derivatives");
     TaskQueue<shared_ptr<GradTask>> tq(move(task));
     tq.compute();
   } else {
@@ -72,7 +75,10 @@ shared_ptr<GradFile> GradEval_base::contract_gradient(const shared_ptr<const Mat
 
   *grad_ += *geom_->hcoreinfo()->compute_grad(geom_, d);
 
-  grad_->allreduce();
+  {
+    Profiler::Region reduce("allreduce");
+    grad_->allreduce();
+  }
 
   return grad_;
 }
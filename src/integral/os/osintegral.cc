@@ -184,7 +184,10 @@ void OSIntegral<DataType, IntType>::common_init() {
 template <typename DataType, Int_t IntType>
 OSIntegral<DataType, IntType>::~OSIntegral() {
   stack_->release(size_alloc_, stack_save_);
-  if (allocated_here_) resources__->release(stack_);
+  if (allocated_here_) {
+    stack_->record_peak(basisinfo_[0]->angular_number() + basisinfo_[1]->angular_number());
+    resources__->release(stack_);
+  }
 }
 
 
@@ -22,18 +22,17 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/breitrootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void BreitRootList::breitroot4(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[4] = {5.235260767382691e-01,2.156648763269094e+00,5.137387546176711e+00,1.018243761381592e+01};
-  constexpr double aw[4] = {2.265043732793038e-01,1.908084800858998e-01,2.539731378612038e-02,4.032955750550154e-04};
-  constexpr double x[1536] = {  1.921924733818690e-01, -8.768074777695027e-03,  2.697283662746131e-04, -6.156764037308125e-06,  8.656755354488836e-08,
+  static constexpr double ax[4] = {5.235260767382691e-01,2.156648763269094e+00,5.137387546176711e+00,1.018243761381592e+01};
+  static constexpr double aw[4] = {2.265043732793038e-01,1.908084800858998e-01,2.539731378612038e-02,4.032955750550154e-04};
+  static constexpr double x[1536] = {  1.921924733818690e-01, -8.768074777695027e-03,  2.697283662746131e-04, -6.156764037308125e-06,  8.656755354488836e-08,
   4.930598884081129e-10, -8.129348133428441e-11,  2.989041249051197e-12, -6.267650683931552e-14,  1.834053994496536e-16,  5.067953578564245e-17, -2.140982816017785e-18,
   7.046383416398344e-01, -2.362767640081116e-02,  2.843174635746880e-04,  6.366780422478742e-06, -2.841085218433418e-07, -3.967910644055882e-10,  2.570067972734486e-10,
  -4.214464090675120e-12, -1.883605499629383e-13,  7.856665055474796e-15,  7.202700678166175e-17, -9.231252526904441e-18,  1.351600377893622e+00, -2.347156772002677e-02,
@@ -253,7 +252,7 @@ void BreitRootList::breitroot4(const double* ta, double* rr, double* ww, const i
  -5.137721477181574e-12,  4.077813596928306e-14, -3.236563868623139e-16,  2.568863264000944e-18, -2.038908627854799e-20,  1.618282640060131e-22, -1.284348457254842e-24,
   3.232927175315348e-01, -2.565976854842198e-03,  2.036617858224267e-05, -1.616465204122882e-07,  1.282989710406743e-09, -1.018309947383852e-11,  8.082334100139870e-14,
  -6.414954949427716e-16,  5.091554732685975e-18, -4.041170628171492e-20,  3.207478661259268e-22, -2.545611658328662e-24  };
-  constexpr double w[1536] = {  5.330565315787104e-02, -5.725700631895237e-03,  4.327690947643411e-04, -2.735356204516888e-05,  1.528603139360458e-06,
+  static constexpr double w[1536] = {  5.330565315787104e-02, -5.725700631895237e-03,  4.327690947643411e-04, -2.735356204516888e-05,  1.528603139360458e-06,
  -7.766091732541141e-08,  3.647194732909942e-09, -1.600845048296128e-10,  6.616927499132635e-12, -2.589853603118810e-13,  9.639032972581570e-15, -3.417453776195249e-16,
   1.359532044695186e-01, -2.649064635399328e-02,  3.250223532983477e-03, -3.052215827427357e-04,  2.374332961231276e-05, -1.595341017065699e-06,  9.498194505601250e-08,
  -5.097129169840624e-09,  2.495745616527642e-10, -1.125176927076223e-11,  4.703877640141090e-13, -1.831555126335759e-14,  1.463540138620439e-01, -4.443562901671851e-02,
@@ -473,51 +472,5 @@ void BreitRootList::breitroot4(const double* ta, double* rr, double* ww, const i
  -8.663029365375581e-15,  7.448832650025229e-17, -6.334435060628351e-19,  5.341870579679046e-21, -4.475392021022420e-23,  3.729728464449196e-25, -3.094641926590341e-27,
   1.613411783850450e-06, -1.920803935714679e-08,  1.905664496247142e-10, -1.764608372103488e-12,  1.575638720097277e-14, -1.375642101097407e-16,  1.182834245529700e-18,
  -1.005873953641280e-20,  8.482601171180554e-23, -7.106681255816148e-25,  5.922612489687230e-27, -4.914147001899122e-29  };
-  int offset = -4;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 4;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 4, 0.5);
-      fill_n(ww+offset, 4, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 4; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=4; ++j) {
-        const int boxof = it*48+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<4, 3>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -22,20 +22,19 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/breitrootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void BreitRootList::breitroot8(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[8] = {1.139873801581614e+00,2.826336481165991e-01,2.601524843406029e+00,4.724114537527791e+00,7.605256299231614e+00,
+  static constexpr double ax[8] = {1.139873801581614e+00,2.826336481165991e-01,2.601524843406029e+00,4.724114537527791e+00,7.605256299231614e+00,
     1.141718207654583e+01,1.649941079765582e+01,2.373000399593471e+01};
-  constexpr double aw[8] = {1.967972714018076e-01,1.135696809762358e-01,1.064544854336141e-01,2.393874160156909e-02,2.271258737381319e-03,
+  static constexpr double aw[8] = {1.967972714018076e-01,1.135696809762358e-01,1.064544854336141e-01,2.393874160156909e-02,2.271258737381319e-03,
     8.120230009266285e-05,8.211887069030494e-07,1.086971563315459e-09};
-  constexpr double x[3072] = {  6.038910939619137e-02, -1.629524894849707e-03,  3.198126791811978e-05, -5.342217687088425e-07,  7.859490831612807e-09,
+  static constexpr double x[3072] = {  6.038910939619137e-02, -1.629524894849707e-03,  3.198126791811978e-05, -5.342217687088425e-07,  7.859490831612807e-09,
  -1.010415206975803e-10,  1.070850838352644e-12, -7.369400439630854e-15, -3.167597466567247e-17,  2.443099084877796e-18, -5.852588668244569e-20,  1.023764315566414e-21,
   2.349452753252876e-01, -5.796652457968223e-03,  9.342297208494112e-05, -1.034036930519525e-06,  4.643396289776993e-09,  1.106703175044163e-10, -3.386252269057934e-12,
   4.728317737966574e-14, -1.924682410426494e-16, -8.231905636466730e-18,  2.427322127745054e-19, -3.330981916899148e-21,  5.042353432987289e-01, -1.062116412278011e-02,
@@ -475,7 +474,7 @@ void BreitRootList::breitroot8(const double* ta, double* rr, double* ww, const i
  -5.233430673632528e-20,  9.184579221325525e-23,  8.234217291728054e-24,  7.534283801893306e-01, -5.979966972436791e-03,  4.746303858345326e-05, -3.767137461499833e-07,
   2.989913211171845e-09, -2.372635687284932e-11,  1.880544885735488e-13, -1.480019837572746e-15,  1.122726815462585e-17, -7.036433424992368e-20, -3.731064444013080e-23,
   1.707081752382375e-23  };
-  constexpr double w[3072] = {  1.011507212876448e-02, -5.455332189787776e-04,  2.091056011420700e-05, -6.871051570254378e-07,  2.048475398197481e-08,
+  static constexpr double w[3072] = {  1.011507212876448e-02, -5.455332189787776e-04,  2.091056011420700e-05, -6.871051570254378e-07,  2.048475398197481e-08,
  -5.686109216277269e-10,  1.491429995484687e-11, -3.732376936312328e-13,  8.972145070125750e-15, -2.082049402203843e-16,  4.681702122809855e-18, -1.022625752159996e-19,
   3.481787833672718e-02, -3.116933547340388e-03,  1.899381548371138e-04, -9.387023256639148e-06,  4.023790696582338e-07, -1.549685332578906e-08,  5.477880457458068e-10,
  -1.802488788040552e-11,  5.576276629924034e-13, -1.633863047099511e-14,  4.559540098725965e-16, -1.216455779339604e-17,  6.151706931638347e-02, -8.882809945607955e-03,
@@ -915,51 +914,5 @@ void BreitRootList::breitroot8(const double* ta, double* rr, double* ww, const i
  -2.795052998707024e-27,  5.664464955762436e-29, -1.410875492053981e-30,  4.348504776671272e-12, -5.176995684466978e-14,  5.136199777285991e-16, -4.756119066427396e-18,
   4.247652539240240e-20, -3.714499183853580e-22,  3.228392660298950e-24, -2.913185693303771e-26,  3.159537586819472e-28, -5.218362543605930e-30,  1.264554244764542e-31,
  -3.423926423373116e-33  };
-  int offset = -8;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 8;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 8, 0.5);
-      fill_n(ww+offset, 8, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 8; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=8; ++j) {
-        const int boxof = it*96+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<8, 3>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -22,20 +22,19 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/breitrootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void BreitRootList::breitroot9(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[9] = {1.020844277720390e+00,2.535325549744191e-01,2.323096077022466e+00,4.199350600657293e+00,6.713974316615029e+00,
+  static constexpr double ax[9] = {1.020844277720390e+00,2.535325549744191e-01,2.323096077022466e+00,4.199350600657293e+00,6.713974316615029e+00,
     9.972009159539347e+00,1.415405367127805e+01,1.961190281916595e+01,2.725123652302706e+01};
-  constexpr double aw[9] = {1.874603923315855e-01,9.928562743400975e-02,1.180374105004125e-01,3.354805250160214e-02,4.504254448322162e-03,
+  static constexpr double aw[9] = {1.874603923315855e-01,9.928562743400975e-02,1.180374105004125e-01,3.354805250160214e-02,4.504254448322162e-03,
     2.713303693179653e-04,6.352683439554197e-06,4.242154619834280e-08,3.614323582198263e-11};
-  constexpr double x[3456] = {  4.899380029235506e-02, -1.196290894649937e-03,  2.137178747682525e-05, -3.278549804673814e-07,  4.492535055104742e-09,
+  static constexpr double x[3456] = {  4.899380029235506e-02, -1.196290894649937e-03,  2.137178747682525e-05, -3.278549804673814e-07,  4.492535055104742e-09,
  -5.515220914505886e-11,  5.902991190637585e-13, -5.027447785750422e-15,  2.118462236884408e-17,  3.562565285862611e-19, -1.242546676094503e-20,  2.400748249197140e-22,
   1.915884995890970e-01, -4.351336393236831e-03,  6.648935103347045e-05, -7.487716552841069e-07,  5.095122668797034e-09,  1.853057067237486e-11, -1.260505416971305e-12,
   2.242063206849866e-14, -2.196407567757976e-16,  2.012300518862894e-20,  4.695950975985983e-20, -1.035793918142581e-21,  4.148561784061573e-01, -8.304654185967191e-03,
@@ -530,7 +529,7 @@ void BreitRootList::breitroot9(const double* ta, double* rr, double* ww, const i
  -4.995539502501934e-21,  1.352499538366372e-22,  8.652276215283033e-01, -6.867317411450848e-03,  5.450577769400032e-05, -4.325936466156399e-07,  3.431945946384590e-09,
  -2.714008286463884e-11,  2.102168680831470e-13, -1.440554023425174e-15,  2.899331611341017e-18,  2.526068265213691e-19, -9.727121727631984e-21,  2.648429801435471e-22
   };
-  constexpr double w[3456] = {  7.441493760603368e-03, -3.547501698281847e-04,  1.201121122365350e-05, -3.494083608571382e-07,  9.249165628568092e-09,
+  static constexpr double w[3456] = {  7.441493760603368e-03, -3.547501698281847e-04,  1.201121122365350e-05, -3.494083608571382e-07,  9.249165628568092e-09,
  -2.286034790876296e-10,  5.352974278676593e-12, -1.198766022724601e-13,  2.584407605734985e-15, -5.389856102138222e-17,  1.091387444110341e-18, -2.151074966108015e-20,
   2.631924358158544e-02, -2.036242319442095e-03,  1.083542711805162e-04, -4.713659428371970e-06,  1.789353444721994e-07, -6.133591517498334e-09,  1.938199279284525e-10,
  -5.723886164240812e-12,  1.595071521334842e-13, -4.224302184641772e-15,  1.068992384209588e-16, -2.594547674884583e-18,  4.853832194251376e-02, -6.012202586232270e-03,
@@ -1025,51 +1024,5 @@ void BreitRootList::breitroot9(const double* ta, double* rr, double* ww, const i
   3.178868351287572e-29, -8.020299078587966e-31,  1.445935233990443e-13, -1.721423672183475e-15,  1.707929552764321e-17, -1.582326654725464e-19,  1.419582841569566e-21,
  -1.282781829312667e-23,  1.332858822829214e-25, -2.156080702907108e-27,  5.704067767053463e-29, -1.753308406441416e-30,  5.099966565743566e-32, -1.326013360123507e-33
   };
-  int offset = -9;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 9;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 9, 0.5);
-      fill_n(ww+offset, 9, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 9; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t*t*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-      const double t2 = t * 2.0;
-      for (int j=1; j <=9; ++j) {
-        const int boxof = it*108+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<9, 3>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,22 +23,21 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot14(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[14] = {4.329203573977358e-02,3.904209260420317e-01,1.088965867569269e+00,2.147799470582228e+00,3.581028249991773e+00,
+  static constexpr double ax[14] = {4.329203573977358e-02,3.904209260420317e-01,1.088965867569269e+00,2.147799470582228e+00,3.581028249991773e+00,
     5.409112330616467e+00,7.660691115610086e+00,1.037556300977004e+01,1.360971142939024e+01,1.744429447570418e+01,2.200319676691491e+01,2.749204150484384e+01,
     3.430462050937307e+01,4.344926230785205e+01};
-  constexpr double aw[14] = {3.986047178264514e-01,2.825613912593883e-01,1.413946097869548e-01,4.951488928989820e-02,1.196842321435483e-02,
+  static constexpr double aw[14] = {3.986047178264514e-01,2.825613912593883e-01,1.413946097869548e-01,4.951488928989820e-02,1.196842321435483e-02,
     1.957331294408983e-03,2.106181000240331e-04,1.434550422971453e-05,5.857719720992989e-07,1.325682501541725e-08,1.475853168277663e-10,6.639436714909627e-13,
     8.315937951206607e-16,1.140139347903643e-19};
-  constexpr double x[5376] = {  5.863225884460311e-03, -1.008043144465862e-04,  1.296004351984622e-06, -1.475479046909010e-08,  1.567062995589956e-10,
+  static constexpr double x[5376] = {  5.863225884460311e-03, -1.008043144465862e-04,  1.296004351984622e-06, -1.475479046909010e-08,  1.567062995589956e-10,
  -1.588297140384826e-12,  1.553865214556062e-14, -1.476599426091007e-16,  1.367387121887355e-18, -1.235844912295443e-20,  1.090091135956141e-22, -9.371934659193016e-25,
   5.238366777658657e-02, -8.802977803161387e-04,  1.080241163157701e-05, -1.134729482139249e-07,  1.059846526012089e-09, -8.797575471953788e-12,  6.262537735117497e-14,
  -3.370956954774454e-16,  5.188731973816234e-19,  1.921788137313139e-20, -3.654400567239601e-22,  4.494055860999608e-24,  1.433824494455882e-01, -2.300491983769947e-03,
@@ -807,7 +806,7 @@ void ERIRootList::eriroot14(const double* ta, double* rr, double* ww, const int
   4.381333156409121e-15, -8.611613752136531e-17, -6.647019848475184e-19,  7.643401445267253e-20,  1.379184761477971e+00, -1.087389338747985e-02,  7.863594300835491e-05,
  -1.243262856335631e-07, -2.078455753386568e-08,  7.883278228500029e-10, -1.544026319272797e-11,  2.113959545794192e-14,  9.355196829518262e-15, -3.079177887620779e-16,
   3.407625370526820e-18,  9.428817037801971e-20,  };
-  constexpr double w[5376] = {  2.157467298688094e-01, -2.149689809613580e-03,  2.368129152577846e-05, -2.737340226577125e-07,  3.208943944678369e-09,
+  static constexpr double w[5376] = {  2.157467298688094e-01, -2.149689809613580e-03,  2.368129152577846e-05, -2.737340226577125e-07,  3.208943944678369e-09,
  -3.752480879495194e-11,  4.346835796430948e-13, -4.977523498639337e-15,  5.632688491460471e-17, -6.302897884568314e-19,  6.979034356357115e-21, -7.652135770194193e-23,
   2.086247345420539e-01, -4.302884016144076e-03,  9.402451875987304e-05, -1.880879699631911e-06,  3.494863482529493e-08, -6.135692647208846e-10,  1.029077874735242e-11,
  -1.661008422926312e-13,  2.593634845184754e-15, -3.933410747348967e-17,  5.811453111881288e-19, -8.383666918678551e-21,  1.953218825674791e-01, -8.108259105119326e-03,
@@ -1576,52 +1575,5 @@ void ERIRootList::eriroot14(const double* ta, double* rr, double* ww, const int
   4.736194555810428e-31, -2.874318457706006e-31,  1.771056340711729e-32, -4.358853288897373e-34,  2.901297396698598e-20, -1.774104727344730e-22,  7.529195772462301e-24,
  -4.681700187664903e-25,  2.172701437735744e-26, -7.341271474502150e-28,  1.858825353146653e-29, -3.957766506285425e-31,  1.006139791744846e-32, -3.621165805565595e-34,
   1.261954155419310e-35, -3.258335229810454e-37,  };
-  int offset = -14;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 14;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 14, 0.5);
-      fill_n(ww+offset, 14, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 14; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=14; ++j) {
-        const int boxof = it*168+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<14, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,22 +23,21 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot15(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[15] = {4.045270430457533e-02,3.647206450514084e-01,1.016746068857496e+00,2.003718953133924e+00,3.336983205734510e+00,
+  static constexpr double ax[15] = {4.045270430457533e-02,3.647206450514084e-01,1.016746068857496e+00,2.003718953133924e+00,3.336983205734510e+00,
     5.032805277625120e+00,7.113593769729874e+00,9.609817284304444e+00,1.256308236994850e+01,1.603128410807399e+01,2.009778533475592e+01,2.488931247515657e+01,
     3.061571740089946e+01,3.767847178420530e+01,4.710550861821894e+01};
-  constexpr double aw[15] = {3.863948895418138e-01,2.801309308392126e-01,1.467358475408904e-01,5.514417687023432e-02,1.470382970482671e-02,
+  static constexpr double aw[15] = {3.863948895418138e-01,2.801309308392126e-01,1.467358475408904e-01,5.514417687023432e-02,1.470382970482671e-02,
     2.737922473067643e-03,3.483101243186879e-04,2.938725228922982e-05,1.579094887324716e-06,5.108522450775959e-08,9.178580424378688e-10,8.106186297462897e-12,
     2.878607080548789e-14,2.810333602750870e-17,2.908254700131161e-21};
-  constexpr double x[5760] = {  5.131568429400928e-03, -8.256196357589432e-05,  9.936955479904116e-07, -1.059573866833442e-08,  1.054645613946593e-10,
+  static constexpr double x[5760] = {  5.131568429400928e-03, -8.256196357589432e-05,  9.936955479904116e-07, -1.059573866833442e-08,  1.054645613946593e-10,
  -1.002544709169358e-12,  9.207625381239939e-15, -8.223487062409958e-17,  7.167397469311344e-19, -6.107678343465886e-21,  5.090986281287950e-23, -4.148435634707592e-25,
   4.588766276797283e-02, -7.236728143234322e-04,  8.362235640466309e-06, -8.313336325886091e-08,  7.406152200963195e-10, -5.941917138601663e-12,  4.200863740851781e-14,
  -2.433028308194579e-16,  8.421398760459940e-19,  4.242905242923270e-21, -1.283158348374167e-22,  1.714045645343626e-24,  1.258279089059138e-01, -1.905617627561940e-03,
@@ -862,7 +861,7 @@ void ERIRootList::eriroot15(const double* ta, double* rr, double* ww, const int
   2.264186240786660e-16, -4.123145717248839e-18, -1.062696145626486e-19,  1.493705498906698e+00, -1.149432656296143e-02,  5.953321007472419e-05,  1.135454417434610e-06,
  -5.603606126267146e-08,  9.194577133839082e-10,  1.305054579997122e-11, -1.008553227101291e-12,  1.574918110817456e-14,  3.686163332222389e-16, -2.064600498880024e-17,
   2.106963526671675e-19,  };
-  constexpr double w[5760] = {  2.019323539670034e-01, -1.867249031834874e-03,  1.902125520176500e-05, -2.033893032001173e-07,  2.209472206254764e-09,
+  static constexpr double w[5760] = {  2.019323539670034e-01, -1.867249031834874e-03,  1.902125520176500e-05, -2.033893032001173e-07,  2.209472206254764e-09,
  -2.398404028298345e-11,  2.582568085833147e-13, -2.751775069644884e-15,  2.899890755948508e-17, -3.023762405330050e-19,  3.121616446538537e-21, -3.192690820895434e-23,
   1.960668378383492e-01, -3.654605903850788e-03,  7.299831376272402e-05, -1.343208027929166e-06,  2.302405464642503e-08, -3.736442344643607e-10,  5.802449561832829e-12,
  -8.684328687287856e-14,  1.259036934364132e-15, -1.774906045889357e-17,  2.440269138128870e-19, -3.279319041474921e-21,  1.850224804543047e-01, -6.862035127890935e-03,
@@ -1686,52 +1685,5 @@ void ERIRootList::eriroot15(const double* ta, double* rr, double* ww, const int
  -7.862652180177753e-32,  8.974901040141753e-34, -2.801396350746910e-37,  7.749230116032913e-22, -1.126353689467915e-23,  8.056298712234824e-25, -4.655894191712934e-26,
   1.947049472971234e-27, -6.609859518949019e-29,  2.174304110346982e-30, -7.703680837611342e-32,  2.676015711168752e-33, -8.063007941548732e-35,  2.105280893968042e-36,
  -5.464867427415361e-38,  };
-  int offset = -15;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 15;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 15, 0.5);
-      fill_n(ww+offset, 15, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 15; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=15; ++j) {
-        const int boxof = it*180+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<15, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,22 +23,21 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot16(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[16] = {3.796291457531356e-02,3.422001560109479e-01,9.535531553908649e-01,1.877931507696073e+00,3.124601050702144e+00,
+  static constexpr double ax[16] = {3.796291457531356e-02,3.422001560109479e-01,9.535531553908649e-01,1.877931507696073e+00,3.124601050702144e+00,
     4.706726707667587e+00,6.642215179741441e+00,8.955001337723402e+00,1.167703367397597e+01,1.485143134180125e+01,1.853774317860670e+01,2.282130069352524e+01,
     2.783143821132866e+01,3.378197048822615e+01,4.108166652549124e+01,5.077722387753705e+01};
-  constexpr double aw[16] = {3.752383525928021e-01,2.774581423025299e-01,1.512697340766425e-01,6.045813095591287e-02,1.755342883157343e-02,
+  static constexpr double aw[16] = {3.752383525928021e-01,2.774581423025299e-01,1.512697340766425e-01,6.045813095591287e-02,1.755342883157343e-02,
     3.654890326654414e-03,5.362683655279714e-04,5.416584061819941e-05,3.650585129562365e-06,1.574167792545599e-07,4.098832164770895e-09,5.933291463396627e-11,
     4.215010211326526e-13,1.197344017092839e-15,9.231736536518329e-19,7.310676427384286e-23};
-  constexpr double x[6144] = {  4.528762093298874e-03, -6.846711148975946e-05,  7.745664694601187e-07, -7.766208948540965e-09,  7.272421585141476e-11,
+  static constexpr double x[6144] = {  4.528762093298874e-03, -6.846711148975946e-05,  7.745664694601187e-07, -7.766208948540965e-09,  7.272421585141476e-11,
  -6.507899924577577e-13,  5.630966140888772e-15, -4.742309608121141e-17,  3.901989162694675e-19, -3.143347320128412e-21,  2.481232111457460e-23, -1.918963285777795e-25,
   4.052708998532357e-02, -6.019704814112580e-04,  6.569739787519514e-06, -6.193910974862438e-08,  5.265115471814889e-10, -4.070740339606129e-12,  2.825678680470423e-14,
  -1.682145150807782e-16,  7.352964823986329e-19, -3.168489292281945e-22, -4.225753800670852e-23,  6.510227937825918e-25,  1.112941168521492e-01, -1.595095779912797e-03,
@@ -917,7 +916,7 @@ void ERIRootList::eriroot16(const double* ta, double* rr, double* ww, const int
   8.779266669587334e-18,  5.660495869870388e-20,  1.604139704453321e+00, -1.145836894269916e-02,  4.257823290429704e-06,  2.904802548559528e-06, -5.196113695184905e-08,
  -1.012211165174755e-09,  5.403272471971107e-11, -1.246594501787857e-14, -4.263553526509180e-14,  5.719557543056236e-16,  2.733640259818529e-17, -8.058700472158450e-19,
   };
-  constexpr double w[6144] = {  1.897754325036586e-01, -1.636718442580110e-03,  1.549818144551287e-05, -1.540646544283416e-07,  1.558284450423197e-09,
+  static constexpr double w[6144] = {  1.897754325036586e-01, -1.636718442580110e-03,  1.549818144551287e-05, -1.540646544283416e-07,  1.558284450423197e-09,
  -1.577383732941935e-11,  1.585882732737436e-13, -1.579242805916153e-15,  1.556510652443644e-17, -1.518811302750803e-19,  1.468024781131584e-21, -1.406364682193309e-23,
   1.848882153418306e-01, -3.136040135641431e-03,  5.757692430722057e-05, -9.795445999485795e-07,  1.556576755715502e-08, -2.346068248215513e-10,  3.388703177507772e-12,
  -4.723461932059342e-14,  6.385054141894570e-16, -8.401472447423508e-18,  1.079161388277186e-19, -1.356112063420470e-21,  1.756239953884898e-01, -5.860675035412515e-03,
@@ -1796,52 +1795,5 @@ void ERIRootList::eriroot16(const double* ta, double* rr, double* ww, const int
   2.491090763845472e-34, -6.790322444405149e-36,  2.331427429317055e-23, -9.519611715243083e-25,  7.743950426129204e-26, -4.543500954095740e-27,  2.184137640133688e-28,
  -9.734883079345340e-30,  4.122761082657208e-31, -1.606874095111913e-32,  5.738539936550815e-34, -1.935820095066170e-35,  6.276684971188242e-37, -1.922394789084812e-38,
   };
-  int offset = -16;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 16;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 16, 0.5);
-      fill_n(ww+offset, 16, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 16; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=16; ++j) {
-        const int boxof = it*192+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<16, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
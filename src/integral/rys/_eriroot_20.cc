@@ -23,24 +23,23 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot20(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[20] = {3.046323927948253e-02,2.744447157928503e-01,7.638875584439140e-01,1.501801497668106e+00,2.492830145121370e+00,
+  static constexpr double ax[20] = {3.046323927948253e-02,2.744447157928503e-01,7.638875584439140e-01,1.501801497668106e+00,2.492830145121370e+00,
     3.743418041216293e+00,5.262055853788349e+00,7.059627735741558e+00,9.149898312030656e+00,1.155019828644284e+01,1.428240368521040e+01,1.737436697519908e+01,
     2.086207518543782e+01,2.479303989246347e+01,2.923191015709341e+01,3.427042892503958e+01,4.004681579024558e+01,4.678884639212502e+01,5.493155562102061e+01,
     6.558993199063974e+01};
-  constexpr double aw[20] = {3.386432774255900e-01,2.657282518773771e-01,1.633787327132713e-01,7.847460586540446e-02,2.931256553617237e-02,
+  static constexpr double aw[20] = {3.386432774255900e-01,2.657282518773771e-01,1.633787327132713e-01,7.847460586540446e-02,2.931256553617237e-02,
     8.460888008258097e-03,1.871496829597982e-03,3.138535945413305e-04,3.936933981092488e-05,3.631576150693002e-06,2.411144163670552e-07,1.121236083227565e-08,
     3.525620791365528e-10,7.156528052690270e-12,8.805707645216158e-14,6.008358789490948e-16,1.989181012116456e-18,2.567593365411567e-21,8.544056963775383e-25,
     2.591043713847118e-29};
-  constexpr double x[7680] = {  2.934473439558871e-03, -3.573508586948995e-05,  3.258966628330927e-07, -2.636853771472591e-09,  1.995245283177864e-11,
+  static constexpr double x[7680] = {  2.934473439558871e-03, -3.573508586948995e-05,  3.258966628330927e-07, -2.636853771472591e-09,  1.995245283177864e-11,
  -1.445121416712311e-13,  1.014041035772519e-15, -6.942155136312800e-18,  4.656450777409809e-20, -3.068293222095214e-22,  1.989317669239406e-24, -1.270123387830068e-26,
   2.631182300747988e-02, -3.167555042529075e-04,  2.822346969331323e-06, -2.195225182029967e-08,  1.562821147471952e-10, -1.035103707819503e-12,  6.391061886037619e-15,
  -3.644088687692954e-17,  1.867748931170394e-19, -8.009152604268712e-22,  2.156261145231332e-24,  6.521801961979763e-27,  7.254344219992115e-02, -8.533351418241553e-04,
@@ -1138,7 +1137,7 @@ void ERIRootList::eriroot20(const double* ta, double* rr, double* ww, const int
   3.298551668440374e-14, -7.893747766838760e-17, -2.046104135499676e-17, -2.746149689646766e-19,  3.023538717534430e-21,  1.889435626975621e+00, -4.222143235418200e-03,
  -9.248549237354549e-05, -1.046919839502015e-06,  7.235876875777122e-09,  5.591743030851936e-10,  9.427924993309305e-12, -3.500598039865958e-14, -5.141792622386859e-15,
  -1.033320633646997e-16,  3.823079202397615e-21,  4.911276572728297e-20,  };
-  constexpr double w[7680] = {  1.529206004707937e-01, -1.037943029039419e-03,  7.645172861035773e-06, -5.907109737408723e-08,  4.662989538825228e-10,
+  static constexpr double w[7680] = {  1.529206004707937e-01, -1.037943029039419e-03,  7.645172861035773e-06, -5.907109737408723e-08,  4.662989538825228e-10,
  -3.701651114025197e-12,  2.930668557512846e-14, -2.305526830245033e-16,  1.799574041137816e-18, -1.393330802754416e-20,  1.070300461460584e-22, -8.160025423030863e-25,
   1.503351540737381e-01, -1.846614058201295e-03,  2.529533342856384e-05, -3.276871780593868e-07,  4.001427979559353e-09, -4.661442210939976e-11,  5.228430286477518e-13,
  -5.682030691714457e-15,  6.009813231707088e-17, -6.207232658577818e-19,  6.276914634175757e-21, -6.226887195594441e-23,  1.453444371683174e-01, -3.366061251501729e-03,
@@ -2236,52 +2235,5 @@ void ERIRootList::eriroot20(const double* ta, double* rr, double* ww, const int
  -3.946479446133409e-32,  1.549811068358469e-33, -5.603229800587370e-35,  1.880806552406861e-36, -5.896057615332871e-38,  1.820835237256158e-27, -5.455993212750949e-28,
   9.047842264085159e-29, -1.060899963558571e-29,  9.737397270277954e-31, -7.393737920188352e-32,  4.808177174533196e-33, -2.742052645579624e-34,  1.395138368042193e-35,
  -6.416113320379756e-37,  2.694562265669582e-38, -1.040720993389087e-39,  };
-  int offset = -20;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 20;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 20, 0.5);
-      fill_n(ww+offset, 20, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 20; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=20; ++j) {
-        const int boxof = it*240+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<20, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,24 +23,23 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot21(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[21] = {2.902954393638768e-02,2.615043070821524e-01,7.277333883436495e-01,1.430315045933035e+00,2.373247472831900e+00,
+  static constexpr double ax[21] = {2.902954393638768e-02,2.615043070821524e-01,7.277333883436495e-01,1.430315045933035e+00,2.373247472831900e+00,
     3.562058392635709e+00,5.003993562818670e+00,6.708280631012666e+00,8.686493482580042e+00,1.095305565041351e+01,1.352594301137335e+01,1.642768238791604e+01,
     1.968680665832298e+01,2.334004538823930e+01,2.743576281852024e+01,3.203964794798858e+01,3.724480661526604e+01,4.319140970101193e+01,5.011037036408683e+01,
     5.844271163828623e+01,6.931910199140093e+01};
-  constexpr double aw[21] = {3.310489138908577e-01,2.627389067822954e-01,1.652880012746675e-01,8.221126930329362e-02,3.220210128890780e-02,
+  static constexpr double aw[21] = {3.310489138908577e-01,2.627389067822954e-01,1.652880012746675e-01,8.221126930329362e-02,3.220210128890780e-02,
     9.879524053188518e-03,2.357161394596322e-03,4.334122717212564e-04,6.071962107788308e-05,6.390245967735531e-06,4.963659393579919e-07,2.783471526549022e-08,
     1.095805228807822e-09,2.921728837233345e-11,5.032705582183915e-13,5.253337715568679e-15,3.035890347810675e-17,8.482152080085886e-20,9.177890695692633e-23,
     2.527869864053624e-26,6.167858925810823e-31};
-  constexpr double x[8064] = {  2.667941270798570e-03, -3.098219073957002e-05,  2.694799056576616e-07, -2.079871601760156e-09,  1.501578669284640e-11,
+  static constexpr double x[8064] = {  2.667941270798570e-03, -3.098219073957002e-05,  2.694799056576616e-07, -2.079871601760156e-09,  1.501578669284640e-11,
  -1.037945120064053e-13,  6.953212153464726e-16, -4.546217195906155e-18,  2.913625284617119e-20, -1.835391519729702e-22,  1.138316701534654e-24, -6.957583824482578e-27,
   2.392992177880591e-02, -2.750016962388864e-04,  2.341901351232219e-06, -1.743907424204795e-08,  1.191424142827327e-10, -7.598085261193838e-13,  4.539743871904534e-15,
  -2.525604784832467e-17,  1.283169955597460e-19, -5.673099515867205e-22,  1.872540978008852e-24, -7.653118504744724e-28,  6.602042022698942e-02, -7.429032178495746e-04,
@@ -1193,7 +1192,7 @@ void ERIRootList::eriroot21(const double* ta, double* rr, double* ww, const int
   4.646247279278627e-16,  1.890182819649594e-19, -1.661584110277126e-19, -2.335126203200188e-21,  1.918511850247442e+00, -2.896266311462068e-03, -6.464400721194813e-05,
  -9.534706959997247e-07, -5.489330575551613e-09,  1.612458674303207e-10,  5.735920461904769e-12,  8.286961240704915e-14, -6.196143862063820e-17, -3.250969682802657e-17,
  -7.862255494949642e-19, -7.307161353159303e-21,  };
-  constexpr double w[8064] = {  1.458360194812409e-01, -9.396229347619806e-04,  6.553270989324980e-06, -4.792477532464067e-08,  3.583088890740087e-10,
+  static constexpr double w[8064] = {  1.458360194812409e-01, -9.396229347619806e-04,  6.553270989324980e-06, -4.792477532464067e-08,  3.583088890740087e-10,
  -2.696511538001052e-12,  2.025616974580649e-14, -1.513002432952851e-16,  1.121882773374831e-18, -8.255030797269369e-21,  6.028387981998798e-23, -4.370593492012882e-25,
   1.435889568470841e-01, -1.644943661749971e-03,  2.113052034597510e-05, -2.578430758300635e-07,  2.971689870432337e-09, -3.271315580682931e-11,  3.470493913670268e-13,
  -3.570155411489491e-15,  3.576954061668617e-17, -3.501813374210291e-19,  3.358399801393902e-21, -3.161410127704544e-23,  1.392379736414512e-01, -2.977646519605426e-03,
@@ -2346,52 +2345,5 @@ void ERIRootList::eriroot21(const double* ta, double* rr, double* ww, const int
   5.674074942795015e-34, -2.192029668539486e-35,  7.817196099276115e-37, -2.590240790961868e-38,  5.926223565246950e-28, -2.012715627321537e-28,  3.699376881831253e-29,
  -4.724756940470262e-30,  4.661239864382756e-31, -3.765145510296205e-32,  2.583229530266981e-33, -1.543795406982451e-34,  8.185210424782363e-36, -3.904266070423698e-37,
   1.693851431218200e-38, -6.734865213361414e-40,  };
-  int offset = -21;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 21;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 21, 0.5);
-      fill_n(ww+offset, 21, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 21; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=21; ++j) {
-        const int boxof = it*252+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<21, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,24 +23,23 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot22(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[22] = {2.772473659127682e-02,2.497302810882349e-01,6.948552179522746e-01,1.365358277686830e+00,2.264707258937521e+00,
+  static constexpr double ax[22] = {2.772473659127682e-02,2.497302810882349e-01,6.948552179522746e-01,1.365358277686830e+00,2.264707258937521e+00,
     3.397680865752056e+00,4.770515676273487e+00,6.391109747809455e+00,8.269300130906052e+00,1.041724021458193e+01,1.284991631425293e+01,1.558586475749591e+01,
     1.864818751747483e+01,2.206602920267685e+01,2.587679811930160e+01,3.012964996496447e+01,3.489125211513239e+01,4.025600692910713e+01,4.636595735293852e+01,
     5.345504450454067e+01,6.197009133480717e+01,7.305697947972854e+01};
-  constexpr double aw[22] = {3.239426288419958e-01,2.597733961158877e-01,1.668671658256460e-01,8.567018730024628e-02,3.503375710968701e-02,
+  static constexpr double aw[22] = {3.239426288419958e-01,2.597733961158877e-01,1.668671658256460e-01,8.567018730024628e-02,3.503375710968701e-02,
     1.135786693907002e-02,2.901293775296623e-03,5.794204327156650e-04,8.959797364061745e-05,1.060017177251762e-05,9.454538542285627e-07,6.242724506281515e-08,
     2.983121019039563e-09,1.002600077890922e-10,2.284807897122037e-12,3.365035612792274e-14,3.001521402980671e-16,1.479409975817158e-18,3.512144955836503e-21,
     3.207221691904951e-24,7.362126104297159e-28,1.456115308176244e-32};
-  constexpr double x[8448] = {  2.436135707445798e-03, -2.703596612057743e-05,  2.247559280844219e-07, -1.658217083177863e-09,  1.144610141110474e-11,
+  static constexpr double x[8448] = {  2.436135707445798e-03, -2.703596612057743e-05,  2.247559280844219e-07, -1.658217083177863e-09,  1.144610141110474e-11,
  -7.566412118772039e-14,  4.848749855169289e-16, -3.033656875417933e-18,  1.861191931354629e-20, -1.122856675051252e-22,  6.673127873844494e-25, -3.910844243808119e-27,
   2.185708864482767e-02, -2.402605287034787e-04,  1.959153369763240e-06, -1.398989786996265e-08,  9.183903208438493e-11, -5.643607849223201e-13,  3.262596102213224e-15,
  -1.767692957770119e-17,  8.849782076212354e-20, -3.956950302041247e-22,  1.439116124958308e-24, -2.689887814776742e-27,  6.033675532481639e-02, -6.506157023237718e-04,
@@ -1248,7 +1247,7 @@ void ERIRootList::eriroot22(const double* ta, double* rr, double* ww, const int
   4.612901547494190e-18,  4.911478527653424e-21, -1.184838993931390e-21,  1.938359385017260e+00, -2.005713543091594e-03, -4.332548921492769e-05, -6.908746819403996e-07,
  -7.194275534463136e-09, -3.671782161337188e-12,  1.838462640786066e-12,  4.626525127207013e-14,  6.061506602137537e-16,  1.213692407113386e-18, -1.533582589211082e-19,
  -4.196332201399684e-21,  };
-  constexpr double w[8448] = {  1.393777385277624e-01, -8.545903814310904e-04,  5.658593453286651e-06, -3.926980550408135e-08,  2.787749128169556e-10,
+  static constexpr double w[8448] = {  1.393777385277624e-01, -8.545903814310904e-04,  5.658593453286651e-06, -3.926980550408135e-08,  2.787749128169556e-10,
  -1.993718629401039e-12,  1.424389166535677e-14, -1.012508548146776e-16,  7.148447150891370e-19, -5.010224244195455e-21,  3.486182223199134e-23, -2.408875418155837e-25,
   1.374125921751643e-01, -1.473380789861621e-03,  1.780116908408771e-05, -2.051658048205381e-07,  2.237651741534877e-09, -2.333673646901052e-11,  2.347534318219663e-13,
  -2.291551202976727e-15,  2.180011064775002e-17, -2.027650410919335e-19,  1.848483888559706e-21, -1.654856605866380e-23,  1.335971596456867e-01, -2.648302891983577e-03,
@@ -2456,52 +2455,5 @@ void ERIRootList::eriroot22(const double* ta, double* rr, double* ww, const int
  -9.743343683562163e-36,  3.657993389848086e-37, -1.270452052230930e-38,  2.562246697646556e-28, -9.392678963364353e-29,  1.847415525849435e-29, -2.500990820692546e-30,
   2.594663859935151e-31, -2.189702361608725e-32,  1.561210249213569e-33, -9.652523841394166e-35,  5.274678702752859e-36, -2.584797328093578e-37,  1.148911831568859e-38,
  -4.668841990317120e-40,  };
-  int offset = -22;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 22;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 22, 0.5);
-      fill_n(ww+offset, 22, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 22; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=22; ++j) {
-        const int boxof = it*264+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<22, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
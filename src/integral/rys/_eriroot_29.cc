@@ -23,26 +23,25 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot29(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[29] = {2.108939509820528e-02,1.898958839897566e-01,5.279975615038072e-01,1.036379651913351e+00,1.716539858419621e+00,
+  static constexpr double ax[29] = {2.108939509820528e-02,1.898958839897566e-01,5.279975615038072e-01,1.036379651913351e+00,1.716539858419621e+00,
     2.570513078602510e+00,3.600905885617244e+00,4.810942229512131e+00,6.204522378750385e+00,7.786297858454517e+00,9.561766127672030e+00,1.153739008940822e+01,
     1.372074942079911e+01,1.612073342103771e+01,1.874778903887881e+01,2.161424367541841e+01,2.473473146698531e+01,2.812676613508207e+01,3.181152693122955e+01,
     3.581496382885539e+01,4.016939799514068e+01,4.491592313790842e+01,5.010816840756123e+01,5.581852415111124e+01,6.214918909678898e+01,6.925369922799511e+01,
     7.738485097617951e+01,8.702589218231859e+01,9.941861090776851e+01};
-  constexpr double aw[29] = {2.843997053142649e-01,2.403980521953700e-01,1.716819278930999e-01,1.034872325933194e-01,5.257437408931641e-02,
+  static constexpr double aw[29] = {2.843997053142649e-01,2.403980521953700e-01,1.716819278930999e-01,1.034872325933194e-01,5.257437408931641e-02,
     2.246531415827838e-02,8.053458274756885e-03,2.414345454729693e-03,6.029606131367349e-04,1.248689305564107e-04,2.132733945420083e-05,2.985130609178755e-06,
     3.398474532453084e-07,3.119524657171614e-08,2.285076676629938e-09,1.319601105882511e-10,5.921777385428942e-12,2.029740224794918e-13,5.204271646572515e-15,
     9.730521835512161e-17,1.285264502254630e-18,1.151965104988007e-20,6.648027661502612e-23,2.301802977748063e-25,4.328835598816510e-28,3.810330373842877e-31,
     1.230286865040881e-34,9.182452610065772e-39,4.934542797516668e-44};
-  constexpr double x[11136] = {  1.417364511095090e-03, -1.200320178142514e-05,  7.618395507811085e-08, -4.294150311585067e-10,  2.266458027860906e-12,
+  static constexpr double x[11136] = {  1.417364511095090e-03, -1.200320178142514e-05,  7.618395507811085e-08, -4.294150311585067e-10,  2.266458027860906e-12,
  -1.146773746891119e-14,  5.631806294569002e-17, -2.704160423449783e-19,  1.275343664497885e-21, -5.925982397526913e-24,  2.718499008429655e-26, -1.232967835445120e-28,
   1.273297585545165e-02, -1.072311306644879e-04,  6.729873522578099e-07, -3.722313036139264e-09,  1.908956506889702e-11, -9.269720376913319e-14,  4.302054295540335e-16,
  -1.914620011358365e-18,  8.164127650356501e-21, -3.318637985859985e-23,  1.271695556739849e-25, -4.489949061307563e-28,  3.524014775459197e-02, -2.934702699939603e-04,
@@ -1634,7 +1633,7 @@ void ERIRootList::eriroot29(const double* ta, double* rr, double* ww, const int
   1.487070064783467e-20, -2.059706482671989e-22, -4.340580534465791e-24,  1.984356392188175e+00, -2.823880629101205e-04, -3.748966012508227e-06, -4.310803729328826e-08,
  -4.493091885425017e-10, -4.301060539472435e-12, -3.767295835243873e-14, -2.953706503231919e-16, -1.949261431220846e-18, -8.635505902169692e-21,  1.833055526311060e-23,
   1.073261673935421e-24,  };
-  constexpr double w[11136] = {  1.063836572841200e-01, -4.869046261213738e-04,  2.374441811859850e-06, -1.208990816926404e-08,  6.309853881180461e-11,
+  static constexpr double w[11136] = {  1.063836572841200e-01, -4.869046261213738e-04,  2.374441811859850e-06, -1.208990816926404e-08,  6.309853881180461e-11,
  -3.331376066277471e-13,  1.764520028949794e-15, -9.332609155931073e-18,  4.916794111234479e-20, -2.577403355132908e-22,  1.343759203775844e-24, -6.967626343720804e-27,
   1.055019539276795e-01, -7.688600818952996e-04,  6.452888055595905e-06, -5.295115118439368e-08,  4.159485949137252e-10, -3.144633877568304e-12,  2.303905129271289e-14,
  -1.644395455809554e-16,  1.147759622978411e-18, -7.856584862752756e-21,  5.285794064936245e-23, -3.501265585708918e-25,  1.037692355028620e-01, -1.315874340708110e-03,
@@ -3226,52 +3225,5 @@ void ERIRootList::eriroot29(const double* ta, double* rr, double* ww, const int
  -3.542838704416056e-37,  1.594125424402720e-38, -6.541730238708368e-40,  1.747001816766234e-29, -7.415599943864676e-30,  1.684343579616558e-30, -2.600897839266685e-31,
   3.039786298650448e-32, -2.857808154218043e-33,  2.247535338688015e-34, -1.519554033385091e-35,  9.011286892851764e-37, -4.759989064303263e-38,  2.267042254492196e-39,
  -9.817419126218389e-41,  };
-  int offset = -29;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 29;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 29, 0.5);
-      fill_n(ww+offset, 29, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 29; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=29; ++j) {
-        const int boxof = it*348+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<29, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
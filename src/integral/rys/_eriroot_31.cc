@@ -23,26 +23,25 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot31(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[31] = {1.973961619317818e-02,1.777314270714174e-01,4.941155764894072e-01,9.696987316449983e-01,1.605705114098536e+00,
+  static constexpr double ax[31] = {1.973961619317818e-02,1.777314270714174e-01,4.941155764894072e-01,9.696987316449983e-01,1.605705114098536e+00,
     2.403794111724268e+00,3.366084710314292e+00,4.495187636816266e+00,5.794246436988960e+00,7.266989129559398e+00,8.917792624474627e+00,1.075176281839592e+01,
     1.277483426484725e+01,1.499389467681596e+01,1.741694143510619e+01,2.005328002532177e+01,2.291377835512352e+01,2.601119694024908e+01,2.936062422099912e+01,
     3.298006091817217e+01,3.689122121747779e+01,4.112065894699022e+01,4.570139813115516e+01,5.067537937066850e+01,5.609729355498452e+01,6.204092566265864e+01,
     6.861041363445379e+01,7.596219511656251e+01,8.435387463479354e+01,9.427804196974294e+01,1.070011389901059e+02};
-  constexpr double aw[31] = {2.755176345713133e-01,2.354014137664905e-01,1.717735112789321e-01,1.069655603592892e-01,5.677355644112947e-02,
+  static constexpr double aw[31] = {2.755176345713133e-01,2.354014137664905e-01,1.717735112789321e-01,1.069655603592892e-01,5.677355644112947e-02,
     2.564184454466973e-02,9.834282267149455e-03,3.194510495128344e-03,8.761600412960132e-04,2.021521799945729e-04,3.906693268870992e-05,6.291925684128613e-06,
     8.395636881833487e-07,9.218573733578959e-08,8.263864761851688e-09,5.992692864265347e-10,3.477943758772892e-11,1.595214880176060e-12,5.697094988418945e-14,
     1.556417651227674e-15,3.183888774771905e-17,4.751303844123422e-19,5.007373932494541e-21,3.576785299957721e-23,1.641411635392467e-25,4.502923907452466e-28,
     6.672511095938867e-31,4.588857404397464e-34,1.142402896672514e-37,6.427456967173713e-42,2.483713818053586e-47};
-  constexpr double x[11904] = {  1.243124640927281e-03, -9.860037795878258e-06,  5.861805125465705e-08, -3.095141657198346e-10,  1.530557625643881e-12,
+  static constexpr double x[11904] = {  1.243124640927281e-03, -9.860037795878258e-06,  5.861805125465705e-08, -3.095141657198346e-10,  1.530557625643881e-12,
  -7.256946536399372e-15,  3.340320651078955e-17, -1.503630014260189e-19,  6.650035004499973e-22, -2.898555378676712e-24,  1.247759255533868e-26, -5.312649906008030e-29,
   1.117015628884473e-02, -8.816470558478981e-05,  5.189984157556771e-07, -2.695392801148270e-09,  1.299769934653964e-11, -5.945498764940261e-14,  2.605435117750911e-16,
  -1.098366167007666e-18,  4.456087320494778e-21, -1.734680442877953e-23,  6.433234912406189e-26, -2.240891836868218e-28,  3.092856891070726e-02, -2.417278938202756e-04,
@@ -1743,7 +1742,7 @@ void ERIRootList::eriroot31(const double* ta, double* rr, double* ww, const int
  -4.925287471102648e-10, -2.159806924732138e-12,  7.578563524825497e-16,  1.393971035472137e-16,  1.737707914710736e-18,  1.326701750490512e-20,  5.369842417136012e-23,
  -2.426846577523171e-25,  1.988079139315417e+00, -1.888871790414948e-04, -2.214019153701129e-06, -2.265378038231379e-08, -2.123374749678108e-10, -1.855247856697735e-12,
  -1.517003999781944e-14, -1.154207307620911e-16, -8.023234930207969e-19, -4.870608994309646e-21, -2.249486213132824e-23, -2.426394552936815e-26,  };
-  constexpr double w[11904] = {  9.964180390584942e-02, -4.251622103985195e-04,  1.927058293492784e-06, -9.109276689406448e-09,  4.414521133468208e-11,
+  static constexpr double w[11904] = {  9.964180390584942e-02, -4.251622103985195e-04,  1.927058293492784e-06, -9.109276689406448e-09,  4.414521133468208e-11,
  -2.165812840341808e-13,  1.066949609243325e-15, -5.252822317892589e-18,  2.577731721932260e-20, -1.259329211035298e-22,  6.121643156161875e-25, -2.960565365022364e-27,
   9.891606682569437e-02, -6.579401455417181e-04,  5.057502728470036e-06, -3.822856116017707e-08,  2.774110937154007e-10, -1.940405768488277e-12,  1.316683624581552e-14,
  -8.711360925970733e-17,  5.640445028511249e-19, -3.583966004656302e-21,  2.239572198779134e-23, -1.378609450963613e-25,  9.748684595038291e-02, -1.111221629300186e-03,
@@ -3444,52 +3443,5 @@ void ERIRootList::eriroot31(const double* ta, double* rr, double* ww, const int
   1.662506882756082e-31, -1.493216032318463e-32,  1.124275805813807e-33, -7.291843887998980e-35,  4.156247529081690e-36, -2.114023791263830e-37,  9.711951795545573e-39,
  -4.063864823639906e-40,  1.194385124437029e-29, -5.121418167540045e-30,  1.175939919421601e-30, -1.835097744589135e-31,  2.166455550720930e-32, -2.056299835241464e-33,
   1.631877675986293e-34, -1.112800125869182e-35,  6.652929119339779e-37, -3.541401610967665e-38,  1.699035608124711e-39, -7.408798745292224e-41,  };
-  int offset = -31;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 31;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 31, 0.5);
-      fill_n(ww+offset, 31, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 31; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=31; ++j) {
-        const int boxof = it*372+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<31, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
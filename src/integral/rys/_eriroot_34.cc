@@ -23,28 +23,27 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot34(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[34] = {1.801053644969250e-02,1.621516966698450e-01,4.507380497098007e-01,8.843812021582210e-01,1.464007517495656e+00,
+  static constexpr double ax[34] = {1.801053644969250e-02,1.621516966698450e-01,4.507380497098007e-01,8.843812021582210e-01,1.464007517495656e+00,
     2.190869145981500e+00,3.066559223223048e+00,4.093031692818531e+00,5.272626367745129e+00,6.608100040485690e+00,8.102664697177419e+00,9.760034205338282e+00,
     1.158448125449669e+01,1.358090687198238e+01,1.575492556667695e+01,1.811297015176490e+01,2.066242168346788e+01,2.341177190969444e+01,2.637082843649360e+01,
     2.955097694782022e+01,3.296552100347061e+01,3.663012945211139e+01,4.056343652613128e+01,4.478786419551375e+01,4.933077780921393e+01,5.422615918504088e+01,
     5.951711695224103e+01,6.525982111013776e+01,7.153001519315002e+01,7.843457727098679e+01,8.613406319080192e+01,9.489292108600368e+01,1.052170586202571e+02,
     1.184080812072897e+02};
-  constexpr double aw[34] = {2.636273560096423e-01,2.283596414733269e-01,1.712956270459728e-01,1.112008383126223e-01,6.241746079469111e-02,
+  static constexpr double aw[34] = {2.636273560096423e-01,2.283596414733269e-01,1.712956270459728e-01,1.112008383126223e-01,6.241746079469111e-02,
     3.025531101024893e-02,1.264471987172237e-02,4.547663268612475e-03,1.404211216213101e-03,3.712410471417878e-04,8.376792857109031e-05,1.607315423292878e-05,
     2.611496537603586e-06,3.575499301869167e-07,4.102331977604315e-08,3.919304831885386e-09,3.095298692877011e-10,2.003858788064466e-11,1.053163064708414e-12,
     4.443309388480383e-14,1.485249432153070e-15,3.873151690251420e-17,7.736213277543244e-19,1.157724753504370e-20,1.263594599711377e-22,9.728365817769475e-25,
     5.064526367985621e-27,1.687406073044250e-29,3.341517852475098e-32,3.543956863668978e-35,1.722545746682900e-38,2.972364265567055e-42,1.121792517702707e-46,
     2.717006711672789e-52};
-  constexpr double x[13056] = {  1.036357832424877e-03, -7.506006823925807e-06,  4.075137210013641e-08, -1.965305650535716e-10,  8.877957084251273e-13,
+  static constexpr double x[13056] = {  1.036357832424877e-03, -7.506006823925807e-06,  4.075137210013641e-08, -1.965305650535716e-10,  8.877957084251273e-13,
  -3.846099201872822e-15,  1.617947681509891e-17, -6.658088754511806e-20,  2.692812222547824e-22, -1.073735003118264e-24,  4.230204806606288e-27, -1.649159424540855e-29,
   9.314700006537750e-03, -6.718799392343269e-05,  3.617880099191953e-07, -1.720879189691014e-09,  7.612931680772328e-12, -3.201453456975368e-14,  1.293270691041556e-16,
  -5.043603327830998e-19,  1.901948523203267e-21, -6.928325888548613e-24,  2.428773338187763e-26, -8.131338248020124e-29,  2.580470603795042e-02, -1.846123517631499e-04,
@@ -1910,7 +1909,7 @@ void ERIRootList::eriroot34(const double* ta, double* rr, double* ww, const int
   1.520886585581352e-19,  2.250503171059233e-19,  2.640452067719723e-21,  2.046069643875805e-23,  1.134162067029186e-25,  1.991600562918319e+00, -1.122438203450082e-04,
  -1.115106872245798e-06, -9.734498100491093e-09, -7.851990815676024e-11, -5.971773518012028e-13, -4.318174591675345e-15, -2.974038641233144e-17, -1.944236592524935e-19,
  -1.194649430638739e-21, -6.755144427771475e-24, -3.347729099773644e-26,  };
-  constexpr double w[13056] = {  9.099105119343424e-02, -3.524116160728746e-04,  1.443987155499555e-06, -6.160241104054297e-09,  2.694442244445778e-11,
+  static constexpr double w[13056] = {  9.099105119343424e-02, -3.524116160728746e-04,  1.443987155499555e-06, -6.160241104054297e-09,  2.694442244445778e-11,
  -1.194174656852010e-13,  5.320435643709383e-16, -2.371478988332509e-18,  1.054594370468437e-20, -4.672301372866182e-23,  2.060931073595905e-25, -9.048687685878135e-28,
   9.043718742017449e-02, -5.307343094226954e-04,  3.612865491589515e-06, -2.437159737600917e-08,  1.584676264509986e-10, -9.953043635737092e-13,  6.073055767047627e-15,
  -3.617117384550536e-17,  2.110383216162722e-19, -1.209364523399848e-21,  6.820889999660501e-24, -3.792360490359957e-26,  8.934369705140911e-02, -8.795091313932533e-04,
@@ -3776,52 +3775,5 @@ void ERIRootList::eriroot34(const double* ta, double* rr, double* ww, const int
  -3.812655427526772e-35,  2.224289498613986e-36, -1.156506877691181e-37,  5.424741151358972e-39, -2.314964607538126e-40,  7.591587452082937e-30, -3.286325259873907e-30,
   7.624383023811517e-31, -1.202011169578628e-31,  1.433087062089749e-32, -1.373113056815770e-33,  1.099580525237432e-34, -7.563177012490842e-36,  4.559147955466018e-37,
  -2.446100962250279e-38,  1.182451923527918e-39, -5.193542609856089e-41,  };
-  int offset = -34;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 34;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 34, 0.5);
-      fill_n(ww+offset, 34, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 34; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=34; ++j) {
-        const int boxof = it*408+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<34, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,28 +23,27 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot38(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[38] = {1.612702673482496e-02,1.451840623965648e-01,4.035162716683504e-01,7.915619649204380e-01,1.309983739894890e+00,
+  static constexpr double ax[38] = {1.612702673482496e-02,1.451840623965648e-01,4.035162716683504e-01,7.915619649204380e-01,1.309983739894890e+00,
     1.959674771052835e+00,2.741767419118650e+00,3.657644364770256e+00,4.708952537591409e+00,5.897620190977973e+00,7.225877569992459e+00,8.696281737817396e+00,
     1.031174627493858e+01,1.207557675358126e+01,1.399151313203277e+01,1.606378052849600e+01,1.829715024902810e+01,2.069701349751276e+01,2.326947094342735e+01,
     2.602144234786216e+01,2.896080187349915e+01,3.209654671911066e+01,3.543900961869141e+01,3.900013000089935e+01,4.279380498833236e+01,4.683635123034369e+01,
     5.114712407453766e+01,5.574936588427845e+01,6.067139810983177e+01,6.594834725083705e+01,7.162473497065578e+01,7.775853867158189e+01,8.442791425946224e+01,
     9.174313520742761e+01,9.986988221096631e+01,1.090811431935787e+02,1.198994682789361e+02,1.336704180732151e+02};
-  constexpr double aw[38] = {2.499300801393398e-01,2.197622105162462e-01,1.698744354394837e-01,1.153864382487449e-01,6.882525739412659e-02,
+  static constexpr double aw[38] = {2.499300801393398e-01,2.197622105162462e-01,1.698744354394837e-01,1.153864382487449e-01,6.882525739412659e-02,
     3.601824635668120e-02,1.651928500999408e-02,6.630685725990292e-03,2.325492670823089e-03,7.112636244182827e-04,1.892976217867182e-04,4.372783157754550e-05,
     8.742083700807699e-06,1.507626466824516e-06,2.234525098112193e-07,2.834470735997166e-08,3.062683224651583e-09,2.803868677899601e-10,2.161805462329055e-11,
     1.394137712580660e-12,7.461785865948289e-14,3.285224408726859e-15,1.177709463373407e-16,3.397355176409182e-18,7.778858985385601e-20,1.391146358285056e-21,
     1.906452084392684e-23,1.956742973666213e-25,1.462832930242021e-27,7.695142746917200e-30,2.726617129645451e-32,6.148207274311863e-35,8.173445792984962e-38,
     5.753058385039598e-41,1.825256448013997e-44,2.004878007028095e-48,4.619586959159565e-53,6.270378448069565e-59};
-  constexpr double x[14592] = {  8.322206759644798e-04, -5.401812209542431e-06,  2.628567628563713e-08, -1.136346937323156e-10,  4.602267904482250e-13,
+  static constexpr double x[14592] = {  8.322206759644798e-04, -5.401812209542431e-06,  2.628567628563713e-08, -1.136346937323156e-10,  4.602267904482250e-13,
  -1.787909380929331e-15,  6.746219942814528e-18, -2.490788573139583e-20,  9.041131747210796e-23, -3.236674206385594e-25,  1.145313803147371e-27, -4.012223787660130e-30,
   7.481888019044308e-03, -4.840428968043917e-05,  2.339885658806322e-07, -1.000410934320522e-09,  3.984434207095561e-12, -1.511581616260292e-14,  5.522778915521922e-17,
  -1.954381687481810e-19,  6.715981087289843e-22, -2.242096178347991e-24,  7.261211566838565e-27, -2.273000600141480e-29,  2.073808464403412e-02, -1.332844331905790e-04,
@@ -2129,7 +2128,7 @@ void ERIRootList::eriroot38(const double* ta, double* rr, double* ww, const int
  -9.827514810305375e-11, -5.196949202620735e-13, -2.374905052465870e-15, -8.461802344464605e-18, -1.295297552285685e-20,  1.348729347013650e-22,  1.808510967972181e-24,
   1.427439398238453e-26,  1.994307636370825e+00, -6.282351458049329e-05, -5.172134855701135e-07, -3.758379051562825e-09, -2.537914991855454e-11, -1.627648440413981e-13,
  -1.001799100028685e-15, -5.946388920945264e-18, -3.408928419132733e-20, -1.885118176298925e-22, -1.001418995562082e-24, -5.067998164255686e-27,  };
-  constexpr double w[14592] = {  8.154963321546213e-02, -2.811954192770734e-04,  1.021022504948982e-06, -3.851762649345345e-09,  1.489503891910817e-11,
+  static constexpr double w[14592] = {  8.154963321546213e-02, -2.811954192770734e-04,  1.021022504948982e-06, -3.851762649345345e-09,  1.489503891910817e-11,
  -5.841458846364859e-14,  2.305739692005181e-16, -9.116286163604409e-19,  3.599830571745387e-21, -1.417450325539196e-23,  5.560735363736921e-26, -2.172700832350250e-28,
   8.114997578958850e-02, -4.103890096689552e-04,  2.414278335578741e-06, -1.420064082264241e-08,  8.090552025808234e-11, -4.464094722262895e-13,  2.396894263473899e-15,
  -1.257844371583211e-17,  6.473267651022011e-20, -3.275204421407986e-22,  1.632376858450198e-24, -8.026659089634917e-27,  8.035895908761528e-02, -6.641778501783889e-04,
@@ -4214,52 +4213,5 @@ void ERIRootList::eriroot38(const double* ta, double* rr, double* ww, const int
   4.004356286870151e-32, -3.776663627910930e-33,  2.978460855746511e-34, -2.018620750415424e-35,  1.199607755732284e-36, -6.348176638538818e-38,  3.028199806233048e-39,
  -1.313127984823439e-40,  4.751832461601373e-30, -2.072411458242729e-30,  4.847816587658894e-31, -7.705708031736373e-32,  9.260860812784349e-33, -8.942340145541427e-34,
   7.214802398672600e-35, -4.998519669303876e-36,  3.034247199448979e-37, -1.638952312544600e-38,  7.974419878181607e-40, -3.524509999097790e-41,  };
-  int offset = -38;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 38;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 38, 0.5);
-      fill_n(ww+offset, 38, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 38; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=38; ++j) {
-        const int boxof = it*456+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<38, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,28 +23,27 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot39(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[39] = {1.571613618132672e-02,1.414830048914107e-01,3.932186023483968e-01,7.713284360788133e-01,1.276425274368880e+00,
+  static constexpr double ax[39] = {1.571613618132672e-02,1.414830048914107e-01,3.932186023483968e-01,7.713284360788133e-01,1.276425274368880e+00,
     1.909334663596226e+00,2.671102470876819e+00,3.563004621230473e+00,4.586559253495662e+00,5.743541583945743e+00,7.036001844270942e+00,8.466286755550328e+00,
     1.003706511763564e+01,1.175135824147279e+01,1.361257614040442e+01,1.562456063930049e+01,1.779163687673834e+01,2.011867509257462e+01,2.261116514995490e+01,
     2.527530699343292e+01,2.811812127646630e+01,3.114758582669629e+01,3.437280564655622e+01,3.780422706716250e+01,4.145391095997715e+01,4.533588634146724e+01,
     4.946661559282549e+01,5.386561814392992e+01,5.855632496290653e+01,6.356727931650277e+01,6.893387537141712e+01,7.470096740337739e+01,8.092696055954460e+01,
     8.769058409016425e+01,9.510292101724212e+01,1.033308766544542e+02,1.126494824260676e+02,1.235852735955694e+02,1.374943368493242e+02};
-  constexpr double aw[39] = {2.468265921334473e-01,2.177439564163269e-01,1.694210883381108e-01,1.162201191647133e-01,7.024633469707303e-02,
+  static constexpr double aw[39] = {2.468265921334473e-01,2.177439564163269e-01,1.694210883381108e-01,1.162201191647133e-01,7.024633469707303e-02,
     3.737996430587537e-02,1.749348862159024e-02,7.190957220422882e-03,2.592482535680938e-03,8.182750269406580e-04,2.256597998205592e-04,5.424629880485159e-05,
     1.133699839583300e-05,2.053702858231855e-06,3.213816725399362e-07,4.328082092479813e-08,4.994592938548768e-09,4.915189598223187e-10,4.102565151657011e-11,
     2.886560496200262e-12,1.700195781355176e-13,8.317318967561869e-15,3.349071221434938e-16,1.098597343564958e-17,2.901028854938575e-19,6.082053819583228e-21,
     9.960470558573057e-23,1.249924853737202e-24,1.174462960833294e-26,8.034302891078219e-29,3.864581126624081e-31,1.250783951936298e-33,2.572371299657925e-36,
     3.112600022097255e-39,1.988404448243757e-42,5.702185273062599e-46,5.626705361999555e-50,1.152993559639697e-54,1.363383330001917e-60};
-  constexpr double x[14976] = {  7.906207866116642e-04, -5.001977095024906e-06,  2.372482193912555e-08, -9.997423106688797e-11,  3.946911952915268e-13,
+  static constexpr double x[14976] = {  7.906207866116642e-04, -5.001977095024906e-06,  2.372482193912555e-08, -9.997423106688797e-11,  3.946911952915268e-13,
  -1.494711622151156e-15,  5.498194393820276e-18, -1.979103784541229e-20,  7.004136760497501e-23, -2.444907324972677e-25,  8.436357780060230e-28, -2.882189422526145e-30,
   7.108273578077450e-03, -4.483119185489703e-05,  2.113078987004109e-07, -8.811173828215605e-10,  3.423715477828093e-12, -1.267697533742008e-14,  4.522891822681700e-17,
  -1.563939004178349e-19,  5.255634346707775e-22, -1.717656859797187e-24,  5.453590013383143e-27, -1.677074192500893e-29,  1.970461827978645e-02, -1.234994030651169e-04,
@@ -2184,7 +2183,7 @@ void ERIRootList::eriroot39(const double* ta, double* rr, double* ww, const int
  -4.095187842767483e-13, -1.875932472346460e-15, -7.066548134777781e-18, -1.644973548604533e-20,  4.202614756698433e-23,  9.055442423751499e-25,  7.788857137379457e-27,
   1.994779780494927e+00, -5.520032056816114e-05, -4.356634589491083e-07, -3.037080329443392e-09, -1.969253996177430e-11, -1.214076945871105e-13, -7.193534135602207e-16,
  -4.117862047521375e-18, -2.281974617513014e-20, -1.223728010866902e-22, -6.332671480393928e-25, -3.143874714708758e-27,  };
-  constexpr double w[14976] = {  7.948751231920860e-02, -2.667637324944252e-04,  9.417608261780250e-07, -3.452472847228082e-09,  1.297309598878263e-11,
+  static constexpr double w[14976] = {  7.948751231920860e-02, -2.667637324944252e-04,  9.417608261780250e-07, -3.452472847228082e-09,  1.297309598878263e-11,
  -4.944536286226116e-14,  1.897271561920230e-16, -7.294050736351746e-19,  2.801363308656874e-21, -1.073049811747052e-23,  4.095823981600354e-26, -1.557274533050881e-28,
   7.911722673551601e-02, -3.865663225916020e-04,  2.198087344082845e-06, -1.252184825728418e-08,  6.917382866585457e-11, -3.703103782125368e-13,  1.929823149588767e-15,
  -9.832369359646394e-18,  4.913873603709418e-20, -2.414915797445520e-22,  1.169315740493288e-24, -5.586907065259178e-27,  7.838396869550243e-02, -6.221169235515783e-04,
@@ -4324,52 +4323,5 @@ void ERIRootList::eriroot39(const double* ta, double* rr, double* ww, const int
  -3.288961004903912e-33,  2.603081802627694e-34, -1.770248031015963e-35,  1.055460917737704e-36, -5.602965171095211e-38,  2.680801177247244e-39, -1.165849709043992e-40,
   4.297647955048975e-30, -1.876833306592087e-30,  4.396851634425195e-31, -6.999321242473651e-32,  8.424233993239982e-33, -8.146099483595328e-34,  6.581500676878745e-35,
  -4.565897758649284e-36,  2.775253269147995e-37, -1.500955950632858e-38,  7.311969033954852e-40, -3.235566755666978e-41,  };
-  int offset = -39;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 39;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 39, 0.5);
-      fill_n(ww+offset, 39, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 39; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=39; ++j) {
-        const int boxof = it*468+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<39, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -22,18 +22,17 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot4(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[4] = {1.453035215033171e-01,1.339097288126363e+00,3.926963501358290e+00,8.588635689012035e+00};
-  constexpr double aw[4] = {6.611470125582407e-01,2.078023258148919e-01,1.707798300741347e-02,1.996040722113680e-04};
-  constexpr double x[1536] = {  6.049031327031341e-02, -3.270068487538848e-03,  1.285969134112606e-04, -4.314986936371710e-06,  1.276525412703032e-07,
+  static constexpr double ax[4] = {1.453035215033171e-01,1.339097288126363e+00,3.926963501358290e+00,8.588635689012035e+00};
+  static constexpr double aw[4] = {6.611470125582407e-01,2.078023258148919e-01,1.707798300741347e-02,1.996040722113680e-04};
+  static constexpr double x[1536] = {  6.049031327031341e-02, -3.270068487538848e-03,  1.285969134112606e-04, -4.314986936371710e-06,  1.276525412703032e-07,
  -3.319420980735172e-09,  7.145272019320873e-11, -1.055050932790330e-12, -4.990355408937095e-15,  1.304466418907947e-15, -5.793426146934574e-17,  1.508269138897369e-18,
   5.081363306251300e-01, -2.164799272614928e-02,  4.680762200994743e-04, -4.377050408282199e-07, -3.478610589995228e-07,  1.029501892042923e-08,  5.102283632027422e-11,
  -1.331871547653920e-11,  3.529162911007458e-13,  6.082140697274363e-15, -5.797250435979266e-16,  8.687790317521172e-18,  1.213095902882022e+00, -2.839120546413938e-02,
@@ -253,7 +252,7 @@ void ERIRootList::eriroot4(const double* ta, double* rr, double* ww, const int n
  -3.927218754731034e-12,  3.117036630219120e-14, -2.473994437092109e-16,  1.963611337865441e-18, -1.558519858258079e-20,  1.236998382478157e-22, -9.817445271474647e-25,
   2.726894558157242e-01, -2.164338366559126e-03,  1.717837072558235e-05, -1.363448642527577e-07,  1.082170265449785e-09, -8.589193951959153e-12,  6.817250029679730e-14,
  -5.410856736765902e-16,  4.294601263096927e-18, -3.408628386414610e-20,  2.705430898398630e-22, -2.147166844469433e-24,  };
-  constexpr double w[1536] = {  6.705271744302512e-01, -2.619524415748476e-02,  1.170505443615014e-03, -5.212507391660261e-05,  2.226764042968755e-06,
+  static constexpr double w[1536] = {  6.705271744302512e-01, -2.619524415748476e-02,  1.170505443615014e-03, -5.212507391660261e-05,  2.226764042968755e-06,
  -9.101956829896582e-08,  3.564981193444281e-09, -1.345525555824187e-10,  4.896995955161307e-12, -1.718629076719417e-13,  5.885797931863237e-15, -1.967508214907542e-16,
   4.923850774034377e-01, -6.102048378251209e-02,  5.984054190981936e-03, -4.750345201718488e-04,  3.245346093385506e-05, -1.967662395491961e-06,  1.078804139517892e-07,
  -5.416181691060193e-09,  2.512770251927413e-10, -1.084557412526323e-11,  4.377427639174442e-13, -1.657383407187138e-14,  2.766459366018412e-01, -7.159779222560791e-02,
@@ -473,52 +472,5 @@ void ERIRootList::eriroot4(const double* ta, double* rr, double* ww, const int n
  -3.335855004407273e-14,  2.427032435637414e-16, -1.788742531082157e-18,  1.330993783491663e-20, -9.977216411488412e-23,  7.522985313944995e-25, -5.699283222821317e-27,
   5.029787498563661e-05, -1.996088875553983e-07,  1.188226107905752e-09, -7.859143658208009e-12,  5.458086765954214e-14, -3.898881050170457e-16,  2.836667290484250e-18,
  -2.090646741531065e-20,  1.555639151244907e-22, -1.166117536233024e-24,  8.792729222592889e-27, -6.661262688234127e-29,  };
-  int offset = -4;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 4;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 4, 0.5);
-      fill_n(ww+offset, 4, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 4; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=4; ++j) {
-        const int boxof = it*48+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<4, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
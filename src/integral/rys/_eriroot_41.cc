@@ -23,30 +23,29 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot41(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[41] = {1.495412318839393e-02,1.346196530603572e-01,3.741245717669348e-01,7.338179903846087e-01,1.214227085453374e+00,
+  static constexpr double ax[41] = {1.495412318839393e-02,1.346196530603572e-01,3.741245717669348e-01,7.338179903846087e-01,1.214227085453374e+00,
     1.816061387586076e+00,2.540218630400303e+00,3.387792277962293e+00,4.360080886504365e+00,5.458599499786691e+00,6.685093329091552e+00,8.041554030961123e+00,
     9.530238971637578e+00,1.115369396095140e+01,1.291478005572015e+01,1.481670518107030e+01,1.686306150767552e+01,1.905786976774064e+01,2.140563201216782e+01,
     2.391139473325466e+01,2.658082484085170e+01,2.942030174226932e+01,3.243702982159083e+01,3.563917706876438e+01,3.903604766610029e+01,4.263829930114852e+01,
     4.645822032213911e+01,5.051008837465523e+01,5.481064218713176e+01,5.937971402598654e+01,6.424109620464289e+01,6.942375878668088e+01,7.496361285123034e+01,
     8.090615698271444e+01,8.731062698640064e+01,9.425686768829939e+01,1.018575395655076e+02,1.102819365820350e+02,1.198090785376495e+02,1.309732808502122e+02,
     1.451511799576251e+02};
-  constexpr double aw[41] = {2.409512031980955e-01,2.138535989833046e-01,1.684288790881375e-01,1.176734858934138e-01,7.289127392474089e-02,
+  static constexpr double aw[41] = {2.409512031980955e-01,2.138535989833046e-01,1.684288790881375e-01,1.176734858934138e-01,7.289127392474089e-02,
     4.000382672300703e-02,1.943433713864227e-02,8.348509096446632e-03,3.167083927136288e-03,1.059421789854996e-03,3.119500328225102e-04,8.069562974703131e-05,
     1.829749053132399e-05,3.627548088743567e-06,6.270222683683111e-07,9.419324500196609e-08,1.225398304711123e-08,1.375070911649690e-09,1.325031121542562e-10,
     1.090961318304441e-11,7.631990251021066e-13,4.507842471875929e-14,2.232059383733774e-15,9.190509652018277e-17,3.117988425407376e-18,8.624530360938065e-20,
     1.921543143288940e-21,3.400135276844942e-23,4.700029149891438e-25,4.977034813475706e-27,3.943908754083598e-29,2.272930361646040e-31,9.196366050568663e-34,
     2.498147611480457e-36,4.299097107561103e-39,4.334876123369952e-42,2.294487143412411e-45,5.407934160768677e-49,4.333162815666903e-53,7.068304065463833e-58,
     6.390084617936297e-64};
-  constexpr double x[15744] = {  7.162598842487031e-04, -4.313292778373942e-06,  1.947382724785179e-08, -7.811573259033619e-11,  2.935870828682837e-13,
+  static constexpr double x[15744] = {  7.162598842487031e-04, -4.313292778373942e-06,  1.947382724785179e-08, -7.811573259033619e-11,  2.935870828682837e-13,
  -1.058517543377415e-15,  3.707319008409632e-18, -1.270724034044082e-20,  4.282822060611644e-23, -1.423923371884718e-25,  4.680487715542327e-28, -1.523495561776137e-30,
   6.440329178977883e-03, -3.867373058797770e-05,  1.736154665140016e-07, -6.898250572001446e-10,  2.555567237277297e-12, -9.028272713132108e-15,  3.076067747551729e-17,
  -1.016896904706066e-19,  3.271703553727580e-22, -1.025577819244530e-24,  3.130779706106532e-27, -9.288070785994918e-30,  1.785644895117920e-02, -1.066199943533484e-04,
@@ -2296,7 +2295,7 @@ void ERIRootList::eriroot41(const double* ta, double* rr, double* ww, const int
  -4.568811111998928e-18, -1.415850462007635e-20, -1.859967736840820e-23,  1.822728350885064e-25,  2.178937829975120e-27,  1.995563837626699e+00, -4.327928251568241e-05,
  -3.154219881152376e-07, -2.032824056251507e-09, -1.220329881560428e-11, -6.978031977724911e-14, -3.843297223558872e-16, -2.050747605032932e-18, -1.063076358554141e-20,
  -5.357574749958629e-23, -2.622189392302681e-25, -1.242646658278412e-27,  };
-  constexpr double w[15744] = {  7.566092113354021e-02, -2.410400796940228e-04,  8.061864712324449e-07, -2.797224196115299e-09,  9.946297309732901e-12,
+  static constexpr double w[15744] = {  7.566092113354021e-02, -2.410400796940228e-04,  8.061864712324449e-07, -2.797224196115299e-09,  9.946297309732901e-12,
  -3.588269407168250e-14,  1.303875012222437e-16, -4.749411261715028e-19,  1.729033405388969e-21, -6.280365258804009e-24,  2.273925380700034e-26, -8.203209935889128e-29,
   7.534128443252569e-02, -3.446207934806731e-04,  1.835538428123680e-06, -9.831821416834911e-09,  5.118242744323734e-11, -2.585076314240787e-13,  1.271962848614270e-15,
  -6.122156004504836e-18,  2.891745945785553e-20, -1.343707654243983e-22,  6.154037970431983e-25, -2.782087806528937e-27,  7.470774323364461e-02, -5.486011452105309e-04,
@@ -4546,52 +4545,5 @@ void ERIRootList::eriroot41(const double* ta, double* rr, double* ww, const int
  -1.395203712737862e-35,  8.364287715536254e-37, -4.463729354797213e-38,  2.146600464077313e-39, -9.380960676959382e-41,  3.568948687270301e-30, -1.562126989611411e-30,
   3.668840596229374e-31, -5.855252008856877e-32,  7.064884882474665e-33, -6.848325666591845e-34,  5.546158558964008e-35, -3.856543963514891e-36,  2.349372299496654e-37,
  -1.273407145806736e-38,  6.216666778962424e-40, -2.756573513477202e-41,  };
-  int offset = -41;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 41;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 41, 0.5);
-      fill_n(ww+offset, 41, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 41; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=41; ++j) {
-        const int boxof = it*492+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<41, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
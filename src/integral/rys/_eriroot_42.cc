@@ -23,30 +23,29 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot42(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[42] = {1.460017135478569e-02,1.314318292053676e-01,3.652569320013846e-01,7.164002894347877e-01,1.185352227654440e+00,
+  static constexpr double ax[42] = {1.460017135478569e-02,1.314318292053676e-01,3.652569320013846e-01,7.164002894347877e-01,1.185352227654440e+00,
     1.772772387972019e+00,2.479494902134027e+00,3.306535043617567e+00,4.255097485700951e+00,5.326586333162191e+00,6.522617136911987e+00,7.845031151606489e+00,
     9.295912157785057e+00,1.087760624554686e+01,1.259274505043534e+01,1.444427304964665e+01,1.643547967545258e+01,1.857003719308730e+01,2.085204553638739e+01,
     2.328608561584580e+01,2.587728303814923e+01,2.863138474333377e+01,3.155485183293098e+01,3.465497291466760e+01,3.794000375365336e+01,4.141934109105191e+01,
     4.510374147266588e+01,4.900560030677341e+01,5.313931293794423e+01,5.752174962197211e+01,6.217289225082515e+01,6.711670672143431e+01,7.238236890708382e+01,
     7.800603996678934e+01,8.403353104686988e+01,9.052448180105013e+01,9.755928035400053e+01,1.052513563988187e+02,1.137711697013339e+02,1.233996876590921e+02,
     1.346750257673260e+02,1.489838572972913e+02};
-  constexpr double aw[42] = {2.381665164123877e-01,2.119783608299676e-01,1.678971935081127e-01,1.183031774092678e-01,7.412062712682743e-02,
+  static constexpr double aw[42] = {2.381665164123877e-01,2.119783608299676e-01,1.678971935081127e-01,1.183031774092678e-01,7.412062712682743e-02,
     4.126550145699646e-02,2.039769051596592e-02,8.942997462150033e-03,3.473555670318476e-03,1.193574051167489e-03,3.622532246353051e-04,9.693254025651544e-05,
     2.282041964292070e-05,4.715890638678973e-06,8.532109247531311e-07,1.347515082659149e-07,1.851735909072757e-08,2.206031653348500e-09,2.269170056982643e-10,
     2.006197650690580e-11,1.516794211468352e-12,9.751111983536444e-14,5.296367290397574e-15,2.413046421035697e-16,9.146809474774557e-18,2.857946497692167e-19,
     7.282847898000456e-21,1.495176144996499e-22,2.438114477260604e-24,3.105677547554655e-26,3.029994066125889e-28,2.211339194320611e-30,1.173072668454671e-32,
     4.365256260679369e-35,1.089369391193148e-37,1.719616536649988e-40,1.587180741790976e-43,7.668228473195954e-47,1.643081895799633e-50,1.189775567817074e-54,
     1.736892166137280e-59,1.377759112535871e-65};
-  constexpr double x[16128] = {  6.829531865545015e-04, -4.016016722500040e-06,  1.770563245081128e-08, -6.935560998859635e-11,  2.545511529857284e-13,
+  static constexpr double x[16128] = {  6.829531865545015e-04, -4.016016722500040e-06,  1.770563245081128e-08, -6.935560998859635e-11,  2.545511529857284e-13,
  -8.962838818005976e-16,  3.065730150695220e-18, -1.026292481999061e-20,  3.378455340359050e-23, -1.097155143765586e-25,  3.522848246434908e-28, -1.120203339970319e-30,
   6.141111733273537e-03, -3.601456622991429e-05,  1.579205605078556e-07, -6.130062272732403e-10,  2.219225191352922e-12, -7.663851039219280e-15,  2.553524285739954e-17,
  -8.259182199644081e-20,  2.601466348167248e-22, -7.989849504625021e-25,  2.392192328618522e-27, -6.970315391300951e-30,  1.702830079740702e-02, -9.932355462904897e-05,
@@ -2351,7 +2350,7 @@ void ERIRootList::eriroot42(const double* ta, double* rr, double* ww, const int
  -1.184355241325139e-20, -2.389132520792820e-23,  5.976603260494107e-26,  1.104441907920396e-27,  1.995891335483962e+00, -3.858915000950707e-05, -2.708466533455290e-07,
  -1.681819654438617e-09, -9.733252409825735e-12, -5.369405277964624e-14, -2.855559251492335e-16, -1.472866771096375e-18, -7.390394129461345e-21, -3.611401884834740e-23,
  -1.717796174676775e-25, -7.936547892583233e-28,  };
-  constexpr double w[16128] = {  7.388247293339276e-02, -2.295499544842064e-04,  7.480613220489151e-07, -2.527748180396700e-09,  8.752390973435472e-12,
+  static constexpr double w[16128] = {  7.388247293339276e-02, -2.295499544842064e-04,  7.480613220489151e-07, -2.527748180396700e-09,  8.752390973435472e-12,
  -3.075105194498142e-14,  1.088463759211708e-16, -3.862978558271751e-19,  1.370516372631620e-21, -4.852262606010927e-24,  1.712697987505398e-26, -6.024047312245151e-29,
   7.358472328549459e-02, -3.261090329306077e-04,  1.683140540554563e-06, -8.751889325948033e-09,  4.427582463794530e-11, -2.174437530147702e-13,  1.040710913625833e-15,
  -4.873670824809866e-18,  2.240282412375655e-20, -1.013261254815197e-22,  4.517785300172047e-25, -1.988627285194124e-27,  7.299432075025068e-02, -5.163975216561338e-04,
@@ -4656,52 +4655,5 @@ void ERIRootList::eriroot42(const double* ta, double* rr, double* ww, const int
   7.521253621040094e-37, -4.022789364198127e-38,  1.938717806658437e-39, -8.490030814058363e-41,  3.273806061998923e-30, -1.434324350745218e-30,  3.372320603776134e-31,
  -5.387886918289967e-32,  6.507953090950895e-33, -6.315104018616556e-34,  5.119580608837440e-35, -3.563488003082113e-36,  2.172964930224924e-37, -1.178911394296309e-38,
   5.760682090298360e-40, -2.556683288469195e-41,  };
-  int offset = -42;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 42;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 42, 0.5);
-      fill_n(ww+offset, 42, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 42; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=42; ++j) {
-        const int boxof = it*504+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<42, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -23,30 +23,29 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot44(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[44] = {1.394026269787452e-02,1.254887261859858e-01,3.487264533764085e-01,6.839360245419450e-01,1.131543776215137e+00,
+  static constexpr double ax[44] = {1.394026269787452e-02,1.254887261859858e-01,3.487264533764085e-01,6.839360245419450e-01,1.131543776215137e+00,
     1.692122807282550e+00,2.366397066581720e+00,3.155246593321557e+00,4.059714003670170e+00,5.081012341982421e+00,6.220534444334326e+00,7.479863996481541e+00,
     8.860788509558922e+00,1.036531448669457e+01,1.199568511468593e+01,1.375440089019443e+01,1.564424368379558e+01,1.766830486333247e+01,1.983001824797306e+01,
     2.213319885653819e+01,2.458208866231789e+01,2.718141089162620e+01,2.993643483281341e+01,3.285305369651100e+01,3.593787884478832e+01,3.919835477256694e+01,
     4.264290070800244e+01,4.628108679673196e+01,5.012385585568197e+01,5.418380611726070e+01,5.847555704006093e+01,6.301623049665658e+01,6.782609582919292e+01,
     7.292945366353734e+01,7.835587804220772e+01,8.414201528655593e+01,9.033428432237336e+01,9.699311155158021e+01,1.041999450430757e+02,1.120697167875161e+02,
     1.207751650537911e+02,1.306010653811563e+02,1.420929648799869e+02,1.566571642945627e+02};
-  constexpr double aw[44] = {2.328749081845471e-01,2.083601726149635e-01,1.667777136192186e-01,1.193907729932987e-01,7.640628999619845e-02,
+  static constexpr double aw[44] = {2.328749081845471e-01,2.083601726149635e-01,1.667777136192186e-01,1.193907729932987e-01,7.640628999619845e-02,
     4.368838005728940e-02,2.230329851479710e-02,1.015685234209423e-02,4.121796569996600e-03,1.488772654095434e-03,4.779519114281924e-04,1.361668444358730e-04,
     3.436524690691869e-05,7.667676245247865e-06,1.509168244222782e-06,2.613748469736829e-07,3.972315688450674e-08,5.281362971560191e-09,6.121978354544024e-10,
     6.163656612278241e-11,5.367349226807181e-12,4.023678119642042e-13,2.583219433937558e-14,1.412014041414147e-15,6.528497854709731e-17,2.534449921267411e-18,
     8.192799213995431e-20,2.184480007299850e-21,4.752613298191917e-23,8.332569096197455e-25,1.160424567801345e-26,1.262139334351897e-28,1.050916165015424e-30,
     6.540321701258348e-33,2.954986811717080e-35,9.349454598812688e-38,1.979215172273072e-40,2.642073629482833e-43,2.053664611058321e-46,8.308654338799789e-50,
     1.479045824609391e-53,8.793797991037640e-58,1.034074040165401e-62,6.355988880481435e-69};
-  constexpr double x[16896] = {  6.229487728614898e-04, -3.498634945843954e-06,  1.473226145302269e-08, -5.512027284548852e-11,  1.932406067322336e-13,
+  static constexpr double x[16896] = {  6.229487728614898e-04, -3.498634945843954e-06,  1.473226145302269e-08, -5.512027284548852e-11,  1.932406067322336e-13,
  -6.499625585018529e-16,  2.123864388505481e-18, -6.792805644160976e-21,  2.136591621013155e-23, -6.630429056033160e-26,  2.034643087723155e-28, -6.183981967256100e-31,
   5.601985660252470e-03, -3.138466509032447e-05,  1.315041061598687e-07, -4.879601354412900e-10,  1.689436019632894e-12, -5.582896107063550e-15,  1.781287762069302e-17,
  -5.521959171014193e-20,  1.668817541037179e-22, -4.924472161065707e-25,  1.419119451089988e-27, -3.989415184240533e-30,  1.553579737291826e-02, -8.660931314682977e-05,
@@ -2461,7 +2460,7 @@ void ERIRootList::eriroot44(const double* ta, double* rr, double* ww, const int
  -2.233782123334010e-26,  2.342463071019990e-28,  1.996446368612268e+00, -3.105713695224128e-05, -2.029542811123552e-07, -1.174260422026793e-09, -6.338232418955940e-12,
  -3.264900387533908e-14, -1.623629655822248e-16, -7.844507087628588e-19, -3.694930581368950e-21, -1.699492360875472e-23, -7.635306290687945e-26, -3.347435199464779e-28,
   };
-  constexpr double w[16896] = {  7.056502674897336e-02, -2.089013222556692e-04,  6.475189158044318e-07, -2.079193847871408e-09,  6.839634381449054e-12,
+  static constexpr double w[16896] = {  7.056502674897336e-02, -2.089013222556692e-04,  6.475189158044318e-07, -2.079193847871408e-09,  6.839634381449054e-12,
  -2.283475305005380e-14,  7.683350249481788e-17, -2.593275471643772e-19,  8.753422398392730e-22, -2.949568845856048e-24,  9.911597906929481e-27, -3.319751268457641e-29,
   7.030540652362430e-02, -2.932100328909080e-04,  1.424282545079989e-06, -6.993585776194931e-09,  3.348037650812868e-11, -1.557693321536560e-13,  7.067635870749230e-16,
  -3.139256416934182e-18,  1.369239259089739e-20, -5.878426526344879e-23,  2.488682052835860e-25, -1.040471909085251e-27,  6.979022758511104e-02, -4.595707298687169e-04,
@@ -4876,52 +4875,5 @@ void ERIRootList::eriroot44(const double* ta, double* rr, double* ww, const int
   1.606173687552763e-39, -7.058814322240411e-41,  2.785744945935055e-30, -1.222531514077728e-30,  2.879754683516289e-31, -4.609646015555220e-32,  5.578359087054711e-33,
  -5.423007871696126e-34,  4.404275235842797e-35, -3.070985177649137e-36,  1.875855863970875e-37, -1.019423102436107e-38,  4.989492744418595e-40, -2.217939290998765e-41,
   };
-  int offset = -44;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 44;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 44, 0.5);
-      fill_n(ww+offset, 44, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 44; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=44; ++j) {
-        const int boxof = it*528+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<44, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
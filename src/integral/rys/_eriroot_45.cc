@@ -23,30 +23,29 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot45(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[45] = {1.363218446064655e-02,1.227143121292312e-01,3.410102265774382e-01,6.687841220517716e-01,1.106434494095849e+00,
+  static constexpr double ax[45] = {1.363218446064655e-02,1.227143121292312e-01,3.410102265774382e-01,6.687841220517716e-01,1.106434494095849e+00,
     1.654496824492952e+00,2.313647229019849e+00,3.084707128763795e+00,3.968649024354158e+00,4.966603473575368e+00,6.079867397224717e+00,7.309913866697611e+00,
     8.658403560798874e+00,1.012719812017698e+01,1.171837567746325e+01,1.343424890213575e+01,1.527738597453940e+01,1.725063499764410e+01,1.935715247368910e+01,
     2.160043662350283e+01,2.398436651943605e+01,2.651324825285741e+01,2.919186968405330e+01,3.202556575438580e+01,3.502029691808950e+01,3.818274403277209e+01,
     4.152042411998880e+01,4.504183289995902e+01,4.875662211598719e+01,5.267582270425613e+01,5.681212932830451e+01,6.118026849586888e+01,6.579748277683728e+01,
     7.068417992710489e+01,7.586482229702409e+01,8.136917686847987e+01,8.723412564031283e+01,9.350638338661895e+01,1.002467601066914e+02,1.075372213306839e+02,
     1.154934331557267e+02,1.242892479663152e+02,1.342113040590704e+02,1.458087842455116e+02,1.604975908002699e+02};
-  constexpr double aw[45] = {2.303579701819461e-01,2.066143037039248e-01,1.661949726099588e-01,1.198565559023908e-01,7.746762760551308e-02,
+  static constexpr double aw[45] = {2.303579701819461e-01,2.066143037039248e-01,1.661949726099588e-01,1.198565559023908e-01,7.746762760551308e-02,
     4.484998813239049e-02,2.324322817375528e-02,1.077378662464251e-02,4.462299859503526e-03,1.649605536181237e-03,5.435922495296234e-04,1.594421436848044e-04,
     4.155792110254414e-05,9.607776074179279e-06,1.966140849465943e-06,3.553304582949643e-07,5.656785290092850e-08,7.910416614910463e-09,9.686384924880712e-10,
     1.035023372624045e-10,9.613782869159589e-12,7.729303108601910e-13,5.353372486198366e-14,3.177312959963773e-15,1.606474294270389e-16,6.873779799095932e-18,
     2.470550592287988e-19,7.396342358359291e-21,1.826917938282980e-22,3.682672905315781e-24,5.982751013848978e-26,7.719967821375217e-28,7.778849187290817e-30,
     5.998718551613889e-32,3.456007258807920e-34,1.444559003928653e-36,4.224614459802521e-39,8.256641293693982e-42,1.015984453644589e-44,7.264422087503349e-48,
     2.695943873799329e-51,4.384966299824010e-55,2.368390700183081e-59,2.506289389600479e-64,1.360224249235594e-70};
-  constexpr double x[17280] = {  5.958695215714654e-04, -3.273044131107183e-06,  1.347978524364530e-08, -4.932792901140093e-11,  1.691444332854027e-13,
+  static constexpr double x[17280] = {  5.958695215714654e-04, -3.273044131107183e-06,  1.347978524364530e-08, -4.932792901140093e-11,  1.691444332854027e-13,
  -5.564640611969447e-16,  1.778602356083645e-18, -5.564426112115111e-21,  1.712103014232476e-23, -5.197654583738223e-26,  1.560393438154406e-28, -4.640016047792100e-31,
   5.358657599207876e-03, -2.936515053736232e-05,  1.203670354456164e-07, -4.369956538030501e-10,  1.480641854518110e-12, -4.789565460273694e-15,  1.496364552222974e-17,
  -4.543940452252456e-20,  1.345839477990497e-22, -3.894485602385265e-25,  1.101410430080640e-27, -3.041718099246496e-30,  1.486202339298491e-02, -8.105925375107369e-05,
@@ -2515,7 +2514,7 @@ void ERIRootList::eriroot45(const double* ta, double* rr, double* ww, const int
  -2.331397431581528e-11, -1.059927210681875e-13, -4.481773623846530e-16, -1.744783060981680e-18, -6.077743684270825e-21, -1.753355016517435e-23, -3.024664065221641e-26,
   8.313589574275992e-29,  1.996682681007814e+00, -2.801768710864268e-05, -1.769824314169319e-07, -9.901354133840028e-10, -5.169728832531449e-12, -2.577198834060896e-14,
  -1.241069153526041e-16, -5.810467345602206e-19, -2.654361032198788e-21, -1.185333776338940e-23, -5.177204078561474e-26, -2.210452343291986e-28,  };
-  constexpr double w[17280] = {  6.901552258454437e-02, -1.996053561707994e-04,  6.039422743228609e-07, -1.892140618267644e-09,  6.072292360291149e-12,
+  static constexpr double w[17280] = {  6.901552258454437e-02, -1.996053561707994e-04,  6.039422743228609e-07, -1.892140618267644e-09,  6.072292360291149e-12,
  -1.977937368291684e-14,  6.494424364921337e-17, -2.139443814849441e-19,  7.049793404551005e-22, -2.319404775270043e-24,  7.611018045744265e-27, -2.489640538554685e-29,
   6.877254320158645e-02, -2.785600708765082e-04,  1.314108100423761e-06, -6.276527773820511e-09,  2.925710742498228e-11, -1.326114041235556e-13,  5.863740998455337e-16,
  -2.538826802750220e-18,  1.079633741832507e-20, -4.519842872810214e-23,  1.866222681052462e-25, -7.610568901532529e-28,  6.829022365389623e-02, -4.344466635451046e-04,
@@ -4984,52 +4983,5 @@ void ERIRootList::eriroot45(const double* ta, double* rr, double* ww, const int
   1.757081491703187e-32, -1.688352030138795e-33,  1.355691079807000e-34, -9.348839526664858e-36,  5.649413864608100e-37, -3.038160867306586e-38,  1.471942229759870e-39,
  -6.478837056189080e-41,  2.582508083855473e-30, -1.134164017309573e-30,  2.673785993162708e-31, -4.283497402077423e-32,  5.187924936017378e-33, -5.047515676123479e-34,
   4.102561612115710e-35, -2.862821467271990e-36,  1.750026006824031e-37, -9.517451737263860e-39,  4.661617116292353e-40, -2.073652288320315e-41,  };
-  int offset = -45;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 45;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 45, 0.5);
-      fill_n(ww+offset, 45, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 45; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=45; ++j) {
-        const int boxof = it*540+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<45, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
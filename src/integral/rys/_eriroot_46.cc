@@ -23,30 +23,29 @@
 // the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot46(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[46] = {1.333742891059480e-02,1.200599470082749e-01,3.336282758938885e-01,6.542897860813291e-01,1.082417508278657e+00,
+  static constexpr double ax[46] = {1.333742891059480e-02,1.200599470082749e-01,3.336282758938885e-01,6.542897860813291e-01,1.082417508278657e+00,
     1.618512537546250e+00,2.263207296941506e+00,3.017269712589601e+00,3.881608367893986e+00,4.857278722422409e+00,5.945490501488364e+00,7.147616386343818e+00,
     8.465202163133917e+00,9.899978522507352e+00,1.145387474250570e+01,1.312903453698342e+01,1.492783441280015e+01,1.685290495462581e+01,1.890715555067650e+01,
     2.109380319177515e+01,2.341640612750172e+01,2.587890335735440e+01,2.848566118623576e+01,3.124152840233684e+01,3.415190207003891e+01,3.722280651143067e+01,
     4.046098883645525e+01,4.387403546057887e+01,4.747051555078885e+01,5.126015946537328e+01,5.525408331208722e+01,5.946507524110557e+01,6.390796583001595e+01,
     6.860011528488650e+01,7.356206657197211e+01,7.881844033999124e+01,8.439919275006795e+01,9.034143722433798e+01,9.669217939657422e+01,1.035126067611858e+02,
     1.108851944593616e+02,1.189263319546920e+02,1.278109698542234e+02,1.378275830301891e+02,1.495289391604307e+02,1.643404073143761e+02};
-  constexpr double aw[46] = {2.279208832278825e-01,2.049087117733847e-01,1.655998150159143e-01,1.202750893159248e-01,7.847783981190361e-02,
+  static constexpr double aw[46] = {2.279208832278825e-01,2.049087117733847e-01,1.655998150159143e-01,1.202750893159248e-01,7.847783981190361e-02,
     4.597881388935413e-02,2.417325210411894e-02,1.139587780743454e-02,4.812868705752729e-03,1.819066584203055e-03,6.145537269722041e-04,1.853300723976886e-04,
     4.981271596855133e-05,1.191232924731862e-05,2.529785014232799e-06,4.760767641836890e-07,7.920499353876436e-08,1.161921427862696e-08,1.498635556105118e-09,
     1.694043339299303e-10,1.672359378492024e-11,1.436200372305090e-12,1.068318855139839e-13,6.850149207931225e-15,3.766082836004507e-16,1.764731333396296e-17,
     7.001068361030809e-19,2.333916032868272e-20,6.482735757989675e-22,1.485946572151995e-23,2.780009179112892e-25,4.191780259187148e-27,5.019934094427782e-29,
     4.693558872978239e-31,3.357458184827123e-33,1.793428827734612e-35,6.945640108299903e-38,1.880361280468476e-40,3.397961343485392e-43,3.859958997823809e-46,
     2.542588333949454e-49,8.668622708166449e-53,1.290263073673895e-56,6.340884055269682e-61,6.048791108598756e-66,2.904278079328870e-72};
-  constexpr double x[17664] = {  5.705182832704843e-04, -3.066437463823634e-06,  1.235761423175758e-08, -4.425079825682941e-11,  1.484812794039761e-13,
+  static constexpr double x[17664] = {  5.705182832704843e-04, -3.066437463823634e-06,  1.235761423175758e-08, -4.425079825682941e-11,  1.484812794039761e-13,
  -4.780219096985130e-16,  1.495199630210889e-18, -4.577887614442449e-21,  1.378529182398367e-23, -4.095941278555837e-26,  1.203543648685720e-28, -3.503097643747352e-31,
   5.130841769398552e-03, -2.751516255050964e-05,  1.103834798137374e-07, -3.922805149740949e-10,  1.301301058186833e-12, -4.122278214513941e-15,  1.261597970564376e-17,
  -3.754186402175555e-20,  1.090107234024180e-22, -3.094274851809046e-25,  8.590048244140987e-28, -2.330777303554375e-30,  1.423111773354266e-02, -7.597275831845512e-05,
@@ -2570,7 +2569,7 @@ void ERIRootList::eriroot46(const double* ta, double* rr, double* ww, const int
  -8.599579972509313e-14, -3.564904980101853e-16, -1.370420548096647e-18, -4.779772739826794e-21, -1.430668536509720e-23, -3.040836564094737e-26,  1.021904050515006e-29,
   1.996896209226804e+00, -2.536165094548022e-05, -1.550274894900554e-07, -8.395145188124023e-10, -4.244321202192907e-12, -2.049652072338770e-14, -9.566271559256604e-17,
  -4.343504334847583e-19, -1.925731826079159e-21, -8.353720646818458e-24, -3.548402453318789e-26, -1.475536360414014e-28,  };
-  constexpr double w[17664] = {  6.753257840753607e-02, -1.909157118462466e-04,  5.641814726984915e-07, -1.725592537778228e-09,  5.405587075663942e-12,
+  static constexpr double w[17664] = {  6.753257840753607e-02, -1.909157118462466e-04,  5.641814726984915e-07, -1.725592537778228e-09,  5.405587075663942e-12,
  -1.718852610032908e-14,  5.510301108067322e-17, -1.772672756028853e-19,  5.705295959542973e-22, -1.833679861647983e-24,  5.878884048613919e-27, -1.879073411350058e-29,
   6.730484818788803e-02, -2.649599281120348e-04,  1.214728901405342e-06, -5.647005976231581e-09,  2.564532228544390e-11, -1.133099114336619e-13,  4.885542932662288e-16,
  -2.063113995455754e-18,  8.558567112587076e-21, -3.495860764262585e-23,  1.408525522405833e-25, -5.605928640764504e-28,  6.685265625355148e-02, -4.112309369816489e-04,
@@ -5094,52 +5093,5 @@ void ERIRootList::eriroot46(const double* ta, double* rr, double* ww, const int
  -1.541536393992103e-33,  1.239829182456159e-34, -8.563440164978146e-36,  5.182779439757868e-37, -2.791378148869517e-38,  1.354339777958685e-39, -5.969557898386045e-41,
   2.401176144692044e-30, -1.055231218341804e-30,  2.489573150082400e-31, -3.991422428987892e-32,  4.837833901759789e-33, -4.710400072608725e-34,  3.831351085874883e-35,
  -2.675477911614506e-36,  1.636648235434485e-37, -8.906945338892199e-39,  4.365516074568392e-40, -1.943205548669877e-41,  };
-  int offset = -46;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 46;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 46, 0.5);
-      fill_n(ww+offset, 46, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 46; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=46; ++j) {
-        const int boxof = it*552+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<46, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
@@ -22,20 +22,19 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot6(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[6] = {9.874701406848116e-02,8.983028345696176e-01,2.552589802668170e+00,5.196152530054465e+00,9.124248037531178e+00,
+  static constexpr double ax[6] = {9.874701406848116e-02,8.983028345696176e-01,2.552589802668170e+00,5.196152530054465e+00,9.124248037531178e+00,
     1.512995978110807e+01};
-  constexpr double aw[6] = {5.701352362624799e-01,2.604923102641610e-01,5.160798561588392e-02,3.905390584629060e-03,8.573687043587890e-05,
+  static constexpr double aw[6] = {5.701352362624799e-01,2.604923102641610e-01,5.160798561588392e-02,3.905390584629060e-03,8.573687043587890e-05,
     2.658551684356309e-07};
-  constexpr double x[2304] = {  2.909526553051856e-02, -1.104032796973577e-03,  3.096629159527982e-05, -7.574753266090117e-07,  1.692060034008341e-08,
+  static constexpr double x[2304] = {  2.909526553051856e-02, -1.104032796973577e-03,  3.096629159527982e-05, -7.574753266090117e-07,  1.692060034008341e-08,
  -3.507786777298290e-10,  6.745845870712323e-12, -1.189681790460672e-13,  1.853870543666345e-15, -2.318394815721284e-17,  1.312197870295791e-19,  4.262128234759834e-21,
   2.530531519182802e-01, -8.582692559511705e-03,  1.879879753135910e-04, -2.743785573735527e-06,  1.212704714094835e-08,  7.245790508320184e-10, -2.631458430541367e-11,
   4.441339946806361e-13, -4.888983215478155e-16, -2.164798016449122e-16,  7.041509779669604e-18, -1.065484641891653e-19,  6.547912762698439e-01, -1.736611366624101e-02,
@@ -365,7 +364,7 @@ void ERIRootList::eriroot6(const double* ta, double* rr, double* ww, const int n
  -5.748284721333979e-16,  4.562380775001588e-18, -3.621003159731187e-20,  2.873364896919869e-22, -2.278255789882872e-24,  4.803767034271206e-01, -3.812753692722983e-03,
   3.026185620055551e-05, -2.401885918515983e-07,  1.906378747552604e-09, -1.513094280659467e-11,  1.200943871583375e-13, -9.531886529448064e-16,  7.565394450587813e-18,
  -6.004348270487048e-20,  4.764443578827114e-22, -3.777050486904373e-24,  };
-  constexpr double w[2304] = {  4.737178111532396e-01, -1.193413125937565e-02,  3.435875622784921e-04, -1.012049382937202e-05,  2.924749750278915e-07,
+  static constexpr double w[2304] = {  4.737178111532396e-01, -1.193413125937565e-02,  3.435875622784921e-04, -1.012049382937202e-05,  2.924749750278915e-07,
  -8.216007586900342e-09,  2.242000404808526e-10, -5.958299040126577e-12,  1.544971831933685e-13, -3.918424560323514e-15,  9.727507628235874e-17, -2.368460848681134e-18,
   4.053078035875129e-01, -2.891909904443605e-02,  1.818014205610514e-03, -9.674076713456094e-05,  4.575121547681064e-06, -1.974049077070637e-07,  7.894426106087379e-09,
  -2.957184795214979e-10,  1.045483213327797e-11, -3.508176826224412e-13,  1.122150122535202e-14, -3.430365793849395e-16,  3.023480149814822e-01, -4.680272809330174e-02,
@@ -695,52 +694,5 @@ void ERIRootList::eriroot6(const double* ta, double* rr, double* ww, const int n
  -8.980567129949590e-21,  6.684566754777584e-23, -5.020107095159913e-25,  3.820842905370580e-27, -3.017081957899163e-29,  6.699237083751757e-08, -2.658615820563780e-10,
   1.582613263856909e-12, -1.046769215381807e-14,  7.269695245338433e-17, -5.192976632948113e-19,  3.778246786614433e-21, -2.784868426440507e-23,  2.073521300325790e-25,
  -1.559983178512732e-27,  1.197985643818946e-29, -9.827272236221206e-32,  };
-  int offset = -6;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 6;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 6, 0.5);
-      fill_n(ww+offset, 6, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 6; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=6; ++j) {
-        const int boxof = it*72+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<6, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
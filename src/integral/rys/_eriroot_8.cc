@@ -22,20 +22,19 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot8(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[8] = {7.479188259681809e-02,6.772490876492899e-01,1.905113635031426e+00,3.809476361484904e+00,6.483145428627162e+00,
+  static constexpr double ax[8] = {7.479188259681809e-02,6.772490876492899e-01,1.905113635031426e+00,3.809476361484904e+00,6.483145428627162e+00,
     1.009332367522134e+01,1.497262708842639e+01,2.198427284096267e+01};
-  constexpr double aw[8] = {5.079294790166138e-01,2.806474585285338e-01,8.381004139898596e-02,1.288031153550992e-02,9.322840086241799e-04,
+  static constexpr double aw[8] = {5.079294790166138e-01,2.806474585285338e-01,8.381004139898596e-02,1.288031153550992e-02,9.322840086241799e-04,
     2.711860092537858e-05,2.320980844865209e-07,2.654807474011186e-10};
-  constexpr double x[3072] = {  1.703852336899448e-02, -4.971200157273414e-04,  1.078591009321988e-05, -2.057293770204887e-07,  3.624793455223872e-09,
+  static constexpr double x[3072] = {  1.703852336899448e-02, -4.971200157273414e-04,  1.078591009321988e-05, -2.057293770204887e-07,  3.624793455223872e-09,
  -6.019529448575780e-11,  9.491459333242739e-13, -1.422689715448951e-14,  2.015908193162744e-16, -2.666507833952862e-18,  3.194787059818172e-20, -3.225809912631879e-22,
   1.502347811917729e-01, -4.104519277125435e-03,  7.749732598649772e-05, -1.140324378805951e-06,  1.223751710228389e-08, -5.221744856168142e-11, -1.571362617573999e-12,
   5.278085627817340e-14, -9.432749211628103e-16,  1.006518478932882e-17,  3.395621825932339e-21, -3.073885522828818e-21,  4.002480376852924e-01, -9.525922227948885e-03,
@@ -475,7 +474,7 @@ void ERIRootList::eriroot8(const double* ta, double* rr, double* ww, const int n
  -5.656409158403767e-20,  3.738877708609036e-22, -7.605589925105277e-25,  6.980013606844938e-01, -5.540042311641627e-03,  4.397135851185450e-05, -3.490008860234267e-07,
   2.770010727279923e-09, -2.198473570975659e-11,  1.744422814835338e-13, -1.382017140693099e-15,  1.085990842560360e-17, -8.207358857229808e-20,  5.137151628688910e-22,
   2.167015775643009e-26,  };
-  constexpr double w[3072] = {  3.651985904515181e-01, -6.708487712289387e-03,  1.397436913178618e-04, -3.017633965178220e-06,  6.479735764103735e-08,
+  static constexpr double w[3072] = {  3.651985904515181e-01, -6.708487712289387e-03,  1.397436913178618e-04, -3.017633965178220e-06,  6.479735764103735e-08,
  -1.365633572496841e-09,  2.816529406177995e-11, -5.690123303389180e-13,  1.127613650641323e-14, -2.195844533208196e-16,  4.206885569194064e-18, -7.937276004066660e-20,
   3.324522944994322e-01, -1.565278512482176e-02,  6.965362556344190e-04, -2.697028755397567e-05,  9.445443620263117e-07, -3.062314572127885e-08,  9.320487979610787e-10,
  -2.688119253686918e-11,  7.395917844375616e-13, -1.950969872983403e-14,  4.953464845429590e-16, -1.213565082406707e-17,  2.777632694739530e-01, -2.812491553743615e-02,
@@ -915,52 +914,5 @@ void ERIRootList::eriroot8(const double* ta, double* rr, double* ww, const int n
  -5.769084200420025e-27,  1.584384113952137e-28, -4.512123551433261e-30,  6.689802118287712e-11, -2.654871645034021e-13,  1.580386647029041e-15, -1.045322754133728e-17,
   7.261982710223815e-20, -5.203902821572211e-22,  3.881657155351792e-24, -3.330471831361262e-26,  4.470691160647841e-28, -1.074563453644504e-29,  3.235149308680949e-31,
  -9.522937932561380e-33,  };
-  int offset = -8;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 8;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 8, 0.5);
-      fill_n(ww+offset, 8, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 8; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=8; ++j) {
-        const int boxof = it*96+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<8, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
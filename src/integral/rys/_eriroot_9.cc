@@ -22,20 +22,19 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <algorithm>
-#include <cassert>
 #include <src/integral/rys/erirootlist.h>
+#include <src/integral/rys/rootkernel.h>
 
 using namespace std;
 using namespace bagel;
 
 void ERIRootList::eriroot9(const double* ta, double* rr, double* ww, const int n) {
 
-  constexpr double ax[9] = {6.670223095819444e-02,6.032363570817492e-01,1.692395079793181e+00,3.369176270243263e+00,5.694423342957752e+00,
+  static constexpr double ax[9] = {6.670223095819444e-02,6.032363570817492e-01,1.692395079793181e+00,3.369176270243263e+00,5.694423342957752e+00,
     8.769756730268591e+00,1.277182535486918e+01,1.804650546772897e+01,2.548597916609908e+01};
-  constexpr double aw[9] = {4.834956947254558e-01,2.848072856699794e-01,9.730174764131549e-02,1.864004238754467e-02,1.888522630268423e-03,
+  static constexpr double aw[9] = {4.834956947254558e-01,2.848072856699794e-01,9.730174764131549e-02,1.864004238754467e-02,1.888522630268423e-03,
     9.181126867929429e-05,1.810654481093432e-06,1.046720579579196e-08,7.828199772115708e-12};
-  constexpr double x[3456] = {  1.364589678108787e-02, -3.567844718759797e-04,  6.948809034988296e-06, -1.192399517051635e-07,  1.895880548687806e-09,
+  static constexpr double x[3456] = {  1.364589678108787e-02, -3.567844718759797e-04,  6.948809034988296e-06, -1.192399517051635e-07,  1.895880548687806e-09,
  -2.852383139983493e-11,  4.096899817958795e-13, -5.635743539448736e-15,  7.412101852962115e-17, -9.266342721982231e-19,  1.086133631427855e-20, -1.161517568985484e-22,
   1.207949834553854e-01, -2.996175800560409e-03,  5.226120551227273e-05, -7.337492300267332e-07,  8.151566084683161e-09, -5.871490805010141e-11, -1.491367500355750e-13,
   1.488888761951310e-14, -3.215237692707799e-16,  4.530630627913158e-18, -3.898747769884238e-20, -7.513035365445165e-23,  3.244542675924523e-01, -7.213518047231881e-03,
@@ -530,7 +529,7 @@ void ERIRootList::eriroot9(const double* ta, double* rr, double* ww, const int n
  -1.085993662698114e-21,  4.026427094637197e-23,  8.091806470754511e-01, -6.422472985252936e-03,  5.097518352771885e-05, -4.045864327361393e-07,  3.210868766412605e-09,
  -2.546227437108244e-11,  2.008699051958225e-13, -1.537970440341332e-15,  9.983801270967021e-18, -3.062297411635790e-21, -2.261156733478208e-21,  7.818990796421360e-23,
   };
-  constexpr double w[3456] = {  3.275160917397238e-01, -5.286154679298699e-03,  9.632045433651562e-05, -1.826684165903604e-06,  3.461715935546855e-08,
+  static constexpr double w[3456] = {  3.275160917397238e-01, -5.286154679298699e-03,  9.632045433651562e-05, -1.826684165903604e-06,  3.461715935546855e-08,
  -6.462651988229814e-10,  1.183925838316089e-11, -2.128978912268673e-13,  3.762065923499545e-15, -6.542744259755366e-17,  1.121162160739750e-18, -1.894770616360207e-20,
   3.035555463588489e-01, -1.202047910662565e-02,  4.621100309492548e-04, -1.562634734973927e-05,  4.809282725536074e-07, -1.377158669210259e-08,  3.718332347860888e-10,
  -9.550608652866109e-12,  2.348554391217942e-13, -5.555638971915294e-15,  1.268935606441885e-16, -2.805420507705207e-18,  2.622335891576053e-01, -2.212507330849835e-02,
@@ -1025,52 +1024,5 @@ void ERIRootList::eriroot9(const double* ta, double* rr, double* ww, const int n
   1.119092522441704e-28, -2.942936861711328e-30,  1.972614168471952e-12, -7.828401061346204e-15,  4.660274889382726e-17, -3.084700080348376e-19,  2.161466089584402e-21,
  -1.669702204878422e-23,  1.890530972894632e-25, -4.449392603530442e-27,  1.514538179396682e-28, -5.106864930737205e-30,  1.548763004356605e-31, -4.157996633926768e-33,
   };
-  int offset = -9;
-  for (int i = 1; i <= n; ++i) {
-    double t = ta[i-1];
-    offset += 9;
-    if (std::isnan(t)) {
-      fill_n(rr+offset, 9, 0.5);
-      fill_n(ww+offset, 9, 0.0);
-    } else if (t >= 64.0) {
-      t = 1.0/sqrt(t);
-      for (int r = 0; r != 9; ++r) {
-        rr[offset+r] = ax[r]*t*t;
-        ww[offset+r] = aw[r]*t;
-      }
-    } else {
-      assert(t >= 0);
-      int it = static_cast<int>(t*   0.500000000000000);
-      t = (t-it*2.000000000000000-   1.000000000000000) *   1.000000000000000;
-
-      const double t2 = t * 2.0;
-      for (int j=1; j <=9; ++j) {
-        const int boxof = it*108+12*(j-1);
-        double d = x[boxof+11];
-        double e = w[boxof+11];
-        double f = t2*d + x[boxof+10];
-        double g = t2*e + w[boxof+10];
-        d = t2*f - d + x[boxof+9];
-        e = t2*g - e + w[boxof+9];
-        f = t2*d - f + x[boxof+8];
-        g = t2*e - g + w[boxof+8];
-        d = t2*f - d + x[boxof+7];
-        e = t2*g - e + w[boxof+7];
-        f = t2*d - f + x[boxof+6];
-        g = t2*e - g + w[boxof+6];
-        d = t2*f - d + x[boxof+5];
-        e = t2*g - e + w[boxof+5];
-        f = t2*d - f + x[boxof+4];
-        g = t2*e - g + w[boxof+4];
-        d = t2*f - d + x[boxof+3];
-        e = t2*g - e + w[boxof+3];
-        f = t2*d - f + x[boxof+2];
-        g = t2*e - g + w[boxof+2];
-        d = t2*f - d + x[boxof+1];
-        e = t2*g - e + w[boxof+1];
-        rr[offset+j-1] = t*d - f + x[boxof+0]*0.5;
-        ww[offset+j-1] = t*e - g + w[boxof+0]*0.5;
-      }
-    }
-  }
+  rys_root::compute<9, 1>(x, w, ax, aw, ta, rr, ww, n);
 }
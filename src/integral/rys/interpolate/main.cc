@@ -357,11 +357,19 @@ int main(int argc, char** argv) {
 // You should have received a copy of the GNU General Public License\n\
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.\n\
 //\n\
-\n\
+\n";
+    // ERI and Breit roots are evaluated by the common (vectorized) kernel in rootkernel.h
+#if !defined(SPIN2) && !defined(DAWSON)
+    const bool use_kernel = true;
+#else
+    const bool use_kernel = false;
+    ofs << "\
 #include <algorithm> \n\
 #include <cassert>" << endl;
+#endif
+    const string kernel_include = use_kernel ? "#include <src/integral/rys/rootkernel.h>\n" : "";
 #ifdef BREIT
-ofs << "#include <src/integral/rys/breitrootlist.h>\n\
+ofs << "#include <src/integral/rys/breitrootlist.h>\n" << kernel_include << "\
 \n\
 using namespace std;\n\
 using namespace bagel;\n\
@@ -384,7 +392,7 @@ using namespace bagel;\n\
 \n\
 void Spin2RootList::" << func << nroot << "(const double* ta, double* rr, double* ww, const int n) {\n" << endl;
 #else
-ofs << "#include <src/integral/rys/erirootlist.h>\n\
+ofs << "#include <src/integral/rys/erirootlist.h>\n" << kernel_include << "\
 \n\
 using namespace std;\n\
 using namespace bagel;\n\
@@ -394,7 +402,7 @@ void ERIRootList::" << func << nroot << "(const double* ta, double* rr, double*
 #endif
 #endif
   ofs << "\
-  constexpr double ax["<<nroot<<"] = {";
+  " << (use_kernel ? "static " : "") << "constexpr double ax["<<nroot<<"] = {";
     for (int j=0; j!= nroot; ++j) {
       ofs << scientific << setprecision(15) << setw(20) << aroot[j];
       if (j != nroot-1) ofs << ",";
@@ -402,7 +410,7 @@ void ERIRootList::" << func << nroot << "(const double* ta, double* rr, double*
     }
     ofs << "};" << endl;
     ofs << "\
-  constexpr double aw["<<nroot<<"] = {";
+  " << (use_kernel ? "static " : "") << "constexpr double aw["<<nroot<<"] = {";
     for (int j=0; j!= nroot; ++j) {
       ofs << scientific << setprecision(15) << setw(20) << aweight[j];
       if (j != nroot-1) ofs << ",";
@@ -496,11 +504,14 @@ void ERIRootList::" << func << nroot << "(const double* ta, double* rr, double*
 #ifndef SPIN2
 #ifndef BREIT
     string tafactor = "t";
+    const int wpower = 1;
 #else
     string tafactor = "t*t*t";
+    const int wpower = 3;
 #endif
 #else
     string tafactor = "t*t*t*t*t";
+    const int wpower = 5;
 #endif
 
     int nbox2 = 0;
@@ -516,14 +527,22 @@ void ERIRootList::" << func << nroot << "(const double* ta, double* rr, double*
     }
 #endif
   ofs << "\
-  constexpr double x[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
+  " << (use_kernel ? "static " : "") << "constexpr double x[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
   ofs << listx.str() << "\
   };" << endl;
   ofs << "\
-  constexpr double w[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
+  " << (use_kernel ? "static " : "") << "constexpr double w[" << nroot*nbox1*ndeg + nroot*nbox2 <<"] = {";
   ofs << listw.str() << "\
   };" << endl;
 
+  if (use_kernel) {
+    ofs << "\
+  rys_root::compute<" << nroot << ", " << wpower << ">(x, w, ax, aw, ta, rr, ww, n);\n\
+}";
+    ofs.close();
+    continue;
+  }
+
   ofs << "\
   int offset = -" << nroot << ";\n";
 #ifdef DAWSON
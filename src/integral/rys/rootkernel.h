@@ -0,0 +1,223 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: rootkernel.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Evaluation of the interpolated Rys roots and weights used by the generated _eriroot_*.cc and _breitroot_*.cc files.
+// The roots and weights in each box are expanded in Chebyshev polynomials of degree 11 (Clenshaw summation);
+// for T >= 64 the asymptotic formulas are used. On x86-64, AVX-512 or AVX2 versions that process 8 or 4 T values
+// at once are selected at run time; the scalar version is used otherwise and for the remainder.
+
+#ifndef __SRC_INTEGRAL_RYS_ROOTKERNEL_H
+#define __SRC_INTEGRAL_RYS_ROOTKERNEL_H
+
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+#if defined(__x86_64__) && defined(__GNUC__)
+  #define RYS_ROOT_SIMD
+  #include <immintrin.h>
+#endif
+
+namespace bagel {
+namespace rys_root {
+
+// 0: scalar, 1: AVX2, 2: AVX-512
+inline int simd_level() {
+#ifdef RYS_ROOT_SIMD
+  static const int level = __builtin_cpu_supports("avx512f") ? 2 : ((__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) ? 1 : 0);
+  return level;
+#else
+  return 0;
+#endif
+}
+
+
+// WPower is the power of 1/sqrt(T) in the asymptotic weights (1 for ERI, 3 for Breit)
+template<int N, int WPower>
+void compute_one(const double* x, const double* w, const double* ax, const double* aw, double t, double* rr, double* ww) {
+  if (std::isnan(t)) {
+    std::fill_n(rr, N, 0.5);
+    std::fill_n(ww, N, 0.0);
+  } else if (t >= 64.0) {
+    t = 1.0/std::sqrt(t);
+    const double tw = WPower == 1 ? t : t*t*t;
+    for (int r = 0; r != N; ++r) {
+      rr[r] = ax[r]*t*t;
+      ww[r] = aw[r]*tw;
+    }
+  } else {
+    assert(t >= 0);
+    const int it = static_cast<int>(t*0.5);
+    t = (t-it*2.0-1.0);
+
+    const double t2 = t * 2.0;
+    for (int j = 0; j != N; ++j) {
+      const double* cx = x + it*12*N + 12*j;
+      const double* cw = w + it*12*N + 12*j;
+      double d = cx[11];
+      double e = cw[11];
+      double f = t2*d + cx[10];
+      double g = t2*e + cw[10];
+      for (int k = 9; k > 1; k -= 2) {
+        d = t2*f - d + cx[k];
+        e = t2*g - e + cw[k];
+        f = t2*d - f + cx[k-1];
+        g = t2*e - g + cw[k-1];
+      }
+      d = t2*f - d + cx[1];
+      e = t2*g - e + cw[1];
+      rr[j] = t*d - f + cx[0]*0.5;
+      ww[j] = t*e - g + cw[0]*0.5;
+    }
+  }
+}
+
+
+template<int N, int WPower>
+void compute_scalar(const double* x, const double* w, const double* ax, const double* aw, const double* ta, double* rr, double* ww, const int n) {
+  for (int i = 0; i != n; ++i)
+    compute_one<N, WPower>(x, w, ax, aw, ta[i], rr+i*N, ww+i*N);
+}
+
+
+#ifdef RYS_ROOT_SIMD
+// Lanes with T >= 64 or NaN are evaluated with a dummy T in the vector part and overwritten afterwards.
+template<int N, int WPower>
+__attribute__((target("avx2,fma")))
+int compute_avx2(const double* x, const double* w, const double* ax, const double* aw, const double* ta, double* rr, double* ww, const int n) {
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d one = _mm256_set1_pd(1.0);
+  const __m256d two = _mm256_set1_pd(2.0);
+  const __m256d half = _mm256_set1_pd(0.5);
+  const __m256d tmax = _mm256_set1_pd(64.0);
+  alignas(32) double rtmp[4];
+  alignas(32) double wtmp[4];
+
+  int i = 0;
+  for ( ; i+4 <= n; i += 4) {
+    __m256d t = _mm256_loadu_pd(ta+i);
+    const __m256d inside = _mm256_cmp_pd(t, tmax, _CMP_LT_OQ);
+    const int mask = _mm256_movemask_pd(inside);
+    t = _mm256_blendv_pd(zero, t, inside);
+
+    const __m128i it = _mm256_cvttpd_epi32(_mm256_mul_pd(t, half));
+    t = _mm256_sub_pd(_mm256_fnmadd_pd(_mm256_cvtepi32_pd(it), two, t), one);
+    const __m256d t2 = _mm256_add_pd(t, t);
+    const __m128i base = _mm_mullo_epi32(it, _mm_set1_epi32(12*N));
+
+    for (int j = 0; j != N; ++j) {
+      const __m128i b = _mm_add_epi32(base, _mm_set1_epi32(12*j));
+      __m256d d = _mm256_i32gather_pd(x+11, b, 8);
+      __m256d e = _mm256_i32gather_pd(w+11, b, 8);
+      __m256d f = _mm256_fmadd_pd(t2, d, _mm256_i32gather_pd(x+10, b, 8));
+      __m256d g = _mm256_fmadd_pd(t2, e, _mm256_i32gather_pd(w+10, b, 8));
+      for (int k = 9; k > 1; k -= 2) {
+        d = _mm256_add_pd(_mm256_fmsub_pd(t2, f, d), _mm256_i32gather_pd(x+k, b, 8));
+        e = _mm256_add_pd(_mm256_fmsub_pd(t2, g, e), _mm256_i32gather_pd(w+k, b, 8));
+        f = _mm256_add_pd(_mm256_fmsub_pd(t2, d, f), _mm256_i32gather_pd(x+k-1, b, 8));
+        g = _mm256_add_pd(_mm256_fmsub_pd(t2, e, g), _mm256_i32gather_pd(w+k-1, b, 8));
+      }
+      d = _mm256_add_pd(_mm256_fmsub_pd(t2, f, d), _mm256_i32gather_pd(x+1, b, 8));
+      e = _mm256_add_pd(_mm256_fmsub_pd(t2, g, e), _mm256_i32gather_pd(w+1, b, 8));
+      _mm256_store_pd(rtmp, _mm256_fmadd_pd(_mm256_i32gather_pd(x, b, 8), half, _mm256_fmsub_pd(t, d, f)));
+      _mm256_store_pd(wtmp, _mm256_fmadd_pd(_mm256_i32gather_pd(w, b, 8), half, _mm256_fmsub_pd(t, e, g)));
+      for (int l = 0; l != 4; ++l) {
+        rr[(i+l)*N+j] = rtmp[l];
+        ww[(i+l)*N+j] = wtmp[l];
+      }
+    }
+    if (mask != 0xF)
+      for (int l = 0; l != 4; ++l)
+        if (!(mask & (1 << l)))
+          compute_one<N, WPower>(x, w, ax, aw, ta[i+l], rr+(i+l)*N, ww+(i+l)*N);
+  }
+  return i;
+}
+
+
+template<int N, int WPower>
+__attribute__((target("avx512f")))
+int compute_avx512(const double* x, const double* w, const double* ax, const double* aw, const double* ta, double* rr, double* ww, const int n) {
+  const __m512d one = _mm512_set1_pd(1.0);
+  const __m512d two = _mm512_set1_pd(2.0);
+  const __m512d half = _mm512_set1_pd(0.5);
+  const __m512d tmax = _mm512_set1_pd(64.0);
+  const __m256i lane = _mm256_setr_epi32(0, N, 2*N, 3*N, 4*N, 5*N, 6*N, 7*N);
+
+  int i = 0;
+  for ( ; i+8 <= n; i += 8) {
+    __m512d t = _mm512_loadu_pd(ta+i);
+    const __mmask8 inside = _mm512_cmp_pd_mask(t, tmax, _CMP_LT_OQ);
+    t = _mm512_maskz_mov_pd(inside, t);
+
+    const __m256i it = _mm512_cvttpd_epi32(_mm512_mul_pd(t, half));
+    t = _mm512_sub_pd(_mm512_fnmadd_pd(_mm512_cvtepi32_pd(it), two, t), one);
+    const __m512d t2 = _mm512_add_pd(t, t);
+    const __m256i base = _mm256_mullo_epi32(it, _mm256_set1_epi32(12*N));
+    const __m256i out = _mm256_add_epi32(lane, _mm256_set1_epi32(i*N));
+
+    for (int j = 0; j != N; ++j) {
+      const __m256i b = _mm256_add_epi32(base, _mm256_set1_epi32(12*j));
+      __m512d d = _mm512_i32gather_pd(b, x+11, 8);
+      __m512d e = _mm512_i32gather_pd(b, w+11, 8);
+      __m512d f = _mm512_fmadd_pd(t2, d, _mm512_i32gather_pd(b, x+10, 8));
+      __m512d g = _mm512_fmadd_pd(t2, e, _mm512_i32gather_pd(b, w+10, 8));
+      for (int k = 9; k > 1; k -= 2) {
+        d = _mm512_add_pd(_mm512_fmsub_pd(t2, f, d), _mm512_i32gather_pd(b, x+k, 8));
+        e = _mm512_add_pd(_mm512_fmsub_pd(t2, g, e), _mm512_i32gather_pd(b, w+k, 8));
+        f = _mm512_add_pd(_mm512_fmsub_pd(t2, d, f), _mm512_i32gather_pd(b, x+k-1, 8));
+        g = _mm512_add_pd(_mm512_fmsub_pd(t2, e, g), _mm512_i32gather_pd(b, w+k-1, 8));
+      }
+      d = _mm512_add_pd(_mm512_fmsub_pd(t2, f, d), _mm512_i32gather_pd(b, x+1, 8));
+      e = _mm512_add_pd(_mm512_fmsub_pd(t2, g, e), _mm512_i32gather_pd(b, w+1, 8));
+      const __m256i o = _mm256_add_epi32(out, _mm256_set1_epi32(j));
+      _mm512_i32scatter_pd(rr, o, _mm512_fmadd_pd(_mm512_i32gather_pd(b, x, 8), half, _mm512_fmsub_pd(t, d, f)), 8);
+      _mm512_i32scatter_pd(ww, o, _mm512_fmadd_pd(_mm512_i32gather_pd(b, w, 8), half, _mm512_fmsub_pd(t, e, g)), 8);
+    }
+    if (inside != 0xFF)
+      for (int l = 0; l != 8; ++l)
+        if (!(inside & (1 << l)))
+          compute_one<N, WPower>(x, w, ax, aw, ta[i+l], rr+(i+l)*N, ww+(i+l)*N);
+  }
+  return i;
+}
+#endif
+
+
+template<int N, int WPower>
+void compute(const double* x, const double* w, const double* ax, const double* aw, const double* ta, double* rr, double* ww, const int n) {
+  int done = 0;
+#ifdef RYS_ROOT_SIMD
+  const int level = simd_level();
+  if (level == 2)
+    done = compute_avx512<N, WPower>(x, w, ax, aw, ta, rr, ww, n);
+  else if (level == 1)
+    done = compute_avx2<N, WPower>(x, w, ax, aw, ta, rr, ww, n);
+#endif
+  compute_scalar<N, WPower>(x, w, ax, aw, ta+done, rr+done*N, ww+done*N, n-done);
+}
+
+}
+}
+
+#endif
@@ -146,8 +146,10 @@ class RysIntegral : public Integral_base<DataType> {
       if (tenno_) stack_->release(size_alloc_, stack_save2_);
       stack_->release(size_alloc_, stack_save_);
 
-      if (allocated_here_)
+      if (allocated_here_) {
+        stack_->record_peak(basisinfo_[0]->angular_number() + basisinfo_[1]->angular_number() + basisinfo_[2]->angular_number() + basisinfo_[3]->angular_number());
         resources__->release(stack_);
+      }
     }
 
     virtual void compute() = 0;
@@ -72,6 +72,7 @@ int main(int argc, char** argv) {
 
       const string title = to_lower(itree->get<string>("title", ""));
       if (title.empty()) throw runtime_error("title is missing in one of the input blocks");
+      Profiler::Region region(title);
 
       if (title == "molecule") {
         geom = geom ? make_shared<Geometry>(*geom, itree) : make_shared<Geometry>(itree);
@@ -223,6 +224,11 @@ int main(int argc, char** argv) {
 
     }
 
+    Profiler::dump();
+
+    if (resources__->stack_grown() || !getenv_multiple("BAGEL_STACK_REPORT").empty())
+      resources__->print_stack_usage();
+
     print_footer();
 
   } catch (const Termination& e) {
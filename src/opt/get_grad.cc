@@ -395,9 +395,10 @@ tuple<double,shared_ptr<const Reference>,shared_ptr<GradFile>> Opt::get_grad_ene
 
     } else if (method_ == "ks") {
 
-      GradEval<KS> eval(cinput, current_, ref);
+      GradEval<KS> eval(cinput, current_, ref, prev_grid_);
       out = eval.compute("force", optinfo());
       prev_ref = eval.ref();
+      prev_grid_ = eval.task()->grid()->atomic_points();
       en = eval.energy();
 
     } else if (method_ == "dhf") {
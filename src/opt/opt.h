@@ -89,6 +89,8 @@ class Opt {
     std::vector<std::shared_ptr<const XYZFile>> prev_xyz_;
     std::vector<std::shared_ptr<const XYZFile>> prev_displ_;
     std::shared_ptr<const GradFile> prev_grad_internal_;
+    // atom-centered DFT grid points of the previous KS step
+    mutable std::shared_ptr<const AtomicPoints> prev_grid_;
 
     // protected compute module (changes object)
     void compute_optimize();
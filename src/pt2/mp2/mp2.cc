@@ -75,29 +75,28 @@ void MP2::compute() {
   size_t memory_size;
 
   {
-    // first compute half transformed integrals
-    shared_ptr<DFHalfDist> half;
+    // occupied and virtual indices are transformed at once (the half-transformed integrals are not stored)
+    shared_ptr<DFFullDist> full;
     if (abasis_.empty()) {
-      half = geom_->df()->compute_half_transform(ocoeff);
-      // used later to determine the cache size
-      memory_size = half->block(0)->size() * 2;
+      shared_ptr<const DFDist> df = geom_->df();
+      full = df->compute_full_transform(ocoeff, vcoeff);
+      // used later to determine the cache size (twice the size of the half-transformed integrals)
+      memory_size = df->block(0)->size() / df->nindex1() * nocc * 2;
       mpi__->broadcast(&memory_size, 1, 0);
     } else {
       auto info = make_shared<PTree>(); info->put("df_basis", abasis_);
       auto cgeom = make_shared<Geometry>(*geom_, info, false);
-      half = cgeom->df()->compute_half_transform(ocoeff);
+      full = cgeom->df()->compute_full_transform(ocoeff, vcoeff);
       // used later to determine the cache size
       memory_size = cgeom->df()->block(0)->size();
       mpi__->broadcast(&memory_size, 1, 0);
     }
 
-    // second transform for virtual index and rearrange data
-    {
-      // this is now (naux, nvirt, nocc), distributed by nvirt*nocc. Always naux*nvirt block is localized to one node
-      shared_ptr<DFFullDist> full = half->compute_second_transform(vcoeff)->apply_J()->swap();
-      auto dist = make_shared<StaticDist>(full->nocc1()*full->nocc2(), mpi__->size(), full->nocc1());
-      fullt = make_shared<DFDistT>(full, dist);
-    }
+    // rearrange data; this is now (naux, nvirt, nocc), distributed by nvirt*nocc. Always naux*nvirt block is localized to one node
+    full = full->apply_J()->swap();
+    auto dist = make_shared<StaticDist>(full->nocc1()*full->nocc2(), mpi__->size(), full->nocc1());
+    fullt = make_shared<DFDistT>(full, dist);
+    full.reset();
 
     fullt->discard_df();
   }
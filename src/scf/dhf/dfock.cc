@@ -39,6 +39,20 @@ DFock::DFock(shared_ptr<const Geometry> a,  shared_ptr<const ZMatrix> hc, const
 }
 
 
+DFock::DFock(shared_ptr<const Geometry> a, shared_ptr<const ZMatrix> hc, shared_ptr<const ZMatrix> coeff, const bool gaunt, const bool breit,
+             const bool store_half, const bool robust, const Part ssss, const Part gauntpart)
+  : ZMatrix(*hc), geom_(a), gaunt_(gaunt), breit_(breit), store_half_(store_half), store_half_gaunt_(false), robust_(robust),
+    skip_ssss_(ssss == Part::Reuse), skip_gaunt_(gaunt && gauntpart == Part::Reuse) {
+
+  assert(breit ? gaunt : true);
+  if (!skip_ssss_)
+    ssss_part_ = make_shared<ZMatrix>(ndim(), mdim());
+  if (gaunt_ && !skip_gaunt_)
+    gaunt_part_ = make_shared<ZMatrix>(ndim(), mdim());
+  two_electron_part(*coeff, 1.0, 1.0);
+}
+
+
 // Constructing DFock from half-transformed integrals. It is assumed that int1 is multiplied by JJ, int2 is not multplied by J.
 // CAUTION! This only does Dirac-Coulomb
 DFock::DFock(shared_ptr<const Geometry> a, shared_ptr<const ZMatrix> hc, shared_ptr<const ZMatrix> coeff, shared_ptr<const ZMatrix> tcoeff,
@@ -78,22 +92,26 @@ void DFock::two_electron_part(const ZMatView coeff, const double scale_exchange,
     // slice of the coefficients
     auto c = make_shared<ZMatrix>(ocoeffall->slice(itable.first, itable.first+itable.second));
     driver(c, false, false, scale_exchange, scale_coulomb);
-    if (gaunt_) {
+    if (gaunt_ && !skip_gaunt_)
       driver(c, gaunt_, breit_, scale_exchange, scale_coulomb);
-    }
   }
+
+  // parts accumulated separately in incremental Fock builds
+  if (ssss_part_)
+    *this += *ssss_part_;
+  if (gaunt_part_)
+    *this += *gaunt_part_;
 }
 
 
-void DFock::add_Jop_block(shared_ptr<const RelDF> dfdata, list<shared_ptr<const RelCDMatrix>> cd, const double scale) {
+void DFock::add_Jop_block(ZMatrix& out, shared_ptr<const RelDF> dfdata, const vector<shared_ptr<ZMatrix>>& dat, const double scale) {
 
-  const int n = geom_->nbasis();
-  vector<shared_ptr<ZMatrix>> dat = dfdata->compute_Jop(cd);
+  const int n = out.ndim() / 4;
 
   //add it twice, once to first basis combo, then once to opposite basis combo
   int j = 0;
   for (auto& i : dfdata->basis()) {
-    add_block(i->fac(dfdata->cartesian())*scale, n * i->basis(0), n * i->basis(1), n, n, dat[j++]);
+    out.add_block(i->fac(dfdata->cartesian())*scale, n * i->basis(0), n * i->basis(1), n, n, dat[j++]);
   }
 
   //if basis1 != basis2, get transpose to fill in opposite corner
@@ -101,7 +119,7 @@ void DFock::add_Jop_block(shared_ptr<const RelDF> dfdata, list<shared_ptr<const
     shared_ptr<const RelDF> swap = dfdata->swap();
     int j = 0;
     for (auto& i : swap->basis()) {
-      add_block(i->fac(swap->cartesian())*scale, n*i->basis(0), n*i->basis(1), n, n, dat[j++]->transpose_conjg());
+      out.add_block(i->fac(swap->cartesian())*scale, n*i->basis(0), n*i->basis(1), n, n, dat[j++]->transpose_conjg());
       // Without magnetic field, conjg does not matter because (1) offdiagonal of Coulomb is real; (2) offdiagonal of Gaunt and Breit is zero.
       // (2) is due to [sigma_w, sigma_w']_+ = \delta_ww' -- tricky!
     }
@@ -109,7 +127,7 @@ void DFock::add_Jop_block(shared_ptr<const RelDF> dfdata, list<shared_ptr<const
 }
 
 
-void DFock::add_Exop_block(shared_ptr<const RelDFHalf> dfc1, shared_ptr<const RelDFHalf> dfc2, const double scale, const bool diag) {
+void DFock::add_Exop_block(ZMatrix& target, shared_ptr<const RelDFHalf> dfc1, shared_ptr<const RelDFHalf> dfc2, const double scale, const bool diag) const {
 
   // minus from -1 in the definition of exchange
   shared_ptr<Matrix> r, i;
@@ -138,9 +156,9 @@ void DFock::add_Exop_block(shared_ptr<const RelDFHalf> dfc1, shared_ptr<const Re
       const int index0 = i1->basis(1);
       const int index1 = i2->basis(1);
 
-      add_block(-scale, n*index0, n*index1, n, n, out);
+      target.add_block(-scale, n*index0, n*index1, n, n, out);
       if (!robust_ && (!diagonal || *i1 != *i2)) {
-        add_block(-scale, n*index1, n*index0, n, n, out->transpose_conjg());
+        target.add_block(-scale, n*index1, n*index0, n, n, out->transpose_conjg());
       }
     }
   }
@@ -337,14 +355,22 @@ void DFock::build_k(list<shared_ptr<const RelDFHalf>> half_complex_exch, list<sh
   const string printtag = !gaunt ? "Coulomb" : "Gaunt";
   const double gscale = gaunt ? (breit ? -0.5 : -1.0) : 1.0;
 
+  // in incremental Fock builds, Gaunt/Breit and (SS|SS) contributions go to the separate parts (or are skipped)
+  ZMatrix& out = gaunt && gaunt_part_ ? *gaunt_part_ : *this;
+  const bool separate = !gaunt && separate_ssss();
+
   // computing K operators
   if (scale_exchange != 0.0) {
     int icnt = 0;
     for (auto& i : half_complex_exch) {
       int jcnt = 0;
       for (auto& j : half_complex_exch2) {
-        if (i->alpha_matches(j) && ((!robust_ && icnt <= jcnt) || robust_))
-          add_Exop_block(i, j, gscale*scale_exchange, icnt == jcnt);
+        if (i->alpha_matches(j) && ((!robust_ && icnt <= jcnt) || robust_)) {
+          if (!separate || !small(i) || !small(j))
+            add_Exop_block(out, i, j, gscale*scale_exchange, icnt == jcnt);
+          else if (ssss_part_)
+            add_Exop_block(*ssss_part_, i, j, gscale*scale_exchange, icnt == jcnt);
+        }
         ++jcnt;
       }
       ++icnt;
@@ -378,13 +404,31 @@ void DFock::build_j(list<shared_ptr<const RelDFHalf>> dummy, list<shared_ptr<con
     }
     list<shared_ptr<RelDF>> dfdists = make_dfdists(dfs, gaunt);
 
-    list<shared_ptr<const RelCDMatrix>> cd;
+    // in incremental Fock builds, Gaunt/Breit and (SS|SS) contributions go to the separate parts (or are skipped)
+    ZMatrix& out = gaunt && gaunt_part_ ? *gaunt_part_ : *this;
+    const bool separate = !gaunt && separate_ssss();
+
+    // fitted densities, and those from the large and small components separately
+    list<shared_ptr<const RelCDMatrix>> cd, cdl, cds;
     // compute J operators
     for (auto& j : half_complex_exch2)
-      for (auto& i : j->basis())
+      for (auto& i : j->basis()) {
         cd.push_back(make_shared<RelCDMatrix>(j, i, trocoeff, tiocoeff, geom_->df()->data2(), number_of_j));
-    for (auto& i : dfdists)
-      add_Jop_block(i, cd, gscale);
+        if (separate)
+          (small(j) ? cds : cdl).push_back(cd.back());
+      }
+    for (auto& i : dfdists) {
+      if (!separate || i->cartesian().second == Comp::L) {
+        add_Jop_block(out, i, i->compute_Jop(cd), gscale);
+      } else if (!ssss_part_) {
+        add_Jop_block(out, i, i->compute_Jop(cdl), gscale);
+      } else {
+        // (LL|SS) and (SS|SS) from one pass over the integrals
+        vector<vector<shared_ptr<ZMatrix>>> dat = i->compute_Jop(vector<list<shared_ptr<const RelCDMatrix>>>{cdl, cds});
+        add_Jop_block(out, i, dat[0], gscale);
+        add_Jop_block(*ssss_part_, i, dat[1], gscale);
+      }
+    }
     timer.tick_print(printtag + ": J operator");
   }
 }
@@ -31,6 +31,11 @@
 namespace bagel {
 
 class DFock : public ZMatrix {
+  public:
+    // In incremental Fock builds, the (SS|SS) part of the Coulomb interaction and the Gaunt (and Breit) interaction are either
+    // recomputed (and kept separately) or skipped, in which case those from a previous iteration are to be added by the caller.
+    enum class Part { Recompute, Reuse };
+
   protected:
     std::shared_ptr<const Geometry> geom_;
     const bool gaunt_;
@@ -39,8 +44,9 @@ class DFock : public ZMatrix {
     void two_electron_part(const ZMatView coeff, const double scale_ex, const double scale_coulomb);
 
 
-    void add_Jop_block(std::shared_ptr<const RelDF>, std::list<std::shared_ptr<const RelCDMatrix>>, const double scale);
-    void add_Exop_block(std::shared_ptr<const RelDFHalf>, std::shared_ptr<const RelDFHalf>, const double scale, const bool diag = false);
+    // J and K blocks are added to out, which is either *this or one of the parts for incremental Fock builds
+    static void add_Jop_block(ZMatrix& out, std::shared_ptr<const RelDF>, const std::vector<std::shared_ptr<ZMatrix>>& dat, const double scale);
+    void add_Exop_block(ZMatrix& out, std::shared_ptr<const RelDFHalf>, std::shared_ptr<const RelDFHalf>, const double scale, const bool diag = false) const;
     void driver(std::shared_ptr<const ZMatrix> coeff, bool gaunt, bool breit, const double scale_exchange, const double scale_coulomb);
 
     // when gradient is requested, we store half-transformed integrals
@@ -54,6 +60,16 @@ class DFock : public ZMatrix {
     // if true, do not use bra-ket symmetry in the exchange build (only useful for breit when accurate orbitals are needed).
     bool robust_;
 
+    // for incremental Fock builds
+    bool skip_ssss_ = false;
+    bool skip_gaunt_ = false;
+    std::shared_ptr<ZMatrix> ssss_part_;
+    std::shared_ptr<ZMatrix> gaunt_part_;
+    // whether the (SS|SS) part of the Coulomb interaction is not added to *this
+    bool separate_ssss() const { return skip_ssss_ || ssss_part_; }
+    // whether half-transformed Coulomb integrals are from the small-small block
+    static bool small(std::shared_ptr<const RelDFHalf> half) { return half->cartesian().second != Comp::L; }
+
   public:
     DFock(std::shared_ptr<const Geometry> a,  std::shared_ptr<const ZMatrix> hc, const ZMatView coeff, const bool gaunt, const bool breit,
           const bool store_half, const bool robust = false, const double scale_exch = 1.0, const double scale_coulomb = 1.0, const bool store_half_gaunt = false);
@@ -62,6 +78,9 @@ class DFock : public ZMatrix {
           const bool store_half, const bool robust = false, const double scale_exch = 1.0, const double scale_coulomb = 1.0, const bool store_half_gaunt = false)
      : DFock(a, hc, *coeff, gaunt, breit, store_half, robust, scale_exch, scale_coulomb, store_half_gaunt) {
     }
+    // incremental Fock build (see Part)
+    DFock(std::shared_ptr<const Geometry> a, std::shared_ptr<const ZMatrix> hc, std::shared_ptr<const ZMatrix> coeff, const bool gaunt, const bool breit,
+          const bool store_half, const bool robust, const Part ssss, const Part gauntpart);
     // DFock from half-transformed integrals
     DFock(std::shared_ptr<const Geometry> a, std::shared_ptr<const ZMatrix> hc, std::shared_ptr<const ZMatrix> coeff, std::shared_ptr<const ZMatrix> tcoeff,
           std::list<std::shared_ptr<const RelDFHalf>> int1c, std::list<std::shared_ptr<const RelDFHalf>> int2c,
@@ -87,6 +106,9 @@ class DFock : public ZMatrix {
     std::list<std::shared_ptr<RelDFHalf>> half_gaunt() const { assert(store_half_gaunt_); return half_gaunt_; }
     std::list<std::shared_ptr<RelDFHalf>> half_breit() const { assert(store_half_gaunt_); return half_breit_; }
 
+    std::shared_ptr<const ZMatrix> ssss_part() const { return ssss_part_; }
+    std::shared_ptr<const ZMatrix> gaunt_part() const { return gaunt_part_; }
+
     void discard_half() const {
       store_half_ = false;
       store_half_gaunt_ = false;
@@ -42,11 +42,25 @@
 using namespace std;
 using namespace bagel;
 
+namespace {
+  // largest RMS of the changes in the LL, LS (and SL) and SS blocks of the density, or of the SS block only
+  double density_change(const ZMatrix& den, const ZMatrix& ref, const bool ssonly) {
+    const int n = den.ndim() / 2;
+    const ZMatrix diff = den - ref;
+    double out = 0.0;
+    for (int i = ssonly ? 1 : 0; i != 2; ++i)
+      for (int j = ssonly ? 1 : 0; j != 2; ++j)
+        out = max(out, diff.get_submatrix(i*n, j*n, n, n)->rms());
+    return out;
+  }
+}
+
 Dirac::Dirac(const shared_ptr<const PTree> idata, const shared_ptr<const Geometry> geom,
              const shared_ptr<const Reference> re) : Method(idata, geom, re) {
   gaunt_ = idata->get<bool>("gaunt", false);
   breit_ = idata->get<bool>("breit", gaunt_);
   robust_ = idata->get<bool>("robust", false);
+  thresh_fock_reuse_ = idata->get<double>("thresh_fock_reuse", 1.0e-5);
 
   // when computing gradient, we store half-transform integrals
   do_grad_ = idata->get<bool>("_gradient", false);
@@ -123,10 +137,39 @@ void Dirac::compute() {
 
   DIIS<DistZMatrix, ZMatrix> diis(5);
 
+  // (SS|SS) and Gaunt/Breit contributions from the last Fock builds in which they were computed, and the densities used there
+  shared_ptr<const ZMatrix> ssss_part, gaunt_part, ssss_den, gaunt_den;
+  bool rebuild = false;
+
   for (int iter = 0; iter != max_iter_; ++iter) {
     Timer ptime(1);
 
-    auto fock = make_shared<DFock>(geom_, hcore_, coeff->matrix()->slice_copy(nneg_, nele_+nneg_), gaunt_, breit_, do_grad_, robust_);
+    shared_ptr<DFock> fock;
+    bool reused = false;
+    if (thresh_fock_reuse_ <= 0.0) {
+      fock = make_shared<DFock>(geom_, hcore_, coeff->matrix()->slice_copy(nneg_, nele_+nneg_), gaunt_, breit_, do_grad_, robust_);
+    } else {
+      shared_ptr<const ZMatrix> den = aodensity->matrix();
+      const bool ssss = rebuild || !ssss_den || density_change(*den, *ssss_den, true) > thresh_fock_reuse_;
+      const bool gaunt = gaunt_ && (rebuild || !gaunt_den || density_change(*den, *gaunt_den, false) > thresh_fock_reuse_);
+      fock = make_shared<DFock>(geom_, hcore_, coeff->matrix()->slice_copy(nneg_, nele_+nneg_), gaunt_, breit_, do_grad_, robust_,
+                                ssss ? DFock::Part::Recompute : DFock::Part::Reuse, gaunt ? DFock::Part::Recompute : DFock::Part::Reuse);
+      if (ssss) {
+        ssss_part = fock->ssss_part();
+        ssss_den = den;
+      } else {
+        *fock += *ssss_part;
+        reused = true;
+      }
+      if (gaunt) {
+        gaunt_part = fock->gaunt_part();
+        gaunt_den = den;
+      } else if (gaunt_) {
+        *fock += *gaunt_part;
+        reused = true;
+      }
+      rebuild = false;
+    }
 
 // TODO I have a feeling that the code should not need this, but sometimes there are slight errors. still looking on it.
 #if 0
@@ -152,7 +195,8 @@ void Dirac::compute() {
     cout << indent << setw(5) << iter << setw(20) << fixed << setprecision(8) << energy_
          << "   " << setw(17) << error << setw(15) << setprecision(2) << scftime.tick() << endl;
 
-    if (error < thresh_scf_ && iter > 0) {
+    // convergence is only accepted with a Fock matrix computed without reusing any contribution
+    if (error < thresh_scf_ && iter > 0 && !reused) {
       cout << indent << endl << indent << "  * SCF iteration converged." << endl << endl;
       // when computing gradient, we store half-transform integrals to avoid recomputation
       if (do_grad_) {
@@ -165,6 +209,10 @@ void Dirac::compute() {
         throw runtime_error("Max iteration reached in Dirac--Hartree--Fock SCF");
       else
         cout << endl << indent << "  * Max iteration reached in Dirac--Hartree--Fock SCF.  Convergence not reached! *   " << endl << endl;
+    } else if (error < thresh_scf_ && iter > 0) {
+      cout << indent << "        * Recomputing the Fock matrix without reused contributions" << endl;
+      rebuild = true;
+      continue;
     }
 
     if (iter >= diis_start_) {
@@ -49,6 +49,8 @@ class Dirac : public Method {
 
     // for Fock build
     bool robust_;
+    // the (SS|SS) and Gaunt/Breit contributions to the Fock matrix are reused while the density changes less than this
+    double thresh_fock_reuse_;
 
     int multipole_print_;
     bool conv_ignore_;
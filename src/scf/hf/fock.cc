@@ -23,159 +23,273 @@
 //
 
 #include <src/scf/hf/fock.h>
+#include <src/util/taskqueue.h>
 
 using namespace std;
 using namespace bagel;
 
 
-// Non-DF Fock matrix, standard basis
-template <>
-void Fock<0>::fock_two_electron_part(shared_ptr<const Matrix> den) {
-  const vector<shared_ptr<const Atom>> atoms = geom_->atoms();
-  vector<shared_ptr<const Shell>> basis;
-  vector<int> offset;
-  int cnt = 0;
-  for (auto aiter = atoms.begin(); aiter != atoms.end(); ++aiter, ++cnt) {
-    const vector<shared_ptr<const Shell>> tmp = (*aiter)->shells();
-    basis.insert(basis.end(), tmp.begin(), tmp.end());
-    const vector<int> tmpoff = geom_->offset(cnt);
-    offset.insert(offset.end(), tmpoff.begin(), tmpoff.end());
-  }
-
-  const int shift = sizeof(int) * 4;
-  const int size = basis.size();
+namespace bagel {
+
+// Shared data for the direct (non-DF) Fock build. Tasks accumulate into thread-private lower-triangular buffers,
+// which are summed up at the end. A task takes a free buffer for its lifetime, so that at most as many buffers
+// as threads are ever allocated.
+class DirectFockData {
+  public:
+    std::vector<std::shared_ptr<const Shell>> basis;
+    std::vector<int> offset;
+    int size;
+    int ndim;
+    // maximum density elements for each shell pair (Coulomb and exchange)
+    std::vector<double> max_density_change;
+    std::vector<double> max_density_change_ex;
+    std::vector<double> schwarz;
+    double schwarz_thresh;
+    // significant shell pairs (i2 <= i3), sorted by angular momenta and contraction patterns
+    std::vector<std::pair<int,int>> pairs;
+    const double* density;
+    const double* density_ex;
+
+    std::vector<std::shared_ptr<Matrix>> buffer;
+    std::unique_ptr<std::atomic_flag[]> flag;
+
+    DirectFockData(const int nbuf) : buffer(nbuf), flag(new std::atomic_flag[nbuf]) {
+      for (int i = 0; i != nbuf; ++i)
+        flag[i].clear();
+    }
 
-  // first make max_density_change vector for each batch pair.
-  const double* density_data = density_->data();
-
-  vector<double> max_density_change(size * size);
-  for (int i = 0; i != size; ++i) {
-    const int ioffset = offset[i];
-    const int isize = basis[i]->nbasis();
-    for (int j = i; j != size; ++j) {
-      const int joffset = offset[j];
-      const int jsize = basis[j]->nbasis();
-
-      double cmax = 0.0;
-      for (int ii = ioffset; ii != ioffset + isize; ++ii) {
-        const int iin = ii * ndim();
-        for (int jj = joffset; jj != joffset + jsize; ++jj) {
-          cmax = max(cmax, fabs(density_data[iin + jj]));
-        }
-      }
-      const int ij = i * size + j;
-      const int ji = j * size + i;
-      max_density_change[ij] = cmax;
-      max_density_change[ji] = cmax;
+    int acquire() {
+      int i = 0;
+      while (flag[i].test_and_set())
+        i = (i+1) % buffer.size();
+      if (!buffer[i])
+        buffer[i] = std::make_shared<Matrix>(ndim, ndim, true);
+      return i;
     }
-  }
+    void release(const int i) { flag[i].clear(); }
+};
 
-  ////////////////////////////////////////////
-  // starting 2-e Fock matrix evaluation!
-  ////////////////////////////////////////////
-  //////////////// ONLY FOR REFERENCES. //////////////////
 
-  for (int i0 = 0; i0 != size; ++i0) {
-    const shared_ptr<const Shell>  b0 = basis[i0];
-    const int b0offset = offset[i0];
-    const int b0size = b0->nbasis();
-    for (int i1 = i0; i1 != size; ++i1) {
-      const unsigned int i01 = i0 *size + i1;
+// computes all the shell quartets (i0 i1|i2 i3) for one bra shell pair i0 <= i1
+class DirectFockTask {
+  protected:
+    DirectFockData* data_;
+    int i0_, i1_;
+
+  public:
+    DirectFockTask(DirectFockData* d, const int i0, const int i1) : data_(d), i0_(i0), i1_(i1) { }
+
+    // the number of ket pairs scales as (size - i0)^2 / 2
+    double cost() const {
+      const int nket = data_->size - i0_;
+      return static_cast<double>(data_->basis[i0_]->nbasis() * data_->basis[i1_]->nbasis()) * nket * nket;
+    }
 
-      const shared_ptr<const Shell>  b1 = basis[i1];
-      const int b1offset = offset[i1];
+    void compute() {
+      const int ib = data_->acquire();
+      Matrix& out = *data_->buffer[ib];
+
+      const int shift = sizeof(int) * 4;
+      const int size = data_->size;
+      const int ndim = data_->ndim;
+      const double* density_data = data_->density;
+      const double* exchange_data = data_->density_ex;
+      const std::vector<double>& dmax = data_->max_density_change;
+      const std::vector<double>& kmax = data_->max_density_change_ex;
+
+      const int i0 = i0_;
+      const int i1 = i1_;
+      const unsigned int i01 = i0 * size + i1;
+
+      const std::shared_ptr<const Shell> b0 = data_->basis[i0];
+      const int b0offset = data_->offset[i0];
+      const int b0size = b0->nbasis();
+      const std::shared_ptr<const Shell> b1 = data_->basis[i1];
+      const int b1offset = data_->offset[i1];
       const int b1size = b1->nbasis();
 
-      const double density_change_01 = max_density_change[i01] * 4.0;
+      const double density_change_01 = dmax[i01] * 4.0;
 
-      for (int i2 = i0; i2 != size; ++i2) {
-        const shared_ptr<const Shell>  b2 = basis[i2];
-        const int b2offset = offset[i2];
-        const int b2size = b2->nbasis();
+      std::shared_ptr<StackMem> stack = resources__->get();
+
+      // ket pairs are visited class by class so that consecutive batches use the same VRR/HRR kernels
+      for (auto& ket : data_->pairs) {
+        const int i2 = ket.first;
+        const int i3 = ket.second;
+        const unsigned int i23 = i2 * size + i3;
+        if (i23 < i01) continue;
 
-        const double density_change_02 = max_density_change[i0 * size + i2];
-        const double density_change_12 = max_density_change[i1 * size + i2];
+        const std::shared_ptr<const Shell> b2 = data_->basis[i2];
+        const int b2offset = data_->offset[i2];
+        const int b2size = b2->nbasis();
 
-        for (int i3 = i2; i3 != size; ++i3) {
-          const unsigned int i23 = i2 * size + i3;
-          if (i23 < i01) continue;
+        const double density_change_02 = kmax[i0 * size + i2];
+        const double density_change_12 = kmax[i1 * size + i2];
 
-          const double density_change_23 = max_density_change[i2 * size + i3] * 4.0;
-          const double density_change_03 = max_density_change[i0 * size + i2];
-          const double density_change_13 = max_density_change[i0 * size + i2];
+        const double density_change_23 = dmax[i23] * 4.0;
+        const double density_change_03 = kmax[i0 * size + i3];
+        const double density_change_13 = kmax[i1 * size + i3];
 
-          const bool eqli01i23 = (i01 == i23);
+        const bool eqli01i23 = (i01 == i23);
 
-          const shared_ptr<const Shell>  b3 = basis[i3];
-          const int b3offset = offset[i3];
-          const int b3size = b3->nbasis();
+        const std::shared_ptr<const Shell> b3 = data_->basis[i3];
+        const int b3offset = data_->offset[i3];
+        const int b3size = b3->nbasis();
 
-          const double mulfactor = max(max(max(density_change_01, density_change_02),
-                                           max(density_change_12, density_change_23)),
-                                           max(density_change_03, density_change_13));
-          const double integral_bound = mulfactor * schwarz_[i01] * schwarz_[i23];
-          const bool skip_schwarz = integral_bound < schwarz_thresh_;
-          if (skip_schwarz) continue;
+        const double mulfactor = std::max(std::max(std::max(density_change_01, density_change_02),
+                                                   std::max(density_change_12, density_change_23)),
+                                                   std::max(density_change_03, density_change_13));
+        const double integral_bound = mulfactor * data_->schwarz[i01] * data_->schwarz[i23];
+        if (integral_bound < data_->schwarz_thresh) continue;
 
-          array<shared_ptr<const Shell>,4> input = {{b3, b2, b1, b0}};
+        std::array<std::shared_ptr<const Shell>,4> input = {{b3, b2, b1, b0}};
 #ifdef LIBINT_INTERFACE
-          Libint eribatch(input);
+        Libint eribatch(input, 0.0, stack);
 #else
-          ERIBatch eribatch(input, mulfactor);
+        ERIBatch eribatch(input, mulfactor, 0.0, true, stack);
 #endif
-          eribatch.compute();
-          const double* eridata = eribatch.data();
-          for (int j0 = b0offset; j0 != b0offset + b0size; ++j0) {
-            const int j0n = j0 * ndim();
-
-            for (int j1 = b1offset; j1 != b1offset + b1size; ++j1) {
-              const unsigned int nj01 = (j0 << shift) + j1;
-              const bool skipj0j1 = (j0 > j1);
-              if (skipj0j1) {
-                eridata += b2size * b3size;
-                continue;
-              }
+        eribatch.compute();
+        const double* eridata = eribatch.data();
+        for (int j0 = b0offset; j0 != b0offset + b0size; ++j0) {
+          const int j0n = j0 * ndim;
+
+          for (int j1 = b1offset; j1 != b1offset + b1size; ++j1) {
+            const unsigned int nj01 = (j0 << shift) + j1;
+            const bool skipj0j1 = (j0 > j1);
+            if (skipj0j1) {
+              eridata += b2size * b3size;
+              continue;
+            }
 
-              const bool eqlj0j1 = (j0 == j1);
-              const double scal01 = (eqlj0j1 ? 0.5 : 1.0);
-              const int j1n = j1 * ndim();
+            const bool eqlj0j1 = (j0 == j1);
+            const double scal01 = (eqlj0j1 ? 0.5 : 1.0);
+            const int j1n = j1 * ndim;
 
-              for (int j2 = b2offset; j2 != b2offset + b2size; ++j2) {
-                const int maxj1j2 = max(j1, j2);
-                const int minj1j2 = min(j1, j2);
+            for (int j2 = b2offset; j2 != b2offset + b2size; ++j2) {
+              const int maxj1j2 = std::max(j1, j2);
+              const int minj1j2 = std::min(j1, j2);
 
-                const int maxj0j2 = max(j0, j2);
-                const int minj0j2 = min(j0, j2);
-                const int j2n = j2 * ndim();
+              const int maxj0j2 = std::max(j0, j2);
+              const int minj0j2 = std::min(j0, j2);
+              const int j2n = j2 * ndim;
 
-                for (int j3 = b3offset; j3 != b3offset + b3size; ++j3, ++eridata) {
-                  const bool skipj2j3 = (j2 > j3);
-                  const unsigned int nj23 = (j2 << shift) + j3;
-                  const bool skipj01j23 = (nj01 > nj23) && eqli01i23;
+              for (int j3 = b3offset; j3 != b3offset + b3size; ++j3, ++eridata) {
+                const bool skipj2j3 = (j2 > j3);
+                const unsigned int nj23 = (j2 << shift) + j3;
+                const bool skipj01j23 = (nj01 > nj23) && eqli01i23;
 
-                  if (skipj2j3 || skipj01j23) continue;
+                if (skipj2j3 || skipj01j23) continue;
 
-                  const int maxj1j3 = max(j1, j3);
-                  const int minj1j3 = min(j1, j3);
+                const int maxj1j3 = std::max(j1, j3);
+                const int minj1j3 = std::min(j1, j3);
 
-                  double intval = *eridata * scal01 * (j2 == j3 ? 0.5 : 1.0) * (nj01 == nj23 ? 0.25 : 0.5); // 1/2 in the Hamiltonian absorbed here
-                  const double intval4 = 4.0 * intval;
+                double intval = *eridata * scal01 * (j2 == j3 ? 0.5 : 1.0) * (nj01 == nj23 ? 0.25 : 0.5); // 1/2 in the Hamiltonian absorbed here
+                const double intval4 = 4.0 * intval;
 
-                  element(j1, j0) += density_data[j2n + j3] * intval4;
-                  element(j3, j2) += density_data[j0n + j1] * intval4;
-                  element(j3, j0) -= density_data[j1n + j2] * intval;
-                  element(maxj1j2, minj1j2) -= density_data[j0n + j3] * intval;
-                  element(maxj0j2, minj0j2) -= density_data[j1n + j3] * intval;
-                  element(maxj1j3, minj1j3) -= density_data[j0n + j2] * intval;
-                }
+                out.element(j1, j0) += density_data[j2n + j3] * intval4;
+                out.element(j3, j2) += density_data[j0n + j1] * intval4;
+                out.element(j3, j0) -= exchange_data[j1n + j2] * intval;
+                out.element(maxj1j2, minj1j2) -= exchange_data[j0n + j3] * intval;
+                out.element(maxj0j2, minj0j2) -= exchange_data[j1n + j3] * intval;
+                out.element(maxj1j3, minj1j3) -= exchange_data[j0n + j2] * intval;
               }
             }
           }
+        }
+      }
+      resources__->release(stack);
+      data_->release(ib);
+    }
+};
+
+}
 
+
+// Non-DF Fock matrix, standard basis. Shell quartets are screened by the Schwarz inequality times the maximum (difference)
+// density elements. Bra shell pairs are distributed over MPI processes and then over threads through TaskQueue.
+// The exchange part is computed with den_ex when given (i.e., J[density_] - 1/2 K[den_ex]).
+template <>
+void Fock<0>::fock_two_electron_part(shared_ptr<const Matrix> den_ex) {
+  Profiler::Region region("Fock::direct");
+  Timer pdebug(3);
+
+  DirectFockData data(resources__->max_num_threads());
+  const vector<shared_ptr<const Atom>> atoms = geom_->atoms();
+  int cnt = 0;
+  for (auto aiter = atoms.begin(); aiter != atoms.end(); ++aiter, ++cnt) {
+    const vector<shared_ptr<const Shell>> tmp = (*aiter)->shells();
+    data.basis.insert(data.basis.end(), tmp.begin(), tmp.end());
+    const vector<int> tmpoff = geom_->offset(cnt);
+    data.offset.insert(data.offset.end(), tmpoff.begin(), tmpoff.end());
+  }
+
+  const int size = data.basis.size();
+  data.size = size;
+  data.ndim = ndim();
+  data.schwarz = schwarz_;
+  data.schwarz_thresh = schwarz_thresh_;
+  data.density = density_->data();
+  data.density_ex = den_ex ? den_ex->data() : density_->data();
+
+  // first make max_density_change vector for each batch pair.
+  auto max_density = [&](const double* density_data) {
+    vector<double> out(size * size);
+    for (int i = 0; i != size; ++i) {
+      const int ioffset = data.offset[i];
+      const int isize = data.basis[i]->nbasis();
+      for (int j = i; j != size; ++j) {
+        const int joffset = data.offset[j];
+        const int jsize = data.basis[j]->nbasis();
+
+        double cmax = 0.0;
+        for (int ii = ioffset; ii != ioffset + isize; ++ii) {
+          const int iin = ii * ndim();
+          for (int jj = joffset; jj != joffset + jsize; ++jj) {
+            cmax = max(cmax, fabs(density_data[iin + jj]));
+          }
         }
+        out[i * size + j] = cmax;
+        out[j * size + i] = cmax;
       }
     }
+    return out;
+  };
+  data.max_density_change = max_density(data.density);
+  data.max_density_change_ex = data.density_ex == data.density ? data.max_density_change : max_density(data.density_ex);
+
+  // significant shell pairs, grouped by (l3, l2) and contraction patterns
+  {
+    const double maxschwarz = *max_element(data.schwarz.begin(), data.schwarz.end());
+    const double maxdensity = 4.0 * max(*max_element(data.max_density_change.begin(), data.max_density_change.end()),
+                                        *max_element(data.max_density_change_ex.begin(), data.max_density_change_ex.end()));
+    for (int i2 = 0; i2 != size; ++i2)
+      for (int i3 = i2; i3 != size; ++i3)
+        if (data.schwarz[i2 * size + i3] * maxschwarz * maxdensity >= schwarz_thresh_)
+          data.pairs.emplace_back(i2, i3);
+    auto key = [&data](const pair<int,int>& p) {
+      const Shell& b2 = *data.basis[p.first];
+      const Shell& b3 = *data.basis[p.second];
+      return make_tuple(b3.angular_number(), b2.angular_number(), b3.num_primitive()*b2.num_primitive(), b3.num_contracted()*b2.num_contracted());
+    };
+    stable_sort(data.pairs.begin(), data.pairs.end(), [&key](const pair<int,int>& a, const pair<int,int>& b) { return key(a) < key(b); });
   }
+
+  ////////////////////////////////////////////
+  // starting 2-e Fock matrix evaluation!
+  ////////////////////////////////////////////
+  TaskQueue<DirectFockTask> tasks(data.pairs.size()/mpi__->size()+1);
+  int u = 0;
+  for (auto& bra : data.pairs)
+    if (u++ % mpi__->size() == mpi__->rank())
+      tasks.emplace_back(&data, bra.first, bra.second);
+  tasks.compute();
+  pdebug.tick_print("Direct Fock build");
+
+  for (auto& i : data.buffer)
+    if (i) *this += *i;
+  allreduce();
+  pdebug.tick_print("Reduction");
+
   for (int i = 0; i != ndim(); ++i) element(i, i) *= 2.0;
   fill_upper();
 }
@@ -193,6 +307,7 @@ void Fock<DF>::fock_two_electron_part(shared_ptr<const Matrix> den_ex) {
   // some constants
   assert(ndim() == df->nbasis0());
 
+  Profiler::Region region("Fock::df");
   Timer pdebug(3);
 
   shared_ptr<Matrix> coeff = den_ex->copy();
@@ -230,6 +345,7 @@ template<int DF>
 void Fock<DF>::fock_two_electron_part_with_coeff(const MatView ocoeff, const bool rhf, const double scale_exchange, const double scale_coulomb) {
   if (DF == 0) throw logic_error("Fock<DF>::fock_two_electron_part_with_coeff() is only for DF cases");
 
+  Profiler::Region region("Fock::df");
   Timer pdebug(3);
 
   shared_ptr<const DFDist> df = geom_->df();
@@ -134,7 +134,6 @@ void RHF::compute() {
     if (!dofmm_) {
       if (!dodf_) {
         previous_fock = make_shared<Fock<0>>(geom_, previous_fock, densitychange, schwarz_);
-        mpi__->broadcast(const_pointer_cast<Matrix>(previous_fock)->data(), previous_fock->size(), 0);
       } else {
         previous_fock = make_shared<Fock<1>>(geom_, hcore_, nullptr, coeff_->slice(0, nocc_), do_grad_, true/*rhf*/);
       }
@@ -22,6 +22,7 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <mutex>
 #include <numeric>
 #include <src/scf/ks/dftgrid.h>
 #include <src/scf/ks/lebedevlist.h>
@@ -36,30 +37,128 @@ using namespace bagel;
 const static LebedevList lebedev;
 
 
-vector<shared_ptr<const Matrix>> DFTGrid_base::compute_rho_sigma(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> mat,
-                                                         unique_ptr<double[]>& rho, unique_ptr<double[]>& sigma,
-                                                         unique_ptr<double[]>& rhox, unique_ptr<double[]>& rhoy, unique_ptr<double[]>& rhoz) const {
+// Kernels on a single grid point. The loops run over orbitals (or basis functions), each of which is read only once.
+namespace {
+  // r = sum_k o_k^2 and g[x] = sum_k o_k ox_k
+  void point_rho_grad(const int n, const double* o, const double* ox, const double* oy, const double* oz, double& r, double* g) {
+    double rr = 0.0, gx = 0.0, gy = 0.0, gz = 0.0;
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:rr,gx,gy,gz)
+#endif
+    for (int k = 0; k < n; ++k) {
+      rr += o[k]*o[k];
+      gx += o[k]*ox[k];
+      gy += o[k]*oy[k];
+      gz += o[k]*oz[k];
+    }
+    r = rr;
+    g[0] = gx;
+    g[1] = gy;
+    g[2] = gz;
+  }
+
+  double point_rho(const int n, const double* o) {
+    double rr = 0.0;
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:rr)
+#endif
+    for (int k = 0; k < n; ++k)
+      rr += o[k]*o[k];
+    return rr;
+  }
+
+  // out_k = a p_k + b (cx px_k + cy py_k + cz pz_k)
+  void point_combine(const int n, const double a, const double* p, const double b, const double cx, const double* px, const double cy, const double* py,
+                     const double cz, const double* pz, double* out) {
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int k = 0; k < n; ++k)
+      out[k] = a*p[k] + b*(cx*px[k] + cy*py[k] + cz*pz[k]);
+  }
+
+  void point_combine(const int n, const double a, const double* p, double* out) {
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int k = 0; k < n; ++k)
+      out[k] = a*p[k];
+  }
+
+  // s[x] = sum_k (cx px_k + cy py_k + cz pz_k) q[x]_k
+  void point_dot(const int n, const double cx, const double* px, const double cy, const double* py, const double cz, const double* pz,
+                 const double* qx, const double* qy, const double* qz, double* s) {
+    double sx = 0.0, sy = 0.0, sz = 0.0;
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:sx,sy,sz)
+#endif
+    for (int k = 0; k < n; ++k) {
+      const double t = cx*px[k] + cy*py[k] + cz*pz[k];
+      sx += t*qx[k];
+      sy += t*qy[k];
+      sz += t*qz[k];
+    }
+    s[0] = sx;
+    s[1] = sy;
+    s[2] = sz;
+  }
+
+  // s[x] = sum_k (sum_y c_y h[xy]_k) q_k, where h holds the second derivatives in the order xx, xy, yy, xz, yz, zz
+  void point_dot(const int n, const double* c, const std::array<const double*,6>& h, const double* q, double* s) {
+    double sx = 0.0, sy = 0.0, sz = 0.0;
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:sx,sy,sz)
+#endif
+    for (int k = 0; k < n; ++k) {
+      sx += (c[0]*h[0][k] + c[1]*h[1][k] + c[2]*h[3][k])*q[k];
+      sy += (c[0]*h[1][k] + c[1]*h[2][k] + c[2]*h[4][k])*q[k];
+      sz += (c[0]*h[3][k] + c[1]*h[4][k] + c[2]*h[5][k])*q[k];
+    }
+    s[0] = sx;
+    s[1] = sy;
+    s[2] = sz;
+  }
+
+  // s[x] = sum_k px[x]_k q_k
+  void point_dot(const int n, const double* px, const double* py, const double* pz, const double* q, double* s) {
+    double sx = 0.0, sy = 0.0, sz = 0.0;
+#ifdef _OPENMP
+    #pragma omp simd reduction(+:sx,sy,sz)
+#endif
+    for (int k = 0; k < n; ++k) {
+      sx += px[k]*q[k];
+      sy += py[k]*q[k];
+      sz += pz[k]*q[k];
+    }
+    s[0] = sx;
+    s[1] = sy;
+    s[2] = sz;
+  }
+}
+
+
+vector<shared_ptr<const Matrix>> DFTGrid_base::compute_rho_sigma(shared_ptr<const XCFunc> func, const GridBlock& block, shared_ptr<const Matrix> mat,
+                                                         double* rho, double* sigma, double* rhox, double* rhoy, double* rhoz) const {
   vector<shared_ptr<const Matrix>> out;
-  auto orb = make_shared<Matrix>(*mat % *grid_->basis());
+  auto orb = make_shared<Matrix>(*mat % *block.basis());
+  const int nocc = orb->ndim();
+  assert(orb->mdim() == block.size());
   if (func->lda()) {
-    assert(orb->mdim() == grid_->size());
-    for (size_t i = 0; i != orb->mdim(); ++i) {
-      rho[i] = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orb->element_ptr(0, i), 1);
-    }
+    for (size_t i = 0; i != orb->mdim(); ++i)
+      rho[i] = 2*point_rho(nocc, orb->element_ptr(0, i));
     out = vector<shared_ptr<const Matrix>>{orb};
   } else {
-    auto orbx = make_shared<Matrix>(*mat % *grid_->gradx());
-    auto orby = make_shared<Matrix>(*mat % *grid_->grady());
-    auto orbz = make_shared<Matrix>(*mat % *grid_->gradz());
+    auto orbx = make_shared<Matrix>(*mat % *block.gradx());
+    auto orby = make_shared<Matrix>(*mat % *block.grady());
+    auto orbz = make_shared<Matrix>(*mat % *block.gradz());
     for (size_t i = 0; i != orb->mdim(); ++i) {
-      rho[i] = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orb->element_ptr(0, i), 1);
-      const double sigx = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orbx->element_ptr(0, i), 1);
-      const double sigy = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orby->element_ptr(0, i), 1);
-      const double sigz = 2*ddot_(orb->ndim(), orb->element_ptr(0, i), 1, orbz->element_ptr(0, i), 1);
-      sigma[i] = 4*(sigx*sigx + sigy*sigy + sigz*sigz);
-      rhox[i] = 2*sigx;
-      rhoy[i] = 2*sigy;
-      rhoz[i] = 2*sigz;
+      double r, sig[3];
+      point_rho_grad(nocc, orb->element_ptr(0, i), orbx->element_ptr(0, i), orby->element_ptr(0, i), orbz->element_ptr(0, i), r, sig);
+      rho[i] = 2*r;
+      rhox[i] = 4*sig[0];
+      rhoy[i] = 4*sig[1];
+      rhoz[i] = 4*sig[2];
+      sigma[i] = rhox[i]*rhox[i] + rhoy[i]*rhoy[i] + rhoz[i]*rhoz[i];
     }
     out = vector<shared_ptr<const Matrix>>{orb, orbx, orby, orbz};
   }
@@ -68,35 +167,55 @@ vector<shared_ptr<const Matrix>> DFTGrid_base::compute_rho_sigma(shared_ptr<cons
 
 
 namespace bagel {
-class ExcVxcTask {
-  protected:
-    const size_t size;
-    const double* rho;
-    const double* sigma;
-    double* exc;
-    double* vxc;
-    double* vxc2;
-    shared_ptr<const XCFunc> func;
-  public:
-    ExcVxcTask(const size_t n, const double* r, const double* s, double* e, double* v, double* v2, shared_ptr<const XCFunc> f)
-     : size(n), rho(r), sigma(s), exc(e), vxc(v), vxc2(v2), func(f) { }
-    void compute() {
-      func->compute_exc_vxc(size, rho, sigma, exc, vxc, vxc2);
-    }
-};
-class VxcTask {
+class XCBlockTask {
   protected:
-    const size_t size;
-    const double* rho;
-    const double* sigma;
-    double* vxc;
-    double* vxc2;
+    const DFTGrid_base* parent;
+    shared_ptr<const GridBlock> block;
     shared_ptr<const XCFunc> func;
+    shared_ptr<const Matrix> mat;
+    Matrix* out;
+    double* en;
+    mutex* mut;
   public:
-    VxcTask(const size_t n, const double* r, const double* s, double* v, double* v2, shared_ptr<const XCFunc> f)
-     : size(n), rho(r), sigma(s), vxc(v), vxc2(v2), func(f) { }
+    XCBlockTask(const DFTGrid_base* p, shared_ptr<const GridBlock> b, shared_ptr<const XCFunc> f, shared_ptr<const Matrix> m, Matrix* o, double* e, mutex* mu)
+     : parent(p), block(b), func(f), mat(m), out(o), en(e), mut(mu) { }
     void compute() {
-      func->compute_vxc(size, rho, sigma, vxc, vxc2);
+      if (block->nbasis() == 0) return;
+      const size_t n = block->size();
+      const size_t offset = block->offset();
+      shared_ptr<const Grid> grid = parent->grid();
+
+      unique_ptr<double[]> rho(new double[n]);
+      unique_ptr<double[]> sigma, rhox, rhoy, rhoz;
+      if (!func->lda()) {
+        sigma = unique_ptr<double[]>(new double[n]);
+        rhox  = unique_ptr<double[]>(new double[n]);
+        rhoy  = unique_ptr<double[]>(new double[n]);
+        rhoz  = unique_ptr<double[]>(new double[n]);
+      }
+      parent->compute_rho_sigma(func, *block, block->gather(*mat), rho.get(), sigma.get(), rhox.get(), rhoy.get(), rhoz.get());
+
+      unique_ptr<double[]> exc(new double[n]);
+      unique_ptr<double[]> vxc(new double[n*(func->lda()?1:2)]);
+      func->compute_exc_vxc(n, rho.get(), sigma.get(), exc.get(), vxc.get(), (!func->lda() ? vxc.get()+n : nullptr));
+
+      double e = 0.0;
+      Matrix scal(block->nbasis(), n, true);
+      for (size_t i = 0; i != n; ++i) {
+        const double weight = grid->weight(offset+i);
+        if (func->lda())
+          point_combine(scal.ndim(), vxc[i]*weight, block->basis()->element_ptr(0, i), scal.element_ptr(0, i));
+        else
+          point_combine(scal.ndim(), vxc[i]*weight, block->basis()->element_ptr(0, i), 4*vxc[i+n]*weight,
+                        rhox[i], block->gradx()->element_ptr(0, i), rhoy[i], block->grady()->element_ptr(0, i), rhoz[i], block->gradz()->element_ptr(0, i),
+                        scal.element_ptr(0, i));
+        e += exc[i] * rho[i] * weight;
+      }
+      const Matrix vxcmat = scal ^ *block->basis();
+
+      lock_guard<mutex> lock(*mut);
+      block->scatter_add(vxcmat, *out);
+      *en += e;
     }
 };
 }
@@ -105,264 +224,272 @@ class VxcTask {
 tuple<shared_ptr<const Matrix>,double> DFTGrid_base::compute_xc(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> mat) const {
   Timer time;
 
-  unique_ptr<double[]> rho(new double[grid_->size()]);
-  unique_ptr<double[]> sigma, rhox, rhoy, rhoz;
-  if (!func->lda()) {
-    sigma = unique_ptr<double[]>(new double[grid_->size()]);
-    rhox  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoy  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoz  = unique_ptr<double[]>(new double[grid_->size()]);
-  }
-
-  compute_rho_sigma(func, mat, rho, sigma, rhox, rhoy, rhoz);
-
-  time.tick_print("rho, sigma");
-
-  unique_ptr<double[]> exc(new double[grid_->size()]);
-  unique_ptr<double[]> vxc(new double[grid_->size()*(func->lda()?1:2)]);
-
-  StaticDist dist(grid_->size(), min(resources__->max_num_threads()*100, grid_->size()));
-  vector<pair<size_t, size_t>> table = dist.atable();
-
-  TaskQueue<ExcVxcTask> tasks(table.size());
-  for (auto& i : table) {
-    const size_t n = i.first;
-    tasks.emplace_back(i.second, rho.get()+n, (!func->lda() ? sigma.get()+n : nullptr),
-                               exc.get()+n, vxc.get()+n, (!func->lda() ? vxc.get()+n+grid_->size() : nullptr), func);
-  }
-  tasks.compute();
-  time.tick_print("exc+vxc");
-
   auto out = make_shared<Matrix>(geom_->nbasis(), geom_->nbasis());
   double en = 0.0;
+  mutex mut;
 
-  auto scal = make_shared<Matrix>(geom_->nbasis(), grid_->size());
-  if (func->lda()) {
-    for (size_t i = 0; i != scal->mdim(); ++i) {
-      daxpy_(scal->ndim(), vxc[i]*grid_->weight(i), grid_->basis()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      en += exc[i] * rho[i] * grid_->weight(i);
-    }
-  } else {
-    for (size_t i = 0; i != scal->mdim(); ++i) {
-      daxpy_(scal->ndim(), vxc[i]*grid_->weight(i), grid_->basis()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      daxpy_(scal->ndim(), 4*vxc[i+grid_->size()]*grid_->weight(i)*rhox[i], grid_->gradx()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      daxpy_(scal->ndim(), 4*vxc[i+grid_->size()]*grid_->weight(i)*rhoy[i], grid_->grady()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      daxpy_(scal->ndim(), 4*vxc[i+grid_->size()]*grid_->weight(i)*rhoz[i], grid_->gradz()->element_ptr(0, i), 1, scal->element_ptr(0, i), 1);
-      en += exc[i] * rho[i] * grid_->weight(i);
-    }
-  }
-  *out += *scal ^ *grid_->basis();
+  // blocks of grid points are processed independently; each process takes its own blocks
+  TaskQueue<XCBlockTask> tasks(grid_->blocks().size());
+  for (size_t i = 0; i != grid_->blocks().size(); ++i)
+    if (grid_->local(i))
+      tasks.emplace_back(this, grid_->blocks()[i], func, mat, out.get(), &en, &mut);
+  tasks.compute();
+
+  out->allreduce();
+  mpi__->allreduce(&en, 1);
   out->symmetrize();
 
-  time.tick_print("contraction");
+  time.tick_print("exc+vxc");
   return make_tuple(out, en);
 }
 
 
-shared_ptr<const GradFile> DFTGrid_base::compute_xcgrad(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> mat) const {
-  auto out = make_shared<GradFile>(geom_->natom());
-
-  unique_ptr<double[]> rho(new double[grid_->size()]);
-  unique_ptr<double[]> sigma, rhox, rhoy, rhoz;
-  if (!func->lda()) {
-    sigma = unique_ptr<double[]>(new double[grid_->size()]);
-    rhox  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoy  = unique_ptr<double[]>(new double[grid_->size()]);
-    rhoz  = unique_ptr<double[]>(new double[grid_->size()]);
-  }
-  unique_ptr<double[]> vxc(new double[grid_->size()*(func->lda()?1:2)]);
-
-  vector<shared_ptr<const Matrix>> orb = compute_rho_sigma(func, mat, rho, sigma, rhox, rhoy, rhoz);
-
-  StaticDist dist(grid_->size(), min(resources__->max_num_threads()*100, grid_->size()));
-  vector<pair<size_t, size_t>> table = dist.atable();
-
-  TaskQueue<VxcTask> tasks(table.size());
-  for (auto& i : table) {
-    const size_t n = i.first;
-    tasks.emplace_back(i.second, rho.get()+n, (!func->lda() ? sigma.get()+n : nullptr),
-                            vxc.get()+n, (!func->lda() ? vxc.get()+n+grid_->size() : nullptr), func);
-  }
-  tasks.compute();
+namespace bagel {
+class XCGradBlockTask {
+  protected:
+    const DFTGrid_base* parent;
+    shared_ptr<const GridBlock> block;
+    shared_ptr<const XCFunc> func;
+    shared_ptr<const Matrix> mat;
+    GradFile* out;
+    mutex* mut;
+  public:
+    XCGradBlockTask(const DFTGrid_base* p, shared_ptr<const GridBlock> b, shared_ptr<const XCFunc> f, shared_ptr<const Matrix> m, GradFile* o, mutex* mu)
+     : parent(p), block(b), func(f), mat(m), out(o), mut(mu) { }
+    void compute() {
+      if (block->nbasis() == 0) return;
+      const size_t n = block->size();
+      const size_t offset = block->offset();
+      shared_ptr<const Grid> grid = parent->grid();
+      shared_ptr<const Geometry> geom = parent->geom();
+
+      unique_ptr<double[]> rho(new double[n]);
+      unique_ptr<double[]> sigma, rhox, rhoy, rhoz;
+      if (!func->lda()) {
+        sigma = unique_ptr<double[]>(new double[n]);
+        rhox  = unique_ptr<double[]>(new double[n]);
+        rhoy  = unique_ptr<double[]>(new double[n]);
+        rhoz  = unique_ptr<double[]>(new double[n]);
+      }
+      unique_ptr<double[]> vxc(new double[n*(func->lda()?1:2)]);
+
+      shared_ptr<const Matrix> cmat = block->gather(*mat);
+      vector<shared_ptr<const Matrix>> orb = parent->compute_rho_sigma(func, *block, cmat, rho.get(), sigma.get(), rhox.get(), rhoy.get(), rhoz.get());
+
+      func->compute_vxc(n, rho.get(), sigma.get(), vxc.get(), (!func->lda() ? vxc.get()+n : nullptr));
+
+      // in GGA, we need nabla^2 basis
+      array<shared_ptr<Matrix>,6> grad2;
+      if (!func->lda())
+        grad2 = block->compute_grad2(*grid->data());
+
+      GradFile grad(geom->natom());
+      const int nocc = mat->mdim();
+
+      // loop over target atom
+      size_t aoffset = 0;
+      int na = 0;
+      for (auto& b : geom->atoms()) {
+        int start, fence;
+        tie(start, fence) = block->local_range(aoffset, aoffset+b->nbasis());
+        aoffset += b->nbasis();
+        ++na;
+        if (start == fence) continue;
+
+        shared_ptr<const Matrix> bmat = cmat->cut(start, fence);
+        array<shared_ptr<const Matrix>,3> d1mat;
+        d1mat[0] = make_shared<const Matrix>(*bmat % *block->gradx()->cut(start, fence));
+        d1mat[1] = make_shared<const Matrix>(*bmat % *block->grady()->cut(start, fence));
+        d1mat[2] = make_shared<const Matrix>(*bmat % *block->gradz()->cut(start, fence));
+
+        double sum[3] = {0.0};
+        for (size_t i = 0; i != n; ++i) {
+          double s[3];
+          point_dot(nocc, d1mat[0]->element_ptr(0,i), d1mat[1]->element_ptr(0,i), d1mat[2]->element_ptr(0,i), orb[0]->element_ptr(0,i), s);
+          for (int x = 0; x != 3; ++x)
+            sum[x] += s[x] * grid->weight(offset+i) * vxc[i];
+        }
 
-  // in GGA, we need nabla^2 basis // TODO I guess this should be more efficient..
-  array<shared_ptr<Matrix>,6> grad2;
-  if (!func->lda())
-    grad2 = grid_->compute_grad2();
-
-  // loop over target atom
-  size_t offset = 0;
-  int n = 0;
-  for (auto& b : geom_->atoms()) {
-    shared_ptr<const Matrix> bmat = mat->cut(offset, offset+b->nbasis());
-    array<shared_ptr<const Matrix>,3> d1mat;
-    d1mat[0] = make_shared<const Matrix>(*bmat % *grid_->gradx()->cut(offset, offset+b->nbasis()));
-    d1mat[1] = make_shared<const Matrix>(*bmat % *grid_->grady()->cut(offset, offset+b->nbasis()));
-    d1mat[2] = make_shared<const Matrix>(*bmat % *grid_->gradz()->cut(offset, offset+b->nbasis()));
-
-    double sum[3] = {0.0};
-    for (size_t i = 0; i != grid_->size(); ++i) {
-      for (int x = 0; x != 3; ++x)
-        sum[x] += ddot_(mat->mdim(), d1mat[x]->element_ptr(0,i), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * vxc[i];
-    }
+        if (!func->lda()) {
+          array<shared_ptr<const Matrix>,6> d2mat;
+          for (int i = 0; i != 6; ++i)
+            d2mat[i] = make_shared<const Matrix>(*bmat % *grad2[i]->cut(start, fence));
+
+          for (size_t i = 0; i != n; ++i) {
+            const double fac = grid->weight(offset+i) * (2*vxc[i+n]);
+            const double c[3] = {rhox[i], rhoy[i], rhoz[i]};
+            double s[3];
+            // first term
+            point_dot(nocc, c, {{d2mat[0]->element_ptr(0,i), d2mat[1]->element_ptr(0,i), d2mat[2]->element_ptr(0,i),
+                                 d2mat[3]->element_ptr(0,i), d2mat[4]->element_ptr(0,i), d2mat[5]->element_ptr(0,i)}}, orb[0]->element_ptr(0,i), s);
+            for (int x = 0; x != 3; ++x)
+              sum[x] += s[x] * fac;
+            // second term
+            point_dot(nocc, c[0], orb[1]->element_ptr(0,i), c[1], orb[2]->element_ptr(0,i), c[2], orb[3]->element_ptr(0,i),
+                      d1mat[0]->element_ptr(0,i), d1mat[1]->element_ptr(0,i), d1mat[2]->element_ptr(0,i), s);
+            for (int x = 0; x != 3; ++x)
+              sum[x] += s[x] * fac;
+          }
+        }
 
-    if (!func->lda()) {
-      array<shared_ptr<const Matrix>,6> d2mat;
-      for (int i = 0; i != 6; ++i)
-        d2mat[i] = make_shared<const Matrix>(*bmat % *grad2[i]->cut(offset, offset+b->nbasis()));
-
-      unique_ptr<double[]> tmp2(new double[mat->mdim()]);
-      for (size_t i = 0; i != grid_->size(); ++i) {
-        // first term
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], d2mat[0]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], d2mat[1]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], d2mat[3]->element_ptr(0,i), 1, tmp2.get(), 1);
-        sum[0] += ddot_(mat->mdim(), tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], d2mat[1]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], d2mat[2]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], d2mat[4]->element_ptr(0,i), 1, tmp2.get(), 1);
-        sum[1] += ddot_(mat->mdim(), tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], d2mat[3]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], d2mat[4]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], d2mat[5]->element_ptr(0,i), 1, tmp2.get(), 1);
-        sum[2] += ddot_(mat->mdim(), tmp2.get(), 1, orb[0]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
-        // second term
-        fill_n(tmp2.get(), mat->mdim(), 0.0);
-        daxpy_(mat->mdim(), rhox[i], orb[1]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoy[i], orb[2]->element_ptr(0,i), 1, tmp2.get(), 1);
-        daxpy_(mat->mdim(), rhoz[i], orb[3]->element_ptr(0,i), 1, tmp2.get(), 1);
         for (int x = 0; x != 3; ++x)
-          sum[x] += ddot_(mat->mdim(), tmp2.get(), 1, d1mat[x]->element_ptr(0,i), 1) * grid_->weight(i) * (2*vxc[i+grid_->size()]);
+          grad.element(x, na-1) += -4.0*sum[x];
       }
+
+      lock_guard<mutex> lock(*mut);
+      *out += grad;
     }
+};
+}
 
-    out->element(0, n) += -4.0*sum[0];
-    out->element(1, n) += -4.0*sum[1];
-    out->element(2, n) += -4.0*sum[2];
 
-    offset += b->nbasis();
-    ++n;
-  }
+shared_ptr<const GradFile> DFTGrid_base::compute_xcgrad(shared_ptr<const XCFunc> func, shared_ptr<const Matrix> mat) const {
+  auto out = make_shared<GradFile>(geom_->natom());
+  mutex mut;
+
+  TaskQueue<XCGradBlockTask> tasks(grid_->blocks().size());
+  for (size_t i = 0; i != grid_->blocks().size(); ++i)
+    if (grid_->local(i))
+      tasks.emplace_back(this, grid_->blocks()[i], func, mat, out.get(), &mut);
+  tasks.compute();
 
+  out->allreduce();
   return out;
 }
 
 
 constexpr double a_stratmann__ = 0.64;
 
-double DFTGrid_base::fuzzy_cell(shared_ptr<const Atom> atom, array<double,3>&& xyz) const {
-  int fuzzy = -1;
-  shared_ptr<StackMem> stack = resources__->get();
-  double* const total = stack->get(geom_->natom());
-  fill_n(total, geom_->natom(), 1.0);
-
-  int i = 0;
-  for (auto b = geom_->atoms().begin(); b != geom_->atoms().end(); ++b, ++i) {
-    const double distbg = (*b)->distance(xyz);
-    int j = i+1;
-    for (auto c = b+1; c != geom_->atoms().end(); ++c, ++j) {
-      const double distbc = (*b)->distance(*c);
-      const double distcg = (*c)->distance(xyz);
-      // Stratmann CPL 1996
-      double nuij = (distbg - distcg) / distbc / a_stratmann__;
-      const double nuij2 = pow(nuij,2);
-      const double fac = (nuij >= -1 ? (nuij < 1 ?  0.5-0.5*(35.0/16.0*nuij*(1.0-nuij2*(1.0-21.0/35.0*nuij2*(1.0-5.0/21.0*nuij2)))) : 0.0) : 1.0);
-      total[i] *= fac;
-      total[j] *= 1.0-fac;
-    }
-    // TODO threshold is still hardwired (not a good practice)
-    if ((*b)->distance(atom) < 1.0e-3) fuzzy = i;
+namespace {
+  // Stratmann's cell function s(nu) with nu = mu / a (CPL 1996)
+  double stratmann(const double mu) {
+    const double nu = mu / a_stratmann__;
+    if (nu <= -1.0) return 1.0;
+    if (nu >= 1.0) return 0.0;
+    const double nu2 = nu*nu;
+    return 0.5-0.5*(35.0/16.0*nu*(1.0-nu2*(1.0-21.0/35.0*nu2*(1.0-5.0/21.0*nu2))));
   }
+}
 
-  if (fuzzy == -1)
-    throw runtime_error("grid and atoms do not match with each other");
 
-  const double out = total[fuzzy] / accumulate(total, total+geom_->natom(), 0.0); // Eq. 22
-  stack->release(geom_->natom(), total);
-  resources__->release(stack);
-  return out;
+bool AtomicPoints::matches(const Geometry& geom) const {
+  if (geom.natom() != names.size()) return false;
+  for (int i = 0; i != names.size(); ++i)
+    if (geom.atoms(i)->name() != names[i]) return false;
+  return true;
 }
 
 
-namespace bagel {
-class FuzzyTask {
-  protected:
-    shared_ptr<Matrix> data;
-    shared_ptr<const Atom> atom;
-    double xg;
-    double yg;
-    double zg;
-    double coeff;
-    DFTGrid_base* parent;
-    const int n;
-  public:
-    FuzzyTask(shared_ptr<Matrix> d, shared_ptr<const Atom> a, double x, double y, double z, double c, DFTGrid_base* ptr, const int i)
-     : data(d), atom(a), xg(x), yg(y), zg(z), coeff(c), parent(ptr), n(i) { }
+double DFTGrid_base::fuzzy_cell(const int iatom, const double* dist) const {
+  const int natom = geom_->natom();
+  const double* rab = rab_.data();
 
-    void compute() {
-      const double weight = coeff * parent->fuzzy_cell(atom, array<double,3>{{xg, yg, zg}});
-      data->element(0, n) = xg;
-      data->element(1, n) = yg;
-      data->element(2, n) = zg;
-      data->element(3, n) = weight;
+  // P_B vanishes when s(mu_AB) = 0, i.e., when d_B - d_A >= a R_AB
+  vector<int> cand;
+  double dmax = 0.0;
+  for (int b = 0; b != natom; ++b)
+    if (b == iatom || dist[b] - dist[iatom] < a_stratmann__*rab[b+natom*iatom]) {
+      cand.push_back(b);
+      dmax = max(dmax, dist[b]);
     }
+  // s(mu_BC) = 1 when d_C - d_B >= a R_BC, which holds for all candidates B when d_C >= d_B (1+a)/(1-a)
+  vector<int> near;
+  for (int c = 0; c != natom; ++c)
+    if (dist[c] < dmax*(1.0+a_stratmann__)/(1.0-a_stratmann__))
+      near.push_back(c);
+
+  double pa = 0.0;
+  double total = 0.0;
+  for (int b : cand) {
+    double pb = 1.0;
+    for (auto c = near.begin(); c != near.end() && pb != 0.0; ++c)
+      if (*c != b)
+        pb *= stratmann((dist[b] - dist[*c]) / rab[*c+natom*b]);
+    total += pb;
+    if (b == iatom) pa = pb;
+  }
+  return pa == 0.0 ? 0.0 : pa / total; // Eq. 22
+}
 
-};
+
+DFTGrid_base::DFTGrid_base(shared_ptr<const Geometry> geom, shared_ptr<const AtomicPoints> atomic) : geom_(geom) {
+  if (!atomic->matches(*geom))
+    throw logic_error("grid points of a different molecule are used in DFTGrid_base");
+  cout << "    * Reusing the grid points of the previous calculation" << endl;
+  build(atomic);
 }
 
 
-void DFTGrid_base::add_grid(const int nrad, const int nang, const unique_ptr<double[]>& r_ch, const unique_ptr<double[]>& w_ch,
-                            const unique_ptr<double[]>& x, const unique_ptr<double[]>& y, const unique_ptr<double[]>& z, const unique_ptr<double[]>& w) {
+void DFTGrid_base::add_grid(AtomicPoints& out, const int nrad, const int nang, const unique_ptr<double[]>& r_ch, const unique_ptr<double[]>& w_ch,
+                            const unique_ptr<double[]>& x, const unique_ptr<double[]>& y, const unique_ptr<double[]>& z, const unique_ptr<double[]>& w) const {
+  if (out.names.empty())
+    for (auto& a : geom_->atoms())
+      out.names.push_back(a->name());
 
-  const int ngrid = nrad*nang;
-  const int nprev = grid_ ? grid_->size() : 0;
+  for (int a = 0; a != geom_->natom(); ++a) {
+    const double rbs = geom_->atoms(a)->radius();
+    for (int i = 0; i != nrad; ++i) {
+      const double rr = r_ch[i] * rbs;
+      for (int j = 0; j != nang; ++j) {
+        out.atom.push_back(a);
+        out.point.push_back({{x[j]*rr, y[j]*rr, z[j]*rr, w[j]*w_ch[i]*pow(rbs,3)*4.0*pi__}});
+      }
+    }
+  }
+}
 
-  auto combined = make_shared<Matrix>(4, nprev+ngrid*geom_->natom());
-  if (nprev)
-    copy_n(grid_->data()->data(), 4*nprev, combined->data());
 
-  TaskQueue<FuzzyTask> tasks(geom_->natom()*nrad*nang);
+void DFTGrid_base::build(shared_ptr<const AtomicPoints> atomic) {
+  atomic_ = atomic;
+  const int natom = geom_->natom();
 
-  int cnt = nprev;
-  for (auto& a : geom_->atoms()) {
-    const double rbs = a->radius();
+  rab_.resize(natom*natom);
+  for (int a = 0; a != natom; ++a)
+    for (int b = 0; b != natom; ++b)
+      rab_[b+natom*a] = geom_->atoms(a)->distance(geom_->atoms(b));
 
+  // points closer to their atom than this are entirely in the cell of the atom
+  vector<double> rinner(natom);
+  for (int a = 0; a != natom; ++a) {
     double rib = 1.0e+10;
-    for (auto& b : geom_->atoms())
+    for (int b = 0; b != natom; ++b)
       if (a != b)
-        rib = min(rib, a->distance(b));
+        rib = min(rib, rab_[b+natom*a]);
+    rinner[a] = (0.5-0.5*a_stratmann__)*rib;
+  }
 
-    for (int i = 0; i != nrad; ++i) {
-      const double rr = r_ch[i] * rbs;
-      if (rr < (0.5-0.5*a_stratmann__)*rib) {
-        for (int j = 0; j != nang; ++j) {
-          const double xg = x[j] * rr + a->position(0);
-          const double yg = y[j] * rr + a->position(1);
-          const double zg = z[j] * rr + a->position(2);
-          combined->element(0, cnt) = xg;
-          combined->element(1, cnt) = yg;
-          combined->element(2, cnt) = zg;
-          combined->element(3, cnt) = w[j]*w_ch[i]*pow(rbs,3)*4.0*pi__;
-          ++cnt;
-        }
-      } else {
-        for (int j = 0; j != nang; ++j) {
-          const double xg = x[j] * rr + a->position(0);
-          const double yg = y[j] * rr + a->position(1);
-          const double zg = z[j] * rr + a->position(2);
-          tasks.emplace_back(combined, a, xg, yg, zg, w[j]*w_ch[i]*pow(rbs,3)*4.0*pi__, this, cnt++);
+  const size_t npoint = atomic->point.size();
+  auto combined = make_shared<Matrix>(4, npoint);
+
+  const size_t chunk = 1024;
+  TaskQueue<function<void(void)>> tasks((npoint+chunk-1)/chunk);
+  for (size_t start = 0; start < npoint; start += chunk) {
+    const size_t fence = min(start+chunk, npoint);
+    tasks.emplace_back(
+      [this, &atomic, &combined, &rinner, natom, start, fence]() {
+        vector<double> dist(natom);
+        for (size_t n = start; n != fence; ++n) {
+          const int a = atomic->atom[n];
+          const array<double,4>& p = atomic->point[n];
+          const array<double,3> xyz{{p[0] + geom_->atoms(a)->position(0), p[1] + geom_->atoms(a)->position(1), p[2] + geom_->atoms(a)->position(2)}};
+          copy_n(xyz.begin(), 3, combined->element_ptr(0, n));
+          if (sqrt(p[0]*p[0] + p[1]*p[1] + p[2]*p[2]) < rinner[a]) {
+            combined->element(3, n) = p[3];
+          } else {
+            for (int b = 0; b != natom; ++b)
+              dist[b] = geom_->atoms(b)->distance(xyz);
+            combined->element(3, n) = p[3] * fuzzy_cell(a, dist.data());
+          }
         }
       }
-    }
+    );
   }
   tasks.compute();
 
   shared_ptr<const Matrix> o = combined;
   grid_ = make_shared<Grid>(geom_, o);
-
+  remove_redgrid();
+  grid_->init();
 }
 
 
@@ -408,9 +535,9 @@ BLGrid::BLGrid(const size_t nrad, const size_t nang, shared_ptr<const Geometry>
             * r_ch[i]*r_ch[i];                       // due to r^2 in the spherical coordinate integration
   }
 
-  add_grid(nrad, nang, r_ch, w_ch, x, y, z, w);
-  remove_redgrid();
-  grid_->init();
+  auto atomic = make_shared<AtomicPoints>();
+  add_grid(*atomic, nrad, nang, r_ch, w_ch, x, y, z, w);
+  build(atomic);
 }
 
 
@@ -433,9 +560,9 @@ TALGrid::TALGrid(const size_t nrad, const size_t nang, shared_ptr<const Geometry
             * r_ch[i]*r_ch[i];                       // due to r^2 in the spherical coordinate integration
   }
 
-  add_grid(nrad, nang, r_ch, w_ch, x, y, z, w);
-  remove_redgrid();
-  grid_->init();
+  auto atomic = make_shared<AtomicPoints>();
+  add_grid(*atomic, nrad, nang, r_ch, w_ch, x, y, z, w);
+  build(atomic);
 }
 
 
@@ -463,6 +590,8 @@ DefaultGrid::DefaultGrid(shared_ptr<const Geometry> geom) : DFTGrid_base(geom) {
   map.push_back(make_tuple(55, 60, 50));
   map.push_back(make_tuple(60, 70, 38));
   map.push_back(make_tuple(70, 75, 6));
+
+  auto atomic = make_shared<AtomicPoints>();
   for (auto& i : map) {
     const int nang = get<2>(i);
     unique_ptr<double[]> rr(new double[get<1>(i)-get<0>(i)]);
@@ -475,9 +604,8 @@ DefaultGrid::DefaultGrid(shared_ptr<const Geometry> geom) : DFTGrid_base(geom) {
     unique_ptr<double[]> z(new double[nang]);
     unique_ptr<double[]> w(new double[nang]);
     lebedev.root(nang, x.get(), y.get(), z.get(), w.get());
-    add_grid(get<1>(i)-get<0>(i), nang, rr, ww, x, y, z, w);
+    add_grid(*atomic, get<1>(i)-get<0>(i), nang, rr, ww, x, y, z, w);
   }
 
-  remove_redgrid();
-  grid_->init();
+  build(atomic);
 }
@@ -30,27 +30,54 @@
 
 namespace bagel {
 
+// Quadrature points relative to the atom they belong to, and their weights in the atomic integration (i.e., without the cell functions).
+// They do not depend on the positions of the atoms, and are reused when the atoms move (e.g., in geometry optimization).
+struct AtomicPoints {
+  // elements of the atoms
+  std::vector<std::string> names;
+  // atom, and x, y, z (relative to the atom) and weight of each point
+  std::vector<int> atom;
+  std::vector<std::array<double,4>> point;
+
+  bool matches(const Geometry& geom) const;
+};
+
+
 class DFTGrid_base {
   protected:
     const std::shared_ptr<const Geometry> geom_;
     std::shared_ptr<Grid> grid_;
+    std::shared_ptr<const AtomicPoints> atomic_;
+
+    // inter-atomic distances
+    std::vector<double> rab_;
 
     // TODO to be controlled by the input deck
     constexpr static double grid_thresh_ = 1.0e-10;
 
-    void add_grid(const int nrad, const int nang, const std::unique_ptr<double[]>& r_ch, const std::unique_ptr<double[]>& w_ch,
-                  const std::unique_ptr<double[]>& x, const std::unique_ptr<double[]>& y, const std::unique_ptr<double[]>& z, const std::unique_ptr<double[]>& w);
+    void add_grid(AtomicPoints& out, const int nrad, const int nang, const std::unique_ptr<double[]>& r_ch, const std::unique_ptr<double[]>& w_ch,
+                  const std::unique_ptr<double[]>& x, const std::unique_ptr<double[]>& y, const std::unique_ptr<double[]>& z, const std::unique_ptr<double[]>& w) const;
+    // places the points on the atoms, computes the weights, and sets up the grid
+    void build(std::shared_ptr<const AtomicPoints> atomic);
     void remove_redgrid();
 
-    std::vector<std::shared_ptr<const Matrix>> compute_rho_sigma(std::shared_ptr<const XCFunc> func, std::shared_ptr<const Matrix> mat,
-                                                    std::unique_ptr<double[]>& rho, std::unique_ptr<double[]>& sigma,
-                                                    std::unique_ptr<double[]>& rhox, std::unique_ptr<double[]>& rhoy, std::unique_ptr<double[]>& rhoz) const;
   public:
     DFTGrid_base(std::shared_ptr<const Geometry> geom) : geom_(geom) { }
+    // grid made of the points of another grid for the same molecule; only the weights and basis functions are recomputed
+    DFTGrid_base(std::shared_ptr<const Geometry> geom, std::shared_ptr<const AtomicPoints> atomic);
+
+    std::shared_ptr<const Geometry> geom() const { return geom_; }
+    std::shared_ptr<const Grid> grid() const { return grid_; }
+    std::shared_ptr<const AtomicPoints> atomic_points() const { return atomic_; }
+
+    // rho, sigma and the gradient of rho on the points of a block; mat holds the rows of the block (see GridBlock::gather)
+    std::vector<std::shared_ptr<const Matrix>> compute_rho_sigma(std::shared_ptr<const XCFunc> func, const GridBlock& block, std::shared_ptr<const Matrix> mat,
+                                                    double* rho, double* sigma, double* rhox, double* rhoy, double* rhoz) const;
 
     std::tuple<std::shared_ptr<const Matrix>,double> compute_xc(std::shared_ptr<const XCFunc> func, std::shared_ptr<const Matrix> mat) const;
     std::shared_ptr<const GradFile> compute_xcgrad(std::shared_ptr<const XCFunc> func, std::shared_ptr<const Matrix> mat) const;
-    double fuzzy_cell(std::shared_ptr<const Atom> a, std::array<double,3>&& x) const;
+    // Becke's cell function of atom iatom with Stratmann's partitioning; dist holds the distances from x to the atoms
+    double fuzzy_cell(const int iatom, const double* dist) const;
 };
 
 
@@ -22,101 +22,208 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <numeric>
 #include <src/scf/ks/grid.h>
 #include <src/util/parallel/resources.h>
 
-namespace bagel {
-class GridBasisTask {
-  protected:
-    double* const a;
-    double* const b;
-    double* const c;
-    double* const d;
-    const double x;
-    const double y;
-    const double z;
-    std::shared_ptr<const Geometry> geom_;
-  public:
-    GridBasisTask(double* aa, double* bb, double* cc, double* dd, const double xx, const double yy, const double zz, std::shared_ptr<const Geometry> g)
-    : a(aa), b(bb), c(cc), d(dd), x(xx), y(yy), z(zz), geom_(g) { }
-    void compute() {
-      int pos = 0;
-      for (auto& i : geom_->atoms()) {
-        // xyz coordinate relative to the atom i
-        const double rx = x - i->position(0);
-        const double ry = y - i->position(1);
-        const double rz = z - i->position(2);
-        for (auto& j : i->shells()) {
-          j->compute_grid_value(a+pos, b+pos, c+pos, d+pos, rx, ry, rz);
-          pos += j->nbasis();
-        }
-      }
+using namespace std;
+using namespace bagel;
+
+GridBlock::GridBlock(const size_t offset, const size_t size, const Matrix& data) : offset_(offset), size_(size), center_{{0.0, 0.0, 0.0}}, radius_(0.0), nbasis_(0) {
+  array<double,3> lo, hi;
+  for (int x = 0; x != 3; ++x) {
+    lo[x] = hi[x] = data(x, offset_);
+    for (size_t g = offset_; g != offset_+size_; ++g) {
+      lo[x] = min(lo[x], data(x, g));
+      hi[x] = max(hi[x], data(x, g));
     }
-};
-class GridDeriv2Task {
-  protected:
-    double* const a;
-    double* const b;
-    double* const c;
-    double* const d;
-    double* const e;
-    double* const f;
-    const double x;
-    const double y;
-    const double z;
-    std::shared_ptr<const Geometry> geom_;
-  public:
-    GridDeriv2Task(double* aa, double* bb, double* cc, double* dd, double* ee, double* ff,
-                   const double xx, const double yy, const double zz, std::shared_ptr<const Geometry> g)
-    : a(aa), b(bb), c(cc), d(dd), e(ee), f(ff), x(xx), y(yy), z(zz), geom_(g) { }
-    void compute() {
-      int pos = 0;
-      for (auto& i : geom_->atoms()) {
-        // xyz coordinate relative to the atom i
-        const double rx = x - i->position(0);
-        const double ry = y - i->position(1);
-        const double rz = z - i->position(2);
-        for (auto& j : i->shells()) {
-          j->compute_grid_value_deriv2(a+pos, b+pos, c+pos, d+pos, e+pos, f+pos, rx, ry, rz);
-          pos += j->nbasis();
-        }
+    center_[x] = 0.5*(lo[x] + hi[x]);
+  }
+  for (size_t g = offset_; g != offset_+size_; ++g)
+    radius_ = max(radius_, sqrt(pow(data(0,g)-center_[0], 2) + pow(data(1,g)-center_[1], 2) + pow(data(2,g)-center_[2], 2)));
+}
+
+
+void GridBlock::add_shell(shared_ptr<const Shell> shell, const int offset) {
+  assert(shells_.empty() || shells_.back().second < offset);
+  shells_.emplace_back(shell, offset);
+  if (!ranges_.empty() && ranges_.back().second == offset)
+    ranges_.back().second += shell->nbasis();
+  else
+    ranges_.emplace_back(offset, offset+shell->nbasis());
+  nbasis_ += shell->nbasis();
+}
+
+
+pair<int,int> GridBlock::local_range(const int start, const int fence) const {
+  int lstart = 0;
+  int lfence = 0;
+  int pos = 0;
+  for (auto& r : ranges_) {
+    if (r.second <= start)
+      lstart += r.second - r.first;
+    else if (r.first < start)
+      lstart += start - r.first;
+    if (r.second <= fence)
+      lfence += r.second - r.first;
+    else if (r.first < fence)
+      lfence += fence - r.first;
+    pos += r.second - r.first;
+  }
+  assert(pos == nbasis_);
+  return {lstart, lfence};
+}
+
+
+shared_ptr<Matrix> GridBlock::gather(const Matrix& mat) const {
+  auto out = make_shared<Matrix>(nbasis_, mat.mdim(), true);
+  int pos = 0;
+  for (auto& r : ranges_) {
+    out->copy_block(pos, 0, r.second-r.first, mat.mdim(), mat.get_submatrix(r.first, 0, r.second-r.first, mat.mdim()));
+    pos += r.second-r.first;
+  }
+  return out;
+}
+
+
+void GridBlock::scatter_add(const Matrix& in, Matrix& out) const {
+  assert(in.ndim() == nbasis_ && in.mdim() == nbasis_);
+  int jpos = 0;
+  for (auto& rj : ranges_) {
+    for (int j = rj.first; j != rj.second; ++j, ++jpos) {
+      int ipos = 0;
+      for (auto& ri : ranges_) {
+        blas::ax_plus_y_n(1.0, in.element_ptr(ipos, jpos), ri.second-ri.first, out.element_ptr(ri.first, j));
+        ipos += ri.second-ri.first;
       }
     }
-};
+  }
 }
 
 
-using namespace std;
-using namespace bagel;
+void GridBlock::init(const Matrix& data) {
+  basis_ = make_shared<Matrix>(nbasis_, size_, true);
+  gradx_ = make_shared<Matrix>(nbasis_, size_, true);
+  grady_ = make_shared<Matrix>(nbasis_, size_, true);
+  gradz_ = make_shared<Matrix>(nbasis_, size_, true);
+  if (nbasis_ == 0) return;
 
-void Grid::init() {
-  const int ngrid = size();
-  basis_ = make_shared<Matrix>(geom_->nbasis(), ngrid);
-  gradx_ = make_shared<Matrix>(geom_->nbasis(), ngrid);
-  grady_ = make_shared<Matrix>(geom_->nbasis(), ngrid);
-  gradz_ = make_shared<Matrix>(geom_->nbasis(), ngrid);
-
-  // TODO I guess this should be more efficient..
-  TaskQueue<GridBasisTask> tasks(ngrid);
-  for (size_t g = 0; g != ngrid; ++g) {
-    tasks.emplace_back(basis_->element_ptr(0,g), gradx_->element_ptr(0,g), grady_->element_ptr(0,g), gradz_->element_ptr(0,g),
-                                  data_->element(0,g), data_->element(1,g), data_->element(2,g), geom_);
+  for (size_t g = 0; g != size_; ++g) {
+    int pos = 0;
+    for (auto& i : shells_) {
+      // xyz coordinate relative to the center of the shell
+      const double rx = data(0, offset_+g) - i.first->position(0);
+      const double ry = data(1, offset_+g) - i.first->position(1);
+      const double rz = data(2, offset_+g) - i.first->position(2);
+      i.first->compute_grid_value(basis_->element_ptr(pos,g), gradx_->element_ptr(pos,g), grady_->element_ptr(pos,g), gradz_->element_ptr(pos,g), rx, ry, rz);
+      pos += i.first->nbasis();
+    }
   }
-  tasks.compute();
 }
 
 
-array<shared_ptr<Matrix>,6> Grid::compute_grad2() const {
+array<shared_ptr<Matrix>,6> GridBlock::compute_grad2(const Matrix& data) const {
   array<shared_ptr<Matrix>,6> out;
   for (auto& i : out)
-   i = make_shared<Matrix>(geom_->nbasis(), size());
+    i = make_shared<Matrix>(nbasis_, size_, true);
+  if (nbasis_ == 0) return out;
 
-  TaskQueue<GridDeriv2Task> tasks(size());
-  for (size_t g = 0; g != size(); ++g) {
-    tasks.emplace_back(out[0]->element_ptr(0,g), out[1]->element_ptr(0,g), out[2]->element_ptr(0,g),
-                                   out[3]->element_ptr(0,g), out[4]->element_ptr(0,g), out[5]->element_ptr(0,g),
-                                   data_->element(0,g), data_->element(1,g), data_->element(2,g), geom_);
+  for (size_t g = 0; g != size_; ++g) {
+    int pos = 0;
+    for (auto& i : shells_) {
+      const double rx = data(0, offset_+g) - i.first->position(0);
+      const double ry = data(1, offset_+g) - i.first->position(1);
+      const double rz = data(2, offset_+g) - i.first->position(2);
+      i.first->compute_grid_value_deriv2(out[0]->element_ptr(pos,g), out[1]->element_ptr(pos,g), out[2]->element_ptr(pos,g),
+                                         out[3]->element_ptr(pos,g), out[4]->element_ptr(pos,g), out[5]->element_ptr(pos,g), rx, ry, rz);
+      pos += i.first->nbasis();
+    }
   }
-  tasks.compute();
   return out;
 }
+
+
+void Grid::partition(Matrix& data, const size_t start, const size_t fence) {
+  if (fence - start <= blocksize_) {
+    blocks_.push_back(make_shared<GridBlock>(start, fence-start, data));
+    return;
+  }
+  // split at the median along the longest extent of the bounding box
+  int axis = 0;
+  double extent = -1.0;
+  for (int x = 0; x != 3; ++x) {
+    double lo = data(x, start);
+    double hi = lo;
+    for (size_t g = start; g != fence; ++g) {
+      lo = min(lo, data(x, g));
+      hi = max(hi, data(x, g));
+    }
+    if (hi - lo > extent) {
+      extent = hi - lo;
+      axis = x;
+    }
+  }
+  vector<size_t> index(fence-start);
+  iota(index.begin(), index.end(), start);
+  const size_t half = (fence-start)/2;
+  nth_element(index.begin(), index.begin()+half, index.end(), [&data, &axis](const size_t a, const size_t b) { return data(axis, a) < data(axis, b); });
+  Matrix tmp(4, fence-start, true);
+  for (size_t g = 0; g != index.size(); ++g)
+    copy_n(data.element_ptr(0, index[g]), 4, tmp.element_ptr(0, g));
+  copy_n(tmp.data(), tmp.size(), data.element_ptr(0, start));
+
+  partition(data, start, start+half);
+  partition(data, start+half, fence);
+}
+
+
+void Grid::init() {
+  // sort the points into spatially compact blocks
+  auto data = make_shared<Matrix>(*data_);
+  blocks_.clear();
+  if (size() > 0)
+    partition(*data, 0, size());
+  data_ = data;
+
+  // extent of each shell: the distance beyond which the shell (and its gradient) is below basis_thresh_ (an upper bound)
+  vector<tuple<shared_ptr<const Shell>, int, double>> shells;
+  int offset = 0;
+  for (auto& atom : geom_->atoms())
+    for (auto& shell : atom->shells()) {
+      const int l = shell->angular_number();
+      double rmax = 0.0;
+      for (auto& c : shell->contractions())
+        for (int j = 0; j != shell->num_primitive(); ++j) {
+          const double a = shell->exponents(j);
+          auto value = [&](const double r) { return fabs(c[j]) * (1.0 + 2.0*a*r) * pow(r, l) * exp(-a*r*r); };
+          // the value decreases monotonically beyond r0
+          double r0 = sqrt((l+1.0)/(2.0*a));
+          double r1 = r0 + 1.0;
+          while (value(r1) > basis_thresh_)
+            r1 *= 2.0;
+          for (int iter = 0; iter != 50; ++iter) {
+            const double r = 0.5*(r0 + r1);
+            (value(r) > basis_thresh_ ? r0 : r1) = r;
+          }
+          rmax = max(rmax, r1);
+        }
+      shells.emplace_back(shell, offset, rmax);
+      offset += shell->nbasis();
+    }
+
+  // each process evaluates the basis functions only on its blocks
+  TaskQueue<function<void(void)>> tasks(blocks_.size());
+  for (size_t i = 0; i != blocks_.size(); ++i) {
+    if (!local(i)) continue;
+    shared_ptr<GridBlock> block = blocks_[i];
+    for (auto& s : shells) {
+      const array<double,3>& center = block->center();
+      const array<double,3>& pos = get<0>(s)->position();
+      const double dist = sqrt(pow(center[0]-pos[0], 2) + pow(center[1]-pos[1], 2) + pow(center[2]-pos[2], 2));
+      if (dist - block->radius() < get<2>(s))
+        block->add_shell(get<0>(s), get<1>(s));
+    }
+    tasks.emplace_back([this, block] { block->init(*data_); });
+  }
+  tasks.compute();
+}
@@ -32,30 +32,87 @@
 
 namespace bagel {
 
-class Grid {
+// A spatially compact batch of grid points together with the basis functions that are not negligible on it.
+// Basis functions (and their derivatives) are stored only for those functions, in the order of the full basis.
+class GridBlock {
   protected:
-    const std::shared_ptr<const Geometry> geom_;
-    const std::shared_ptr<const Matrix> data_; // x,y,z,weight
+    // first point in Grid::data() and number of points
+    size_t offset_;
+    size_t size_;
+    // bounding sphere of the points
+    std::array<double,3> center_;
+    double radius_;
+
+    // ranges [start, fence) of the significant basis functions in the full basis (adjacent shells are merged)
+    std::vector<std::pair<int,int>> ranges_;
+    int nbasis_;
 
-    // basis functions and derivaties on this grid
+    // basis functions and derivatives on the points (nbasis_ x size_)
     std::shared_ptr<Matrix> basis_;
     std::shared_ptr<Matrix> gradx_;
     std::shared_ptr<Matrix> grady_;
     std::shared_ptr<Matrix> gradz_;
 
+    // shells (and their offsets in the full basis) that reach this block
+    std::vector<std::pair<std::shared_ptr<const Shell>,int>> shells_;
+
   public:
-    Grid(std::shared_ptr<const Geometry> g, std::shared_ptr<const Matrix>& o)
-      : geom_(g), data_(o) { assert(data_->ndim() == 4); }
+    GridBlock(const size_t offset, const size_t size, const Matrix& data);
+
+    size_t offset() const { return offset_; }
+    size_t size() const { return size_; }
+    const std::array<double,3>& center() const { return center_; }
+    double radius() const { return radius_; }
+
+    // adds a shell that starts at offset in the full basis; shells must be added in the order of the full basis
+    void add_shell(std::shared_ptr<const Shell> shell, const int offset);
+    int nbasis() const { return nbasis_; }
+    const std::vector<std::pair<int,int>>& ranges() const { return ranges_; }
+    // local range of the functions in [start, fence) of the full basis
+    std::pair<int,int> local_range(const int start, const int fence) const;
 
     std::shared_ptr<const Matrix> basis() const { return basis_; }
     std::shared_ptr<const Matrix> gradx() const { return gradx_; }
     std::shared_ptr<const Matrix> grady() const { return grady_; }
     std::shared_ptr<const Matrix> gradz() const { return gradz_; }
+
+    // rows of mat (nbasis x m) that belong to this block
+    std::shared_ptr<Matrix> gather(const Matrix& mat) const;
+    // adds a nbasis_ x nbasis_ matrix to the corresponding elements of out (nbasis x nbasis)
+    void scatter_add(const Matrix& in, Matrix& out) const;
+
+    void init(const Matrix& data);
+    std::array<std::shared_ptr<Matrix>,6> compute_grad2(const Matrix& data) const;
+};
+
+
+class Grid {
+  protected:
+    const std::shared_ptr<const Geometry> geom_;
+    std::shared_ptr<const Matrix> data_; // x,y,z,weight
+
+    // blocks of points; the points are sorted so that each block is contiguous in data_
+    std::vector<std::shared_ptr<GridBlock>> blocks_;
+
+    // maximum number of points in a block
+    static const size_t blocksize_ = 128;
+    // basis functions whose values (and gradients) are smaller than this on a block are neglected
+    constexpr static double basis_thresh_ = 1.0e-12;
+
+    // recursively bisects the points in [start, fence) of data along the longest extent
+    void partition(Matrix& data, const size_t start, const size_t fence);
+
+  public:
+    Grid(std::shared_ptr<const Geometry> g, std::shared_ptr<const Matrix>& o)
+      : geom_(g), data_(o) { assert(data_->ndim() == 4); }
+
     const double& weight(const size_t i) const { return data_->element(3,i); }
     size_t size() const { return data_->mdim(); }
     std::shared_ptr<const Matrix> data() const { return data_; }
 
-    std::array<std::shared_ptr<Matrix>,6> compute_grad2() const;
+    const std::vector<std::shared_ptr<GridBlock>>& blocks() const { return blocks_; }
+    // blocks are distributed over MPI processes
+    bool local(const size_t iblock) const { return iblock % mpi__->size() == mpi__->rank(); }
 
     void init();
 
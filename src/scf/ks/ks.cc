@@ -30,6 +30,13 @@
 using namespace std;
 using namespace bagel;
 
+shared_ptr<DFTGrid_base> KS::construct_grid(shared_ptr<const Geometry> geom, shared_ptr<const AtomicPoints> points) {
+  if (points && points->matches(*geom))
+    return make_shared<DFTGrid_base>(geom, points);
+  return make_shared<DefaultGrid>(geom);
+}
+
+
 void KS::compute() {
 
   Matrix intermediate = *tildex_ % *hcore_ * *tildex_;
@@ -40,8 +40,12 @@ class KS : public SCF_base {
     std::shared_ptr<XCFunc> func_;
     std::shared_ptr<DFTGrid_base> grid_;
 
+    // reuses the atom-centered grid points when they belong to the same molecule (e.g., those of the previous step in geometry optimization)
+    static std::shared_ptr<DFTGrid_base> construct_grid(std::shared_ptr<const Geometry> geom, std::shared_ptr<const AtomicPoints> points);
+
   public:
-    KS(const std::shared_ptr<const PTree> idata, const std::shared_ptr<const Geometry> geom, const std::shared_ptr<const Reference> re = nullptr)
+    KS(const std::shared_ptr<const PTree> idata, const std::shared_ptr<const Geometry> geom, const std::shared_ptr<const Reference> re = nullptr,
+       const std::shared_ptr<const AtomicPoints> points = nullptr)
       : SCF_base(idata, geom, re) {
 
       std::cout << indent << "*** Kohn-Sham DFT ***" << std::endl << std::endl;
@@ -51,7 +55,7 @@ class KS : public SCF_base {
       func_ = std::make_shared<XCFunc>(name_);
 
       Timer preptime;
-      grid_ = std::make_shared<DefaultGrid>(geom);
+      grid_ = construct_grid(geom, points);
       preptime.tick_print("DFT grid generation");
 
       std::cout << std::endl;
@@ -0,0 +1,317 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: xcfunc.cc
+// Copyright (C) 2013 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: NU theory
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <cmath>
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <src/scf/ks/xcfunc.h>
+#include <src/util/constants.h>
+
+using namespace std;
+using namespace bagel;
+
+// Kernels for closed-shell densities. Each of them adds c times the energy per particle (exc) and the derivatives of rho*exc
+// with respect to rho (vrho) and sigma = |grad rho|^2 (vsigma) on a block of points. The points with rho below the threshold are skipped.
+namespace {
+  constexpr double rho_thresh__ = 1.0e-14;
+
+  // functionals in BAGEL: components with their coefficients, and the fraction of the exact exchange
+  const map<string, pair<vector<pair<XCKernel,double>>, double>>& kernel_list() {
+    static const map<string, pair<vector<pair<XCKernel,double>>, double>> list = {
+      {"slater", {{{XCKernel::Slater, 1.0}}, 0.0}},
+      {"vwn5",   {{{XCKernel::VWN5, 1.0}}, 0.0}},
+      {"pw92c",  {{{XCKernel::PW92, 1.0}}, 0.0}},
+      {"b88",    {{{XCKernel::B88, 1.0}}, 0.0}},
+      {"lyp",    {{{XCKernel::LYP, 1.0}}, 0.0}},
+      {"pbex",   {{{XCKernel::PBEX, 1.0}}, 0.0}},
+      {"pbec",   {{{XCKernel::PBEC, 1.0}}, 0.0}},
+      {"blyp",   {{{XCKernel::B88, 1.0}, {XCKernel::LYP, 1.0}}, 0.0}},
+      {"pbe",    {{{XCKernel::PBEX, 1.0}, {XCKernel::PBEC, 1.0}}, 0.0}},
+      // as in libxc, VWN is in the RPA parametrization
+      {"b3lyp",  {{{XCKernel::Slater, 0.08}, {XCKernel::B88, 0.72}, {XCKernel::VWNRPA, 0.19}, {XCKernel::LYP, 0.81}}, 0.20}},
+      {"pbe0",   {{{XCKernel::PBEX, 0.75}, {XCKernel::PBEC, 1.0}}, 0.25}}
+    };
+    return list;
+  }
+
+  // Slater exchange
+  void slater(const int n, const double c, const double* rho, double* exc, double* vrho) {
+    const double cx = 0.75*cbrt(3.0/pi__);
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int i = 0; i < n; ++i) {
+      const double fac = rho[i] > rho_thresh__ ? c : 0.0;
+      const double r13 = cbrt(max(rho[i], rho_thresh__));
+      exc[i] -= fac*cx*r13;
+      vrho[i] -= fac*4.0/3.0*cx*r13;
+    }
+  }
+
+  // Vosko-Wilk-Nusair correlation; p = {A, b, c, x0}
+  void vwn(const array<double,4>& p, const int n, const double c, const double* rho, double* exc, double* vrho) {
+    const double a = p[0];
+    const double b = p[1];
+    const double q = sqrt(4.0*p[2] - b*b);
+    const double x0 = p[3];
+    const double f0 = b*x0 / (x0*x0 + b*x0 + p[2]);
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int i = 0; i < n; ++i) {
+      const double fac = rho[i] > rho_thresh__ ? c : 0.0;
+      const double x = sqrt(cbrt(3.0/(4.0*pi__*max(rho[i], rho_thresh__))));
+      const double xx = x*x + b*x + p[2];
+      const double at = atan(q/(2.0*x+b));
+      const double den = (2.0*x+b)*(2.0*x+b) + q*q;
+      const double e = a*(log(x*x/xx) + 2.0*b/q*at - f0*(log((x-x0)*(x-x0)/xx) + 2.0*(b+2.0*x0)/q*at));
+      const double dedx = a*(2.0/x - (2.0*x+b)/xx - 4.0*b/den - f0*(2.0/(x-x0) - (2.0*x+b)/xx - 4.0*(b+2.0*x0)/den));
+      exc[i] += fac*e;
+      vrho[i] += fac*(e - x/6.0*dedx);
+    }
+  }
+
+  // parameter A of the Perdew-Wang 1992 correlation: as published, and with more digits as used in PBE (PW_MOD in libxc)
+  constexpr double pw92_a__ = 0.031091;
+  constexpr double pw92mod_a__ = 0.0310907;
+
+  // Perdew-Wang 1992 correlation of the unpolarized electron gas and its derivative with respect to rs
+  inline void pw92(const double rs, const double a, double& e, double& dedrs) {
+    const double x = sqrt(rs);
+    const double q0 = -2.0*a*(1.0+0.21370*rs);
+    const double q1 = 2.0*a*x*(7.5957 + x*(3.5876 + x*(1.6382 + x*0.49294)));
+    const double q1p = a*(7.5957/x + 2.0*3.5876 + 3.0*1.6382*x + 4.0*0.49294*rs);
+    const double l = log(1.0 + 1.0/q1);
+    e = q0*l;
+    dedrs = -2.0*a*0.21370*l - q0*q1p/(q1*q1 + q1);
+  }
+
+  void pw92c(const double a, const int n, const double c, const double* rho, double* exc, double* vrho) {
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int i = 0; i < n; ++i) {
+      const double fac = rho[i] > rho_thresh__ ? c : 0.0;
+      const double rs = cbrt(3.0/(4.0*pi__*max(rho[i], rho_thresh__)));
+      double e, dedrs;
+      pw92(rs, a, e, dedrs);
+      exc[i] += fac*e;
+      vrho[i] += fac*(e - rs/3.0*dedrs);
+    }
+  }
+
+  // Becke 1988 exchange (including the Slater exchange), written in terms of the spin densities rho/2
+  void b88(const int n, const double c, const double* rho, const double* sigma, double* exc, double* vrho, double* vsigma) {
+    const double beta = 0.0042;
+    const double cs = 1.5*cbrt(3.0/(4.0*pi__));
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int i = 0; i < n; ++i) {
+      const double fac = rho[i] > rho_thresh__ ? c : 0.0;
+      const double r = 0.5*max(rho[i], rho_thresh__);
+      const double r13 = cbrt(r);
+      const double r43 = r*r13;
+      const double x = 0.5*sqrt(sigma[i])/r43;
+      const double ash = asinh(x);
+      const double d = 1.0 + 6.0*beta*x*ash;
+      const double xdd = 6.0*beta*(x*ash + x*x/sqrt(1.0+x*x));
+      const double h = x*x/d;
+      // h'(x)/x
+      const double hx = (2.0*d - xdd)/(d*d);
+      exc[i] -= fac*r13*(cs + beta*h);
+      vrho[i] -= fac*4.0/3.0*r13*(cs + beta*h - beta*x*x*hx);
+      vsigma[i] -= fac*0.25*beta*hx/r43;
+    }
+  }
+
+  // Lee-Yang-Parr correlation in the form of Miehlich et al.
+  void lyp(const int n, const double c, const double* rho, const double* sigma, double* exc, double* vrho, double* vsigma) {
+    const double a = 0.04918;
+    const double b = 0.132;
+    const double cc = 0.2533;
+    const double d = 0.349;
+    const double cf = 0.3*pow(3.0*pi__*pi__, 2.0/3.0);
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int i = 0; i < n; ++i) {
+      const double fac = rho[i] > rho_thresh__ ? c : 0.0;
+      const double r = max(rho[i], rho_thresh__);
+      const double u = 1.0/cbrt(r);
+      const double u5 = u*u*u*u*u;
+      const double den = 1.0/(1.0+d*u);
+      const double w = exp(-cc*u)*den;
+      const double delta = cc*u + d*u*den;
+      const double ddelta = -u/(3.0*r)*(cc + d*den*den);
+      const double g = (3.0+7.0*delta)/72.0;
+      const double f = -a*r*den - a*b*w*(cf*r - sigma[i]*u5*g);
+      exc[i] += fac*f/r;
+      vrho[i] += fac*(-a*(den + d*u*den*den/3.0) - a*b*w*(cf*(1.0+delta/3.0) - sigma[i]*u5*((delta-5.0)*g/(3.0*r) + 7.0*ddelta/72.0)));
+      vsigma[i] += fac*a*b*w*u5*g;
+    }
+  }
+
+  // Perdew-Burke-Ernzerhof exchange
+  void pbex(const int n, const double c, const double* rho, const double* sigma, double* exc, double* vrho, double* vsigma) {
+    const double kappa = 0.804;
+    const double mu = 0.2195149727645171;
+    const double cx = 0.75*cbrt(3.0/pi__);
+    const double cs = 1.0/(4.0*pow(3.0*pi__*pi__, 2.0/3.0));
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int i = 0; i < n; ++i) {
+      const double fac = rho[i] > rho_thresh__ ? c : 0.0;
+      const double r = max(rho[i], rho_thresh__);
+      const double r13 = cbrt(r);
+      const double r43 = r*r13;
+      // s^2
+      const double p = cs*sigma[i]/(r43*r43);
+      const double den = 1.0/(1.0+mu*p/kappa);
+      const double f = 1.0 + kappa - kappa*den;
+      const double fp = mu*den*den;
+      exc[i] -= fac*cx*r13*f;
+      vrho[i] -= fac*4.0/3.0*cx*r13*(f - 2.0*p*fp);
+      vsigma[i] -= fac*cx*fp*cs/r43;
+    }
+  }
+
+  // Perdew-Burke-Ernzerhof correlation
+  void pbec(const int n, const double c, const double* rho, const double* sigma, double* exc, double* vrho, double* vsigma) {
+    const double gamma = (1.0-log(2.0))/(pi__*pi__);
+    const double beta = 0.06672455060314922;
+    const double ct = pi__/(16.0*cbrt(3.0*pi__*pi__));
+#ifdef _OPENMP
+    #pragma omp simd
+#endif
+    for (int i = 0; i < n; ++i) {
+      const double fac = rho[i] > rho_thresh__ ? c : 0.0;
+      const double r = max(rho[i], rho_thresh__);
+      const double r13 = cbrt(r);
+      const double rs = cbrt(3.0/(4.0*pi__))/r13;
+      double ec, decdrs;
+      pw92(rs, pw92mod_a__, ec, decdrs);
+      const double dec = -rs/(3.0*r)*decdrs;
+      // t^2
+      const double y = ct*sigma[i]/(r*r*r13);
+      const double e = exp(-ec/gamma);
+      const double aa = beta/gamma/(e-1.0);
+      const double nn = 1.0 + aa*y;
+      const double dd = 1.0 + aa*y + aa*aa*y*y;
+      const double g = beta/gamma*y*nn/dd;
+      const double h = gamma*log(1.0+g);
+      const double hy = beta/(1.0+g)*(nn/dd - aa*aa*y*y*(2.0+aa*y)/(dd*dd));
+      const double ha = -beta/(1.0+g)*aa*y*y*y*(2.0+aa*y)/(dd*dd);
+      const double daa = aa*aa*e/beta;
+      exc[i] += fac*(ec + h);
+      vrho[i] += fac*(ec + h + r*(dec + ha*daa*dec) - 7.0/3.0*y*hy);
+      vsigma[i] += fac*hy*ct/(r*r13);
+    }
+  }
+}
+
+
+XCFunc::XCFunc(const string name) : name_(name), gga_(false), scale_ex_(0.0), libxc_(false) {
+  auto iter = kernel_list().find(name_);
+  if (iter != kernel_list().end()) {
+    kernels_ = iter->second.first;
+    scale_ex_ = iter->second.second;
+    for (auto& k : kernels_)
+      gga_ |= k.first == XCKernel::B88 || k.first == XCKernel::LYP || k.first == XCKernel::PBEX || k.first == XCKernel::PBEC;
+  } else {
+#ifdef HAVE_XC_H
+    const FuncList flist;
+    if (xc_func_init(&func_, flist.num(name_), XC_UNPOLARIZED))
+      throw runtime_error("unknown functional..");
+    libxc_ = true;
+    const int family = func_.info->family;
+    if (family != XC_FAMILY_LDA && family != XC_FAMILY_GGA && family != XC_FAMILY_HYB_GGA)
+      throw runtime_error("Meta GGA not supported yet");
+    gga_ = family != XC_FAMILY_LDA;
+    scale_ex_ = family == XC_FAMILY_HYB_GGA ? xc_hyb_exx_coef(&func_) : 0.0;
+#else
+    throw runtime_error("Functional " + name_ + " requires libxc");
+#endif
+  }
+}
+
+
+XCFunc::~XCFunc() {
+#ifdef HAVE_XC_H
+  if (libxc_)
+    xc_func_end(&func_);
+#endif
+}
+
+
+void XCFunc::compute_kernels(const int np, const double* rho, const double* sigma, double* exc, double* vxc, double* vxc2) const {
+  fill_n(exc, np, 0.0);
+  fill_n(vxc, np, 0.0);
+  if (gga_)
+    fill_n(vxc2, np, 0.0);
+
+  for (auto& k : kernels_) {
+    switch (k.first) {
+      case XCKernel::Slater:  slater(np, k.second, rho, exc, vxc); break;
+      case XCKernel::VWN5:    vwn({{0.0310907, 3.72744, 12.9352, -0.10498}}, np, k.second, rho, exc, vxc); break;
+      case XCKernel::VWNRPA:  vwn({{0.0310907, 13.0720, 42.7198, -0.409286}}, np, k.second, rho, exc, vxc); break;
+      case XCKernel::PW92:    pw92c(pw92_a__, np, k.second, rho, exc, vxc); break;
+      case XCKernel::B88:     b88(np, k.second, rho, sigma, exc, vxc, vxc2); break;
+      case XCKernel::LYP:     lyp(np, k.second, rho, sigma, exc, vxc, vxc2); break;
+      case XCKernel::PBEX:    pbex(np, k.second, rho, sigma, exc, vxc, vxc2); break;
+      case XCKernel::PBEC:    pbec(np, k.second, rho, sigma, exc, vxc, vxc2); break;
+    }
+  }
+}
+
+
+void XCFunc::compute_exc_vxc(int np, const double* rho, const double* sigma, double* exc, double* vxc, double* vxc2) const {
+  if (!libxc_) {
+    compute_kernels(np, rho, sigma, exc, vxc, vxc2);
+    return;
+  }
+#ifdef HAVE_XC_H
+  if (gga_)
+    xc_gga_exc_vxc(&func_, np, rho, sigma, exc, vxc, vxc2);
+  else
+    xc_lda_exc_vxc(&func_, np, rho, exc, vxc);
+#endif
+}
+
+
+void XCFunc::compute_vxc(int np, const double* rho, const double* sigma, double* vxc, double* vxc2) const {
+  if (!libxc_) {
+    unique_ptr<double[]> exc(new double[np]);
+    compute_kernels(np, rho, sigma, exc.get(), vxc, vxc2);
+    return;
+  }
+#ifdef HAVE_XC_H
+  if (gga_)
+    xc_gga_vxc(&func_, np, rho, sigma, vxc, vxc2);
+  else
+    xc_lda_vxc(&func_, np, rho, vxc);
+#endif
+}
@@ -26,6 +26,7 @@
 #define __SRC_KS_XCFUNC_H
 
 #include <map>
+#include <vector>
 #include <string>
 #include <stdexcept>
 #include <iostream>
@@ -37,6 +38,9 @@
 
 namespace bagel {
 
+// Components of the functionals implemented in BAGEL (closed-shell densities)
+enum class XCKernel { Slater, VWN5, VWNRPA, PW92, B88, LYP, PBEX, PBEC };
+
 #ifdef HAVE_XC_H
 class FuncList {
   protected:
@@ -58,57 +62,42 @@ class FuncList {
       return iter->second;
     }
 };
+#endif
 
 
+// Functionals in BAGEL are evaluated on a block of points in one call, in which all of the components are accumulated.
+// Those not implemented in BAGEL are computed by libxc.
 class XCFunc {
   protected:
-    xc_func_type func_;
     const std::string name_;
-    const FuncList flist;
+    // components of the functional; empty if libxc is used
+    std::vector<std::pair<XCKernel,double>> kernels_;
+    bool gga_;
+    double scale_ex_;
+
+#ifdef HAVE_XC_H
+    xc_func_type func_;
+#endif
+    bool libxc_;
+
+    void compute_kernels(const int np, const double* rho, const double* sigma, double* exc, double* vxc, double* vxc2) const;
 
   public:
-    XCFunc(const std::string name) : name_(name) {
-      if (xc_func_init(&func_, flist.num(name_), XC_UNPOLARIZED))
-        throw std::runtime_error("unknown functional..");
-    }
-    ~XCFunc() { xc_func_end(&func_); }
-
-    void compute_exc_vxc(int np, const double* rho, const double* sigma, double* exc, double* vxc, double* vxc2) const {
-      if (lda()) {
-        xc_lda_exc_vxc(&func_, np, rho, exc, vxc);
-      } else if (gga()) {
-        xc_gga_exc_vxc(&func_, np, rho, sigma, exc, vxc, vxc2);
-      } else {
-        throw std::runtime_error("Meta GGA not supported yet");
-      }
-    }
+    XCFunc(const std::string name);
+    ~XCFunc();
 
-    void compute_vxc(int np, const double* rho, const double* sigma, double* vxc, double* vxc2) const {
-      if (lda()) {
-        xc_lda_vxc(&func_, np, rho, vxc);
-      } else if (gga()) {
-        xc_gga_vxc(&func_, np, rho, sigma, vxc, vxc2);
-      } else {
-        throw std::runtime_error("Meta GGA not supported yet");
-      }
-    }
+    XCFunc(const XCFunc&) = delete;
+    XCFunc& operator=(const XCFunc&) = delete;
 
-    bool lda() const { return func_.info->family == XC_FAMILY_LDA; }
-    bool gga() const { return func_.info->family == XC_FAMILY_HYB_GGA || func_.info->family == XC_FAMILY_GGA; }
+    // exc is the energy per particle; vxc and vxc2 are the derivatives of rho*exc with respect to rho and sigma
+    void compute_exc_vxc(int np, const double* rho, const double* sigma, double* exc, double* vxc, double* vxc2) const;
+    void compute_vxc(int np, const double* rho, const double* sigma, double* vxc, double* vxc2) const;
 
-    double scale_ex() const { return (func_.info->family == XC_FAMILY_HYB_GGA) ? xc_hyb_exx_coef(&func_) : 0.0; }
-};
+    bool lda() const { return !gga_; }
+    bool gga() const { return gga_; }
 
-#else
-class XCFunc {
-public:
-  XCFunc(const std::string) { assert(false); }
-  void compute_exc_vxc(int np, const double* rho, const double* sigma, double* exc, double* vxc, double* vxc2) const {}
-  void compute_vxc(int np, const double* rho, const double* sigma, double* vxc, double* vxc2) const {}
-  bool lda() const { return true; }
-  double scale_ex() const { return 0.0; }
-}; // dummy
-#endif
+    double scale_ex() const { return scale_ex_; }
+};
 
 }
 
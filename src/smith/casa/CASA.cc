@@ -72,8 +72,7 @@ void CASA::CASA::solve() {
       set_rdm(jst, istate);
       s = sall_[istate]->at(jst);
       shared_ptr<Queue> sourceq = make_sourceq(false, jst == istate);
-      while(!sourceq->done())
-        sourceq->next_compute();
+      sourceq->compute();
     }
   }
 
@@ -101,8 +100,7 @@ void CASA::CASA::solve() {
           set_rdm(jst, ist);
           s = init_residual();
           shared_ptr<Queue> sourceq = make_sourceq(false, jst == ist);
-          while(!sourceq->done())
-            sourceq->next_compute();
+          sourceq->compute();
           sist->at(jst) = s;
         }
       }
@@ -204,8 +202,7 @@ vector<shared_ptr<MultiTensor_<double>>> CASA::CASA::solve_linear(vector<shared_
           const double e0save = e0_;
           e0_ = e0all_[i] - e0all_[ist];
           shared_ptr<Queue> queue = make_residualq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           diagonal(r, t2, jst == ist);
           e0_ = e0save;
         }
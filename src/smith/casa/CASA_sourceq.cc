@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> CASA::CASA::make_sourceq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto sourceq = make_shared<Queue>();
+  auto sourceq = make_shared<Queue>(info_->memory_budget());
   auto tensor235 = vector<shared_ptr<Tensor>>{s};
   auto task235 = make_shared<Task235>(tensor235, reset);
   sourceq->add_task(task235);
@@ -7690,19 +7690,18 @@ void Task42::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), c1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c3.size());
     // tensor label: I1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x0, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c2.size(), c1.size()*x0.size()*x1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, c1, x0, x1, c2);
 }
@@ -7717,21 +7716,20 @@ void Task43::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma0
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x0, x1);
 }
@@ -7746,19 +7744,18 @@ void Task44::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), c1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    gemm.reserve(x2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size());
     // tensor label: I4
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x1, x2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
-    dgemm_("T", "N", c2.size(), c1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, c1, x0, x1, c2);
 }
@@ -7773,23 +7770,22 @@ void Task45::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma1
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x0, x1, x2);
 }
@@ -7804,21 +7800,20 @@ void Task46::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: I7
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, x0, x1, c2);
 }
@@ -7833,19 +7828,18 @@ void Task47::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), c1.size()*c2.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a3, c2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a3, c2, x3)]);
-    sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
-    dgemm_("T", "N", x2.size(), c1.size()*c2.size()*x3.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a3.size(), c2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), c1.size(), c2.size(), x3.size());
   out()->add_block(odata, c1, c2, x3, x2);
 }
@@ -7876,19 +7870,18 @@ void Task49::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c2.size());
     // tensor label: I10
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x2, x1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), x2.size()*x1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -42,23 +42,22 @@ void Task50::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma3
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x2, x1, x0);
 }
@@ -73,23 +72,22 @@ void Task51::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x3, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x3, x4, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
         // tensor label: I13
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -104,19 +102,18 @@ void Task52::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c2, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-    dgemm_("T", "N", x3.size(), c1.size()*x5.size()*x4.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x5.size(), x4.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -131,19 +128,18 @@ void Task53::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma5
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
     // tensor label: I16
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -156,21 +152,20 @@ void Task54::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(1, c1.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), c2.size());
+      gemm.reserve(c2.size()*a3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), c2.size());
       // tensor label: I17
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, c1, x3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
-      dgemm_("T", "N", 1, c1.size()*x3.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
   out()->add_block(odata, c1, x3);
 }
@@ -206,23 +201,22 @@ void Task56::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma7
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x2, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x2, x4, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
         // tensor label: I22
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, c1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, c1, x4, x3)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), c1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,3,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), c1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -237,19 +231,18 @@ void Task57::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, c1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, c1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, c1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*c1.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-    dgemm_("T", "N", x3.size(), x5.size()*c1.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), c1.size(), x4.size());
   out()->add_block(odata, x5, c1, x4, x3);
 }
@@ -264,23 +257,22 @@ void Task58::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma3
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I25
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -312,19 +304,18 @@ void Task60::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
-    dgemm_("T", "N", x3.size(), c1.size()*x5.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x5.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x5.size(), x4.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -339,23 +330,22 @@ void Task61::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma94
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x2, x5, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x2, x5, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c1, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c1, x5)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), c1.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -370,23 +360,22 @@ void Task62::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x9 : *range_[1]) {
     for (auto& x8 : *range_[1]) {
       for (auto& x7 : *range_[1]) {
         // tensor label: Gamma95
         std::unique_ptr<double[]> i0data = in(0)->get_block(x9, x8, x2, x7, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x9, x8, x2, x7, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x9.size(), x8.size(), x2.size(), x7.size(), x1.size(), x0.size());
+        gemm.reserve(x9.size()*x8.size()*x7.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x9.size(), x8.size(), x2.size(), x7.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x9, x8, c1, x7);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x9, x8, c1, x7)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x9.size(), x8.size(), c1.size(), x7.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x9.size()*x8.size()*x7.size(),
-               1.0, i0data_sorted, x9.size()*x8.size()*x7.size(), i1data_sorted, x9.size()*x8.size()*x7.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x9.size(), x8.size(), c1.size(), x7.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -417,19 +406,18 @@ void Task64::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*c3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c4.size());
     // tensor label: I28
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c3, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", c1.size(), a2.size()*c3.size()*x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -444,19 +432,18 @@ void Task65::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, a2, c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, a2, c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, a2, c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size()*a2.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I29
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c4.size()*a2.size()*c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size(), a2.size(), c3.size());
   out()->add_block(odata, c4, a2, c3, x0);
 }
@@ -492,19 +479,18 @@ void Task67::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(c3.size(), a2.size()*c1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), c4.size());
     // tensor label: I34
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c1.size(), x0.size());
-    dgemm_("T", "N", c3.size(), a2.size()*c1.size()*x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -519,19 +505,18 @@ void Task68::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, a2, c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, a2, c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, a2, c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I35
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c4.size()*a2.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size(), a2.size(), c1.size());
   out()->add_block(odata, c4, a2, c1, x0);
 }
@@ -567,19 +552,18 @@ void Task70::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*c3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size());
     // tensor label: I40
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), a2.size()*c3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -594,21 +578,20 @@ void Task71::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma13
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -623,21 +606,20 @@ void Task72::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma15
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -652,19 +634,18 @@ void Task73::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(c3.size(), a2.size()*c1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size());
     // tensor label: I43
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c3.size(), a2.size()*c1.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -679,21 +660,20 @@ void Task74::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma15
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I44
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, x0, x1);
 }
@@ -752,23 +732,22 @@ void Task77::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma15
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
   out()->add_block(odata, c3, x0);
 }
@@ -806,23 +785,22 @@ void Task79::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma15
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -837,19 +815,18 @@ void Task80::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size()*a2.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a2.size());
     // tensor label: I58
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", c1.size()*c3.size()*a2.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -862,19 +839,18 @@ void Task81::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,-2,1>(i1data, i1data_sorted, a4.size(), x1.size());
-    dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,0,1,-2,1>(i1data.get(), gemm.b(), a4.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -889,19 +865,18 @@ void Task82::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
     // tensor label: I61
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -914,19 +889,18 @@ void Task83::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,4,1>(i1data, i1data_sorted, a4.size(), x1.size());
-    dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,0,1,4,1>(i1data.get(), gemm.b(), a4.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -941,19 +915,18 @@ void Task84::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*c3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size());
     // tensor label: I64
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x1.size(), x0.size());
-    dgemm_("T", "N", a2.size(), c1.size()*c3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -968,21 +941,20 @@ void Task85::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x1, x0);
 }
@@ -997,19 +969,18 @@ void Task86::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(a2.size(), c3.size()*c1.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), a2.size());
+    gemm.reserve(a4.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a2.size());
     // tensor label: I67
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, c1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, c1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), c1.size(), x0.size());
-    dgemm_("T", "N", a2.size(), c3.size()*c1.size()*x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), c1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x0.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -1024,19 +995,18 @@ void Task87::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a4.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I68
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a4.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a4.size(), c1.size());
   out()->add_block(odata, c3, a4, c1, x0);
 }
@@ -1072,19 +1042,18 @@ void Task89::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I253
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -1122,19 +1091,18 @@ void Task91::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma96
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size());
     // tensor label: I283
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -1170,19 +1138,18 @@ void Task93::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, c1), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     // tensor label: Gamma98
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size());
+    gemm.reserve(x5.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size());
     // tensor label: I287
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x5)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x5.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x5.size(),
-           1.0, i0data_sorted, x5.size(), i1data_sorted, x5.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c3, x0, c1);
 }
@@ -1234,19 +1201,18 @@ void Task96::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), a1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c3.size());
     // tensor label: I73
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c3, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c3, x0, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c3.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c2.size(), a1.size()*x0.size()*x1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c3.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -1261,21 +1227,20 @@ void Task97::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c3.size());
   out()->add_block(odata, a1, c3, x0, x1);
 }
@@ -1290,21 +1255,20 @@ void Task98::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c3.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c3.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c3.size(), a1.size());
   out()->add_block(odata, a1, c3, x0, x1);
 }
@@ -1319,21 +1283,20 @@ void Task99::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma26
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: I79
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -42,19 +42,18 @@ void Task100::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), a1.size()*c2.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a1, c2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a1, c2, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
-    dgemm_("T", "N", x2.size(), a1.size()*c2.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a1.size(), c2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), a1.size(), c2.size(), x3.size());
   out()->add_block(odata, a1, c2, x3, x2);
 }
@@ -69,21 +68,20 @@ void Task101::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma5
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: I82
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -98,19 +96,18 @@ void Task102::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), c2.size()*a1.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, c3, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
-    dgemm_("T", "N", x2.size(), c2.size()*a1.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), c3.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), c2.size(), a1.size(), x3.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -125,19 +122,18 @@ void Task103::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), a1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    gemm.reserve(x2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size());
     // tensor label: I85
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x1, x2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x1.size(), x2.size());
-    dgemm_("T", "N", c2.size(), a1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -152,23 +148,22 @@ void Task104::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma28
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, x2);
 }
@@ -206,21 +201,20 @@ void Task106::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(1, c2.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), c3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), c3.size());
       // tensor label: I89
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
-      dgemm_("T", "N", 1, c2.size()*a1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a4.size(), c3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
   out()->add_block(odata, c2, a1);
 }
@@ -256,21 +250,20 @@ void Task108::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I94
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2, a1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2, a1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size(), a1.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c2.size(), a1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -302,19 +295,18 @@ void Task110::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2, a1, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x2.size(), x3.size()*c2.size()*a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), c2.size(), a1.size());
   out()->add_block(odata, x3, c2, a1, x2);
 }
@@ -329,21 +321,20 @@ void Task111::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: I97
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -375,19 +366,18 @@ void Task113::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, c2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, c2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, c2, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*a1.size()*c2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x2.size(), x3.size()*a1.size()*c2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), a1.size(), c2.size());
   out()->add_block(odata, x3, a1, c2, x2);
 }
@@ -402,19 +392,18 @@ void Task114::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size());
+    gemm.reserve(x2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size());
     // tensor label: I100
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x2, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
-    dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x2.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -429,23 +418,22 @@ void Task115::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma33
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x2, x0);
 }
@@ -460,19 +448,18 @@ void Task116::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), a1.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a1.size());
     // tensor label: I103
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x0, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", a1.size(), c2.size()*x0.size()*x1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -487,21 +474,20 @@ void Task117::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a3.size(), c2.size());
   out()->add_block(odata, a3, c2, x0, x1);
 }
@@ -516,21 +502,20 @@ void Task118::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, x0, x1);
 }
@@ -545,21 +530,20 @@ void Task119::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma112
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, c2, x4)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -574,21 +558,20 @@ void Task120::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma113
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x5.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -603,21 +586,20 @@ void Task121::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma116
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x1, x6);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x1, x6)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x1.size(), x6.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x1.size(), x6.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, c2, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, c2, x6)]);
-      sort_indices<0,3,1,2,0,1,-1,2>(i1data, i1data_sorted, x7.size(), a1.size(), c2.size(), x6.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,2>(i1data.get(), gemm.b(), x7.size(), a1.size(), c2.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -632,21 +614,20 @@ void Task122::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, c2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma117
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x1.size(), x0.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x7, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x7, x6)]);
-      sort_indices<2,3,0,1,0,1,1,2>(i1data, i1data_sorted, c2.size(), a1.size(), x7.size(), x6.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), c2.size(), a1.size(), x7.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, c2);
 }
@@ -677,19 +658,18 @@ void Task124::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c3.size());
     // tensor label: I109
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), a2.size()*x1.size()*x0.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -704,21 +684,20 @@ void Task125::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I110
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -754,21 +733,20 @@ void Task127::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma5
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: I115
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -783,19 +761,18 @@ void Task128::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), a2.size()*c1.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: I116
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x2.size(), a2.size()*c1.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), a2.size(), c1.size(), x3.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -831,19 +808,18 @@ void Task130::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size());
+    gemm.reserve(x2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x2.size());
     // tensor label: I121
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x2, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), a2.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -858,23 +834,22 @@ void Task131::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma40
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a2.size());
   out()->add_block(odata, a2, x2, x1, x0);
 }
@@ -912,21 +887,20 @@ void Task133::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(1, c1.size()*a2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), c3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), c3.size());
       // tensor label: I125
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
-      dgemm_("T", "N", 1, c1.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, c1, a2);
 }
@@ -962,21 +936,20 @@ void Task135::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I130
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, a2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, a2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), a2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c1.size(), a2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -1014,19 +987,18 @@ void Task137::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c1, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, a2, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*c1.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: I131
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c1, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c1.size(), a2.size());
-    dgemm_("T", "N", x2.size(), x3.size()*c1.size()*a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), c1.size(), a2.size());
   out()->add_block(odata, x3, c1, a2, x2);
 }
@@ -1062,19 +1034,18 @@ void Task139::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    gemm.reserve(x2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size());
     // tensor label: I136
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -1089,23 +1060,22 @@ void Task140::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma3
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -1120,19 +1090,18 @@ void Task141::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a2.size());
     // tensor label: I139
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c1, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c1, x1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c1.size(), x1.size(), x0.size());
-    dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c1.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -1147,21 +1116,20 @@ void Task142::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I140
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c1.size());
   out()->add_block(odata, a3, c1, x1, x0);
 }
@@ -1197,21 +1165,20 @@ void Task144::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma113
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x0.size());
       // tensor label: I319
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -1247,21 +1214,20 @@ void Task146::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma117
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x1.size(), x0.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x1.size(), x0.size());
       // tensor label: I327
       std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a2, c1, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a2, c1, x6)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x7.size(), a2.size(), c1.size(), x6.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), a2.size(), c1.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, x1, x0, c1);
 }
@@ -1313,23 +1279,22 @@ void Task149::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma48
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x3, x4, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x3, x4, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
         // tensor label: I145
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,3,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
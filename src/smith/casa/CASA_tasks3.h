@@ -55,13 +55,17 @@ class Task100 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task100(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task100() {}
@@ -84,13 +88,17 @@ class Task101 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task101(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task101() {}
@@ -113,13 +121,17 @@ class Task102 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task102(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task102() {}
@@ -142,13 +154,17 @@ class Task103 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task103(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task103() {}
@@ -171,13 +187,17 @@ class Task104 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task104(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task104() {}
@@ -200,13 +220,17 @@ class Task105 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task105(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task105() {}
@@ -229,13 +253,17 @@ class Task106 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task106(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task106() {}
@@ -258,13 +286,17 @@ class Task107 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task107(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task107() {}
@@ -287,13 +319,17 @@ class Task108 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task108(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task108() {}
@@ -317,13 +353,17 @@ class Task109 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task109(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range, const double e);
     ~Task109() {}
@@ -346,13 +386,17 @@ class Task110 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task110(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task110() {}
@@ -375,13 +419,17 @@ class Task111 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task111(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task111() {}
@@ -405,13 +453,17 @@ class Task112 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task112(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range, const double e);
     ~Task112() {}
@@ -434,13 +486,17 @@ class Task113 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task113(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task113() {}
@@ -463,13 +519,17 @@ class Task114 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task114(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task114() {}
@@ -492,13 +552,17 @@ class Task115 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task115(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task115() {}
@@ -521,13 +585,17 @@ class Task116 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task116(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task116() {}
@@ -550,13 +618,17 @@ class Task117 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task117(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task117() {}
@@ -579,13 +651,17 @@ class Task118 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task118(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task118() {}
@@ -608,13 +684,17 @@ class Task119 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task119(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task119() {}
@@ -637,13 +717,17 @@ class Task120 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task120(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task120() {}
@@ -666,13 +750,17 @@ class Task121 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task121(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task121() {}
@@ -695,13 +783,17 @@ class Task122 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task122(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task122() {}
@@ -724,13 +816,17 @@ class Task123 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task123(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task123() {}
@@ -753,13 +849,17 @@ class Task124 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task124(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task124() {}
@@ -782,13 +882,17 @@ class Task125 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task125(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task125() {}
@@ -811,13 +915,17 @@ class Task126 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task126(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task126() {}
@@ -840,13 +948,17 @@ class Task127 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task127(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task127() {}
@@ -869,13 +981,17 @@ class Task128 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task128(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task128() {}
@@ -898,13 +1014,17 @@ class Task129 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task129(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task129() {}
@@ -927,13 +1047,17 @@ class Task130 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task130(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task130() {}
@@ -956,13 +1080,17 @@ class Task131 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task131(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task131() {}
@@ -985,13 +1113,17 @@ class Task132 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task132(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task132() {}
@@ -1014,13 +1146,17 @@ class Task133 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task133(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task133() {}
@@ -1043,13 +1179,17 @@ class Task134 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task134(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task134() {}
@@ -1072,13 +1212,17 @@ class Task135 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task135(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task135() {}
@@ -1102,13 +1246,17 @@ class Task136 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task136(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range, const double e);
     ~Task136() {}
@@ -1131,13 +1279,17 @@ class Task137 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task137(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task137() {}
@@ -1160,13 +1312,17 @@ class Task138 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task138(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task138() {}
@@ -1189,13 +1345,17 @@ class Task139 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task139(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task139() {}
@@ -1218,13 +1378,17 @@ class Task140 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task140(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task140() {}
@@ -1247,13 +1411,17 @@ class Task141 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task141(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task141() {}
@@ -1276,13 +1444,17 @@ class Task142 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task142(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task142() {}
@@ -1305,13 +1477,17 @@ class Task143 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task143(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task143() {}
@@ -1334,13 +1510,17 @@ class Task144 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task144(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task144() {}
@@ -1363,13 +1543,17 @@ class Task145 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task145(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task145() {}
@@ -1392,13 +1576,17 @@ class Task146 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task146(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task146() {}
@@ -1421,13 +1609,17 @@ class Task147 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task147(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task147() {}
@@ -1450,13 +1642,17 @@ class Task148 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task148(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task148() {}
@@ -1479,13 +1675,17 @@ class Task149 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task149(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task149() {}
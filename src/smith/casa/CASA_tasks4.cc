@@ -42,19 +42,18 @@ void Task150::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, a1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, a1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, a1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*a1.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, c2, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-    dgemm_("T", "N", x3.size(), x5.size()*a1.size()*x4.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), a1.size(), x4.size());
   out()->add_block(odata, x5, a1, x4, x3);
 }
@@ -69,23 +68,22 @@ void Task151::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma49
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I148
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -100,19 +98,18 @@ void Task152::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x5, x4)]);
-    sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
-    dgemm_("T", "N", x3.size(), a1.size()*x5.size()*x4.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x5.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x5.size(), x4.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -127,19 +124,18 @@ void Task153::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma50
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
     // tensor label: I151
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size());
-    dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -152,21 +148,20 @@ void Task154::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(1, x3.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), c2.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), c2.size());
       // tensor label: I152
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-      dgemm_("T", "N", 1, x3.size()*a1.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, x3, a1);
 }
@@ -202,23 +197,22 @@ void Task156::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma52
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I157
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -250,19 +244,18 @@ void Task158::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, a1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, a1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, a1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*a1.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, a2)]);
-    sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-    dgemm_("T", "N", x3.size(), x5.size()*a1.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), a1.size(), x4.size());
   out()->add_block(odata, x5, a1, x4, x3);
 }
@@ -277,19 +270,18 @@ void Task159::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), a1.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), a1.size());
     // tensor label: I160
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x0, x2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x0, x2, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x0.size(), x2.size(), x1.size());
-    dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x0.size(), x2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -304,23 +296,22 @@ void Task160::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma52
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a2.size());
   out()->add_block(odata, a2, x0, x2, x1);
 }
@@ -335,23 +326,22 @@ void Task161::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma100
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, x6, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, x6, x5)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x7.size(), a1.size(), x6.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -366,23 +356,22 @@ void Task162::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x9 : *range_[1]) {
     for (auto& x8 : *range_[1]) {
       for (auto& x7 : *range_[1]) {
         // tensor label: Gamma101
         std::unique_ptr<double[]> i0data = in(0)->get_block(x9, x0, x8, x7, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x9, x0, x8, x7, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x9.size(), x0.size(), x8.size(), x7.size(), x2.size(), x1.size());
+        gemm.reserve(x9.size()*x8.size()*x7.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x9.size(), x0.size(), x8.size(), x7.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x9, a1, x8, x7);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x9, a1, x8, x7)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x9.size(), a1.size(), x8.size(), x7.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x9.size()*x8.size()*x7.size(),
-               1.0, i0data_sorted, x9.size()*x8.size()*x7.size(), i1data_sorted, x9.size()*x8.size()*x7.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x9.size(), a1.size(), x8.size(), x7.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -418,19 +407,18 @@ void Task164::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, a2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c1.size()*a4.size()*a2.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c5)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), c5.size());
+    gemm.reserve(c5.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), c5.size());
     // tensor label: I163
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c5, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c5, a2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
-    dgemm_("T", "N", c3.size(), c1.size()*a4.size()*a2.size(), c5.size(),
-           1.0, i0data_sorted, c5.size(), i1data_sorted, c5.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c5.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size(), a4.size(), a2.size());
   out()->add_block(odata, c1, a4, a2, c3);
 }
@@ -466,19 +454,18 @@ void Task166::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, a2, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c1.size()*a2.size(), c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c1.size(), a2.size());
     // tensor label: I167
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
-    dgemm_("T", "N", a4.size()*c1.size()*a2.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a4.size()*c1.size()*a2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c1, a4, a2, c3);
 }
@@ -491,19 +478,18 @@ void Task167::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-    sort_indices<1,0,0,1,-2,1>(i1data, i1data_sorted, c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,-2,1>(i1data.get(), gemm.b(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
   out()->add_block(odata, c3, x1);
 }
@@ -518,19 +504,18 @@ void Task168::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, a2, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size()*a4.size(), c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, a4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), a4.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size(), c1.size(), a4.size());
     // tensor label: I170
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
-    dgemm_("T", "N", a2.size()*c1.size()*a4.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*a4.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), a4.size(), c3.size());
   out()->add_block(odata, c1, a4, a2, c3);
 }
@@ -543,19 +528,18 @@ void Task169::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
   out()->add_block(odata, c3, x1);
 }
@@ -593,21 +577,20 @@ void Task171::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I174
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a4.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
   out()->add_block(odata, a4, c1);
 }
@@ -666,21 +649,20 @@ void Task174::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I177
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
   out()->add_block(odata, a2, c1);
 }
@@ -716,19 +698,18 @@ void Task176::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, a2, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size()*c3.size(), a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x1.size());
     // tensor label: I185
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size());
-    dgemm_("T", "N", c1.size()*a4.size()*c3.size(), a2.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*a4.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, c1, a4, a2, c3);
 }
@@ -741,19 +722,18 @@ void Task177::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a2.size());
-    dgemm_("T", "N", x1.size(), a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size());
   out()->add_block(odata, a2, x1);
 }
@@ -768,19 +748,18 @@ void Task178::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, a2, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x1.size());
     // tensor label: I188
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, c1, a4, a2, c3);
 }
@@ -793,19 +772,18 @@ void Task179::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a4)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, x0.size(), a4.size());
-    dgemm_("T", "N", x1.size(), a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
   out()->add_block(odata, a4, x1);
 }
@@ -820,19 +798,18 @@ void Task180::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, a2, c3), 0.0);
+  GemmBatch<double> gemm(a4.size(), c1.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a5, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a5, a4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a5.size(), a4.size());
+    gemm.reserve(a5.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a5.size(), a4.size());
     // tensor label: I191
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a5, c3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a5, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
-    dgemm_("T", "N", a4.size(), c1.size()*c3.size()*a2.size(), a5.size(),
-           1.0, i0data_sorted, a5.size(), i1data_sorted, a5.size(),
-           1.0, odata_sorted, a4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), c3.size(), a2.size());
   out()->add_block(odata, c1, a4, a2, c3);
 }
@@ -884,19 +861,18 @@ void Task183::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), a3.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c4.size());
     // tensor label: I195
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c4, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c4, a1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c4.size(), a1.size(), x0.size());
-    dgemm_("T", "N", c2.size(), a3.size()*a1.size()*x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c4.size(), a1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -911,19 +887,18 @@ void Task184::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c4, a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c4.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I196
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c4, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c4, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c4.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), c4.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c4.size(), a1.size());
   out()->add_block(odata, a3, c4, a1, x0);
 }
@@ -959,19 +934,18 @@ void Task186::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size()*a1.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, a1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), a1.size());
     // tensor label: I201
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", c2.size()*a3.size()*a1.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c2.size()*a3.size()*a1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -984,19 +958,18 @@ void Task187::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c4)]);
-    sort_indices<0,1,0,1,-4,1>(i1data, i1data_sorted, x1.size(), c4.size());
-    dgemm_("T", "N", x0.size(), c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,-4,1>(i1data.get(), gemm.b(), x1.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1011,19 +984,18 @@ void Task188::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size()*a3.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, a3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a3.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), a3.size());
     // tensor label: I204
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", c2.size()*a1.size()*a3.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c2.size()*a1.size()*a3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -1036,19 +1008,18 @@ void Task189::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c4)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, x1.size(), c4.size());
-    dgemm_("T", "N", x0.size(), c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1063,19 +1034,18 @@ void Task190::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), a1.size()*a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x1.size());
     // tensor label: I207
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a3, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a3, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c2.size(), a1.size()*a3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a3.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -1090,21 +1060,20 @@ void Task191::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma50
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a3)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a3.size());
   out()->add_block(odata, a1, a3, x0, x1);
 }
@@ -1142,23 +1111,22 @@ void Task193::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
   out()->add_block(odata, a3, x0);
 }
@@ -1196,23 +1164,22 @@ void Task195::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
   out()->add_block(odata, a1, x0);
 }
@@ -1227,19 +1194,18 @@ void Task196::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(a1.size(), a3.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size());
     // tensor label: I216
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", a1.size(), a3.size()*c2.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -1254,21 +1220,20 @@ void Task197::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I217
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c2.size());
   out()->add_block(odata, a3, c2, x1, x0);
 }
@@ -1304,19 +1269,18 @@ void Task199::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(a3.size(), a1.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size());
     // tensor label: I219
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", a3.size(), a1.size()*c2.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -42,21 +42,20 @@ void Task200::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -71,21 +70,20 @@ void Task201::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -100,19 +98,18 @@ void Task202::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*a3.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), a1.size());
+    gemm.reserve(a4.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a1.size());
     // tensor label: I228
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c2, a3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c2, a3, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c2.size(), a3.size(), x0.size());
-    dgemm_("T", "N", a1.size(), c2.size()*a3.size()*x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c2.size(), a3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -127,19 +124,18 @@ void Task203::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c2, a3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c2, a3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c2, a3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size()*c2.size()*a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I229
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x0.size(), a4.size()*c2.size()*a3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size(), c2.size(), a3.size());
   out()->add_block(odata, a4, c2, a3, x0);
 }
@@ -175,19 +171,18 @@ void Task205::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(a3.size(), c2.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), a3.size());
+    gemm.reserve(a4.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a3.size());
     // tensor label: I234
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c2, a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c2, a1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c2.size(), a1.size(), x0.size());
-    dgemm_("T", "N", a3.size(), c2.size()*a1.size()*x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c2.size(), a1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -202,19 +197,18 @@ void Task206::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c2, a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c2, a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c2, a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I235
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a4.size()*c2.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size(), c2.size(), a1.size());
   out()->add_block(odata, a4, c2, a1, x0);
 }
@@ -250,19 +244,18 @@ void Task208::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I269
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,3,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -300,19 +293,18 @@ void Task210::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma106
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size());
     // tensor label: I303
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,3,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -348,19 +340,18 @@ void Task212::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c2), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     // tensor label: Gamma108
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size());
+    gemm.reserve(x5.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size());
     // tensor label: I307
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x5.size(),
-           1.0, i0data_sorted, x5.size(), i1data_sorted, x5.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,3,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, a1, x0, c2);
 }
@@ -417,21 +408,20 @@ void Task215::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma50
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I240
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, a2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, a2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), a2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), a2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -446,19 +436,18 @@ void Task216::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, a2, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*a1.size()*a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c3, a2)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c3.size(), a2.size());
-    dgemm_("T", "N", x2.size(), x3.size()*a1.size()*a2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), a1.size(), a2.size());
   out()->add_block(odata, x3, a1, a2, x2);
 }
@@ -473,19 +462,18 @@ void Task217::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(a2.size(), a1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    gemm.reserve(x2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size());
     // tensor label: I243
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
-    dgemm_("T", "N", a2.size(), a1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -500,23 +488,22 @@ void Task218::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma52
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -531,19 +518,18 @@ void Task219::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(a2.size(), a1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a2.size());
     // tensor label: I246
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a3, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a3, x0, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size());
-    dgemm_("T", "N", a2.size(), a1.size()*x0.size()*x1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a3.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -558,21 +544,20 @@ void Task220::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma50
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a3)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a3.size());
   out()->add_block(odata, a1, a3, x0, x1);
 }
@@ -633,21 +618,20 @@ void Task223::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma92
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x1, x4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x1.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size(), x1.size(), x4.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c2, x4)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x0, x1);
 }
@@ -662,21 +646,20 @@ void Task224::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma93
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x7, x1, x6);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x7, x1, x6)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x7.size(), x1.size(), x6.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x7.size(), x1.size(), x6.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x7, c2, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x7, c2, x6)]);
-      sort_indices<1,3,0,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), x7.size(), c2.size(), x6.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), x7.size(), c2.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x0, x1);
 }
@@ -870,21 +853,20 @@ void Task233::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma110
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, a2)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -899,21 +881,20 @@ void Task234::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma111
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x1.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, x6, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, x6, a2)]);
-      sort_indices<0,2,1,3,0,1,-1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-1,1>(i1data.get(), gemm.b(), x7.size(), a1.size(), x6.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -944,21 +925,20 @@ void Task237::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma0
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c2, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x0, x1);
 }
@@ -989,23 +969,22 @@ void Task239::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma121
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x4, x3, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,2>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -1020,23 +999,22 @@ void Task240::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma3
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -1051,19 +1029,18 @@ void Task241::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma5
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -1094,19 +1071,18 @@ void Task243::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c1, a2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c1, a2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c1, a2, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*c1.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma9
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I337
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, c1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, c1, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size(), c1.size(), a2.size());
-    dgemm_("T", "N", x0.size(), c3.size()*c1.size()*a2.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size(), c1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), c1.size(), a2.size());
   out()->add_block(odata, c3, c1, a2, x0);
 }
@@ -1158,21 +1134,20 @@ void Task246::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I341
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, a1, x1, x0);
 }
@@ -1208,21 +1183,20 @@ void Task248::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma26
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, a1)]);
-      sort_indices<1,2,0,3,0,1,-1,2>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), a1.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,-1,2>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, a1, x1, x0);
 }
@@ -1237,21 +1211,20 @@ void Task249::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,2>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x1, x0);
 }
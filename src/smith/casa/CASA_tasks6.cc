@@ -83,21 +83,20 @@ void Task252::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I349
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, a2, x1, x0);
 }
@@ -138,21 +137,20 @@ void Task254::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma5
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, x2, a2)]);
-      sort_indices<2,1,0,3,0,1,1,2>(i1data, i1data_sorted, c1.size(), x3.size(), x2.size(), a2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,2>(i1data.get(), gemm.b(), c1.size(), x3.size(), x2.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, a2, x1, x0);
 }
@@ -208,23 +206,22 @@ void Task257::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma52
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -239,23 +236,22 @@ void Task258::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma49
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x3, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x3, a1)]);
-        sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), x3.size(), a1.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), x3.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -270,19 +266,18 @@ void Task259::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma50
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size());
-    dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -350,19 +345,18 @@ void Task263::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma29
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I363
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, c2, a1, x0);
 }
@@ -414,21 +408,20 @@ void Task266::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma50
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -121,8 +121,7 @@ void CASPT2::CASPT2::do_rdm_deriv(double factor) {
     auto bdata = make_shared<VectorB>(ndet);
     shared_ptr<Queue> queue = contract_rdm_deriv(/*ciwfn=*/info_->ciwfn(), bdata, /*offset=*/ioffset, /*size=*/isize, /*reset=*/true);
 
-    while (!queue->done())
-      queue->next_compute();
+    queue->compute();
 
     blas::ax_plus_y_n(factor, deci->vectorb()->data(), isize, ci_deriv_->data(0)->data()+ioffset);
     blas::ax_plus_y_n(factor, bdata->data(), ndet, ci_deriv_->data(0)->data());
@@ -150,8 +149,7 @@ void CASPT2::CASPT2::solve() {
       set_rdm(jst, istate);
       s = sall_[istate]->at(jst);
       shared_ptr<Queue> sourceq = make_sourceq(false, jst == istate);
-      while(!sourceq->done())
-        sourceq->next_compute();
+      sourceq->compute();
     }
   }
 
@@ -170,8 +168,7 @@ void CASPT2::CASPT2::solve() {
         set_rdm(jst, ist);
         t2 = t2all_[istate]->at(ist);
         shared_ptr<Queue> normq = make_normq(true, jst == ist);
-        while (!normq->done())
-          normq->next_compute();
+        normq->compute();
         norm += dot_product_transpose(n, t2all_[istate]->at(jst));
       }
     }
@@ -201,8 +198,7 @@ void CASPT2::CASPT2::solve() {
           set_rdm(jst, ist);
           s = init_residual();
           shared_ptr<Queue> sourceq = make_sourceq(false, jst == ist);
-          while(!sourceq->done())
-            sourceq->next_compute();
+          sourceq->compute();
           sist->at(jst) = s;
         }
       }
@@ -308,8 +304,7 @@ vector<shared_ptr<MultiTensor_<double>>> CASPT2::CASPT2::solve_linear(vector<sha
           // compute residuals named r for each K
           e0_ = e0all_[i] - info_->shift();
           shared_ptr<Queue> queue = make_residualq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           diagonal(r, t2, jst == ist);
         }
       }
@@ -378,8 +373,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
             set_rdm(jst, ist);
             s = init_residual();
             shared_ptr<Queue> sourceq = make_sourceq(false, jst == ist);
-            while(!sourceq->done())
-              sourceq->next_compute();
+            sourceq->compute();
             sist->at(jst) = s;
           }
         }
@@ -401,8 +395,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
               set_rdm(jst, ist);
               t2 = t2all_[istate]->at(ist);
               shared_ptr<Queue> normq = make_normq(true, jst == ist);
-              while (!normq->done())
-                normq->next_compute();
+              normq->compute();
               sall_[istate]->at(jst)->ax_plus_y(-2.0 * info_->shift() * pow((*heff_)(istate, target), 2.0), n);
             }
           }
@@ -426,8 +419,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
             set_rdm(jst, ist);
             s = init_residual();
             shared_ptr<Queue> sourceq = make_sourceq(false, jst == ist);
-            while(!sourceq->done())
-              sourceq->next_compute();
+            sourceq->compute();
             sist->at(jst) = s;
           }
         }
@@ -452,8 +444,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
               set_rdm(jst, ist);
               t2 = t2all_[istate]->at(ist);
               shared_ptr<Queue> normq = make_normq(true, jst == ist);
-              while (!normq->done())
-                normq->next_compute();
+              normq->compute();
               sall_[istate]->at(jst)->ax_plus_y(-2.0 * info_->shift() * (*heff_)(istate, targetJ) * (*heff_)(istate, targetI), n);
             }
           }
@@ -471,20 +462,17 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
     {
       den2 = h1_->clone();
       shared_ptr<Queue> dens2 = make_densityq();
-      while (!dens2->done())
-        dens2->next_compute();
+      dens2->compute();
       den2_ = den2->matrix();
     } {
       den1 = h1_->clone();
       shared_ptr<Queue> dens1 = make_density1q();
-      while (!dens1->done())
-        dens1->next_compute();
+      dens1->compute();
       den1_ = den1->matrix();
     } {
       Den1 = init_residual();
       shared_ptr<Queue> Dens1 = make_density2q();
-      while (!Dens1->done())
-        Dens1->next_compute();
+      Dens1->compute();
       Den1_ = Den1;
     }
     timer.tick_print("Correlated density matrix evaluation");
@@ -499,8 +487,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
     den3ci = rdm3_->clone();
     den4ci = rdm3_->clone();
     shared_ptr<Queue> dec = make_deciq(/*reset = */true);
-    while (!dec->done())
-      dec->next_compute();
+    dec->compute();
     timer.tick_print("CI derivative evaluation");
 
     // when active is divided into the blocks, den4ci is evaluated (activeblock)**2 times
@@ -531,8 +518,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
   if (nstates_ == 1) {
     n = init_residual();
     shared_ptr<Queue> normq = make_normq();
-    while (!normq->done())
-      normq->next_compute();
+    normq->compute();
     correlated_norm_[0] = dot_product_transpose(n, t2);
   } else {
     n = init_residual();
@@ -545,8 +531,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
           set_rdm(jst, ist);
           t2 = t2all_[istate]->at(ist);
           shared_ptr<Queue> normq = make_normq(true, jst == ist);
-          while (!normq->done())
-            normq->next_compute();
+          normq->compute();
           tmp += dot_product_transpose(n, lall_[istate]->at(jst));
         }
       }
@@ -579,7 +564,7 @@ void CASPT2::CASPT2::solve_gradient(const int targetJ, const int targetI, shared
   auto focksub = [&](shared_ptr<const Matrix> moden, const MatView coeff, const bool add) {
     shared_ptr<const Matrix> jop = ref->geom()->df()->compute_Jop(make_shared<Matrix>(coeff * *moden ^ coeff));
     auto out = make_shared<Matrix>(acoeff % (add ? (*ref->hcore() + *jop) : *jop) * acoeff);
-    shared_ptr<const DFFullDist> full = ref->geom()->df()->compute_half_transform(acoeff)->apply_J()->compute_second_transform(coeff)->swap();
+    shared_ptr<const DFFullDist> full = ref->geom()->df()->compute_full_transform(acoeff, coeff)->apply_J()->swap();
     shared_ptr<DFFullDist> full2 = full->copy();
     full2 = full2->transform_occ1(moden);
     *out += *full->form_2index(full2, -0.5);
@@ -37,7 +37,7 @@ shared_ptr<Queue> CASPT2::CASPT2::contract_rdm_deriv(shared_ptr<const CIWfn> ciw
 
   array<shared_ptr<const IndexRange>,4> cindex = {{rclosed_, ractive_, rvirt_, rci_}};
 
-  auto contract = make_shared<Queue>();
+  auto contract = make_shared<Queue>(info_->memory_budget());
   auto tensor900 = vector<shared_ptr<Tensor>>{deci};
   auto task900 = make_shared<Task900>(tensor900, reset);
   contract->add_task(task900);
@@ -37,7 +37,7 @@ shared_ptr<Queue> CASPT2::CASPT2::make_deciq(const bool reset, const bool diagon
 
   array<shared_ptr<const IndexRange>,4> cindex = {{rclosed_, ractive_, rvirt_, rci_}};
 
-  auto deciq = make_shared<Queue>();
+  auto deciq = make_shared<Queue>(info_->memory_budget());
   auto tensor519 = vector<shared_ptr<Tensor>>{den0ci, den1ci, den2ci, den3ci, den4ci};
   auto task519 = make_shared<Task519>(tensor519, reset);
   deciq->add_task(task519);
@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> CASPT2::CASPT2::make_density1q(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto density1q = make_shared<Queue>();
+  auto density1q = make_shared<Queue>(info_->memory_budget());
   auto tensor488 = vector<shared_ptr<Tensor>>{den1};
   auto task488 = make_shared<Task488>(tensor488, reset);
   density1q->add_task(task488);
@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> CASPT2::CASPT2::make_densityq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto densityq = make_shared<Queue>();
+  auto densityq = make_shared<Queue>(info_->memory_budget());
   auto tensor265 = vector<shared_ptr<Tensor>>{den2};
   auto task265 = make_shared<Task265>(tensor265, reset);
   densityq->add_task(task265);
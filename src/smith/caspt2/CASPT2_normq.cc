@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> CASPT2::CASPT2::make_normq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto normq = make_shared<Queue>();
+  auto normq = make_shared<Queue>(info_->memory_budget());
   auto tensor242 = vector<shared_ptr<Tensor>>{n};
   auto task242 = make_shared<Task242>(tensor242, reset);
   normq->add_task(task242);
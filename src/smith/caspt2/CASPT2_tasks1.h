@@ -55,11 +55,15 @@ class Task0 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task0(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task0() {}
@@ -82,11 +86,15 @@ class Task1 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task1(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task1() {}
@@ -109,11 +117,15 @@ class Task2 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task2(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task2() {}
@@ -136,11 +148,15 @@ class Task3 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task3(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task3() {}
@@ -163,11 +179,15 @@ class Task4 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task4(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task4() {}
@@ -190,11 +210,15 @@ class Task5 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task5(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task5() {}
@@ -217,11 +241,15 @@ class Task6 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task6(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task6() {}
@@ -244,11 +272,15 @@ class Task7 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task7(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task7() {}
@@ -271,11 +303,15 @@ class Task8 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task8(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task8() {}
@@ -298,11 +334,15 @@ class Task9 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task9(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task9() {}
@@ -325,11 +365,15 @@ class Task10 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task10(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task10() {}
@@ -352,11 +396,15 @@ class Task11 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task11(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task11() {}
@@ -379,11 +427,15 @@ class Task12 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task12(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task12() {}
@@ -406,11 +458,15 @@ class Task13 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task13(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task13() {}
@@ -433,11 +489,15 @@ class Task14 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task14(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task14() {}
@@ -460,11 +520,15 @@ class Task15 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task15(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task15() {}
@@ -487,11 +551,15 @@ class Task16 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task16(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task16() {}
@@ -514,11 +582,15 @@ class Task17 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task17(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task17() {}
@@ -541,11 +613,15 @@ class Task18 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task18(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task18() {}
@@ -568,11 +644,15 @@ class Task19 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task19(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task19() {}
@@ -595,11 +675,15 @@ class Task20 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task20(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task20() {}
@@ -622,11 +706,15 @@ class Task21 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task21(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task21() {}
@@ -649,11 +737,15 @@ class Task22 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task22(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task22() {}
@@ -676,11 +768,15 @@ class Task23 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task23(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task23() {}
@@ -703,11 +799,15 @@ class Task24 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task24(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task24() {}
@@ -730,11 +830,15 @@ class Task25 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task25(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task25() {}
@@ -757,11 +861,15 @@ class Task26 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task26(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task26() {}
@@ -784,11 +892,15 @@ class Task27 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task27(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task27() {}
@@ -811,11 +923,15 @@ class Task28 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task28(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task28() {}
@@ -838,11 +954,15 @@ class Task29 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task29(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task29() {}
@@ -865,11 +985,15 @@ class Task30 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task30(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task30() {}
@@ -892,11 +1016,15 @@ class Task31 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task31(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task31() {}
@@ -919,11 +1047,15 @@ class Task32 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task32(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task32() {}
@@ -946,11 +1078,15 @@ class Task33 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task33(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task33() {}
@@ -973,11 +1109,15 @@ class Task34 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task34(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task34() {}
@@ -1000,11 +1140,15 @@ class Task35 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task35(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task35() {}
@@ -1027,11 +1171,15 @@ class Task36 : public Task {  // associated with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task36(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task36() {}
@@ -1069,13 +1217,17 @@ class Task38 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task38(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task38() {}
@@ -1098,13 +1250,17 @@ class Task39 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task39(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task39() {}
@@ -1128,13 +1284,17 @@ class Task40 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task40(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range, const double e);
     ~Task40() {}
@@ -1157,13 +1317,17 @@ class Task41 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task41(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task41() {}
@@ -1186,13 +1350,17 @@ class Task42 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task42(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task42() {}
@@ -1215,13 +1383,17 @@ class Task43 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task43(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task43() {}
@@ -1244,13 +1416,17 @@ class Task44 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task44(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task44() {}
@@ -1273,13 +1449,17 @@ class Task45 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task45(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task45() {}
@@ -1302,13 +1482,17 @@ class Task46 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task46(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task46() {}
@@ -1331,13 +1515,17 @@ class Task47 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task47(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task47() {}
@@ -1360,13 +1548,17 @@ class Task48 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task48(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task48() {}
@@ -1389,13 +1581,17 @@ class Task49 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task49(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task49() {}
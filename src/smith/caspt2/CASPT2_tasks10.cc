@@ -40,23 +40,22 @@ void Task450::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(a4.size()*c1.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I583
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, a2)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a4.size()*c1.size()*a2.size(),
-               1.0, i0data_sorted, a4.size()*c1.size()*a2.size(), i1data_sorted, a4.size()*c1.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -104,23 +103,22 @@ void Task453::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I588
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x1, x0)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a1.size(), x1.size(), a3.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x0.size(), i1data_sorted, a3.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x1.size());
   out()->add_block(odata, x1, a1);
 }
@@ -135,21 +133,20 @@ void Task454::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I589
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c2.size());
   out()->add_block(odata, a3, c2, x1, x0);
 }
@@ -197,23 +194,22 @@ void Task457::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a1.size()*c2.size()*x0.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I591
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x0, x1)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x0.size(), x1.size());
-        dgemm_("T", "N", a3.size(), x1.size(), a1.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a1.size()*c2.size()*x0.size(), i1data_sorted, a1.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size());
   out()->add_block(odata, x1, a3);
 }
@@ -228,21 +224,20 @@ void Task458::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -257,21 +252,20 @@ void Task459::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -298,21 +292,20 @@ void Task461::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), 1, odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a3.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I600
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), 1, a3.size()*x0.size(),
-             1.0, i0data_sorted, a3.size()*x0.size(), i1data_sorted, a3.size()*x0.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
   out()->add_block(odata, c2, a1);
 }
@@ -325,23 +318,22 @@ void Task462::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
   out()->add_block(odata, a3, x0);
 }
@@ -368,21 +360,20 @@ void Task464::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), 1, odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a1.size()*x0.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I603
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size());
-      dgemm_("T", "N", a3.size()*c2.size(), 1, a1.size()*x0.size(),
-             1.0, i0data_sorted, a1.size()*x0.size(), i1data_sorted, a1.size()*x0.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
   out()->add_block(odata, a3, c2);
 }
@@ -395,23 +386,22 @@ void Task465::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
   out()->add_block(odata, a1, x0);
 }
@@ -438,19 +428,18 @@ void Task467::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I606
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c4.size());
   out()->add_block(odata, c4, x1);
 }
@@ -463,23 +452,22 @@ void Task468::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a3.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I607
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, c4, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, c4, a1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), c2.size()*a3.size()*a1.size(),
-               1.0, i0data_sorted, c2.size()*a3.size()*a1.size(), i1data_sorted, c2.size()*a3.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c4.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -527,23 +515,22 @@ void Task471::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+        gemm.reserve(a3.size()*a1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a1.size());
         // tensor label: I618
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c2.size(), a3.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*x1.size(), i1data_sorted, a3.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c2.size());
   out()->add_block(odata, c2, c4);
 }
@@ -558,19 +545,18 @@ void Task472::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -583,23 +569,22 @@ void Task473::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c4, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c4, a3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a3.size());
+        gemm.reserve(a3.size()*a1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c4.size(), a3.size());
         // tensor label: I621
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c2.size(), a3.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*x1.size(), i1data_sorted, a3.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c2.size());
   out()->add_block(odata, c2, c4);
 }
@@ -614,19 +599,18 @@ void Task474::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -653,23 +637,22 @@ void Task476::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a3.size());
         // tensor label: I624
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a1.size(), a3.size()*c2.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x1.size(), i1data_sorted, a3.size()*c2.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a1.size());
   out()->add_block(odata, a1, a4);
 }
@@ -684,19 +667,18 @@ void Task477::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -709,23 +691,22 @@ void Task478::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       for (auto& c2 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a4.size());
+        gemm.reserve(a3.size()*c2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a4.size());
         // tensor label: I627
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a1.size(), a3.size()*c2.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x1.size(), i1data_sorted, a3.size()*c2.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a1.size());
   out()->add_block(odata, a1, a4);
 }
@@ -740,19 +721,18 @@ void Task479::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -779,23 +759,22 @@ void Task481::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
+        gemm.reserve(c2.size()*a1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a1.size());
         // tensor label: I630
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a3.size(), c2.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x1.size(), i1data_sorted, c2.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a3.size());
   out()->add_block(odata, a3, a4);
 }
@@ -810,19 +789,18 @@ void Task482::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -835,23 +813,22 @@ void Task483::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& c2 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a4.size());
+        gemm.reserve(c2.size()*a1.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a4.size());
         // tensor label: I633
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a3.size(), c2.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x1.size(), i1data_sorted, c2.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a3.size());
   out()->add_block(odata, a3, a4);
 }
@@ -866,19 +843,18 @@ void Task484::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -905,23 +881,22 @@ void Task486::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a1.size()*a3.size()*x0.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I636
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a3, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a3, x0, x1)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size());
-        dgemm_("T", "N", c2.size(), x1.size(), a1.size()*a3.size()*x0.size(),
-               1.0, i0data_sorted, a1.size()*a3.size()*x0.size(), i1data_sorted, a1.size()*a3.size()*x0.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a3.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x1.size());
   out()->add_block(odata, x1, c2);
 }
@@ -936,21 +911,20 @@ void Task487::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma60
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a3)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a3.size());
   out()->add_block(odata, a1, a3, x0, x1);
 }
@@ -977,23 +951,22 @@ void Task490::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -1020,21 +993,20 @@ void Task492::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I653
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
   out()->add_block(odata, a2, c1);
 }
@@ -1082,23 +1054,22 @@ void Task495::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
   out()->add_block(odata, a1, x0);
 }
@@ -1129,21 +1100,20 @@ void Task498::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma92
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c2, x2)]);
-      sort_indices<1,3,0,2,0,1,2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x0, x1);
 }
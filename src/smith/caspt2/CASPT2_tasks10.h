@@ -55,13 +55,17 @@ class Task450 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task450(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task450() {}
@@ -84,13 +88,17 @@ class Task451 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task451(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task451() {}
@@ -113,13 +121,17 @@ class Task452 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task452(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task452() {}
@@ -142,13 +154,17 @@ class Task453 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task453(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task453() {}
@@ -171,13 +187,17 @@ class Task454 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task454(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task454() {}
@@ -200,13 +220,17 @@ class Task455 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task455(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task455() {}
@@ -229,13 +253,17 @@ class Task456 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task456(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task456() {}
@@ -258,13 +286,17 @@ class Task457 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task457(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task457() {}
@@ -287,13 +319,17 @@ class Task458 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task458(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task458() {}
@@ -316,13 +352,17 @@ class Task459 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task459(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task459() {}
@@ -345,13 +385,17 @@ class Task460 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task460(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task460() {}
@@ -374,13 +418,17 @@ class Task461 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task461(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task461() {}
@@ -403,13 +451,17 @@ class Task462 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task462(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task462() {}
@@ -432,13 +484,17 @@ class Task463 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task463(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task463() {}
@@ -461,13 +517,17 @@ class Task464 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task464(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task464() {}
@@ -490,13 +550,17 @@ class Task465 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task465(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task465() {}
@@ -519,13 +583,17 @@ class Task466 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task466(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task466() {}
@@ -548,13 +616,17 @@ class Task467 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task467(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task467() {}
@@ -577,13 +649,17 @@ class Task468 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task468(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task468() {}
@@ -606,13 +682,17 @@ class Task469 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task469(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task469() {}
@@ -635,13 +715,17 @@ class Task470 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task470(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task470() {}
@@ -664,13 +748,17 @@ class Task471 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task471(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task471() {}
@@ -693,13 +781,17 @@ class Task472 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task472(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task472() {}
@@ -722,13 +814,17 @@ class Task473 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task473(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task473() {}
@@ -751,13 +847,17 @@ class Task474 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task474(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task474() {}
@@ -780,13 +880,17 @@ class Task475 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task475(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task475() {}
@@ -809,13 +913,17 @@ class Task476 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task476(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task476() {}
@@ -838,13 +946,17 @@ class Task477 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task477(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task477() {}
@@ -867,13 +979,17 @@ class Task478 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task478(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task478() {}
@@ -896,13 +1012,17 @@ class Task479 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task479(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task479() {}
@@ -925,13 +1045,17 @@ class Task480 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task480(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task480() {}
@@ -954,13 +1078,17 @@ class Task481 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task481(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task481() {}
@@ -983,13 +1111,17 @@ class Task482 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task482(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task482() {}
@@ -1012,13 +1144,17 @@ class Task483 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task483(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task483() {}
@@ -1041,13 +1177,17 @@ class Task484 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task484(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task484() {}
@@ -1070,13 +1210,17 @@ class Task485 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task485(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task485() {}
@@ -1099,13 +1243,17 @@ class Task486 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task486(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task486() {}
@@ -1128,13 +1276,17 @@ class Task487 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task487(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task487() {}
@@ -1172,13 +1324,17 @@ class Task489 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task489(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task489() {}
@@ -1201,13 +1357,17 @@ class Task490 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task490(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task490() {}
@@ -1230,13 +1390,17 @@ class Task491 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task491(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task491() {}
@@ -1259,13 +1423,17 @@ class Task492 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task492(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task492() {}
@@ -1288,13 +1456,17 @@ class Task493 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task493(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task493() {}
@@ -1317,13 +1489,17 @@ class Task494 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task494(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task494() {}
@@ -1346,13 +1522,17 @@ class Task495 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task495(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task495() {}
@@ -1390,13 +1570,17 @@ class Task497 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task497(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task497() {}
@@ -1419,13 +1603,17 @@ class Task498 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task498(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task498() {}
@@ -1448,13 +1636,17 @@ class Task499 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task499(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task499() {}
@@ -42,23 +42,22 @@ void Task500::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -89,19 +88,18 @@ void Task502::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I663
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, c3, a2, c1, x0);
 }
@@ -153,21 +151,20 @@ void Task505::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -182,21 +179,20 @@ void Task506::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -227,21 +223,20 @@ void Task508::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I671
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, x1, x0);
 }
@@ -293,23 +288,22 @@ void Task511::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma59
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -377,19 +371,18 @@ void Task515::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I679
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, c2, a1, x0);
 }
@@ -441,21 +434,20 @@ void Task518::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma60
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -907,21 +899,20 @@ void Task522::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.reserve(c1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-      sort_indices<2,0,1,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), c1.size()*c2.size(),
-             1.0, i0data_sorted, c1.size()*c2.size(), i1data_sorted, c1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -1042,21 +1033,20 @@ void Task524::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.reserve(c1.size()*c3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c3.size(), x2.size());
       // tensor label: I689
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, c3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c1.size()*c3.size(),
-             1.0, i0data_sorted, c1.size()*c3.size(), i1data_sorted, c1.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), c1.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1071,19 +1061,18 @@ void Task525::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size()*x0.size()*c1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-    sort_indices<2,0,1,3,0,1,-8,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-    dgemm_("T", "N", c3.size(), x1.size()*x0.size()*c1.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<0,1,3,2,0,1,-8,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, c1, c3);
 }
@@ -1128,21 +1117,20 @@ void Task527::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c2, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.reserve(c2.size()*c1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c2.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1157,21 +1145,20 @@ void Task528::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*c1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c2, x2)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1424,19 +1411,18 @@ void Task530::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: I693
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->add_block(odata, x1, x0, x2, x5, x4, x3);
 }
@@ -1451,19 +1437,18 @@ void Task531::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x1.size()*x0.size()*c1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-    sort_indices<2,0,1,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-    dgemm_("T", "N", x2.size(), x1.size()*x0.size()*c1.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x2.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, c1, x2);
 }
@@ -1584,21 +1569,20 @@ void Task533::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.reserve(c1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: I697
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c2, x3, x2)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), c1.size()*c2.size(),
-             1.0, i0data_sorted, c1.size()*c2.size(), i1data_sorted, c1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -1613,19 +1597,18 @@ void Task534::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), c1.size()*c2.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a3, c2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a3, c2, x3)]);
-    sort_indices<1,0,2,3,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
-    dgemm_("T", "N", x2.size(), c1.size()*c2.size()*x3.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a3.size(), c2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), c1.size(), c2.size(), x3.size());
   out()->add_block(odata, c1, c2, x3, x2);
 }
@@ -1640,21 +1623,20 @@ void Task535::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.reserve(c3.size()*c1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c3.size(), x2.size());
       // tensor label: I728
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, c1, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), c1.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c3.size()*c1.size(),
-             1.0, i0data_sorted, c3.size()*c1.size(), i1data_sorted, c3.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), c1.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -1669,19 +1651,18 @@ void Task536::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*c3.size()*c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<1,0,2,3,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*c3.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, c1, x1);
 }
@@ -1934,19 +1915,18 @@ void Task538::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I701
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -1961,19 +1941,18 @@ void Task539::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c2, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-    dgemm_("T", "N", x3.size(), c1.size()*x5.size()*x4.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,3,2,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x5.size(), x4.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -2529,19 +2508,18 @@ void Task541::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x7, x6, x5, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(x7, x6, c1, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x7, x6, c1, x5)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), c1.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x7.size(), x6.size(), x5.size());
   out()->add_block(odata, x7, x6, x5, x2, x1, x0);
 }
@@ -2688,19 +2666,18 @@ void Task543::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c2.size(), x3.size());
     // tensor label: I708
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, c2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), c2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), x1.size(), x0.size(), c2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -2715,19 +2692,18 @@ void Task544::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c2.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", c2.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, c2);
 }
@@ -2744,19 +2720,18 @@ void Task545::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I724
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,4,5,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -2788,19 +2763,18 @@ void Task547::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
-    dgemm_("T", "N", x3.size(), c1.size()*x5.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x5.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x5.size(), x4.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -2817,19 +2791,18 @@ void Task548::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: I848
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,3,4,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -2844,19 +2817,18 @@ void Task549::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x1.size()*x0.size()*c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", x2.size(), x1.size()*x0.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x2.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, c1, x2);
 }
@@ -55,13 +55,17 @@ class Task500 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task500(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task500() {}
@@ -84,13 +88,17 @@ class Task501 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task501(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task501() {}
@@ -113,13 +121,17 @@ class Task502 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task502(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task502() {}
@@ -142,13 +154,17 @@ class Task503 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task503(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task503() {}
@@ -171,13 +187,17 @@ class Task504 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task504(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task504() {}
@@ -200,13 +220,17 @@ class Task505 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task505(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task505() {}
@@ -229,13 +253,17 @@ class Task506 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task506(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task506() {}
@@ -258,13 +286,17 @@ class Task507 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task507(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task507() {}
@@ -287,13 +319,17 @@ class Task508 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task508(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task508() {}
@@ -316,13 +352,17 @@ class Task509 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task509(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task509() {}
@@ -345,13 +385,17 @@ class Task510 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task510(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task510() {}
@@ -374,13 +418,17 @@ class Task511 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task511(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task511() {}
@@ -403,13 +451,17 @@ class Task512 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task512(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task512() {}
@@ -432,13 +484,17 @@ class Task513 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task513(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task513() {}
@@ -461,13 +517,17 @@ class Task514 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task514(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task514() {}
@@ -490,13 +550,17 @@ class Task515 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task515(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task515() {}
@@ -519,13 +583,17 @@ class Task516 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task516(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task516() {}
@@ -548,13 +616,17 @@ class Task517 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task517(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task517() {}
@@ -577,13 +649,17 @@ class Task518 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task518(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,3> range);
     ~Task518() {}
@@ -632,7 +708,7 @@ class Task521 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -643,8 +719,12 @@ class Task521 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task521(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task521() {}
@@ -667,13 +747,17 @@ class Task522 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task522(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task522() {}
@@ -696,7 +780,7 @@ class Task523 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -707,8 +791,12 @@ class Task523 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task523(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task523() {}
@@ -731,13 +819,17 @@ class Task524 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task524(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task524() {}
@@ -760,13 +852,17 @@ class Task525 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task525(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task525() {}
@@ -790,13 +886,17 @@ class Task526 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task526(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range, const double e);
     ~Task526() {}
@@ -819,13 +919,17 @@ class Task527 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task527(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task527() {}
@@ -848,13 +952,17 @@ class Task528 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task528(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task528() {}
@@ -877,7 +985,7 @@ class Task529 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -888,8 +996,12 @@ class Task529 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task529(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task529() {}
@@ -912,13 +1024,17 @@ class Task530 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task530(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task530() {}
@@ -941,13 +1057,17 @@ class Task531 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task531(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task531() {}
@@ -970,7 +1090,7 @@ class Task532 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -981,8 +1101,12 @@ class Task532 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task532(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task532() {}
@@ -1005,13 +1129,17 @@ class Task533 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task533(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task533() {}
@@ -1034,13 +1162,17 @@ class Task534 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task534(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task534() {}
@@ -1063,13 +1195,17 @@ class Task535 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task535(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task535() {}
@@ -1092,13 +1228,17 @@ class Task536 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task536(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task536() {}
@@ -1121,7 +1261,7 @@ class Task537 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -1132,8 +1272,12 @@ class Task537 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task537(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task537() {}
@@ -1156,13 +1300,17 @@ class Task538 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task538(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task538() {}
@@ -1185,13 +1333,17 @@ class Task539 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task539(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task539() {}
@@ -1214,7 +1366,7 @@ class Task540 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -1225,8 +1377,12 @@ class Task540 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task540(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task540() {}
@@ -1249,13 +1405,17 @@ class Task541 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task541(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task541() {}
@@ -1278,7 +1438,7 @@ class Task542 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -1289,8 +1449,12 @@ class Task542 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task542(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task542() {}
@@ -1313,13 +1477,17 @@ class Task543 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task543(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task543() {}
@@ -1342,13 +1510,17 @@ class Task544 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task544(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task544() {}
@@ -1371,13 +1543,17 @@ class Task545 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task545(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task545() {}
@@ -1401,13 +1577,17 @@ class Task546 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task546(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range, const double e);
     ~Task546() {}
@@ -1430,13 +1610,17 @@ class Task547 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task547(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task547() {}
@@ -1459,13 +1643,17 @@ class Task548 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task548(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task548() {}
@@ -1488,13 +1676,17 @@ class Task549 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task549(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task549() {}
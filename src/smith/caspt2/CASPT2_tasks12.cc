@@ -44,19 +44,18 @@ void Task550::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -73,19 +72,18 @@ void Task551::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,4,5,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -148,19 +146,18 @@ void Task553::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I712
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -173,21 +170,20 @@ void Task554::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(1, c1.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), c2.size());
+      gemm.reserve(c2.size()*a3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), c2.size());
       // tensor label: I713
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, c1, x3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
-      dgemm_("T", "N", 1, c1.size()*x3.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
   out()->add_block(odata, c1, x3);
 }
@@ -223,21 +219,20 @@ void Task556::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I802
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -252,19 +247,18 @@ void Task557::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), c2.size()*a1.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, c3, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
-    dgemm_("T", "N", x2.size(), c2.size()*a1.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), c3.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), c2.size(), a1.size(), x3.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -279,21 +273,20 @@ void Task558::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I852
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -308,19 +301,18 @@ void Task559::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), a2.size()*c1.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: I853
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x2.size(), a2.size()*c1.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), a2.size(), c1.size(), x3.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -356,21 +348,20 @@ void Task561::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, x2, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), x2.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), x2.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -385,19 +376,18 @@ void Task562::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -544,19 +534,18 @@ void Task564::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I720
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, c1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, c1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), c1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), c1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -571,19 +560,18 @@ void Task565::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, c1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, c1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, c1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*c1.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-    dgemm_("T", "N", x3.size(), x5.size()*c1.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), c1.size(), x4.size());
   out()->add_block(odata, x5, c1, x4, x3);
 }
@@ -646,19 +634,18 @@ void Task567::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size()*x1.size(), x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c3, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c3.size(), x1.size());
     // tensor label: I732
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size());
-    dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -671,21 +658,20 @@ void Task568::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3), 0.0);
+  GemmBatch<double> gemm(1, x0.size()*c3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-      sort_indices<0,1,2,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-      dgemm_("T", "N", 1, x0.size()*c3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,0,1,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x0.size());
   out()->add_block(odata, x0, c3);
 }
@@ -700,19 +686,18 @@ void Task569::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size()*x1.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c1.size(), x1.size());
     // tensor label: I736
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c1.size());
-    dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -725,21 +710,20 @@ void Task570::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c1), 0.0);
+  GemmBatch<double> gemm(1, x0.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-      sort_indices<2,1,0,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-      dgemm_("T", "N", 1, x0.size()*c1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x0.size());
   out()->add_block(odata, x0, c1);
 }
@@ -754,21 +738,20 @@ void Task571::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I774
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a2.size(), c1.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -783,19 +766,18 @@ void Task572::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, a2, c1, x1);
 }
@@ -810,21 +792,20 @@ void Task573::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I778
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), a2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -839,19 +820,18 @@ void Task574::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, a2, x1);
 }
@@ -866,21 +846,20 @@ void Task575::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I782
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a2.size(), c1.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -895,19 +874,18 @@ void Task576::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<2,0,1,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,3,2,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, a2, c1, x1);
 }
@@ -922,21 +900,20 @@ void Task577::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, x1, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), x1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), x1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -951,19 +928,18 @@ void Task578::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size()*x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), x1.size()*x2.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), x2.size(), x1.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -1056,23 +1032,22 @@ void Task580::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I740
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size(), x3.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
@@ -1134,23 +1109,22 @@ void Task583::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*c4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I746
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c4)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c4.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c4.size(), i1data_sorted, c3.size()*a2.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), a2.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1165,19 +1139,18 @@ void Task584::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, a2, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), x0.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c4.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<0,1,2,3,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", c4.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c4.size());
+    sort_indices<1,2,3,0,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c4.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, a2, c4);
 }
@@ -1190,23 +1163,22 @@ void Task585::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c4 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*c4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I750
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, c4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), c4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c4.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c4.size(), i1data_sorted, c3.size()*a2.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), a2.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1221,19 +1193,18 @@ void Task586::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, a2, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), x0.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c4.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", c4.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c4.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c4.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, a2, c4);
 }
@@ -1246,23 +1217,22 @@ void Task587::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*c4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I754
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, c4)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), c4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a2.size()*c1.size()*c4.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*c4.size(), i1data_sorted, a2.size()*c1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a2.size(), c1.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1277,19 +1247,18 @@ void Task588::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a2, c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), x0.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), c4.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), c4.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", c4.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c4.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, a2, c1, c4);
 }
@@ -1302,23 +1271,22 @@ void Task589::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*a4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c1.size(), x1.size());
         // tensor label: I758
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, c1, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, c1, a4)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), c1.size(), a4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*c1.size()*a4.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*a4.size(), i1data_sorted, c3.size()*c1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), c1.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1333,19 +1301,18 @@ void Task590::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, c1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), x0.size()*c3.size()*c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", a4.size(), x0.size()*c3.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a4.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, c1, a4);
 }
@@ -1358,23 +1325,22 @@ void Task591::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c4 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*c4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I762
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, c4)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), c4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a2.size()*c1.size()*c4.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*c4.size(), i1data_sorted, a2.size()*c1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a2.size(), c1.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1389,19 +1355,18 @@ void Task592::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a2, c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), x0.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), c4.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), c4.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<2,0,1,3,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", c4.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c4.size());
+    sort_indices<0,1,3,2,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, a2, c1, c4);
 }
@@ -1414,23 +1379,22 @@ void Task593::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*a4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: I766
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, c1, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, c1, a4)]);
-        sort_indices<2,3,1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), c1.size(), a4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*c1.size()*a4.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*a4.size(), i1data_sorted, c3.size()*c1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), c1.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1445,19 +1409,18 @@ void Task594::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, c1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), x0.size()*c3.size()*c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<1,0,2,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", a4.size(), x0.size()*c3.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a4.size());
+    sort_indices<0,2,3,1,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, c1, a4);
 }
@@ -1470,19 +1433,18 @@ void Task595::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), x1.size());
+    gemm.reserve(a4.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), x1.size());
     // tensor label: I786
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1495,23 +1457,22 @@ void Task596::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c1.size()*c3.size()*a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I787
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
-        dgemm_("T", "N", x0.size(), a4.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -1545,19 +1506,18 @@ void Task598::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a2.size());
     // tensor label: I929
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size());
-    dgemm_("T", "N", x0.size(), x1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1570,23 +1530,22 @@ void Task599::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a4.size()*c3.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<1,2,0,3,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
-        dgemm_("T", "N", a2.size(), x1.size(), c1.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a4.size()*c3.size(), i1data_sorted, c1.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,1,2,0,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x1.size());
   out()->add_block(odata, x1, a2);
 }
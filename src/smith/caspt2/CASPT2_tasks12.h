@@ -55,13 +55,17 @@ class Task550 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task550(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task550() {}
@@ -84,13 +88,17 @@ class Task551 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task551(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task551() {}
@@ -113,7 +121,7 @@ class Task552 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -124,8 +132,12 @@ class Task552 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task552(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task552() {}
@@ -148,13 +160,17 @@ class Task553 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task553(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task553() {}
@@ -177,13 +193,17 @@ class Task554 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task554(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task554() {}
@@ -206,13 +226,17 @@ class Task555 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task555(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task555() {}
@@ -235,13 +259,17 @@ class Task556 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task556(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task556() {}
@@ -264,13 +292,17 @@ class Task557 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task557(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task557() {}
@@ -293,13 +325,17 @@ class Task558 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task558(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task558() {}
@@ -322,13 +358,17 @@ class Task559 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task559(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task559() {}
@@ -351,13 +391,17 @@ class Task560 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task560(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task560() {}
@@ -380,13 +424,17 @@ class Task561 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task561(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task561() {}
@@ -409,13 +457,17 @@ class Task562 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task562(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task562() {}
@@ -438,7 +490,7 @@ class Task563 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -449,8 +501,12 @@ class Task563 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task563(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task563() {}
@@ -473,13 +529,17 @@ class Task564 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task564(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task564() {}
@@ -502,13 +562,17 @@ class Task565 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task565(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task565() {}
@@ -531,7 +595,7 @@ class Task566 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -542,8 +606,12 @@ class Task566 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task566(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task566() {}
@@ -566,13 +634,17 @@ class Task567 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task567(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task567() {}
@@ -595,13 +667,17 @@ class Task568 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task568(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task568() {}
@@ -624,13 +700,17 @@ class Task569 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task569(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task569() {}
@@ -653,13 +733,17 @@ class Task570 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task570(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task570() {}
@@ -682,13 +766,17 @@ class Task571 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task571(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task571() {}
@@ -711,13 +799,17 @@ class Task572 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task572(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task572() {}
@@ -740,13 +832,17 @@ class Task573 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task573(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task573() {}
@@ -769,13 +865,17 @@ class Task574 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task574(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task574() {}
@@ -798,13 +898,17 @@ class Task575 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task575(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task575() {}
@@ -827,13 +931,17 @@ class Task576 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task576(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task576() {}
@@ -856,13 +964,17 @@ class Task577 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task577(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task577() {}
@@ -885,13 +997,17 @@ class Task578 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task578(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task578() {}
@@ -914,7 +1030,7 @@ class Task579 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -925,8 +1041,12 @@ class Task579 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task579(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task579() {}
@@ -949,13 +1069,17 @@ class Task580 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task580(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task580() {}
@@ -978,13 +1102,17 @@ class Task581 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task581(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task581() {}
@@ -1007,7 +1135,7 @@ class Task582 : public Task {  // merged with gamma
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_[0]->allocated())
         out_[0]->allocate();
       if (!out_[1]->allocated())
@@ -1018,8 +1146,12 @@ class Task582 : public Task {  // merged with gamma
         out_[3]->allocate();
       if (!out_[4]->allocated())
         out_[4]->allocate();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task582(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task582() {}
@@ -1042,13 +1174,17 @@ class Task583 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task583(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task583() {}
@@ -1071,13 +1207,17 @@ class Task584 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task584(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task584() {}
@@ -1100,13 +1240,17 @@ class Task585 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task585(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task585() {}
@@ -1129,13 +1273,17 @@ class Task586 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task586(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task586() {}
@@ -1158,13 +1306,17 @@ class Task587 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task587(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task587() {}
@@ -1187,13 +1339,17 @@ class Task588 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task588(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task588() {}
@@ -1216,13 +1372,17 @@ class Task589 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task589(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task589() {}
@@ -1245,13 +1405,17 @@ class Task590 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task590(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task590() {}
@@ -1274,13 +1438,17 @@ class Task591 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task591(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task591() {}
@@ -1303,13 +1471,17 @@ class Task592 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task592(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task592() {}
@@ -1332,13 +1504,17 @@ class Task593 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task593(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task593() {}
@@ -1361,13 +1537,17 @@ class Task594 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task594(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task594() {}
@@ -1390,13 +1570,17 @@ class Task595 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task595(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task595() {}
@@ -1419,13 +1603,17 @@ class Task596 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task596(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task596() {}
@@ -1448,13 +1636,17 @@ class Task597 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task597(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task597() {}
@@ -1477,13 +1669,17 @@ class Task598 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task598(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task598() {}
@@ -1506,13 +1702,17 @@ class Task599 : public Task {
         void compute() override;
     };
     std::vector<std::shared_ptr<Task_local>> subtasks_;
-    void compute_() override {
+    void prepare_() override {
       if (!out_->allocated())
         out_->allocate();
       for (auto& i : in_)
         i->init();
+    }
+    void compute_() override {
       for (auto& i : subtasks_) i->compute();
     }
+    bool concurrent() const override { return true; }
+    std::vector<std::pair<const void*, size_t>> allocation() const override { return allocation_of(out_); }
   public:
     Task599(std::vector<std::shared_ptr<Tensor>> t, std::array<std::shared_ptr<const IndexRange>,4> range);
     ~Task599() {}
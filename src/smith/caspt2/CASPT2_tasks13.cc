@@ -40,19 +40,18 @@ void Task600::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a4.size());
     // tensor label: I933
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size());
-    dgemm_("T", "N", x0.size(), x1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x0, x1);
 }
@@ -65,23 +64,22 @@ void Task601::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a2.size()*c3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<2,1,0,3,0,1,8,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", a4.size(), x1.size(), c1.size()*a2.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a2.size()*c3.size(), i1data_sorted, c1.size()*a2.size()*c3.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<3,2,1,0,0,1,8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x1.size());
   out()->add_block(odata, x1, a4);
 }
@@ -94,23 +92,22 @@ void Task602::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I1070
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), x1.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x0, x1);
 }
@@ -146,23 +143,22 @@ void Task604::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size(), c1.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size(), c1.size(), a2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,0,1,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<3,2,0,1,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -175,23 +171,22 @@ void Task605::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size(), c3.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size(), c3.size(), a2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<3,0,2,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -204,23 +199,22 @@ void Task606::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x0, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x0.size(), c1.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x0.size(), c1.size(), a2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x1)]);
-        sort_indices<2,0,1,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), x1.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,2,0,1,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x0, x1);
 }
@@ -233,23 +227,22 @@ void Task607::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c3.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c3.size(), a2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x1)]);
-        sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), x1.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,2,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x0, x1);
 }
@@ -312,21 +305,20 @@ void Task609::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c3.size(), x2.size());
       // tensor label: I770
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), a2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x1, x3, x2);
 }
@@ -341,19 +333,18 @@ void Task610::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, a2, x1);
 }
@@ -368,21 +359,20 @@ void Task611::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x0, x1, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x0, x1, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), x0.size(), x1.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x0.size(), x1.size(), a1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x0, x1, x3, x2);
 }
@@ -529,19 +519,18 @@ void Task613::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c2.size(), x3.size());
     // tensor label: I794
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c2.size(), x0.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->add_block(odata, x1, x0, x2, x5, x4, x3);
 }
@@ -556,19 +545,18 @@ void Task614::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c2, x0, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x1.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-    dgemm_("T", "N", x2.size(), x1.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x2.size(), x0.size(), c2.size(), x1.size());
   out()->add_block(odata, x1, c2, x0, x2);
 }
@@ -631,21 +619,20 @@ void Task616::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(a1.size()*c2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I798
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x3, x2)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), a1.size()*c2.size(),
-             1.0, i0data_sorted, a1.size()*c2.size(), i1data_sorted, a1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -660,19 +647,18 @@ void Task617::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), a1.size()*c2.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a1, c2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a1, c2, x3)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
-    dgemm_("T", "N", x2.size(), a1.size()*c2.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), c3.size(), a1.size(), c2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), a1.size(), c2.size(), x3.size());
   out()->add_block(odata, a1, c2, x3, x2);
 }
@@ -687,21 +673,20 @@ void Task618::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x3, x2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x3, x2, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), x3.size(), x2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x3.size(), x2.size(), a1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -817,21 +802,20 @@ void Task620::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(a1.size()*c2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-      sort_indices<2,1,0,3,0,1,2,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a1.size()*c2.size(),
-             1.0, i0data_sorted, a1.size()*c2.size(), i1data_sorted, a1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -879,21 +863,20 @@ void Task622::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+      gemm.reserve(a1.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), x2.size());
       // tensor label: I809
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, c3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a1.size()*c3.size(),
-             1.0, i0data_sorted, a1.size()*c3.size(), i1data_sorted, a1.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), x0.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -908,19 +891,18 @@ void Task623::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a1, x0, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-    sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-    dgemm_("T", "N", c3.size(), x1.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x0.size(), a1.size(), x1.size());
   out()->add_block(odata, x1, a1, x0, c3);
 }
@@ -935,21 +917,20 @@ void Task624::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.reserve(c2.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), x2.size());
       // tensor label: I813
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, a3)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), a3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c2.size(), x0.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -964,19 +945,18 @@ void Task625::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c2, x0, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-    dgemm_("T", "N", a3.size(), x1.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x0.size(), c2.size(), x1.size());
   out()->add_block(odata, x1, c2, x0, a3);
 }
@@ -991,21 +971,20 @@ void Task626::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(a1.size()*c2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I844
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), a1.size()*c2.size(),
-             1.0, i0data_sorted, a1.size()*c2.size(), i1data_sorted, a1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1037,19 +1016,18 @@ void Task628::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, c2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, c2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, c2, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*a1.size()*c2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x2.size(), x3.size()*a1.size()*c2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), a1.size(), c2.size());
   out()->add_block(odata, x3, a1, c2, x2);
 }
@@ -1064,21 +1042,20 @@ void Task629::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: I987
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1093,19 +1070,18 @@ void Task630::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c2.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x0, x1);
 }
@@ -1120,21 +1096,20 @@ void Task631::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1149,21 +1124,20 @@ void Task632::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1279,21 +1253,20 @@ void Task634::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x5.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -1308,21 +1281,20 @@ void Task635::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I860
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -1391,21 +1363,20 @@ void Task638::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+      gemm.reserve(a1.size()*c3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), x3.size(), x2.size());
       // tensor label: I820
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, c3)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a1.size()*c3.size(),
-             1.0, i0data_sorted, a1.size()*c3.size(), i1data_sorted, a1.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), x0.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1420,19 +1391,18 @@ void Task639::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a1, x0, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c3.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-    dgemm_("T", "N", c3.size(), x1.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x0.size(), a1.size(), x1.size());
   out()->add_block(odata, x1, a1, x0, c3);
 }
@@ -1447,21 +1417,20 @@ void Task640::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x3.size(), x2.size());
+      gemm.reserve(c2.size()*a3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x3.size(), x2.size());
       // tensor label: I824
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, x0, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, x0, a3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), x0.size(), a3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c2.size(), x0.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1476,19 +1445,18 @@ void Task641::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c2, x0, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-    dgemm_("T", "N", a3.size(), x1.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x0.size(), c2.size(), x1.size());
   out()->add_block(odata, x1, c2, x0, a3);
 }
@@ -1503,19 +1471,18 @@ void Task642::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c2, x0, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2, x0, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2, x0, a3), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<1,0,2,3,0,1,4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a3.size());
   out()->add_block(odata, x1, c2, x0, a3);
 }
@@ -1530,21 +1497,20 @@ void Task643::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I840
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2, a1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2, a1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size(), a1.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c2.size(), a1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1576,19 +1542,18 @@ void Task645::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2, a1, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x2.size(), x3.size()*c2.size()*a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), c2.size(), a1.size());
   out()->add_block(odata, x3, c2, a1, x2);
 }
@@ -1603,21 +1568,20 @@ void Task646::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.reserve(a2.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c3.size(), x2.size());
       // tensor label: I863
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c3.size(),
-             1.0, i0data_sorted, a2.size()*c3.size(), i1data_sorted, a2.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), a2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1632,19 +1596,18 @@ void Task647::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size()*x0.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c3.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c3.size(), x1.size()*x0.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, a2, c3);
 }
@@ -1659,21 +1622,20 @@ void Task648::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), x2.size());
+      gemm.reserve(c1.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c1.size(), x2.size());
       // tensor label: I867
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, a3)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), a3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c1.size()*a3.size(),
-             1.0, i0data_sorted, c1.size()*a3.size(), i1data_sorted, c1.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), c1.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1688,19 +1650,18 @@ void Task649::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size()*x0.size()*c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", a3.size(), x1.size()*x0.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a3.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, c1, a3);
 }
@@ -42,21 +42,20 @@ void Task650::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(a2.size()*c3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I874
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c3)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c3.size(),
-             1.0, i0data_sorted, a2.size()*c3.size(), i1data_sorted, a2.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), a2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -71,19 +70,18 @@ void Task651::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size()*x0.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), c3.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-    sort_indices<0,1,2,3,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c3.size(), x1.size()*x0.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<1,2,3,0,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, a2, c3);
 }
@@ -98,21 +96,20 @@ void Task652::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x3.size(), x2.size());
+      gemm.reserve(c1.size()*a3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), x3.size(), x2.size());
       // tensor label: I878
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), a3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c1.size()*a3.size(),
-             1.0, i0data_sorted, c1.size()*a3.size(), i1data_sorted, c1.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), c1.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -127,19 +124,18 @@ void Task653::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size()*x0.size()*c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-    sort_indices<1,0,2,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", a3.size(), x1.size()*x0.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<0,2,3,1,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a3.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, c1, a3);
 }
@@ -154,21 +150,20 @@ void Task654::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(c1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I894
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, a2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, a2, x2)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), a2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), c1.size()*a2.size(),
-             1.0, i0data_sorted, c1.size()*a2.size(), i1data_sorted, c1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c1.size(), a2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -206,19 +201,18 @@ void Task656::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c1, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, a2, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*c1.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size());
     // tensor label: I895
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c1, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c1.size(), a2.size());
-    dgemm_("T", "N", x2.size(), x3.size()*c1.size()*a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), c1.size(), a2.size());
   out()->add_block(odata, x3, c1, a2, x2);
 }
@@ -254,21 +248,20 @@ void Task658::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), x2.size());
       // tensor label: I983
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -283,19 +276,18 @@ void Task659::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, x0, x1);
 }
@@ -310,21 +302,20 @@ void Task660::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: I995
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -339,19 +330,18 @@ void Task661::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c2.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x0, x1);
 }
@@ -366,21 +356,20 @@ void Task662::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -395,21 +384,20 @@ void Task663::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c2.size(), a1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -424,21 +412,20 @@ void Task664::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -453,21 +440,20 @@ void Task665::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,1,0,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -482,21 +468,20 @@ void Task666::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -511,21 +496,20 @@ void Task667::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x0.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -540,21 +524,20 @@ void Task668::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c2.size(), a1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -569,21 +552,20 @@ void Task669::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -598,21 +580,20 @@ void Task670::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2, c1, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a2.size(), c1.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,1,0,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -627,21 +608,20 @@ void Task671::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -716,19 +696,18 @@ void Task673::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: I828
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), x0.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->add_block(odata, x1, x0, x2, x5, x4, x3);
 }
@@ -743,19 +722,18 @@ void Task674::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a1, x0, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x1.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-    dgemm_("T", "N", x2.size(), x1.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x2.size(), x0.size(), a1.size(), x1.size());
   out()->add_block(odata, x1, a1, x0, x2);
 }
@@ -784,21 +762,20 @@ void Task676::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), 1, odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I832
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size());
-      dgemm_("T", "N", x1.size()*x0.size(), 1, c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -811,21 +788,20 @@ void Task677::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(1, c2.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), c3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), c3.size());
       // tensor label: I833
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
-      dgemm_("T", "N", 1, c2.size()*a1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a4.size(), c3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
   out()->add_block(odata, c2, a1);
 }
@@ -859,21 +835,20 @@ void Task679::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), 1, odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(c1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I886
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), 1, c1.size()*a2.size(),
-             1.0, i0data_sorted, c1.size()*a2.size(), i1data_sorted, c1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -886,21 +861,20 @@ void Task680::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(1, c1.size()*a2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, c3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), c3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), c3.size());
       // tensor label: I887
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
-      dgemm_("T", "N", 1, c1.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, c1, a2);
 }
@@ -934,21 +908,20 @@ void Task682::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), 1, odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
+      gemm.reserve(a4.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c1.size(), x0.size());
       // tensor label: I937
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
-      dgemm_("T", "N", x1.size()*x0.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -961,21 +934,20 @@ void Task683::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,1,0,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-      dgemm_("T", "N", 1, a4.size()*c1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size());
   out()->add_block(odata, a4, c1);
 }
@@ -988,21 +960,20 @@ void Task684::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), 1, odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size(), c1.size(), x0.size());
       // tensor label: I941
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
-      dgemm_("T", "N", x1.size()*x0.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1015,21 +986,20 @@ void Task685::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,-8,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,-8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, a2, c1);
 }
@@ -1042,21 +1012,20 @@ void Task686::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), x1.size(), x0.size());
+      gemm.reserve(a4.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), x1.size(), x0.size());
       // tensor label: I945
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
-      dgemm_("T", "N", x1.size()*x0.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1069,21 +1038,20 @@ void Task687::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,1,0,3,0,1,-8,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-      dgemm_("T", "N", 1, a4.size()*c1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size());
   out()->add_block(odata, a4, c1);
 }
@@ -1096,21 +1064,20 @@ void Task688::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x1.size(), x0.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x1.size(), x0.size());
       // tensor label: I949
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
-      dgemm_("T", "N", x1.size()*x0.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1123,21 +1090,20 @@ void Task689::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,16,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,16,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, a2, c1);
 }
@@ -1150,19 +1116,18 @@ void Task690::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x0.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x0.size());
     // tensor label: I975
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), c3.size());
-    dgemm_("T", "N", x0.size(), x1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1175,23 +1140,22 @@ void Task691::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(a4.size()*c1.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I976
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, a2)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a4.size()*c1.size()*a2.size(),
-               1.0, i0data_sorted, a4.size()*c1.size()*a2.size(), i1data_sorted, a4.size()*c1.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -1225,19 +1189,18 @@ void Task693::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), c4.size());
     // tensor label: I1007
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1250,23 +1213,22 @@ void Task694::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a3.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I1008
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, c4, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, c4, a1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), c2.size()*a3.size()*a1.size(),
-               1.0, i0data_sorted, c2.size()*a3.size()*a1.size(), i1data_sorted, c2.size()*a3.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c4.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1300,23 +1262,22 @@ void Task696::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+        gemm.reserve(a3.size()*a1.size()*c4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a1.size());
         // tensor label: I1021
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x0, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x0, c4)]);
-        sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x0.size(), c4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*a1.size()*c4.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*c4.size(), i1data_sorted, a3.size()*a1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<2,0,3,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a1.size(), x0.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1331,19 +1292,18 @@ void Task697::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), a3.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c4.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c4.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", c4.size(), a3.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c4.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size(), a1.size(), a3.size());
   out()->add_block(odata, a3, a1, x0, c4);
 }
@@ -1356,23 +1316,22 @@ void Task698::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c4, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c4, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a3.size());
+        gemm.reserve(a3.size()*a1.size()*c4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c4.size(), a3.size());
         // tensor label: I1025
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x0, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x0, c4)]);
-        sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x0.size(), c4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*a1.size()*c4.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*c4.size(), i1data_sorted, a3.size()*a1.size()*c4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<2,1,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a1.size(), x0.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1387,19 +1346,18 @@ void Task699::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), a3.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, c4)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), c4.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), c4.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<2,0,1,3,0,1,-4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", c4.size(), a3.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c4.size());
+    sort_indices<0,1,3,2,0,1,-4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c4.size(), x0.size(), a1.size(), a3.size());
   out()->add_block(odata, a3, a1, x0, c4);
 }
@@ -40,23 +40,22 @@ void Task700::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a3.size());
         // tensor label: I1029
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x0, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x0.size(), a4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a4.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a4.size(), i1data_sorted, a3.size()*c2.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x0.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -71,19 +70,18 @@ void Task701::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a3.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<1,0,2,3,0,1,4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", a4.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a4.size());
+    sort_indices<0,2,3,1,0,1,4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, x0, a4);
 }
@@ -96,23 +94,22 @@ void Task702::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a4.size());
+        gemm.reserve(a3.size()*c2.size()*a4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a4.size());
         // tensor label: I1033
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x0, a4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x0.size(), a4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a4.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a4.size(), i1data_sorted, a3.size()*c2.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x0.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -127,19 +124,18 @@ void Task703::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a3.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<1,0,2,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", a4.size(), a3.size()*c2.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a4.size());
+    sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, x0, a4);
 }
@@ -152,23 +148,22 @@ void Task704::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
+        gemm.reserve(c2.size()*a1.size()*a4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a1.size());
         // tensor label: I1037
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, a4)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), a4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c2.size()*a1.size()*a4.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*a4.size(), i1data_sorted, c2.size()*a1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x0.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -183,19 +178,18 @@ void Task705::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x0, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), c2.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", a4.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, a4.size());
+    sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x0, a4);
 }
@@ -208,23 +202,22 @@ void Task706::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a4.size());
+        gemm.reserve(c2.size()*a1.size()*a4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a4.size());
         // tensor label: I1041
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x0, a4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x0.size(), a4.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c2.size()*a1.size()*a4.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*a4.size(), i1data_sorted, c2.size()*a1.size()*a4.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x0.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -239,19 +232,18 @@ void Task707::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x0, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x0, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x0, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), c2.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a4.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", a4.size(), c2.size()*a1.size()*x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, a4.size());
+    sort_indices<0,1,2,3,0,1,4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x0, a4);
 }
@@ -264,23 +256,22 @@ void Task708::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I1097
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c2, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
-        dgemm_("T", "N", x0.size(), x1.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), c2.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -316,23 +307,22 @@ void Task710::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,3,2,1,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -345,23 +335,22 @@ void Task711::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,1,2,3,0,1,4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -374,23 +363,22 @@ void Task712::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a3.size(), c2.size(), a1.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a3.size(), c2.size(), a1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,-2,1>(i1data, i1data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x0.size(), x1.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,3,2,1,0,1,-2,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -403,23 +391,22 @@ void Task713::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,4,1>(i1data, i1data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x0.size(), x1.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,1,2,3,0,1,4,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -432,21 +419,20 @@ void Task714::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(1, x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: h1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size());
       // tensor label: I1223
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c2, a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c2, a1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), c2.size(), a1.size(), x0.size());
-      dgemm_("T", "N", 1, x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c2.size(), a1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -480,21 +466,20 @@ void Task716::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(1, x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: h1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size());
       // tensor label: I1226
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, c1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), c1.size());
-      dgemm_("T", "N", 1, x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), a2.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -590,19 +575,18 @@ void Task719::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), x4.size(), x3.size());
     // tensor label: I882
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, a2, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, a2, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), a2.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), a2.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->add_block(odata, x1, x0, x2, x5, x4, x3);
 }
@@ -617,19 +601,18 @@ void Task720::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x1.size()*x0.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-    sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", x2.size(), x1.size()*x0.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<1,2,3,0,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x2.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, a2, x2);
 }
@@ -646,19 +629,18 @@ void Task721::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x2, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x2, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, x2, a1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), x2.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), x2.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,4,5,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x1, x0, x2, x5, x4, x3);
 }
@@ -733,19 +715,18 @@ void Task723::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I902
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -760,19 +741,18 @@ void Task724::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, a1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, a1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, a1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*a1.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, c2, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-    dgemm_("T", "N", x3.size(), x5.size()*a1.size()*x4.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), a1.size(), x4.size());
   out()->add_block(odata, x5, a1, x4, x3);
 }
@@ -847,19 +827,18 @@ void Task726::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I906
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -874,19 +853,18 @@ void Task727::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x5, x4)]);
-    sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
-    dgemm_("T", "N", x3.size(), a1.size()*x5.size()*x4.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<1,2,3,0,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x5.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x5.size(), x4.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -903,19 +881,18 @@ void Task728::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, a1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,5,4,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -1051,19 +1028,18 @@ void Task730::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x7, x6, x5, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(x7, a1, x6, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x7, a1, x6, x5)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x7.size(), a1.size(), x6.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x7.size(), x6.size(), x5.size());
   out()->add_block(odata, x7, x6, x5, x2, x1, x0);
 }
@@ -1119,19 +1095,18 @@ void Task732::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), x4.size(), x3.size());
     // tensor label: I913
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, a2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), a2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), x1.size(), x0.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1146,19 +1121,18 @@ void Task733::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a2.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-    dgemm_("T", "N", a2.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, a2);
 }
@@ -1175,19 +1149,18 @@ void Task734::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I925
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,4,5,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1219,19 +1192,18 @@ void Task736::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, a1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, a1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, a1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*a1.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, a2)]);
-    sort_indices<3,0,1,2,0,1,4,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-    dgemm_("T", "N", x3.size(), x5.size()*a1.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,2,3,0,1,4,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), a1.size(), x4.size());
   out()->add_block(odata, x5, a1, x4, x3);
 }
@@ -1248,19 +1220,18 @@ void Task737::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: I1049
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, x0, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, x0, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a1.size(), x0.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), x0.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,3,4,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1275,19 +1246,18 @@ void Task738::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a1, x0, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1, x0, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1, x0, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x1.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, a2)]);
-    sort_indices<3,0,1,2,0,1,4,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
-    dgemm_("T", "N", x2.size(), x1.size()*a1.size()*x0.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,2,3,0,1,4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x2.size(), x0.size(), a1.size(), x1.size());
   out()->add_block(odata, x1, a1, x0, x2);
 }
@@ -1304,19 +1274,18 @@ void Task739::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1333,19 +1302,18 @@ void Task740::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,4,5,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1378,19 +1346,18 @@ void Task742::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: I917
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -1403,21 +1370,20 @@ void Task743::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(1, x3.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), c2.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), c2.size());
       // tensor label: I918
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-      dgemm_("T", "N", 1, x3.size()*a1.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, x3, a1);
 }
@@ -1453,19 +1419,18 @@ void Task745::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size()*x1.size(), x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, x2, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), x2.size(), x1.size());
     // tensor label: I999
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size());
-    dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -1478,21 +1443,20 @@ void Task746::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
+  GemmBatch<double> gemm(1, a3.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-      sort_indices<2,1,0,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-      dgemm_("T", "N", 1, a3.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
   out()->add_block(odata, a3, x0);
 }
@@ -1507,19 +1471,18 @@ void Task747::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size()*x1.size(), x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), x1.size());
     // tensor label: I1003
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size());
-    dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -1532,21 +1495,20 @@ void Task748::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
+  GemmBatch<double> gemm(1, a1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-      sort_indices<2,3,0,1,0,1,4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-      dgemm_("T", "N", 1, a1.size()*x0.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
   out()->add_block(odata, a1, x0);
 }
@@ -1561,21 +1523,20 @@ void Task749::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+      gemm.reserve(a3.size()*a1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), a3.size());
       // tensor label: I1045
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a3.size()*a1.size(),
-             1.0, i0data_sorted, a3.size()*a1.size(), i1data_sorted, a3.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a1.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -42,19 +42,18 @@ void Task750::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<2,0,1,3,0,1,-4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*a1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,3,2,0,1,-4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), a3.size());
   out()->add_block(odata, a3, a1, x0, x1);
 }
@@ -69,19 +68,18 @@ void Task751::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a1, x0, x1), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size()*a1.size()*x0.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, a3.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), a2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, a2)]);
-    sort_indices<3,0,1,2,0,1,8,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
-    dgemm_("T", "N", a3.size(), x1.size()*a1.size()*x0.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<0,1,2,3,0,1,8,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, a3.size(), x0.size(), a1.size(), x1.size());
   out()->add_block(odata, a3, a1, x0, x1);
 }
@@ -96,21 +94,20 @@ void Task752::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.reserve(a1.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: I1053
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, a2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, a2, x2)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), a2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), a1.size()*a2.size(),
-             1.0, i0data_sorted, a1.size()*a2.size(), i1data_sorted, a1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), a2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -142,19 +139,18 @@ void Task754::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, a2, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x3.size()*a1.size()*a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c3, a2)]);
-    sort_indices<2,0,1,3,0,1,-4,1>(i1data, i1data_sorted, x3.size(), a1.size(), c3.size(), a2.size());
-    dgemm_("T", "N", x2.size(), x3.size()*a1.size()*a2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,-4,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), a1.size(), a2.size());
   out()->add_block(odata, x3, a1, a2, x2);
 }
@@ -169,21 +165,20 @@ void Task755::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.reserve(a2.size()*a1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, a2)]);
-      sort_indices<1,3,0,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -198,21 +193,20 @@ void Task756::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.reserve(a2.size()*a1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<1,3,0,2,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -227,19 +221,18 @@ void Task757::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-    dgemm_("T", "N", x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -254,19 +247,18 @@ void Task758::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size()*x2.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-    dgemm_("T", "N", x0.size(), x1.size()*x2.size()*x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), x2.size(), x1.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -377,23 +369,22 @@ void Task764::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c5.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a4.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a4, c5, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a4, c5, a2)]);
-        sort_indices<1,3,0,2,0,1,16,1>(i1data, i1data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
-        dgemm_("T", "N", c3.size(), c5.size(), c1.size()*a4.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*a4.size()*a2.size(), i1data_sorted, c1.size()*a4.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,1,3,0,0,1,16,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c5.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c5, c3);
 }
@@ -460,23 +451,22 @@ void Task768::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c5.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a2.size()*a4.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c5, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a2, c5, a4)]);
-        sort_indices<3,1,0,2,0,1,-32,1>(i1data, i1data_sorted, c1.size(), a2.size(), c5.size(), a4.size());
-        dgemm_("T", "N", c3.size(), c5.size(), c1.size()*a2.size()*a4.size(),
-               1.0, i0data_sorted, c1.size()*a2.size()*a4.size(), i1data_sorted, c1.size()*a2.size()*a4.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,3,1,0,0,1,-32,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c5.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c5, c3);
 }
@@ -520,23 +510,22 @@ void Task771::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a5.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*c3.size()*a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a5, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a5, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,-16,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
-        dgemm_("T", "N", a4.size(), a5.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,2,3,0,0,1,-16,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a5.size());
   out()->add_block(odata, a5, a4);
 }
@@ -604,23 +593,22 @@ void Task775::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a5.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a2.size()*c3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, a5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a2, c3, a5)]);
-        sort_indices<2,1,0,3,0,1,32,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a5.size());
-        dgemm_("T", "N", a4.size(), a5.size(), c1.size()*a2.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a2.size()*c3.size(), i1data_sorted, c1.size()*a2.size()*c3.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<3,2,1,0,0,1,32,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a5.size());
   out()->add_block(odata, a5, a4);
 }
@@ -662,23 +650,22 @@ void Task777::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I1015
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-        dgemm_("T", "N", x0.size(), x3.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
@@ -749,21 +736,20 @@ void Task780::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.reserve(a1.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-      sort_indices<3,1,0,2,0,1,4,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a1.size()*a2.size(),
-             1.0, i0data_sorted, a1.size()*a2.size(), i1data_sorted, a1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,3,1,0,1,4,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -997,19 +983,18 @@ void Task784::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), x4.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1209,19 +1194,18 @@ void Task786::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x4, x5, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, x1, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), x1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, x4, x5, x0, x1, x2);
 }
@@ -42,19 +42,18 @@ void Task50::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c2, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-    dgemm_("T", "N", x3.size(), c1.size()*x5.size()*x4.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x5.size(), x4.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -69,23 +68,22 @@ void Task51::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma5
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x2, x5, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x2, x5, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c1, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c1, x5)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), c1.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -100,19 +98,18 @@ void Task52::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(c1.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c2.size());
     // tensor label: I17
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x2, x1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), x2.size()*x1.size()*x0.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -127,23 +124,22 @@ void Task53::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x2, x1, x0);
 }
@@ -158,19 +154,18 @@ void Task54::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma7
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
     // tensor label: I20
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -183,21 +178,20 @@ void Task55::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(1, c1.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), c2.size());
+      gemm.reserve(c2.size()*a3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), c2.size());
       // tensor label: I21
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, c1, x3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
-      dgemm_("T", "N", 1, c1.size()*x3.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
   out()->add_block(odata, c1, x3);
 }
@@ -233,23 +227,22 @@ void Task57::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma9
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x2, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x2, x4, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
         // tensor label: I26
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, c1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, c1, x4, x3)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), c1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,3,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), c1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -264,19 +257,18 @@ void Task58::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, c1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, c1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, c1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*c1.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-    dgemm_("T", "N", x3.size(), x5.size()*c1.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), c1.size(), x4.size());
   out()->add_block(odata, x5, c1, x4, x3);
 }
@@ -291,23 +283,22 @@ void Task59::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I29
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -339,19 +330,18 @@ void Task61::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
-    dgemm_("T", "N", x3.size(), c1.size()*x5.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x5.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x5.size(), x4.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -382,19 +372,18 @@ void Task63::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*c3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size());
     // tensor label: I32
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x1.size(), x0.size());
-    dgemm_("T", "N", a2.size(), c1.size()*c3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -409,21 +398,20 @@ void Task64::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma3
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x1, x0);
 }
@@ -461,23 +449,22 @@ void Task66::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
   out()->add_block(odata, c3, x0);
 }
@@ -515,23 +502,22 @@ void Task68::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -546,19 +532,18 @@ void Task69::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma14
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size());
     // tensor label: I41
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -594,19 +579,18 @@ void Task71::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*c3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c4.size());
     // tensor label: I45
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c3, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", c1.size(), a2.size()*c3.size()*x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -621,19 +605,18 @@ void Task72::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, a2, c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, a2, c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, a2, c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size()*a2.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I46
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c4.size()*a2.size()*c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size(), a2.size(), c3.size());
   out()->add_block(odata, c4, a2, c3, x0);
 }
@@ -669,19 +652,18 @@ void Task74::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size(), a2.size()*c1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), c4.size());
     // tensor label: I51
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c1, x0)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c1.size(), x0.size());
-    dgemm_("T", "N", c3.size(), a2.size()*c1.size()*x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -696,19 +678,18 @@ void Task75::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, a2, c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, a2, c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, a2, c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I52
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c4.size()*a2.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size(), a2.size(), c1.size());
   out()->add_block(odata, c4, a2, c1, x0);
 }
@@ -744,19 +725,18 @@ void Task77::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c3.size()*c1.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), a2.size());
+    gemm.reserve(a4.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a2.size());
     // tensor label: I54
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, c1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, c1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), c1.size(), x0.size());
-    dgemm_("T", "N", a2.size(), c3.size()*c1.size()*x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), c1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -771,19 +751,18 @@ void Task78::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a4.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I55
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a4.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a4.size(), c1.size());
   out()->add_block(odata, c3, a4, c1, x0);
 }
@@ -819,19 +798,18 @@ void Task80::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*c3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size());
     // tensor label: I63
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), a2.size()*c3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -846,21 +824,20 @@ void Task81::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma22
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -875,21 +852,20 @@ void Task82::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -904,19 +880,18 @@ void Task83::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size(), a2.size()*c1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size());
     // tensor label: I66
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c3.size(), a2.size()*c1.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -931,21 +906,20 @@ void Task84::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I67
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, x0, x1);
 }
@@ -981,19 +955,18 @@ void Task86::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size()*a2.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a2.size());
     // tensor label: I75
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", c1.size()*c3.size()*a2.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1006,19 +979,18 @@ void Task87::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,-2,1>(i1data, i1data_sorted, a4.size(), x1.size());
-    dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,0,1,-2,1>(i1data.get(), gemm.b(), a4.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -1033,19 +1005,18 @@ void Task88::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
     // tensor label: I78
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1058,19 +1029,18 @@ void Task89::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: f1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,4,1>(i1data, i1data_sorted, a4.size(), x1.size());
-    dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,0,1,4,1>(i1data.get(), gemm.b(), a4.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -1085,19 +1055,18 @@ void Task90::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I269
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1151,19 +1120,18 @@ void Task93::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size());
+    gemm.reserve(x2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size());
     // tensor label: I81
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x2, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
-    dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x2.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1178,23 +1146,22 @@ void Task94::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma28
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x2, x0);
 }
@@ -1209,21 +1176,20 @@ void Task95::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: I84
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1238,19 +1204,18 @@ void Task96::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), a1.size()*c2.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a1, c2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a1, c2, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
-    dgemm_("T", "N", x2.size(), a1.size()*c2.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a1.size(), c2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), a1.size(), c2.size(), x3.size());
   out()->add_block(odata, a1, c2, x3, x2);
 }
@@ -1265,21 +1230,20 @@ void Task97::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma7
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: I87
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1294,19 +1258,18 @@ void Task98::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), c2.size()*a1.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, c3, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
-    dgemm_("T", "N", x2.size(), c2.size()*a1.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), c3.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), c2.size(), a1.size(), x3.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -1321,21 +1284,20 @@ void Task99::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma31
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, c2, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
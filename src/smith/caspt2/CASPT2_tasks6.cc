@@ -58,21 +58,20 @@ void Task251::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -87,21 +86,20 @@ void Task252::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -132,21 +130,20 @@ void Task254::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I347
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, x1, x0);
 }
@@ -198,23 +195,22 @@ void Task257::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma59
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -282,19 +278,18 @@ void Task261::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I355
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, c2, a1, x0);
 }
@@ -346,21 +341,20 @@ void Task264::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma60
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, a2, x0, x1);
 }
@@ -387,25 +381,24 @@ void Task267::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma138
           std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x1, x4, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I361
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<3,0,2,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -420,21 +413,20 @@ void Task268::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.reserve(c1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-      sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), c1.size()*c2.size(),
-             1.0, i0data_sorted, c1.size()*c2.size(), i1data_sorted, c1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -447,25 +439,24 @@ void Task269::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma169
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I454
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -480,21 +471,20 @@ void Task270::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(a1.size()*c2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a1.size()*c2.size(),
-             1.0, i0data_sorted, a1.size()*c2.size(), i1data_sorted, a1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -507,25 +497,24 @@ void Task271::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x0 : *range_[1]) {
           // tensor label: Gamma172
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-          sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<2,3,0,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
           // tensor label: I463
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -540,21 +529,20 @@ void Task272::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x5.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -569,21 +557,20 @@ void Task273::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I497
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -617,25 +604,24 @@ void Task275::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x1 : *range_[1]) {
           // tensor label: Gamma230
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
           // tensor label: I645
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -650,21 +636,20 @@ void Task276::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.reserve(a1.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-      sort_indices<3,1,0,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a1.size()*a2.size(),
-             1.0, i0data_sorted, a1.size()*a2.size(), i1data_sorted, a1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -691,23 +676,22 @@ void Task278::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+        gemm.reserve(c1.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c3.size(), x2.size());
         // tensor label: I364
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -722,21 +706,20 @@ void Task279::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma92
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-      sort_indices<1,3,0,2,0,1,-4,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), c2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -749,23 +732,22 @@ void Task280::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+        gemm.reserve(a1.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), x2.size());
         // tensor label: I457
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -780,21 +762,20 @@ void Task281::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -807,23 +788,22 @@ void Task282::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+        gemm.reserve(a1.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), x3.size(), x2.size());
         // tensor label: I466
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -838,21 +818,20 @@ void Task283::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -879,23 +858,22 @@ void Task285::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+        gemm.reserve(c1.size()*x0.size()*x1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
         // tensor label: I367
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x1, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
-        dgemm_("T", "N", c2.size(), x2.size(), c1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, c1.size()*x0.size()*x1.size(), i1data_sorted, c1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size());
   out()->add_block(odata, x2, c2);
 }
@@ -910,23 +888,22 @@ void Task286::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x0, x1, x2);
 }
@@ -939,23 +916,22 @@ void Task287::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+        gemm.reserve(a1.size()*x0.size()*x1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
         // tensor label: I472
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x1, x2)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x1.size(), x2.size());
-        dgemm_("T", "N", c2.size(), x2.size(), a1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, a1.size()*x0.size()*x1.size(), i1data_sorted, a1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size());
   out()->add_block(odata, x2, c2);
 }
@@ -970,23 +946,22 @@ void Task288::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma37
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, x2);
 }
@@ -1013,23 +988,22 @@ void Task290::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+        gemm.reserve(c2.size()*c1.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c2.size(), x3.size());
         // tensor label: I370
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), c2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*c1.size()*x3.size(), i1data_sorted, c2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -1044,21 +1018,20 @@ void Task291::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma3
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-      sort_indices<3,1,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), c2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -1071,23 +1044,22 @@ void Task292::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I481
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -1102,21 +1074,20 @@ void Task293::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -1129,23 +1100,22 @@ void Task294::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& c2 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I484
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -1160,21 +1130,20 @@ void Task295::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -1187,23 +1156,22 @@ void Task296::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), a2.size());
+        gemm.reserve(a2.size()*c1.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c1.size(), a2.size());
         // tensor label: I523
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), a2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x3.size(), i1data_sorted, a2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -1218,21 +1186,20 @@ void Task297::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -1245,23 +1212,22 @@ void Task298::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, a3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), a3.size());
+        gemm.reserve(a2.size()*c1.size()*x3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), a3.size());
         // tensor label: I526
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), a2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x3.size(), i1data_sorted, a2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -1276,21 +1242,20 @@ void Task299::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -54,23 +54,22 @@ void Task301::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+        gemm.reserve(c1.size()*x5.size()*x4.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), c2.size(), x4.size());
         // tensor label: I373
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x3, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x3, x4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x3.size(), x4.size());
-        dgemm_("T", "N", c2.size(), x3.size(), c1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c1.size()*x5.size()*x4.size(), i1data_sorted, c1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x3.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size());
   out()->add_block(odata, x3, c2);
 }
@@ -85,23 +84,22 @@ void Task302::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x3, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x3, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x3, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x3.size()*x4.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x3, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x3, x4, x1, x0)]);
-        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x3.size()*x4.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x3.size()*x4.size());
+        sort_indices<2,3,1,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x3.size(), x4.size(), c1.size());
   out()->add_block(odata, c1, x5, x3, x4);
 }
@@ -114,23 +112,22 @@ void Task303::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+        gemm.reserve(a1.size()*x5.size()*x4.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c2.size(), x4.size());
         // tensor label: I529
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x3, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x3, x4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x3.size(), x4.size());
-        dgemm_("T", "N", c2.size(), x3.size(), a1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, a1.size()*x5.size()*x4.size(), i1data_sorted, a1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x3.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size());
   out()->add_block(odata, x3, c2);
 }
@@ -145,23 +142,22 @@ void Task304::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x3, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x3, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x3, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x3.size()*x4.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma56
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x3, x4, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x3, x4, x2, x1)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x3.size()*x4.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x3.size()*x4.size());
+        sort_indices<1,0,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x3.size(), x4.size(), a1.size());
   out()->add_block(odata, a1, x5, x3, x4);
 }
@@ -174,23 +170,22 @@ void Task305::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+        gemm.reserve(a1.size()*x5.size()*x4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x5.size(), x4.size());
         // tensor label: I532
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", c2.size(), x3.size(), a1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, a1.size()*x5.size()*x4.size(), i1data_sorted, a1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size());
   out()->add_block(odata, x3, c2);
 }
@@ -205,23 +200,22 @@ void Task306::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma57
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<1,0,3,2,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -248,6 +242,7 @@ void Task308::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, x3), 0.0);
+  GemmBatch<double> gemm(x4.size()*x3.size(), 1, odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
@@ -256,21 +251,19 @@ void Task308::Task_local::compute() {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma143
               std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x2, x5, x4, x3, x1, x0);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x2, x5, x4, x3, x1, x0)]);
-              sort_indices<0,1,2,3,6,7,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+              gemm.reserve(x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size());
+              sort_indices<4,5,0,1,2,3,6,7,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
               // tensor label: I376
               std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, x5, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, x5, x2, x1, x0)]);
-              sort_indices<0,1,3,2,4,5,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
-              dgemm_("T", "N", x4.size()*x3.size(), 1, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, x4.size()*x3.size());
+              sort_indices<0,1,3,2,4,5,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
+              gemm.commit();
             }
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x4.size(), x3.size());
   out()->add_block(odata, x4, x3);
 }
@@ -287,19 +280,18 @@ void Task309::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x7, x6, x5, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(x7, x6, c1, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x7, x6, c1, x5)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), c1.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x7.size(), x6.size(), x5.size());
   out()->add_block(odata, x7, x6, x5, x2, x1, x0);
 }
@@ -312,6 +304,7 @@ void Task310::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, x3), 0.0);
+  GemmBatch<double> gemm(x4.size()*x3.size(), 1, odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x6 : *range_[1]) {
@@ -320,21 +313,19 @@ void Task310::Task_local::compute() {
             for (auto& x1 : *range_[1]) {
               // tensor label: Gamma196
               std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x4, x3, x2, x1);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x4, x3, x2, x1)]);
-              sort_indices<0,1,2,3,6,7,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
+              gemm.reserve(x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size());
+              sort_indices<4,5,0,1,2,3,6,7,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
               // tensor label: I535
               std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, x5, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, x5, x2, x1, x0)]);
-              sort_indices<0,5,1,2,3,4,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
-              dgemm_("T", "N", x4.size()*x3.size(), 1, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, x4.size()*x3.size());
+              sort_indices<0,5,1,2,3,4,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
+              gemm.commit();
             }
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x4.size(), x3.size());
   out()->add_block(odata, x4, x3);
 }
@@ -351,19 +342,18 @@ void Task311::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x7, x6, x5, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(x7, a1, x6, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x7, a1, x6, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), a1.size(), x6.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x7.size(), x6.size(), x5.size());
   out()->add_block(odata, x7, x6, x5, x2, x1, x0);
 }
@@ -390,23 +380,22 @@ void Task313::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c2.size(), x3.size());
         // tensor label: I379
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", c2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), c1.size());
   out()->add_block(odata, c1, c2);
 }
@@ -421,23 +410,22 @@ void Task314::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<2,3,1,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -464,21 +452,20 @@ void Task316::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c1, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
+      gemm.reserve(c1.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c1.size(), x3.size());
       // tensor label: I382
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-      dgemm_("T", "N", c2.size()*a3.size(), 1, c1.size()*x3.size(),
-             1.0, i0data_sorted, c1.size()*x3.size(), i1data_sorted, c1.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
   out()->add_block(odata, c2, a3);
 }
@@ -491,23 +478,22 @@ void Task317::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma7
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<2,3,1,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size());
   out()->add_block(odata, c1, x3);
 }
@@ -520,21 +506,20 @@ void Task318::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+      gemm.reserve(c1.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c2.size(), x3.size());
       // tensor label: I385
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-      dgemm_("T", "N", a3.size()*c2.size(), 1, c1.size()*x3.size(),
-             1.0, i0data_sorted, c1.size()*x3.size(), i1data_sorted, c1.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size());
   out()->add_block(odata, c2, a3);
 }
@@ -547,23 +532,22 @@ void Task319::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma7
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<2,3,1,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size());
   out()->add_block(odata, c1, x3);
 }
@@ -576,21 +560,20 @@ void Task320::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), 1, odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+      gemm.reserve(a1.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a1.size());
       // tensor label: I541
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x3.size());
-      dgemm_("T", "N", a3.size()*c2.size(), 1, a1.size()*x3.size(),
-             1.0, i0data_sorted, a1.size()*x3.size(), i1data_sorted, a1.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size());
   out()->add_block(odata, c2, a3);
 }
@@ -603,23 +586,22 @@ void Task321::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,0,3,2,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, a1, x3);
 }
@@ -632,21 +614,20 @@ void Task322::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), 1, odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a1.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I544
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x3.size());
-      dgemm_("T", "N", c2.size()*a3.size(), 1, a1.size()*x3.size(),
-             1.0, i0data_sorted, a1.size()*x3.size(), i1data_sorted, a1.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
   out()->add_block(odata, c2, a3);
 }
@@ -659,23 +640,22 @@ void Task323::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,0,3,2,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, a1, x3);
 }
@@ -702,23 +682,22 @@ void Task325::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+        gemm.reserve(c1.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c1.size(), x4.size());
         // tensor label: I388
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x3, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x3, x4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x3.size(), x4.size());
-        dgemm_("T", "N", a2.size(), x3.size(), c1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c1.size()*x5.size()*x4.size(), i1data_sorted, c1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x3.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
   out()->add_block(odata, x3, a2);
 }
@@ -733,23 +712,22 @@ void Task326::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x3, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x3, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x3, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x3.size()*x4.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma9
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x2, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x2, x4, x1, x0)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x3.size()*x4.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x3.size()*x4.size());
+        sort_indices<2,3,1,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x3.size(), x4.size(), c1.size());
   out()->add_block(odata, c1, x5, x3, x4);
 }
@@ -762,23 +740,22 @@ void Task327::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+        gemm.reserve(c1.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x5.size(), x4.size());
         // tensor label: I391
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", a2.size(), x3.size(), c1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c1.size()*x5.size()*x4.size(), i1data_sorted, c1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
   out()->add_block(odata, x3, a2);
 }
@@ -793,23 +770,22 @@ void Task328::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -822,23 +798,22 @@ void Task329::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+        gemm.reserve(a1.size()*x5.size()*x4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a2.size());
         // tensor label: I547
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", a2.size(), x3.size(), a1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, a1.size()*x5.size()*x4.size(), i1data_sorted, a1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
   out()->add_block(odata, x3, a2);
 }
@@ -853,23 +828,22 @@ void Task330::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma59
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<1,0,3,2,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -896,23 +870,22 @@ void Task332::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c1.size()*c3.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I394
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x1, x0)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), x1.size(), c1.size()*c3.size()*x0.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*x0.size(), i1data_sorted, c1.size()*c3.size()*x0.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x1.size());
   out()->add_block(odata, x1, a2);
 }
@@ -927,21 +900,20 @@ void Task333::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma3
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x1, x0);
 }
@@ -968,21 +940,20 @@ void Task335::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.reserve(c3.size()*x0.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
       // tensor label: I397
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), 1, c3.size()*x0.size(),
-             1.0, i0data_sorted, c3.size()*x0.size(), i1data_sorted, c3.size()*x0.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, a2, c1);
 }
@@ -995,23 +966,22 @@ void Task336::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
   out()->add_block(odata, c3, x0);
 }
@@ -1038,21 +1008,20 @@ void Task338::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.reserve(c1.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
       // tensor label: I400
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size());
-      dgemm_("T", "N", c3.size()*a2.size(), 1, c1.size()*x0.size(),
-             1.0, i0data_sorted, c1.size()*x0.size(), i1data_sorted, c1.size()*x0.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
   out()->add_block(odata, c3, a2);
 }
@@ -1065,23 +1034,22 @@ void Task339::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -1094,21 +1062,20 @@ void Task340::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), 1, odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I556
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
-      dgemm_("T", "N", c3.size()*a2.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
   out()->add_block(odata, c3, a2);
 }
@@ -1121,21 +1088,20 @@ void Task341::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I557
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a4.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
   out()->add_block(odata, a4, c1);
 }
@@ -1183,21 +1149,20 @@ void Task344::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma152
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I403
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size());
-      dgemm_("T", "N", x2.size()*x1.size(), 1, x3.size()*x0.size(),
-             1.0, i0data_sorted, x3.size()*x0.size(), i1data_sorted, x3.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
   out()->add_block(odata, x2, x1);
 }
@@ -1210,23 +1175,22 @@ void Task345::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I404
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size(), x3.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
@@ -1260,21 +1224,20 @@ void Task347::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size(), 1, odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma60
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I612
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size());
-      dgemm_("T", "N", x2.size()*x1.size(), 1, x3.size()*x0.size(),
-             1.0, i0data_sorted, x3.size()*x0.size(), i1data_sorted, x3.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
   out()->add_block(odata, x2, x1);
 }
@@ -1287,23 +1250,22 @@ void Task348::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I613
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-        dgemm_("T", "N", x0.size(), x3.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
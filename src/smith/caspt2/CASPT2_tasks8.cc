@@ -54,23 +54,22 @@ void Task351::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I409
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
   out()->add_block(odata, c1, c4);
 }
@@ -85,19 +84,18 @@ void Task352::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -110,23 +108,22 @@ void Task353::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I412
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
   out()->add_block(odata, c1, c4);
 }
@@ -141,19 +138,18 @@ void Task354::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -180,23 +176,22 @@ void Task356::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I415
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
   out()->add_block(odata, c3, c4);
 }
@@ -211,19 +206,18 @@ void Task357::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -236,23 +230,22 @@ void Task358::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I421
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
   out()->add_block(odata, c3, c4);
 }
@@ -267,19 +260,18 @@ void Task359::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -306,23 +298,22 @@ void Task361::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c1.size(), x1.size());
         // tensor label: I418
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a2.size(), c3.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*x1.size(), i1data_sorted, c3.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size());
   out()->add_block(odata, a2, a4);
 }
@@ -337,19 +328,18 @@ void Task362::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -362,23 +352,22 @@ void Task363::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: I424
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a2.size(), c3.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*x1.size(), i1data_sorted, c3.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size());
   out()->add_block(odata, a2, a4);
 }
@@ -393,19 +382,18 @@ void Task364::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -432,23 +420,22 @@ void Task366::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(a2.size()*c3.size()*x0.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I427
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x1, x0)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x1.size(), x0.size());
-        dgemm_("T", "N", c1.size(), x1.size(), a2.size()*c3.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*c3.size()*x0.size(), i1data_sorted, a2.size()*c3.size()*x0.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x1.size());
   out()->add_block(odata, x1, c1);
 }
@@ -463,21 +450,20 @@ void Task367::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma22
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -492,21 +478,20 @@ void Task368::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -533,23 +518,22 @@ void Task370::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(a2.size()*c1.size()*x0.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I430
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x0, x1)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x0.size(), x1.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a2.size()*c1.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x0.size(), i1data_sorted, a2.size()*c1.size()*x0.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -564,21 +548,20 @@ void Task371::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I431
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, x0, x1);
 }
@@ -626,19 +609,18 @@ void Task374::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I439
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", x1.size(), a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
   out()->add_block(odata, a4, x1);
 }
@@ -651,23 +633,22 @@ void Task375::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c1.size()*c3.size()*a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I440
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
-        dgemm_("T", "N", x0.size(), a4.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -715,23 +696,22 @@ void Task378::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+        gemm.reserve(c2.size()*x1.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
         // tensor label: I445
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x2, x0)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
-        dgemm_("T", "N", a1.size(), x2.size(), c2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, c2.size()*x1.size()*x0.size(), i1data_sorted, c2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x2.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x2.size());
   out()->add_block(odata, x2, a1);
 }
@@ -746,23 +726,22 @@ void Task379::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma28
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x2, x0);
 }
@@ -789,23 +768,22 @@ void Task381::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c2, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), c2.size(), x3.size());
         // tensor label: I448
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -820,21 +798,20 @@ void Task382::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -847,23 +824,22 @@ void Task383::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), x3.size());
         // tensor label: I451
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x2, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x2.size(), x3.size());
-        dgemm_("T", "N", c3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -878,21 +854,20 @@ void Task384::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x2, x3), 0.0);
+  GemmBatch<double> gemm(x2.size()*x3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma7
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x2.size()*x3.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x3.size());
+      sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x2, x3);
 }
@@ -905,23 +880,22 @@ void Task385::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+        gemm.reserve(a2.size()*c1.size()*x3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c1.size(), x3.size());
         // tensor label: I490
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x2, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x2.size(), x3.size());
-        dgemm_("T", "N", c3.size(), x2.size(), a2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x3.size(), i1data_sorted, a2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -936,21 +910,20 @@ void Task386::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x2, x3), 0.0);
+  GemmBatch<double> gemm(x2.size()*x3.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma7
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x2.size()*x3.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x3.size());
+      sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x2, x3);
 }
@@ -963,23 +936,22 @@ void Task387::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+        gemm.reserve(a2.size()*c1.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x3.size());
         // tensor label: I493
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x2, x3)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x2.size(), x3.size());
-        dgemm_("T", "N", c3.size(), x2.size(), a2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x3.size(), i1data_sorted, a2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -994,21 +966,20 @@ void Task388::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x2, x3), 0.0);
+  GemmBatch<double> gemm(x2.size()*x3.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma7
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x2.size()*x3.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x3.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x2, x3);
 }
@@ -1021,23 +992,22 @@ void Task389::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, a2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), a2.size());
+        gemm.reserve(a2.size()*a1.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), a2.size());
         // tensor label: I642
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, a1, x3, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), x2.size(), a2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*a1.size()*x3.size(), i1data_sorted, a2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -1052,21 +1022,20 @@ void Task390::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma60
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, a2)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), a2.size());
   out()->add_block(odata, a2, a1, x3, x2);
 }
@@ -1093,23 +1062,22 @@ void Task392::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+        gemm.reserve(c2.size()*x3.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), x2.size());
         // tensor label: I460
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), a1.size(), c2.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c2.size()*x3.size()*x2.size(), i1data_sorted, c2.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size());
   out()->add_block(odata, a1, a3);
 }
@@ -1124,21 +1092,20 @@ void Task393::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -1151,23 +1118,22 @@ void Task394::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), a1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x3.size(), x2.size());
+        gemm.reserve(c2.size()*x3.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x3.size(), x2.size());
         // tensor label: I469
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), a1.size(), c2.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c2.size()*x3.size()*x2.size(), i1data_sorted, c2.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size());
   out()->add_block(odata, a1, a3);
 }
@@ -1182,21 +1148,20 @@ void Task395::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -1223,21 +1188,20 @@ void Task397::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c3.size(), 1, odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c3.size(), a1.size());
       // tensor label: I475
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size());
-      dgemm_("T", "N", a4.size()*c3.size(), 1, c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c3.size());
   out()->add_block(odata, a4, c3);
 }
@@ -1250,21 +1214,20 @@ void Task398::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(1, c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", 1, c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
   out()->add_block(odata, c2, a1);
 }
@@ -1277,21 +1240,20 @@ void Task399::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
+  GemmBatch<double> gemm(c3.size()*a4.size(), 1, odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, a4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), a4.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), a4.size());
       // tensor label: I478
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size());
-      dgemm_("T", "N", c3.size()*a4.size(), 1, c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, c3.size()*a4.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size());
   out()->add_block(odata, a4, c3);
 }
@@ -40,21 +40,20 @@ void Task400::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(1, c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,-4,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", 1, c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,3,0,0,1,-4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
   out()->add_block(odata, c2, a1);
 }
@@ -67,21 +66,20 @@ void Task401::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c3.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a2.size());
       // tensor label: I517
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
-      dgemm_("T", "N", a4.size()*c3.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, a4.size()*c3.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c3.size());
   out()->add_block(odata, a4, c3);
 }
@@ -94,21 +92,20 @@ void Task402::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,3,2,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, a2, c1);
 }
@@ -121,21 +118,20 @@ void Task403::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
+  GemmBatch<double> gemm(c3.size()*a4.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I520
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
-      dgemm_("T", "N", c3.size()*a4.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, c3.size()*a4.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size());
   out()->add_block(odata, a4, c3);
 }
@@ -148,21 +144,20 @@ void Task404::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,8,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,3,2,0,1,8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, a2, c1);
 }
@@ -189,23 +184,22 @@ void Task406::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+        gemm.reserve(c1.size()*x1.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
         // tensor label: I487
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, x0)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), x2.size(), c1.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, c1.size()*x1.size()*x0.size(), i1data_sorted, c1.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x2.size());
   out()->add_block(odata, x2, a2);
 }
@@ -220,23 +214,22 @@ void Task407::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -249,23 +242,22 @@ void Task408::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+        gemm.reserve(a1.size()*x0.size()*x1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
         // tensor label: I639
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
-        dgemm_("T", "N", a2.size(), x2.size(), a1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, a1.size()*x0.size()*x1.size(), i1data_sorted, a1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x2.size());
   out()->add_block(odata, x2, a2);
 }
@@ -280,23 +272,22 @@ void Task409::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma59
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,2,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -323,23 +314,22 @@ void Task411::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+        gemm.reserve(a2.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c3.size(), x2.size());
         // tensor label: I499
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c1.size(), a2.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a2.size()*x3.size()*x2.size(), i1data_sorted, a2.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size());
   out()->add_block(odata, c1, c3);
 }
@@ -354,21 +344,20 @@ void Task412::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -381,23 +370,22 @@ void Task413::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+        gemm.reserve(a2.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x3.size(), x2.size());
         // tensor label: I508
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c1.size(), a2.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a2.size()*x3.size()*x2.size(), i1data_sorted, a2.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size());
   out()->add_block(odata, c1, c3);
 }
@@ -412,21 +400,20 @@ void Task414::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -453,23 +440,22 @@ void Task416::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), x2.size());
+        gemm.reserve(c1.size()*x3.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c1.size(), x2.size());
         // tensor label: I502
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), a2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a2.size());
   out()->add_block(odata, a2, a3);
 }
@@ -484,21 +470,20 @@ void Task417::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -511,23 +496,22 @@ void Task418::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x3.size(), x2.size());
+        gemm.reserve(c1.size()*x3.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), x3.size(), x2.size());
         // tensor label: I511
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), a2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a2.size());
   out()->add_block(odata, a2, a3);
 }
@@ -542,21 +526,20 @@ void Task419::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -569,23 +552,22 @@ void Task420::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+        gemm.reserve(a1.size()*x3.size()*x2.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), a3.size());
         // tensor label: I648
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, a1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), a2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), a2.size());
   out()->add_block(odata, a2, a3);
 }
@@ -600,21 +582,20 @@ void Task421::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma60
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, a2)]);
-      sort_indices<0,2,1,3,0,1,4,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,4,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), a2.size());
   out()->add_block(odata, a2, a1, x3, x2);
 }
@@ -641,23 +622,22 @@ void Task423::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+        gemm.reserve(a2.size()*x1.size()*x0.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
         // tensor label: I514
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x2, x1, x0)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", c1.size(), x2.size(), a2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*x1.size()*x0.size(), i1data_sorted, a2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size());
   out()->add_block(odata, x2, c1);
 }
@@ -672,23 +652,22 @@ void Task424::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a2.size());
   out()->add_block(odata, a2, x2, x1, x0);
 }
@@ -715,23 +694,22 @@ void Task426::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), x4.size(), x3.size());
         // tensor label: I538
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", a2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size());
   out()->add_block(odata, a1, a2);
 }
@@ -746,23 +724,22 @@ void Task427::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma59
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<1,0,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -789,19 +766,18 @@ void Task429::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I550
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size());
-    dgemm_("T", "N", x0.size(), a2.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a2.size());
   out()->add_block(odata, a2, x0);
 }
@@ -814,23 +790,22 @@ void Task430::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a4.size()*c3.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<1,2,0,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
-        dgemm_("T", "N", a2.size(), x1.size(), c1.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a4.size()*c3.size(), i1data_sorted, c1.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,1,2,0,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x1.size());
   out()->add_block(odata, x1, a2);
 }
@@ -857,19 +832,18 @@ void Task432::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I553
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size());
-    dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -882,23 +856,22 @@ void Task433::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a2.size()*c3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<2,1,0,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", a4.size(), x1.size(), c1.size()*a2.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a2.size()*c3.size(), i1data_sorted, c1.size()*a2.size()*c3.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<3,2,1,0,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x1.size());
   out()->add_block(odata, x1, a4);
 }
@@ -925,21 +898,20 @@ void Task435::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c3.size(), 1, odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I559
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
-      dgemm_("T", "N", a4.size()*c3.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size());
   out()->add_block(odata, a4, c3);
 }
@@ -952,21 +924,20 @@ void Task436::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma38
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I560
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
   out()->add_block(odata, a2, c1);
 }
@@ -1095,23 +1066,22 @@ void Task443::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c5.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a4.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I574
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c5, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c5, a2)]);
-        sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
-        dgemm_("T", "N", c3.size(), c5.size(), c1.size()*a4.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*a4.size()*a2.size(), i1data_sorted, c1.size()*a4.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,1,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c5.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c5, c3);
 }
@@ -1159,23 +1129,22 @@ void Task446::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a5.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*c3.size()*a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I578
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a5, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a5, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
-        dgemm_("T", "N", a4.size(), a5.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a5.size());
   out()->add_block(odata, a5, a4);
 }
@@ -1223,19 +1192,18 @@ void Task449::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma38
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I582
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), c3.size());
-    dgemm_("T", "N", x0.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
   out()->add_block(odata, c3, x0);
 }
@@ -102,8 +102,7 @@ void MSCASPT2::MSCASPT2::solve_dm(const int targetJ, const int targetI) {
           l2 = t2all_[istate]->at(ist); // careful
 
           shared_ptr<Queue> queue = make_density1q(true, ist == jst);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           resultv->ax_plus_y(ijvJI, den1);
         }
       }
@@ -164,8 +163,7 @@ void MSCASPT2::MSCASPT2::do_rdm_deriv(double factor) {
         deci->allocate();
         auto bdata = make_shared<VectorB>(ndet);
         shared_ptr<Queue> queue = contract_rdm_deriv(/*ciwfn=*/info_->ciwfn(), bdata, /*offset=*/ioffset, /*size=*/isize, /*reset=*/true);
-        while (!queue->done())
-          queue->next_compute();
+        queue->compute();
 
         blas::ax_plus_y_n(factor, deci->vectorb()->data(), isize, ci_deriv_->data(mst)->data()+ioffset);
         blas::ax_plus_y_n(factor, bdata->data(), ndet, ci_deriv_->data(mst)->data());
@@ -203,15 +201,13 @@ void MSCASPT2::MSCASPT2::solve_gradient(const int targetJ, const int targetI, co
           l2 = t2all_[istate]->at(ist); // careful
 
           shared_ptr<Queue> queue = make_density1q(true, ist == jst);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           result->ax_plus_y(ijhJI, den1);
           if (targetJ != targetI)
             resultv->ax_plus_y(ijvJI, den1);
 
           shared_ptr<Queue> queue2 = make_density2q(true, ist == jst);
-          while (!queue2->done())
-            queue2->next_compute();
+          queue2->compute();
           result2->ax_plus_y(ijhJI, Den1);
         }
       }
@@ -233,8 +229,7 @@ void MSCASPT2::MSCASPT2::solve_gradient(const int targetJ, const int targetI, co
           l2 = lall_[istate]->at(ist);
           t2 = t2all_[istate]->at(jst);
           shared_ptr<Queue> queue = make_densityq(false, ist == jst);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
         }
       }
     }
@@ -252,12 +247,10 @@ void MSCASPT2::MSCASPT2::solve_gradient(const int targetJ, const int targetI, co
 
         l2 = lall_[jst]->at(ist);
         shared_ptr<Queue> queue = make_density1q(false, ist == jst);
-        while (!queue->done())
-          queue->next_compute();
+        queue->compute();
 
         shared_ptr<Queue> queue2 = make_density2q(false, ist == jst);
-        while (!queue2->done())
-          queue2->next_compute();
+        queue2->compute();
       }
     }
     den1_->ax_plus_y(1.0, den1->matrix());
@@ -292,16 +285,14 @@ void MSCASPT2::MSCASPT2::solve_gradient(const int targetJ, const int targetI, co
         if (!info_->sssr() || nst == lst) {
           l2 = t2all_[lst]->at(nst);
           dec = make_deci3q(/*zero=*/true);
-          while (!dec->done())
-            dec->next_compute();
+          dec->compute();
           add_total(lmhJI);
         }
 
         if (!info_->sssr() || mst == lst) {
           l2 = t2all_[lst]->at(mst);
           dec = make_deci4q(/*zero=*/true);
-          while (!dec->done())
-            dec->next_compute();
+          dec->compute();
           add_total(lnhJI);
         }
 
@@ -310,8 +301,7 @@ void MSCASPT2::MSCASPT2::solve_gradient(const int targetJ, const int targetI, co
             l2 = t2all_[lst]->at(nst);
             t2 = t2all_[lst]->at(mst);
             dec = make_deci2q(/*zero=*/true);
-            while (!dec->done())
-              dec->next_compute();
+            dec->compute();
             add_total(llhJI);
           }
         }
@@ -319,13 +309,11 @@ void MSCASPT2::MSCASPT2::solve_gradient(const int targetJ, const int targetI, co
         if (!info_->sssr() || nst == mst) {
           l2 = lall_[mst]->at(nst);
           dec = make_deci3q(/*zero*/true);
-          while (!dec->done())
-            dec->next_compute();
+          dec->compute();
 
           l2 = lall_[nst]->at(mst);
           dec = make_deci4q(false);
-          while (!dec->done())
-            dec->next_compute();
+          dec->compute();
 
           for (int lst = 0; lst != nstates; ++lst) {
             if (info_->sssr() && (nst != lst || mst != lst))
@@ -335,20 +323,16 @@ void MSCASPT2::MSCASPT2::solve_gradient(const int targetJ, const int targetI, co
             l2 = lall_[lst]->at(nst);
             t2 = t2all_[lst]->at(mst);
             dec = make_deciq(false);
-            while (!dec->done())
-              dec->next_compute();
+            dec->compute();
             dec = make_deci2q(false);
-            while (!dec->done())
-              dec->next_compute();
+            dec->compute();
 
             l2 = t2all_[lst]->at(nst);
             t2 = lall_[lst]->at(mst);
             dec = make_deciq(false);
-            while (!dec->done())
-              dec->next_compute();
+            dec->compute();
             dec = make_deci2q(false);
-            while (!dec->done())
-              dec->next_compute();
+            dec->compute();
           }
           add_total(1.0);
         }
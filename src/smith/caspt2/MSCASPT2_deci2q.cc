@@ -37,7 +37,7 @@ shared_ptr<Queue> MSCASPT2::MSCASPT2::make_deci2q(const bool reset, const bool d
 
   array<shared_ptr<const IndexRange>,4> cindex = {{rclosed_, ractive_, rvirt_, rci_}};
 
-  auto deci2q = make_shared<Queue>();
+  auto deci2q = make_shared<Queue>(info_->memory_budget());
   auto tensor470 = vector<shared_ptr<Tensor>>{den0ci, den1ci, den2ci, den3ci, den4ci};
   auto task470 = make_shared<Task470>(tensor470, reset);
   deci2q->add_task(task470);
@@ -37,7 +37,7 @@ shared_ptr<Queue> MSCASPT2::MSCASPT2::make_deci3q(const bool reset, const bool d
 
   array<shared_ptr<const IndexRange>,4> cindex = {{rclosed_, ractive_, rvirt_, rci_}};
 
-  auto deci3q = make_shared<Queue>();
+  auto deci3q = make_shared<Queue>(info_->memory_budget());
   auto tensor496 = vector<shared_ptr<Tensor>>{den0ci, den1ci, den2ci, den3ci, den4ci};
   auto task496 = make_shared<Task496>(tensor496, reset);
   deci3q->add_task(task496);
@@ -37,7 +37,7 @@ shared_ptr<Queue> MSCASPT2::MSCASPT2::make_deciq(const bool reset, const bool di
 
   array<shared_ptr<const IndexRange>,4> cindex = {{rclosed_, ractive_, rvirt_, rci_}};
 
-  auto deciq = make_shared<Queue>();
+  auto deciq = make_shared<Queue>(info_->memory_budget());
   auto tensor282 = vector<shared_ptr<Tensor>>{den0ci, den1ci, den2ci, den3ci, den4ci};
   auto task282 = make_shared<Task282>(tensor282, reset);
   deciq->add_task(task282);
@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> MSCASPT2::MSCASPT2::make_density2q(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto density2q = make_shared<Queue>();
+  auto density2q = make_shared<Queue>(info_->memory_budget());
   auto tensor259 = vector<shared_ptr<Tensor>>{Den1};
   auto task259 = make_shared<Task259>(tensor259, reset);
   density2q->add_task(task259);
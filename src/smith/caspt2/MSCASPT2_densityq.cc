@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> MSCASPT2::MSCASPT2::make_densityq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto densityq = make_shared<Queue>();
+  auto densityq = make_shared<Queue>(info_->memory_budget());
   auto tensor28 = vector<shared_ptr<Tensor>>{den2};
   auto task28 = make_shared<Task28>(tensor28, reset);
   densityq->add_task(task28);
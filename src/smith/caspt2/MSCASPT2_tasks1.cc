@@ -2788,25 +2788,24 @@ void Task30::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma0
           std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x1, x4, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I1
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<3,0,2,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -2821,21 +2820,20 @@ void Task31::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.reserve(c1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c2, x4)]);
-      sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), c1.size()*c2.size(),
-             1.0, i0data_sorted, c1.size()*c2.size(), i1data_sorted, c1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -2848,25 +2846,24 @@ void Task32::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma31
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I94
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -2881,21 +2878,20 @@ void Task33::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(a1.size()*c2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, c2, x4)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a1.size()*c2.size(),
-             1.0, i0data_sorted, a1.size()*c2.size(), i1data_sorted, a1.size()*c2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -2908,25 +2904,24 @@ void Task34::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         for (auto& x0 : *range_[1]) {
           // tensor label: Gamma34
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-          sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<2,3,0,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
           // tensor label: I103
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -2941,21 +2936,20 @@ void Task35::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x5.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -2970,21 +2964,20 @@ void Task36::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I137
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -3018,25 +3011,24 @@ void Task38::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x1 : *range_[1]) {
           // tensor label: Gamma92
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
           // tensor label: I285
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -3051,21 +3043,20 @@ void Task39::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.reserve(a1.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, a2)]);
-      sort_indices<3,1,0,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a1.size()*a2.size(),
-             1.0, i0data_sorted, a1.size()*a2.size(), i1data_sorted, a1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -3092,23 +3083,22 @@ void Task41::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+        gemm.reserve(c1.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c3.size(), x2.size());
         // tensor label: I4
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -3123,21 +3113,20 @@ void Task42::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma1
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-      sort_indices<1,3,0,2,0,1,-4,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), c2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -3150,23 +3139,22 @@ void Task43::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+        gemm.reserve(a1.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), x2.size());
         // tensor label: I97
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -3181,21 +3169,20 @@ void Task44::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -3208,23 +3195,22 @@ void Task45::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+        gemm.reserve(a1.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), x3.size(), x2.size());
         // tensor label: I106
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -3239,21 +3225,20 @@ void Task46::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -3280,23 +3265,22 @@ void Task48::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+        gemm.reserve(c1.size()*x0.size()*x1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
         // tensor label: I7
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x1, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
-        dgemm_("T", "N", c2.size(), x2.size(), c1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, c1.size()*x0.size()*x1.size(), i1data_sorted, c1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size());
   out()->add_block(odata, x2, c2);
 }
@@ -3311,23 +3295,22 @@ void Task49::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x0, x1, x2);
 }
@@ -140,23 +140,22 @@ void Task455::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
+  GemmBatch<double> gemm(c5.size(), c3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c5, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c5, a2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
+        gemm.reserve(a4.size()*a2.size()*c1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c5.size(), a2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,3,1,2,0,1,8,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-        dgemm_("T", "N", c5.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, c5.size());
+        sort_indices<2,0,3,1,0,1,8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c5.size(), c3.size());
   out()->add_block(odata, c3, c5);
 }
@@ -200,23 +199,22 @@ void Task458::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
+  GemmBatch<double> gemm(c5.size(), c3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c5, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c5, a4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c5.size(), a4.size());
+        gemm.reserve(a4.size()*a2.size()*c1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c5.size(), a4.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,1,3,2,0,1,-16,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-        dgemm_("T", "N", c5.size(), c3.size(), a4.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*a2.size()*c1.size(), i1data_sorted, a4.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, c5.size());
+        sort_indices<2,0,1,3,0,1,-16,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c5.size(), c3.size());
   out()->add_block(odata, c3, c5);
 }
@@ -260,23 +258,22 @@ void Task461::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a5), 0.0);
+  GemmBatch<double> gemm(a5.size(), a4.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a5, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a5, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a5.size(), c3.size(), a2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,2,1,3,0,1,-8,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-        dgemm_("T", "N", a5.size(), a4.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a5.size());
+        sort_indices<3,0,2,1,0,1,-8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
   out()->add_block(odata, a4, a5);
 }
@@ -320,23 +317,22 @@ void Task464::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a5), 0.0);
+  GemmBatch<double> gemm(a5.size(), a4.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a5)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a5.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a5.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,1,2,3,0,1,16,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-        dgemm_("T", "N", a5.size(), a4.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a5.size());
+        sort_indices<3,0,1,2,0,1,16,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
   out()->add_block(odata, a4, a5);
 }
@@ -378,23 +374,22 @@ void Task466::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x3.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
   out()->add_block(odata, x0, x3);
 }
@@ -407,23 +402,22 @@ void Task467::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a3.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x3.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
   out()->add_block(odata, x0, x3);
 }
@@ -473,21 +467,20 @@ void Task469::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x5, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+      gemm.reserve(a2.size()*a1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, a2)]);
-      sort_indices<1,3,0,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<0,2,1,3,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x5, x4);
 }
@@ -1439,21 +1432,20 @@ void Task499::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c2, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.reserve(c2.size()*c1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c2.size(), x2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
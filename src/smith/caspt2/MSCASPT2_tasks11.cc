@@ -227,19 +227,18 @@ void Task501::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), x4.size(), x3.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,2>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -386,19 +385,18 @@ void Task503::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,2>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -439,23 +437,22 @@ void Task505::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size(), c1.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size(), c1.size(), a2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<3,2,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -468,23 +465,22 @@ void Task506::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size(), c3.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size(), c3.size(), a2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<0,2,1,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x1.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<3,0,2,1,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -532,21 +528,20 @@ void Task508::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -561,21 +556,20 @@ void Task509::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c2.size(), a1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -590,21 +584,20 @@ void Task510::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -619,21 +612,20 @@ void Task511::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,-1,2>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,1,0,0,1,-1,2>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -648,21 +640,20 @@ void Task512::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -725,21 +716,20 @@ void Task514::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x3, x2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x3, x2, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), x3.size(), x2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x3.size(), x2.size(), a1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -787,21 +777,20 @@ void Task516::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,2>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,2>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -864,21 +853,20 @@ void Task518::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, x2, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), x2.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), x2.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,2>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -893,19 +881,18 @@ void Task519::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x3.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -961,19 +948,18 @@ void Task521::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), x3.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,2>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,2,3,1,0,1,1,2>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1048,19 +1034,18 @@ void Task523::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, a1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), a1.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,2>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,2,3,1,0,1,1,2>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x5, x4, x3);
 }
@@ -1155,23 +1140,22 @@ void Task529::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1184,23 +1168,22 @@ void Task530::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a3.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x1.size(), x0.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1213,21 +1196,20 @@ void Task531::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(1, x1.size()*x0.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: h1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", 1, x1.size()*x0.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1240,21 +1222,20 @@ void Task532::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1), 0.0);
+  GemmBatch<double> gemm(1, x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: h1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", 1, x1.size()*x0.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x0, x1);
 }
@@ -1287,21 +1268,20 @@ void Task534::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.reserve(a2.size()*a1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x1.size()*x0.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1316,19 +1296,18 @@ void Task535::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-    dgemm_("T", "N", x3.size(), x2.size()*x1.size()*x0.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x1, x0, x3, x2);
 }
@@ -1449,21 +1428,20 @@ void Task539::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*c1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c2, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*c1.size(),
-             1.0, i0data_sorted, c2.size()*c1.size(), i1data_sorted, c2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -1663,19 +1641,18 @@ void Task541::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x4, x5, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, x1, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), x1.size(), x2.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,1,3,2,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, x4, x5, x0, x1, x2);
 }
@@ -1822,19 +1799,18 @@ void Task543::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x4, x5, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,1,3,2,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, x4, x5, x0, x1, x2);
 }
@@ -1875,23 +1851,22 @@ void Task545::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x0, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x0, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x0.size(), c1.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x0.size(), c1.size(), a2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x1)]);
-        sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), x1.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,2,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1904,23 +1879,22 @@ void Task546::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c3.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c3.size(), a2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x1)]);
-        sort_indices<0,2,1,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), x1.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,2,1,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1968,21 +1942,20 @@ void Task548::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x0.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x0.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -1997,21 +1970,20 @@ void Task549::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c2, a1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c2.size(), a1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -42,21 +42,20 @@ void Task550::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -71,21 +70,20 @@ void Task551::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2, c1, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a2.size(), c1.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<1,0,2,3,0,1,-1,2>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,1,0,0,1,-1,2>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -100,21 +98,20 @@ void Task552::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -177,21 +174,20 @@ void Task554::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x0, x1, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x0, x1, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), x0.size(), x1.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x0.size(), x1.size(), a1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -239,21 +235,20 @@ void Task556::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<1,2,0,3,0,1,1,2>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -316,21 +311,20 @@ void Task558::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, x1, a2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), x1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), x1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,2>(i1data.get(), gemm.b(), c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -345,19 +339,18 @@ void Task559::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size()*x2.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", x0.size(), x1.size()*x2.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), x2.size(), x1.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -413,19 +406,18 @@ void Task561::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x4, x5, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,2>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,2,3,1,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, x4, x5, x0, x1, x2);
 }
@@ -500,19 +492,18 @@ void Task563::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x4, x5, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x4, x5, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, x2, a1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), x2.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), x2.size(), a1.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,2>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x0.size()*x1.size()*x2.size(), x3.size()*x4.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+    sort_indices<0,2,3,1,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, x4, x5, x0, x1, x2);
 }
@@ -607,23 +598,22 @@ void Task569::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a3.size(), c2.size(), a1.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a3.size(), c2.size(), a1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,-1,1>(i1data, i1data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x0.size(), x1.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -636,23 +626,22 @@ void Task570::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, c2, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,2,1>(i1data, i1data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
-        dgemm_("T", "N", x0.size(), x1.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), c2.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -665,21 +654,20 @@ void Task571::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(1, x0.size()*x1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: h1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, c2, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, c2, x0)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x1.size(), a1.size(), c2.size(), x0.size());
-      dgemm_("T", "N", 1, x0.size()*x1.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), c2.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -692,21 +680,20 @@ void Task572::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(1, x0.size()*x1.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: h1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", 1, x0.size()*x1.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -739,21 +726,20 @@ void Task574::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), x2.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.reserve(a2.size()*a1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), x2.size()*x3.size(), a2.size()*a1.size(),
-             1.0, i0data_sorted, a2.size()*a1.size(), i1data_sorted, a2.size()*a1.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
@@ -768,19 +754,18 @@ void Task575::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size()*x2.size()*x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-    dgemm_("T", "N", x0.size(), x1.size()*x2.size()*x3.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), x2.size(), x1.size());
   out()->add_block(odata, x2, x3, x0, x1);
 }
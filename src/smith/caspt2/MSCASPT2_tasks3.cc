@@ -54,21 +54,20 @@ void Task101::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.reserve(c1.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
       // tensor label: I40
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size());
-      dgemm_("T", "N", c3.size()*a2.size(), 1, c1.size()*x0.size(),
-             1.0, i0data_sorted, c1.size()*x0.size(), i1data_sorted, c1.size()*x0.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
   out()->add_block(odata, c3, a2);
 }
@@ -81,23 +80,22 @@ void Task102::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -110,21 +108,20 @@ void Task103::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), 1, odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I196
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
-      dgemm_("T", "N", c3.size()*a2.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
   out()->add_block(odata, c3, a2);
 }
@@ -137,21 +134,20 @@ void Task104::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma65
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I197
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a4.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
   out()->add_block(odata, a4, c1);
 }
@@ -199,21 +195,20 @@ void Task107::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma14
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I43
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size());
-      dgemm_("T", "N", x2.size()*x1.size(), 1, x3.size()*x0.size(),
-             1.0, i0data_sorted, x3.size()*x0.size(), i1data_sorted, x3.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
   out()->add_block(odata, x2, x1);
 }
@@ -226,23 +221,22 @@ void Task108::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I44
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size(), x3.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
@@ -276,21 +270,20 @@ void Task110::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size(), 1, odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma60
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I252
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size());
-      dgemm_("T", "N", x2.size()*x1.size(), 1, x3.size()*x0.size(),
-             1.0, i0data_sorted, x3.size()*x0.size(), i1data_sorted, x3.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
   out()->add_block(odata, x2, x1);
 }
@@ -303,23 +296,22 @@ void Task111::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I253
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-        dgemm_("T", "N", x0.size(), x3.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
@@ -367,23 +359,22 @@ void Task114::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I49
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
   out()->add_block(odata, c1, c4);
 }
@@ -398,19 +389,18 @@ void Task115::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -423,23 +413,22 @@ void Task116::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I52
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
   out()->add_block(odata, c1, c4);
 }
@@ -454,19 +443,18 @@ void Task117::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -493,23 +481,22 @@ void Task119::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I55
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
   out()->add_block(odata, c3, c4);
 }
@@ -524,19 +511,18 @@ void Task120::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -549,23 +535,22 @@ void Task121::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I61
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
   out()->add_block(odata, c3, c4);
 }
@@ -580,19 +565,18 @@ void Task122::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -619,23 +603,22 @@ void Task124::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c1.size(), x1.size());
         // tensor label: I58
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a2.size(), c3.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*x1.size(), i1data_sorted, c3.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size());
   out()->add_block(odata, a2, a4);
 }
@@ -650,19 +633,18 @@ void Task125::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -675,23 +657,22 @@ void Task126::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: I64
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a2.size(), c3.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*x1.size(), i1data_sorted, c3.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size());
   out()->add_block(odata, a2, a4);
 }
@@ -706,19 +687,18 @@ void Task127::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -745,23 +725,22 @@ void Task129::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(a2.size()*c3.size()*x0.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I67
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x1, x0)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x1.size(), x0.size());
-        dgemm_("T", "N", c1.size(), x1.size(), a2.size()*c3.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*c3.size()*x0.size(), i1data_sorted, a2.size()*c3.size()*x0.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x1.size());
   out()->add_block(odata, x1, c1);
 }
@@ -776,21 +755,20 @@ void Task130::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma22
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -805,21 +783,20 @@ void Task131::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c3, x1, x0);
 }
@@ -846,23 +823,22 @@ void Task133::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(a2.size()*c1.size()*x0.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I70
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x0, x1)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x0.size(), x1.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a2.size()*c1.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x0.size(), i1data_sorted, a2.size()*c1.size()*x0.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -877,21 +853,20 @@ void Task134::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I71
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, x0, x1);
 }
@@ -939,19 +914,18 @@ void Task137::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I79
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", x1.size(), a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
   out()->add_block(odata, a4, x1);
 }
@@ -964,23 +938,22 @@ void Task138::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c1.size()*c3.size()*a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I80
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
-        dgemm_("T", "N", x0.size(), a4.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -1028,23 +1001,22 @@ void Task141::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+        gemm.reserve(c2.size()*x1.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
         // tensor label: I85
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x2, x0)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
-        dgemm_("T", "N", a1.size(), x2.size(), c2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, c2.size()*x1.size()*x0.size(), i1data_sorted, c2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x2.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x2.size());
   out()->add_block(odata, x2, a1);
 }
@@ -1059,23 +1031,22 @@ void Task142::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma28
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x2, x0);
 }
@@ -1102,23 +1073,22 @@ void Task144::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c2, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), c2.size(), x3.size());
         // tensor label: I88
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -1133,21 +1103,20 @@ void Task145::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -1160,23 +1129,22 @@ void Task146::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), x3.size());
         // tensor label: I91
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x2, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x2.size(), x3.size());
-        dgemm_("T", "N", c3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -1191,21 +1159,20 @@ void Task147::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x2, x3), 0.0);
+  GemmBatch<double> gemm(x2.size()*x3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma7
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x2.size()*x3.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x3.size());
+      sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x2, x3);
 }
@@ -1218,23 +1185,22 @@ void Task148::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x2.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+        gemm.reserve(a2.size()*c1.size()*x3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c1.size(), x3.size());
         // tensor label: I130
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x2, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x2.size(), x3.size());
-        dgemm_("T", "N", c3.size(), x2.size(), a2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x3.size(), i1data_sorted, a2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x2.size());
   out()->add_block(odata, x2, c3);
 }
@@ -1249,21 +1215,20 @@ void Task149::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x2, x3), 0.0);
+  GemmBatch<double> gemm(x2.size()*x3.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma7
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x2.size()*x3.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x3.size());
+      sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x3.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x2, x3);
 }
@@ -156,23 +156,22 @@ void Task206::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c5.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a4.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I214
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, c5, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, c5, a2)]);
-        sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
-        dgemm_("T", "N", c3.size(), c5.size(), c1.size()*a4.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*a4.size()*a2.size(), i1data_sorted, c1.size()*a4.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,1,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c5.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c5, c3);
 }
@@ -220,23 +219,22 @@ void Task209::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a5.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*c3.size()*a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I218
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a5, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a5, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
-        dgemm_("T", "N", a4.size(), a5.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a5.size());
   out()->add_block(odata, a5, a4);
 }
@@ -284,19 +282,18 @@ void Task212::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I222
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), c3.size());
-    dgemm_("T", "N", x0.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
   out()->add_block(odata, c3, x0);
 }
@@ -309,23 +306,22 @@ void Task213::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(a4.size()*c1.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: I223
         std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, a2)]);
-        sort_indices<1,3,2,0,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a4.size()*c1.size()*a2.size(),
-               1.0, i0data_sorted, a4.size()*c1.size()*a2.size(), i1data_sorted, a4.size()*c1.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -373,23 +369,22 @@ void Task216::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I228
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x1, x0)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a1.size(), x1.size(), a3.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x0.size(), i1data_sorted, a3.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x1.size());
   out()->add_block(odata, x1, a1);
 }
@@ -404,21 +399,20 @@ void Task217::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I229
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c2.size());
   out()->add_block(odata, a3, c2, x1, x0);
 }
@@ -466,23 +460,22 @@ void Task220::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a1.size()*c2.size()*x0.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I231
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x0, x1)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x0.size(), x1.size());
-        dgemm_("T", "N", a3.size(), x1.size(), a1.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a1.size()*c2.size()*x0.size(), i1data_sorted, a1.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size());
   out()->add_block(odata, x1, a3);
 }
@@ -497,21 +490,20 @@ void Task221::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -526,21 +518,20 @@ void Task222::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -567,21 +558,20 @@ void Task224::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), 1, odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a3.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I240
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), 1, a3.size()*x0.size(),
-             1.0, i0data_sorted, a3.size()*x0.size(), i1data_sorted, a3.size()*x0.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
   out()->add_block(odata, c2, a1);
 }
@@ -594,23 +584,22 @@ void Task225::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
   out()->add_block(odata, a3, x0);
 }
@@ -637,21 +626,20 @@ void Task227::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), 1, odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a1.size()*x0.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I243
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size());
-      dgemm_("T", "N", a3.size()*c2.size(), 1, a1.size()*x0.size(),
-             1.0, i0data_sorted, a1.size()*x0.size(), i1data_sorted, a1.size()*x0.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
   out()->add_block(odata, a3, c2);
 }
@@ -664,23 +652,22 @@ void Task228::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
   out()->add_block(odata, a1, x0);
 }
@@ -707,19 +694,18 @@ void Task230::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I246
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c4.size());
   out()->add_block(odata, c4, x1);
 }
@@ -732,23 +718,22 @@ void Task231::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a3.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I247
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, c4, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, c4, a1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), c2.size()*a3.size()*a1.size(),
-               1.0, i0data_sorted, c2.size()*a3.size()*a1.size(), i1data_sorted, c2.size()*a3.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c4.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -796,23 +781,22 @@ void Task234::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+        gemm.reserve(a3.size()*a1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a1.size());
         // tensor label: I258
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c2.size(), a3.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*x1.size(), i1data_sorted, a3.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c2.size());
   out()->add_block(odata, c2, c4);
 }
@@ -827,19 +811,18 @@ void Task235::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -852,23 +835,22 @@ void Task236::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c4, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c4, a3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a3.size());
+        gemm.reserve(a3.size()*a1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c4.size(), a3.size());
         // tensor label: I261
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c2.size(), a3.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*x1.size(), i1data_sorted, a3.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c2.size());
   out()->add_block(odata, c2, c4);
 }
@@ -883,19 +865,18 @@ void Task237::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -922,23 +903,22 @@ void Task239::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a3.size());
         // tensor label: I264
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a1.size(), a3.size()*c2.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x1.size(), i1data_sorted, a3.size()*c2.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a1.size());
   out()->add_block(odata, a1, a4);
 }
@@ -953,19 +933,18 @@ void Task240::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -978,23 +957,22 @@ void Task241::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       for (auto& c2 : *range_[0]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a4.size());
+        gemm.reserve(a3.size()*c2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a4.size());
         // tensor label: I267
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a1.size(), a3.size()*c2.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x1.size(), i1data_sorted, a3.size()*c2.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a1.size());
   out()->add_block(odata, a1, a4);
 }
@@ -1009,19 +987,18 @@ void Task242::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -1048,23 +1025,22 @@ void Task244::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
+        gemm.reserve(c2.size()*a1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a1.size());
         // tensor label: I270
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a3.size(), c2.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x1.size(), i1data_sorted, c2.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a3.size());
   out()->add_block(odata, a3, a4);
 }
@@ -1079,19 +1055,18 @@ void Task245::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -1104,23 +1079,22 @@ void Task246::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& c2 : *range_[0]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a4.size());
+        gemm.reserve(c2.size()*a1.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a4.size());
         // tensor label: I273
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a3.size(), c2.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x1.size(), i1data_sorted, c2.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a3.size());
   out()->add_block(odata, a3, a4);
 }
@@ -1135,19 +1109,18 @@ void Task247::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
@@ -1174,23 +1147,22 @@ void Task249::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a1.size()*a3.size()*x0.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I276
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a3, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a3, x0, x1)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size());
-        dgemm_("T", "N", c2.size(), x1.size(), a1.size()*a3.size()*x0.size(),
-               1.0, i0data_sorted, a1.size()*a3.size()*x0.size(), i1data_sorted, a1.size()*a3.size()*x0.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a3.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x1.size());
   out()->add_block(odata, x1, c2);
 }
@@ -583,19 +583,18 @@ void Task301::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, x7, x6, x5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, x7, x6, x5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, x7, x6, x5), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x5.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, c1, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, c1, x5)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), c1.size(), x5.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x7.size()*x6.size()*x5.size(), x2.size()*x1.size()*x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x7.size()*x6.size()*x5.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<5,4,3,0,1,2,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), x0.size(), x1.size(), x2.size());
   out()->add_block(odata, x2, x1, x0, x7, x6, x5);
 }
@@ -742,19 +741,18 @@ void Task303::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: l2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I348
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x3, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x3, c1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x3.size(), c1.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x3.size(), c1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -769,19 +767,18 @@ void Task304::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), c2.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-    dgemm_("T", "N", c1.size(), x5.size()*x4.size()*x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, c1);
 }
@@ -796,19 +793,18 @@ void Task305::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, c1), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size()*x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x5, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
-    dgemm_("T", "N", x3.size(), c1.size()*x5.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x5.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x3, c1);
 }
@@ -825,19 +821,18 @@ void Task306::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c1.size(), x3.size());
     // tensor label: I488
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0, c1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x1.size(), x0.size(), c1.size(), x2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), x1.size()*x0.size()*x2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), x0.size(), c1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,5,3,4,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), x1.size(), x0.size(), x2.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -852,19 +847,18 @@ void Task307::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), x1.size()*x0.size()*c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", x2.size(), x1.size()*x0.size()*c1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x2.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, c1, x2);
 }
@@ -927,19 +921,18 @@ void Task309::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: l2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I352
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x3.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -952,21 +945,20 @@ void Task310::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(1, c1.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, c2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a3.size(), c2.size());
+      gemm.reserve(c2.size()*a3.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), c2.size());
       // tensor label: I353
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, c1, x3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
-      dgemm_("T", "N", 1, c1.size()*x3.size(), c2.size()*a3.size(),
-             1.0, i0data_sorted, c2.size()*a3.size(), i1data_sorted, c2.size()*a3.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size());
   out()->add_block(odata, c1, x3);
 }
@@ -1002,21 +994,20 @@ void Task312::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: l2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I442
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), c2.size()*a1.size(),
-             1.0, i0data_sorted, c2.size()*a1.size(), i1data_sorted, c2.size()*a1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -1031,19 +1022,18 @@ void Task313::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), c2.size()*a1.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, c3, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
-    dgemm_("T", "N", x2.size(), c2.size()*a1.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), c3.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), c2.size(), a1.size(), x3.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -1058,21 +1048,20 @@ void Task314::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: l2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x0.size(), x1.size());
       // tensor label: I492
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x3.size()*x2.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x3.size(), x2.size());
   out()->add_block(odata, x3, x2, x1, x0);
 }
@@ -1087,19 +1076,18 @@ void Task315::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x2.size(), a2.size()*c1.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size());
     // tensor label: I493
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x2.size(), a2.size()*c1.size()*x3.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x2.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x2.size(), a2.size(), c1.size(), x3.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -1267,19 +1255,18 @@ void Task318::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: l2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: I360
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, c1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, c1, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), c1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), c1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, x2, x1, x0);
 }
@@ -1294,19 +1281,18 @@ void Task319::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, c1, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, c1, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, c1, x4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x5.size()*c1.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a2.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a2.size(), x3.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-    dgemm_("T", "N", x3.size(), x5.size()*c1.size()*x4.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x3.size());
+    sort_indices<0,2,3,1,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x3.size(), x5.size(), c1.size(), x4.size());
   out()->add_block(odata, x5, c1, x4, x3);
 }
@@ -1369,19 +1355,18 @@ void Task321::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size()*x1.size(), x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c3, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c3.size(), x1.size());
     // tensor label: I372
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size());
-    dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -1394,21 +1379,20 @@ void Task322::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3), 0.0);
+  GemmBatch<double> gemm(1, x0.size()*c3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-      dgemm_("T", "N", 1, x0.size()*c3.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x0.size());
   out()->add_block(odata, x0, c3);
 }
@@ -1423,19 +1407,18 @@ void Task323::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size()*x1.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c1.size(), x1.size());
     // tensor label: I376
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), c1.size());
-    dgemm_("T", "N", x3.size()*x2.size()*x1.size(), x0.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x3.size()*x2.size()*x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -1448,21 +1431,20 @@ void Task324::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c1), 0.0);
+  GemmBatch<double> gemm(1, x0.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: f1
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size());
       // tensor label: l2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-      dgemm_("T", "N", 1, x0.size()*c1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x0.size());
   out()->add_block(odata, x0, c1);
 }
@@ -1477,21 +1459,20 @@ void Task325::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I414
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a2.size(), c1.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -1506,19 +1487,18 @@ void Task326::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, a2, c1, x1);
 }
@@ -1533,21 +1513,20 @@ void Task327::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I418
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c3, a2, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c3.size(), a2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c3.size(), a2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -1562,19 +1541,18 @@ void Task328::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size());
+    gemm.reserve(c1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*c3.size()*a2.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, a2, x1);
 }
@@ -1589,21 +1567,20 @@ void Task329::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I422
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2, c1, x1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a2.size(), c1.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), x0.size()*x1.size(), a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a2.size(), c1.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x3, x2, x1);
 }
@@ -1618,19 +1595,18 @@ void Task330::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size());
     // tensor label: l2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), x0.size()*a2.size()*c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, a2, c1, x1);
 }
@@ -1723,23 +1699,22 @@ void Task332::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c1.size(), x3.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x3.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<3,2,1,0,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
   out()->add_block(odata, x0, x3);
 }
@@ -1752,23 +1727,22 @@ void Task333::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x3.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x3.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<3,0,1,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size());
   out()->add_block(odata, x0, x3);
 }
@@ -1809,23 +1783,22 @@ void Task335::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: l2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(a2.size()*c3.size()*c1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I386
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x1, c1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x1, c1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x1.size(), c1.size());
-        dgemm_("T", "N", x0.size(), x1.size(), a2.size()*c3.size()*c1.size(),
-               1.0, i0data_sorted, a2.size()*c3.size()*c1.size(), i1data_sorted, a2.size()*c3.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x1.size(), c1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -1840,19 +1813,18 @@ void Task336::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*c3.size()*x1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c4.size());
     // tensor label: I387
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c3, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
-    dgemm_("T", "N", c1.size(), a2.size()*c3.size()*x1.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x1.size());
   out()->add_block(odata, a2, c3, x1, c1);
 }
@@ -1888,19 +1860,18 @@ void Task338::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, c1), 0.0);
+  GemmBatch<double> gemm(c3.size(), a2.size()*c1.size()*x1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, c4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), c4.size());
     // tensor label: I395
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, c1, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
-    dgemm_("T", "N", c3.size(), a2.size()*c1.size()*x1.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x1.size());
   out()->add_block(odata, a2, c3, x1, c1);
 }
@@ -1936,19 +1907,18 @@ void Task340::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x1, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x1, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x1, c1), 0.0);
+  GemmBatch<double> gemm(a2.size(), c3.size()*c1.size()*x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), a2.size());
+    gemm.reserve(a4.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), a2.size());
     // tensor label: I399
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, c1, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, c1, x1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
-    dgemm_("T", "N", a2.size(), c3.size()*c1.size()*x1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), c1.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x1.size());
   out()->add_block(odata, a2, c3, x1, c1);
 }
@@ -1982,19 +1952,18 @@ void Task342::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, a4.size(), x1.size());
+    gemm.reserve(a4.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), x1.size());
     // tensor label: I426
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x0.size(), a4.size());
-    dgemm_("T", "N", x1.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size());
   out()->add_block(odata, x1, x0);
 }
@@ -2007,23 +1976,22 @@ void Task343::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a2.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", a4.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<3,0,2,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size());
   out()->add_block(odata, x0, a4);
 }
@@ -2036,23 +2004,22 @@ void Task344::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), x0.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-        sort_indices<0,1,2,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-        dgemm_("T", "N", a4.size(), x0.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<3,0,1,2,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x0.size());
   out()->add_block(odata, x0, a4);
 }
@@ -2065,19 +2032,18 @@ void Task345::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a2.size());
     // tensor label: I569
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size());
-    dgemm_("T", "N", x0.size(), x1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -2090,23 +2056,22 @@ void Task346::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.reserve(a4.size()*c3.size()*c1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,3,2,1,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-        dgemm_("T", "N", x1.size(), a2.size(), a4.size()*c3.size()*c1.size(),
-               1.0, i0data_sorted, a4.size()*c3.size()*c1.size(), i1data_sorted, a4.size()*c3.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<1,0,3,2,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size());
   out()->add_block(odata, a2, x1);
 }
@@ -2119,19 +2084,18 @@ void Task347::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: f1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a4)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a4.size());
     // tensor label: I573
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
-    dgemm_("T", "N", x0.size(), x1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size());
   out()->add_block(odata, x1, x0);
 }
@@ -2144,23 +2108,22 @@ void Task348::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a4.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x1.size());
         // tensor label: l2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, a4)]);
-        sort_indices<0,1,2,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
-        dgemm_("T", "N", x1.size(), a4.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x1.size());
+        sort_indices<3,0,1,2,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
   out()->add_block(odata, a4, x1);
 }
@@ -73,12 +73,10 @@ SPCASPT2::SPCASPT2::SPCASPT2(const CASPT2::CASPT2& cas) {
 
 void SPCASPT2::SPCASPT2::solve() {
   shared_ptr<Queue> dens2 = make_densityq();
-  while (!dens2->done())
-    dens2->next_compute();
+  dens2->compute();
 
   shared_ptr<Queue> dens1 = make_density1q();
-  while (!dens1->done())
-    dens1->next_compute();
+  dens1->compute();
 }
 
 #endif
@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> SPCASPT2::SPCASPT2::make_density1q(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto density1q = make_shared<Queue>();
+  auto density1q = make_shared<Queue>(info_->memory_budget());
   auto tensor265 = vector<shared_ptr<Tensor>>{den1};
   auto task265 = make_shared<Task265>(tensor265, reset);
   density1q->add_task(task265);
@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> SPCASPT2::SPCASPT2::make_densityq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto densityq = make_shared<Queue>();
+  auto densityq = make_shared<Queue>(info_->memory_budget());
   auto tensor40 = vector<shared_ptr<Tensor>>{den2};
   auto task40 = make_shared<Task40>(tensor40, reset);
   densityq->add_task(task40);
@@ -40,25 +40,24 @@ void Task50::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), 1, odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x1 : *range_[1]) {
           // tensor label: Gamma92
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+          gemm.reserve(x5.size()*x4.size()*x1.size()*x0.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
           // tensor label: I285
           std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x1, x0);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x1, x0)]);
-          sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
-          dgemm_("T", "N", x3.size()*x2.size(), 1, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, i0data_sorted, x5.size()*x4.size()*x1.size()*x0.size(), i1data_sorted, x5.size()*x4.size()*x1.size()*x0.size(),
-                 1.0, odata_sorted, x3.size()*x2.size());
+          sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x1.size(), x0.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size());
   out()->add_block(odata, x3, x2);
 }
@@ -73,21 +72,20 @@ void Task51::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), x5.size()*x4.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, a2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), a2.size());
+      gemm.reserve(a1.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), a2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(0)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-      sort_indices<3,1,0,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), x5.size()*x4.size(), a1.size()*a2.size(),
-             1.0, i0data_sorted, a1.size()*a2.size(), i1data_sorted, a1.size()*a2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x5.size(), x4.size());
   out()->add_block(odata, x5, x4, x1, x0);
 }
@@ -114,23 +112,22 @@ void Task53::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+        gemm.reserve(c1.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c3.size(), x2.size());
         // tensor label: I4
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), c1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c1.size()*x3.size()*x2.size(), i1data_sorted, c1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -145,21 +142,20 @@ void Task54::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma1
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-      sort_indices<1,3,0,2,0,1,-4,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), c2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -172,23 +168,22 @@ void Task55::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+        gemm.reserve(a1.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), x2.size());
         // tensor label: I97
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -203,21 +198,20 @@ void Task56::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -230,23 +224,22 @@ void Task57::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c2.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+        gemm.reserve(a1.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), x3.size(), x2.size());
         // tensor label: I106
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", c3.size(), c2.size(), a1.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, a1.size()*x3.size()*x2.size(), i1data_sorted, a1.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c2.size());
   out()->add_block(odata, c2, c3);
 }
@@ -261,21 +254,20 @@ void Task58::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -302,23 +294,22 @@ void Task60::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c2, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
+        gemm.reserve(c1.size()*x0.size()*x1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c2.size(), x1.size());
         // tensor label: I7
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x1, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
-        dgemm_("T", "N", c2.size(), x2.size(), c1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, c1.size()*x0.size()*x1.size(), i1data_sorted, c1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size());
   out()->add_block(odata, x2, c2);
 }
@@ -333,23 +324,22 @@ void Task61::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x0, x1, x2);
 }
@@ -362,23 +352,22 @@ void Task62::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, x1)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
+        gemm.reserve(a1.size()*x0.size()*x1.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), x1.size());
         // tensor label: I112
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x1, x2)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x1.size(), x2.size());
-        dgemm_("T", "N", c2.size(), x2.size(), a1.size()*x0.size()*x1.size(),
-               1.0, i0data_sorted, a1.size()*x0.size()*x1.size(), i1data_sorted, a1.size()*x0.size()*x1.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x2.size());
   out()->add_block(odata, x2, c2);
 }
@@ -393,23 +382,22 @@ void Task63::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma37
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, x2);
 }
@@ -436,23 +424,22 @@ void Task65::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+        gemm.reserve(c2.size()*c1.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c2.size(), x3.size());
         // tensor label: I10
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), c2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*c1.size()*x3.size(), i1data_sorted, c2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -467,21 +454,20 @@ void Task66::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma3
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c2, x1)]);
-      sort_indices<3,1,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x0.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), c2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -494,23 +480,22 @@ void Task67::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a1.size());
         // tensor label: I121
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -525,21 +510,20 @@ void Task68::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma40
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size(), x3.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -552,23 +536,22 @@ void Task69::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& c2 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a1.size()*x3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I124
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), c2.size()*a1.size()*x3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x3.size(), i1data_sorted, c2.size()*a1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -583,21 +566,20 @@ void Task70::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -610,23 +592,22 @@ void Task71::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, a2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), a2.size());
+        gemm.reserve(a2.size()*c1.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c1.size(), a2.size());
         // tensor label: I163
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), a2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x3.size(), i1data_sorted, a2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -641,21 +622,20 @@ void Task72::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma40
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size(), x3.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -668,23 +648,22 @@ void Task73::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, a3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), a3.size());
+        gemm.reserve(a2.size()*c1.size()*x3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), a3.size());
         // tensor label: I166
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x3, x2)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a3.size(), x2.size(), a2.size()*c1.size()*x3.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x3.size(), i1data_sorted, a2.size()*c1.size()*x3.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x2.size());
   out()->add_block(odata, x2, a3);
 }
@@ -699,21 +678,20 @@ void Task74::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma40
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size(), x3.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size(), x3.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, x0, x1)]);
-      sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, a2, c1, x3, x2);
 }
@@ -740,23 +718,22 @@ void Task76::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+        gemm.reserve(c1.size()*x5.size()*x4.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), c2.size(), x4.size());
         // tensor label: I13
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x3, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x3, x4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x3.size(), x4.size());
-        dgemm_("T", "N", c2.size(), x3.size(), c1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c1.size()*x5.size()*x4.size(), i1data_sorted, c1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x3.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size());
   out()->add_block(odata, x3, c2);
 }
@@ -771,23 +748,22 @@ void Task77::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x3, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x3, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x3, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x3.size()*x4.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x1, x0, x3, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x1, x0, x3, x4)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x1.size(), x0.size(), x3.size(), x4.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x1.size(), x0.size(), x3.size(), x4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x3.size()*x4.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x3.size()*x4.size());
+        sort_indices<2,3,1,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x3.size(), x4.size(), c1.size());
   out()->add_block(odata, c1, x5, x3, x4);
 }
@@ -800,23 +776,22 @@ void Task78::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+        gemm.reserve(a1.size()*x5.size()*x4.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c2.size(), x4.size());
         // tensor label: I169
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x3, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x3, x4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x3.size(), x4.size());
-        dgemm_("T", "N", c2.size(), x3.size(), a1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, a1.size()*x5.size()*x4.size(), i1data_sorted, a1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x3.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size());
   out()->add_block(odata, x3, c2);
 }
@@ -831,23 +806,22 @@ void Task79::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x3, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x3, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x3, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x3.size()*x4.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma56
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x2, x1, x3, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x2, x1, x3, x4)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x2.size(), x1.size(), x3.size(), x4.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x2.size(), x1.size(), x3.size(), x4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x3.size()*x4.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x3.size()*x4.size());
+        sort_indices<1,0,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x3.size(), x4.size(), a1.size());
   out()->add_block(odata, a1, x5, x3, x4);
 }
@@ -860,23 +834,22 @@ void Task80::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), x3.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+        gemm.reserve(a1.size()*x5.size()*x4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x5.size(), x4.size());
         // tensor label: I172
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", c2.size(), x3.size(), a1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, a1.size()*x5.size()*x4.size(), i1data_sorted, a1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size());
   out()->add_block(odata, x3, c2);
 }
@@ -891,23 +864,22 @@ void Task81::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma57
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x1, x3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x1, x3, x0)]);
-        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x1.size(), x3.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x1.size(), x3.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<1,3,2,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -934,6 +906,7 @@ void Task83::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, x3), 0.0);
+  GemmBatch<double> gemm(x4.size()*x3.size(), 1, odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
@@ -942,21 +915,19 @@ void Task83::Task_local::compute() {
             for (auto& x0 : *range_[1]) {
               // tensor label: Gamma5
               std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x2, x5, x1, x0, x4, x3);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x2, x5, x1, x0, x4, x3)]);
-              sort_indices<0,1,2,3,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size(), x4.size(), x3.size());
+              gemm.reserve(x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size());
+              sort_indices<6,7,0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x2.size(), x5.size(), x1.size(), x0.size(), x4.size(), x3.size());
               // tensor label: I16
               std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, x5, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, x5, x2, x1, x0)]);
-              sort_indices<0,1,3,2,4,5,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
-              dgemm_("T", "N", x4.size()*x3.size(), 1, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, x4.size()*x3.size());
+              sort_indices<0,1,3,2,4,5,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
+              gemm.commit();
             }
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x4.size(), x3.size());
   out()->add_block(odata, x4, x3);
 }
@@ -973,19 +944,18 @@ void Task84::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x7, x6, x5, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1, c1, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
+    gemm.reserve(c1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size(), c1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(x7, x6, c1, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x7, x6, c1, x5)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), c1.size(),
-           1.0, i0data_sorted, c1.size(), i1data_sorted, c1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), c1.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x7.size(), x6.size(), x5.size());
   out()->add_block(odata, x7, x6, x5, x2, x1, x0);
 }
@@ -998,6 +968,7 @@ void Task85::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, x3), 0.0);
+  GemmBatch<double> gemm(x4.size()*x3.size(), 1, odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x6 : *range_[1]) {
@@ -1006,21 +977,19 @@ void Task85::Task_local::compute() {
             for (auto& x1 : *range_[1]) {
               // tensor label: Gamma58
               std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x2, x1, x4, x3);
-              std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x2, x1, x4, x3)]);
-              sort_indices<0,1,2,3,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size(), x4.size(), x3.size());
+              gemm.reserve(x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size());
+              sort_indices<6,7,0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size(), x4.size(), x3.size());
               // tensor label: I175
               std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, x5, x2, x1, x0);
-              std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, x5, x2, x1, x0)]);
-              sort_indices<0,5,1,2,3,4,0,1,1,1>(i1data, i1data_sorted, x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
-              dgemm_("T", "N", x4.size()*x3.size(), 1, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, i0data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(), i1data_sorted, x7.size()*x6.size()*x5.size()*x2.size()*x1.size()*x0.size(),
-                     1.0, odata_sorted, x4.size()*x3.size());
+              sort_indices<0,5,1,2,3,4,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), x5.size(), x2.size(), x1.size(), x0.size());
+              gemm.commit();
             }
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x4.size(), x3.size());
   out()->add_block(odata, x4, x3);
 }
@@ -1037,19 +1006,18 @@ void Task86::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x7, x6, x5, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x7, x6, x5, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, x1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, x1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
+    gemm.reserve(a1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), x1.size(), x2.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(0)->get_block(x7, a1, x6, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x7, a1, x6, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
-    dgemm_("T", "N", x2.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(), a1.size(),
-           1.0, i0data_sorted, a1.size(), i1data_sorted, a1.size(),
-           1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), a1.size(), x6.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), x7.size(), x6.size(), x5.size());
   out()->add_block(odata, x7, x6, x5, x2, x1, x0);
 }
@@ -1076,23 +1044,22 @@ void Task88::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c2.size(), x3.size());
         // tensor label: I19
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", c2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), c1.size());
   out()->add_block(odata, c1, c2);
 }
@@ -1107,23 +1074,22 @@ void Task89::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0, x2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0, x2, x3)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size(), x2.size(), x3.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x0.size(), x2.size(), x3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<1,0,3,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<2,1,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -1150,21 +1116,20 @@ void Task91::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c1, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c1.size(), x3.size());
+      gemm.reserve(c1.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c1.size(), x3.size());
       // tensor label: I22
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-      dgemm_("T", "N", c2.size()*a3.size(), 1, c1.size()*x3.size(),
-             1.0, i0data_sorted, c1.size()*x3.size(), i1data_sorted, c1.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
   out()->add_block(odata, c2, a3);
 }
@@ -1177,23 +1142,22 @@ void Task92::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma7
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size());
   out()->add_block(odata, c1, x3);
 }
@@ -1206,21 +1170,20 @@ void Task93::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), 1, odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+      gemm.reserve(c1.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c2.size(), x3.size());
       // tensor label: I25
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size());
-      dgemm_("T", "N", a3.size()*c2.size(), 1, c1.size()*x3.size(),
-             1.0, i0data_sorted, c1.size()*x3.size(), i1data_sorted, c1.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size());
   out()->add_block(odata, c2, a3);
 }
@@ -1233,23 +1196,22 @@ void Task94::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma8
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0, x2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0, x2, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size(), x2.size(), x3.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size(), x2.size(), x3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<1,0,3,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<2,1,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size());
   out()->add_block(odata, c1, x3);
 }
@@ -1262,21 +1224,20 @@ void Task95::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), 1, odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+      gemm.reserve(a1.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a1.size());
       // tensor label: I181
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x3.size());
-      dgemm_("T", "N", a3.size()*c2.size(), 1, a1.size()*x3.size(),
-             1.0, i0data_sorted, a1.size()*x3.size(), i1data_sorted, a1.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size());
   out()->add_block(odata, c2, a3);
 }
@@ -1289,23 +1250,22 @@ void Task96::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1, x3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x1, x3, x0)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), x1.size(), x3.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x1.size(), x3.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,3,2,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, a1, x3);
 }
@@ -1318,21 +1278,20 @@ void Task97::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), 1, odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a1.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I184
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x3)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x3.size());
-      dgemm_("T", "N", c2.size()*a3.size(), 1, a1.size()*x3.size(),
-             1.0, i0data_sorted, a1.size()*x3.size(), i1data_sorted, a1.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
   out()->add_block(odata, c2, a3);
 }
@@ -1345,23 +1304,22 @@ void Task98::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma61
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,0,3,2,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, a1, x3);
 }
@@ -40,23 +40,22 @@ void Task100::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+        gemm.reserve(c1.size()*x4.size()*x5.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c1.size(), x4.size());
         // tensor label: I28
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x4, x5, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x4, x5, x3)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x4.size(), x5.size(), x3.size());
-        dgemm_("T", "N", a2.size(), x3.size(), c1.size()*x4.size()*x5.size(),
-               1.0, i0data_sorted, c1.size()*x4.size()*x5.size(), i1data_sorted, c1.size()*x4.size()*x5.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x4.size(), x5.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
   out()->add_block(odata, x3, a2);
 }
@@ -71,23 +70,22 @@ void Task101::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x4, x5, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x4, x5, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x4, x5, x3), 0.0);
+  GemmBatch<double> gemm(x4.size()*x5.size()*x3.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma9
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x4, x1, x0, x5, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x4, x1, x0, x5, x3)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x4.size(), x1.size(), x0.size(), x5.size(), x3.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x4.size(), x1.size(), x0.size(), x5.size(), x3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<3,1,0,2,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x4.size()*x5.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x4.size()*x5.size()*x3.size());
+        sort_indices<2,3,1,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x4.size(), x5.size(), x3.size(), c1.size());
   out()->add_block(odata, c1, x4, x5, x3);
 }
@@ -100,23 +98,22 @@ void Task102::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+        gemm.reserve(c1.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x5.size(), x4.size());
         // tensor label: I31
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", a2.size(), x3.size(), c1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c1.size()*x5.size()*x4.size(), i1data_sorted, c1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
   out()->add_block(odata, x3, a2);
 }
@@ -131,23 +128,22 @@ void Task103::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma6
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0, x2, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0, x2, x3)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size(), x2.size(), x3.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x0.size(), x2.size(), x3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1, c1, x2)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), x1.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x1.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -160,23 +156,22 @@ void Task104::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+        gemm.reserve(a1.size()*x5.size()*x4.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a2.size());
         // tensor label: I187
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", a2.size(), x3.size(), a1.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, a1.size()*x5.size()*x4.size(), i1data_sorted, a1.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size());
   out()->add_block(odata, x3, a2);
 }
@@ -191,23 +186,22 @@ void Task105::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma62
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x2, x1, x4, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x2, x1, x4, x3)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x2.size(), x1.size(), x4.size(), x3.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x2.size(), x1.size(), x4.size(), x3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<0,3,2,1,0,1,2,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+        sort_indices<1,0,3,2,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -234,23 +228,22 @@ void Task107::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c1.size()*c3.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I34
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x0, x1)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x0.size(), x1.size());
-        dgemm_("T", "N", a2.size(), x1.size(), c1.size()*c3.size()*x0.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*x0.size(), i1data_sorted, c1.size()*c3.size()*x0.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x1.size());
   out()->add_block(odata, x1, a2);
 }
@@ -265,21 +258,20 @@ void Task108::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma11
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2, x1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x2, x1, x3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x2.size(), x1.size(), x3.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x2.size(), x1.size(), x3.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<3,1,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x0, x1);
 }
@@ -306,21 +298,20 @@ void Task110::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.reserve(c3.size()*x0.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
       // tensor label: I37
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), 1, c3.size()*x0.size(),
-             1.0, i0data_sorted, c3.size()*x0.size(), i1data_sorted, c3.size()*x0.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, a2, c1);
 }
@@ -333,23 +324,22 @@ void Task111::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma12
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
   out()->add_block(odata, c3, x0);
 }
@@ -376,21 +366,20 @@ void Task113::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+      gemm.reserve(c1.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
       // tensor label: I40
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size());
-      dgemm_("T", "N", c3.size()*a2.size(), 1, c1.size()*x0.size(),
-             1.0, i0data_sorted, c1.size()*x0.size(), i1data_sorted, c1.size()*x0.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
   out()->add_block(odata, c3, a2);
 }
@@ -403,23 +392,22 @@ void Task114::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma13
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -432,21 +420,20 @@ void Task115::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), 1, odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I196
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size());
-      dgemm_("T", "N", c3.size()*a2.size(), 1, a4.size()*c1.size(),
-             1.0, i0data_sorted, a4.size()*c1.size(), i1data_sorted, a4.size()*c1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size());
   out()->add_block(odata, c3, a2);
 }
@@ -459,21 +446,20 @@ void Task116::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma65
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,2,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a4.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
   out()->add_block(odata, a4, c1);
 }
@@ -486,21 +472,20 @@ void Task117::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, c1.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma67
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", 1, c1.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size());
   out()->add_block(odata, a4, c1);
 }
@@ -527,21 +512,20 @@ void Task119::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size(), 1, odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma14
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I43
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0)]);
-      sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size());
-      dgemm_("T", "N", x2.size()*x1.size(), 1, x3.size()*x0.size(),
-             1.0, i0data_sorted, x3.size()*x0.size(), i1data_sorted, x3.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+      sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
   out()->add_block(odata, x2, x1);
 }
@@ -554,23 +538,22 @@ void Task120::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c3.size()*a2.size()*c1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I44
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size(), x3.size(), c3.size()*a2.size()*c1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*c1.size(), i1data_sorted, c3.size()*a2.size()*c1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
@@ -604,21 +587,20 @@ void Task122::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size(), 1, odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma81
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x0.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I252
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size());
-      dgemm_("T", "N", x2.size()*x1.size(), 1, x3.size()*x0.size(),
-             1.0, i0data_sorted, x3.size()*x0.size(), i1data_sorted, x3.size()*x0.size(),
-             1.0, odata_sorted, x2.size()*x1.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size());
   out()->add_block(odata, x2, x1);
 }
@@ -631,23 +613,22 @@ void Task123::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I253
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-        dgemm_("T", "N", x0.size(), x3.size(), a3.size()*c2.size()*a1.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*a1.size(), i1data_sorted, a3.size()*c2.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size());
   out()->add_block(odata, x3, x0);
 }
@@ -695,23 +676,22 @@ void Task126::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c3.size(), x1.size());
         // tensor label: I49
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
   out()->add_block(odata, c1, c4);
 }
@@ -726,19 +706,18 @@ void Task127::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -751,23 +730,22 @@ void Task128::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(c3.size()*a2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I52
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c1.size(), c3.size()*a2.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x1.size(), i1data_sorted, c3.size()*a2.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c1.size());
   out()->add_block(odata, c1, c4);
 }
@@ -782,19 +760,18 @@ void Task129::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma17
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -821,23 +798,22 @@ void Task131::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c1.size(), x1.size());
         // tensor label: I55
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
   out()->add_block(odata, c3, c4);
 }
@@ -852,19 +828,18 @@ void Task132::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma17
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -877,23 +852,22 @@ void Task133::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c3.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x1.size());
+        gemm.reserve(a2.size()*c1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c4.size(), x1.size());
         // tensor label: I61
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<2,1,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c3.size(), a2.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x1.size(), i1data_sorted, a2.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c3.size());
   out()->add_block(odata, c3, c4);
 }
@@ -908,19 +882,18 @@ void Task134::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma17
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -947,23 +920,22 @@ void Task136::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c1 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c1.size(), x1.size());
         // tensor label: I58
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a2.size(), c3.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*x1.size(), i1data_sorted, c3.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size());
   out()->add_block(odata, a2, a4);
 }
@@ -978,19 +950,18 @@ void Task137::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma17
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -1003,23 +974,22 @@ void Task138::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a2.size(), odata_sorted.get());
   for (auto& c1 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.reserve(c3.size()*c1.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x1.size());
         // tensor label: I64
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x1)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", a4.size(), a2.size(), c3.size()*c1.size()*x1.size(),
-               1.0, i0data_sorted, c3.size()*c1.size()*x1.size(), i1data_sorted, c3.size()*c1.size()*x1.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size());
   out()->add_block(odata, a2, a4);
 }
@@ -1034,19 +1004,18 @@ void Task139::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, c1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, c1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, c1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma16
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, c3, x0)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size()*a2.size()*c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, c1, x1);
 }
@@ -1073,23 +1042,22 @@ void Task141::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(a2.size()*c3.size()*x0.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I67
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x0, x1)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x0.size(), x1.size());
-        dgemm_("T", "N", c1.size(), x1.size(), a2.size()*c3.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*c3.size()*x0.size(), i1data_sorted, a2.size()*c3.size()*x0.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x1.size());
   out()->add_block(odata, x1, c1);
 }
@@ -1104,21 +1072,20 @@ void Task142::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma22
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x2, x3, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x2, x3, x1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), x2.size(), x3.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x2.size(), x3.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c3, x2)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x0, x1);
 }
@@ -1131,23 +1098,22 @@ void Task143::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a2 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(c3.size()*a2.size()*x0.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I73
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x0, x1)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x0.size(), x1.size());
-        dgemm_("T", "N", c1.size(), x1.size(), c3.size()*a2.size()*x0.size(),
-               1.0, i0data_sorted, c3.size()*a2.size()*x0.size(), i1data_sorted, c3.size()*a2.size()*x0.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c1.size(), x1.size());
   out()->add_block(odata, x1, c1);
 }
@@ -1162,21 +1128,20 @@ void Task144::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma13
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a2.size());
   out()->add_block(odata, c3, a2, x0, x1);
 }
@@ -1203,23 +1168,22 @@ void Task146::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x0)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x0.size());
+        gemm.reserve(a2.size()*c1.size()*x0.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x0.size());
         // tensor label: I70
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1, x0, x1)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size(), x0.size(), x1.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a2.size()*c1.size()*x0.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*x0.size(), i1data_sorted, a2.size()*c1.size()*x0.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -1234,21 +1198,20 @@ void Task147::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma13
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I71
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, x0, x1);
 }
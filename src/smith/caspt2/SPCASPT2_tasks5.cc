@@ -42,23 +42,22 @@ void Task200::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1, x0, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1, x0, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1, x0, x2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size()*x2.size(), a2.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x3, x1, x0, x5, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x3, x1, x0, x5, x2)]);
-        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data, i0data_sorted, x4.size(), x3.size(), x1.size(), x0.size(), x5.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x3.size(), x1.size(), x0.size(), x5.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x0.size()*x2.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x0.size()*x2.size());
+        sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), x2.size(), a2.size());
   out()->add_block(odata, a2, x1, x0, x2);
 }
@@ -85,23 +84,22 @@ void Task202::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.reserve(x4.size()*x3.size()*x5.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), x4.size(), x3.size());
         // tensor label: I178
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x4, x3, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x4, x3, x5)]);
-        sort_indices<3,1,2,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x4.size(), x3.size(), x5.size());
-        dgemm_("T", "N", a2.size(), a1.size(), x4.size()*x3.size()*x5.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x5.size(), i1data_sorted, x4.size()*x3.size()*x5.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x4.size(), x3.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size());
   out()->add_block(odata, a1, a2);
 }
@@ -116,23 +114,22 @@ void Task203::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x4, x3, x5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x4, x3, x5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x4, x3, x5), 0.0);
+  GemmBatch<double> gemm(x4.size()*x3.size()*x5.size(), a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma59
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x3, x2, x1, x5, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x3, x2, x1, x5, x0)]);
-        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data, i0data_sorted, x4.size(), x3.size(), x2.size(), x1.size(), x5.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x3.size(), x2.size(), x1.size(), x5.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, x1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, x1, x2)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), x1.size(), x2.size());
-        dgemm_("T", "N", x4.size()*x3.size()*x5.size(), a1.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x4.size()*x3.size()*x5.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), x1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x4.size(), x3.size(), x5.size(), a1.size());
   out()->add_block(odata, a1, x4, x3, x5);
 }
@@ -159,19 +156,18 @@ void Task205::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma17
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I190
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size());
-    dgemm_("T", "N", x0.size(), a2.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a2.size());
   out()->add_block(odata, a2, x0);
 }
@@ -184,23 +180,22 @@ void Task206::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a4.size()*c3.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a4, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-        sort_indices<1,2,0,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
-        dgemm_("T", "N", a2.size(), x1.size(), c1.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a4.size()*c3.size(), i1data_sorted, c1.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<3,1,2,0,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), x1.size());
   out()->add_block(odata, x1, a2);
 }
@@ -227,19 +222,18 @@ void Task208::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma17
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I193
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size());
-    dgemm_("T", "N", x0.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -252,23 +246,22 @@ void Task209::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), x1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a2.size()*c3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-        sort_indices<2,1,0,3,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", a4.size(), x1.size(), c1.size()*a2.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a2.size()*c3.size(), i1data_sorted, c1.size()*a2.size()*c3.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<3,2,1,0,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), x1.size());
   out()->add_block(odata, x1, a4);
 }
@@ -295,21 +288,20 @@ void Task211::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c3.size(), 1, odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c1 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I199
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c1)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), c1.size());
-      dgemm_("T", "N", a4.size()*c3.size(), 1, a2.size()*c1.size(),
-             1.0, i0data_sorted, a2.size()*c1.size(), i1data_sorted, a2.size()*c1.size(),
-             1.0, odata_sorted, a4.size()*c3.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size());
   out()->add_block(odata, a4, c3);
 }
@@ -322,21 +314,20 @@ void Task212::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma67
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I200
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
   out()->add_block(odata, a2, c1);
 }
@@ -465,23 +456,22 @@ void Task219::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c5.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a4.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a4, c5, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a4, c5, a2)]);
-        sort_indices<1,3,0,2,0,1,4,1>(i1data, i1data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
-        dgemm_("T", "N", c3.size(), c5.size(), c1.size()*a4.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*a4.size()*a2.size(), i1data_sorted, c1.size()*a4.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,1,3,0,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), c5.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c5, c3);
 }
@@ -494,23 +484,22 @@ void Task220::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), c5.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a2.size()*a4.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c5, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a2, c5, a4)]);
-        sort_indices<3,1,0,2,0,1,-8,1>(i1data, i1data_sorted, c1.size(), a2.size(), c5.size(), a4.size());
-        dgemm_("T", "N", c3.size(), c5.size(), c1.size()*a2.size()*a4.size(),
-               1.0, i0data_sorted, c1.size()*a2.size()*a4.size(), i1data_sorted, c1.size()*a2.size()*a4.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<2,3,1,0,0,1,-8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c5.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c5, c3);
 }
@@ -537,23 +526,22 @@ void Task222::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a5.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*c3.size()*a2.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a5, c3, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a5, c3, a2)]);
-        sort_indices<2,3,0,1,0,1,-4,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
-        dgemm_("T", "N", a4.size(), a5.size(), c1.size()*c3.size()*a2.size(),
-               1.0, i0data_sorted, c1.size()*c3.size()*a2.size(), i1data_sorted, c1.size()*c3.size()*a2.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<1,2,3,0,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a5.size());
   out()->add_block(odata, a5, a4);
 }
@@ -566,23 +554,22 @@ void Task223::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(a4.size(), a5.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(c1.size()*a2.size()*c3.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c1, a2, c3, a5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c1, a2, c3, a5)]);
-        sort_indices<2,1,0,3,0,1,8,1>(i1data, i1data_sorted, c1.size(), a2.size(), c3.size(), a5.size());
-        dgemm_("T", "N", a4.size(), a5.size(), c1.size()*a2.size()*c3.size(),
-               1.0, i0data_sorted, c1.size()*a2.size()*c3.size(), i1data_sorted, c1.size()*a2.size()*c3.size(),
-               1.0, odata_sorted, a4.size());
+        sort_indices<3,2,1,0,0,1,8,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), c3.size(), a5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a5.size());
   out()->add_block(odata, a5, a4);
 }
@@ -609,19 +596,18 @@ void Task225::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I222
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x1.size(), c3.size());
-    dgemm_("T", "N", x0.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size());
   out()->add_block(odata, c3, x0);
 }
@@ -634,23 +620,22 @@ void Task226::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(a4.size()*c1.size()*a2.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(x1, a4, c1, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x1, a4, c1, a2)]);
-        sort_indices<1,3,2,0,0,1,-4,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a4.size()*c1.size()*a2.size(),
-               1.0, i0data_sorted, a4.size()*c1.size()*a2.size(), i1data_sorted, a4.size()*c1.size()*a2.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,1,3,2,0,1,-4,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -663,23 +648,22 @@ void Task227::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, c3), 0.0);
+  GemmBatch<double> gemm(c3.size(), x1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a2 : *range_[2]) {
       for (auto& c1 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-        sort_indices<3,1,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+        gemm.reserve(a2.size()*c1.size()*a4.size());
+        sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(x1, a2, c1, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(x1, a2, c1, a4)]);
-        sort_indices<3,1,2,0,0,1,2,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), a4.size());
-        dgemm_("T", "N", c3.size(), x1.size(), a2.size()*c1.size()*a4.size(),
-               1.0, i0data_sorted, a2.size()*c1.size()*a4.size(), i1data_sorted, a2.size()*c1.size()*a4.size(),
-               1.0, odata_sorted, c3.size());
+        sort_indices<0,3,1,2,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), a2.size(), c1.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c3.size(), x1.size());
   out()->add_block(odata, x1, c3);
 }
@@ -706,23 +690,22 @@ void Task229::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a3.size()*c2.size()*x0.size());
+        sort_indices<1,3,2,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I228
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x1, x0)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a1.size(), x1.size(), a3.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a3.size()*c2.size()*x0.size(), i1data_sorted, a3.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x1.size());
   out()->add_block(odata, x1, a1);
 }
@@ -737,21 +720,20 @@ void Task230::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I229
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c2.size());
   out()->add_block(odata, a3, c2, x1, x0);
 }
@@ -799,23 +781,22 @@ void Task233::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(a1.size()*c2.size()*x0.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I231
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x0, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x0, x1)]);
-        sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x0.size(), x1.size());
-        dgemm_("T", "N", a3.size(), x1.size(), a1.size()*c2.size()*x0.size(),
-               1.0, i0data_sorted, a1.size()*c2.size()*x0.size(), i1data_sorted, a1.size()*c2.size()*x0.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<3,1,0,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x0.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size());
   out()->add_block(odata, x1, a3);
 }
@@ -830,21 +811,20 @@ void Task234::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -857,23 +837,22 @@ void Task235::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, a3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, a3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, a3), 0.0);
+  GemmBatch<double> gemm(a3.size(), x1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a1 : *range_[2]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a1.size()*x0.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: I237
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x1, x0)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a3.size(), x1.size(), c2.size()*a1.size()*x0.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*x0.size(), i1data_sorted, c2.size()*a1.size()*x0.size(),
-               1.0, odata_sorted, a3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a3.size(), x1.size());
   out()->add_block(odata, x1, a3);
 }
@@ -888,21 +867,20 @@ void Task236::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma35
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, a1, x1, x0);
 }
@@ -929,21 +907,20 @@ void Task238::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), 1, odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a3.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I240
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), 1, a3.size()*x0.size(),
-             1.0, i0data_sorted, a3.size()*x0.size(), i1data_sorted, a3.size()*x0.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
   out()->add_block(odata, c2, a1);
 }
@@ -956,23 +933,22 @@ void Task239::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma60
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1, x3, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x1, x3, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x1.size(), x3.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x1.size(), x3.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
   out()->add_block(odata, a3, x0);
 }
@@ -999,21 +975,20 @@ void Task241::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), 1, odata_sorted.get());
   for (auto& a1 : *range_[2]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a1.size()*x0.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I243
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size());
-      dgemm_("T", "N", a3.size()*c2.size(), 1, a1.size()*x0.size(),
-             1.0, i0data_sorted, a1.size()*x0.size(), i1data_sorted, a1.size()*x0.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size());
   out()->add_block(odata, a3, c2);
 }
@@ -1026,23 +1001,22 @@ void Task242::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma61
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
   out()->add_block(odata, a1, x0);
 }
@@ -1069,19 +1043,18 @@ void Task244::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I246
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c4.size());
   out()->add_block(odata, c4, x1);
 }
@@ -1094,23 +1067,22 @@ void Task245::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a3.size()*a1.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c2, a3, c4, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c2, a3, c4, a1)]);
-        sort_indices<1,0,3,2,0,1,-4,1>(i1data, i1data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), c2.size()*a3.size()*a1.size(),
-               1.0, i0data_sorted, c2.size()*a3.size()*a1.size(), i1data_sorted, c2.size()*a3.size()*a1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,1,0,3,0,1,-4,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), c4.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1123,23 +1095,22 @@ void Task246::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a1, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a1, c2, a3)]);
-        sort_indices<3,2,1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
+        gemm.reserve(c2.size()*a1.size()*a3.size());
+        sort_indices<0,3,2,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a1.size(), c2.size(), a3.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(0)->get_block(c2, a1, c4, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(0)->get_size(c2, a1, c4, a3)]);
-        sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, c2.size(), a1.size(), c4.size(), a3.size());
-        dgemm_("T", "N", x0.size(), c4.size(), c2.size()*a1.size()*a3.size(),
-               1.0, i0data_sorted, c2.size()*a1.size()*a3.size(), i1data_sorted, c2.size()*a1.size()*a3.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), c4.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1166,23 +1137,22 @@ void Task248::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4), 0.0);
+  GemmBatch<double> gemm(c4.size(), c2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       for (auto& a1 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+        gemm.reserve(a3.size()*a1.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a1.size());
         // tensor label: I258
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, a1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, a1, x1)]);
-        sort_indices<3,0,2,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), a1.size(), x1.size());
-        dgemm_("T", "N", c4.size(), c2.size(), a3.size()*a1.size()*x1.size(),
-               1.0, i0data_sorted, a3.size()*a1.size()*x1.size(), i1data_sorted, a3.size()*a1.size()*x1.size(),
-               1.0, odata_sorted, c4.size());
+        sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), a1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, c4.size(), c2.size());
   out()->add_block(odata, c2, c4);
 }
@@ -1197,19 +1167,18 @@ void Task249::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma65
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x1.size(), a3.size()*c2.size()*a1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, a3, c2, a1, x1);
 }
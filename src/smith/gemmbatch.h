@@ -0,0 +1,96 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: gemmbatch.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef __SRC_SMITH_GEMMBATCH_H
+#define __SRC_SMITH_GEMMBATCH_H
+
+#include <complex>
+#include <memory>
+#include <algorithm>
+#include <src/util/f77.h>
+
+namespace bagel {
+namespace SMITH {
+
+// Accumulates C(m,n) += sum_K A_K(m,k) B_K(n,k)^T over the blocks K of the contracted indices, and computes it
+// with one GEMM. The blocks are sorted directly into the packed buffers (a() and b() after reserve(k)), in which
+// the contracted index runs slowest so that the blocks are contiguous.
+template<typename DataType>
+class GemmBatch {
+  protected:
+    const int m_;
+    const int n_;
+    DataType* const c_;
+
+    std::unique_ptr<DataType[]> a_;
+    std::unique_ptr<DataType[]> b_;
+    // number of columns in use, reserved for the current block, and allocated
+    size_t k_;
+    size_t knext_;
+    size_t kcap_;
+
+    // the packed buffers are flushed when they exceed this size (in elements)
+    static const size_t maxsize_ = 1LU << 24;
+
+    static void gemm(const int m, const int n, const int k, const double* a, const double* b, double* c) {
+      dgemm_("N", "T", m, n, k, 1.0, a, m, b, n, 1.0, c, m);
+    }
+    static void gemm(const int m, const int n, const int k, const std::complex<double>* a, const std::complex<double>* b, std::complex<double>* c) {
+      zgemm3m_("N", "T", m, n, k, 1.0, a, m, b, n, 1.0, c, m);
+    }
+
+  public:
+    GemmBatch(const int m, const int n, DataType* c) : m_(m), n_(n), c_(c), k_(0), knext_(0), kcap_(0) { }
+
+    void reserve(const int k) {
+      if (k_ != 0 && (k_+k)*(m_+n_) > maxsize_)
+        compute();
+      knext_ = k_ + k;
+      if (knext_ > kcap_) {
+        kcap_ = std::max(knext_, 2*kcap_);
+        std::unique_ptr<DataType[]> a(new DataType[m_*kcap_]);
+        std::unique_ptr<DataType[]> b(new DataType[n_*kcap_]);
+        std::copy_n(a_.get(), m_*k_, a.get());
+        std::copy_n(b_.get(), n_*k_, b.get());
+        a_ = std::move(a);
+        b_ = std::move(b);
+      }
+    }
+
+    // areas for the current block
+    DataType* a() { return a_.get() + m_*k_; }
+    DataType* b() { return b_.get() + n_*k_; }
+    void commit() { k_ = knext_; }
+
+    void compute() {
+      if (k_ == 0) return;
+      gemm(m_, n_, k_, a_.get(), b_.get(), c_);
+      k_ = knext_ = 0;
+    }
+};
+
+}
+}
+
+#endif
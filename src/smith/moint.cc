@@ -196,15 +196,20 @@ void K2ext<double>::init() {
   Tensor_<double> ext(vector<IndexRange>{aux, blocks_[0], blocks_[1]});
   ext.allocate();
 
+  // the orbitals in blocks_[1] are contiguous
+  const size_t offset1 = blocks_[1].front().offset();
+  assert(blocks_[1].back().offset() + blocks_[1].back().size() == offset1 + blocks_[1].size());
+
   // occ loop
   for (auto& i0 : blocks_[0]) {
-    shared_ptr<DFHalfDist> df_half = df->compute_half_transform(coeff_->slice(i0.offset(), i0.offset()+i0.size()))->apply_J();
+    // all the virtual blocks are transformed at once; J^-1/2 commutes with the MO transformation
+    shared_ptr<const DFFullDist> df_full = df->compute_full_transform(coeff_->slice(i0.offset(), i0.offset()+i0.size()),
+                                                                      coeff_->slice(offset1, offset1+blocks_[1].size()))->apply_J();
     // virtual loop
     for (auto& i1 : blocks_[1]) {
-      shared_ptr<DFFullDist> df_full = df_half->compute_second_transform(coeff_->slice(i1.offset(), i1.offset()+i1.size()));
-      const size_t bufsize = df_full->block(0)->size();
+      const size_t bufsize = df_full->block(0)->asize() * i0.size() * i1.size();
       unique_ptr<double[]> buf(new double[bufsize]);
-      copy_n(df_full->block(0)->data(), bufsize, buf.get());
+      copy_n(df_full->block(0)->data() + df_full->block(0)->asize() * i0.size() * (i1.offset()-offset1), bufsize, buf.get());
 
       for (auto& a : aux)
         if (a.offset() == df->block(0)->astart())
@@ -71,8 +71,7 @@ void MRCI::MRCI::solve() {
       set_rdm(jst, istate);
       s = sall_[istate]->at(jst);
       auto queue = make_sourceq(false, jst == istate);
-      while (!queue->done())
-        queue->next_compute();
+      queue->compute();
     }
   }
 
@@ -125,8 +124,7 @@ void MRCI::MRCI::solve() {
           t2 = t2all_[istate]->at(ist);
           n  = nall_[istate]->at(jst);
           auto queue = make_normq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
         }
       }
 
@@ -145,8 +143,7 @@ void MRCI::MRCI::solve() {
           t2 = t2all_[istate]->at(ist);
           r = rtmp->at(jst);
           auto queue = make_residualq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           diagonal(r, t2);
         }
       }
@@ -163,8 +160,7 @@ void MRCI::MRCI::solve() {
             t2 = m->at(ist);
             n  = rtmp->at(jst);
             auto queue = make_normq(false, jst == ist);
-            while (!queue->done())
-              queue->next_compute();
+            queue->compute();
           }
         }
       }
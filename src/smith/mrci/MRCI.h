@@ -189,10 +189,7 @@ class MRCI : public SpinFreeMethod<double> {
     void solve_gradient(const int targetJ, const int targetI, std::shared_ptr<const NacmType> nacmtype = std::make_shared<const NacmType>(), const bool nocider = false);
 
     double accumulate(std::shared_ptr<Queue> queue) {
-      double sum = 0.0;
-      while (!queue->done())
-        sum += queue->next_compute()->target();
-      return sum;
+      return queue->compute();
     }
 
 };
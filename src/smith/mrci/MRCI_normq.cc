@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> MRCI::MRCI::make_normq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto normq = make_shared<Queue>();
+  auto normq = make_shared<Queue>(info_->memory_budget());
   auto tensor967 = vector<shared_ptr<Tensor>>{n};
   auto task967 = make_shared<Task967>(tensor967, reset);
   normq->add_task(task967);
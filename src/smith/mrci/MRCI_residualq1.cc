@@ -34,7 +34,7 @@ using namespace bagel;
 using namespace bagel::SMITH;
 
 shared_ptr<Queue> MRCI::MRCI::make_residualq(const bool reset, const bool diagonal) {
-  auto out = make_shared<Queue>();
+  auto out = make_shared<Queue>(info_->memory_budget());
   auto tensor108 = vector<shared_ptr<Tensor>>{r};
   auto task108 = make_shared<Task108>(tensor108, reset);
   out->add_task(task108);
@@ -37,7 +37,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> MRCI::MRCI::make_sourceq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto sourceq = make_shared<Queue>();
+  auto sourceq = make_shared<Queue>(info_->memory_budget());
   auto tensor934 = vector<shared_ptr<Tensor>>{s};
   auto task934 = make_shared<Task934>(tensor934, reset);
   sourceq->add_task(task934);
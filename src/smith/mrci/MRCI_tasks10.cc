@@ -42,21 +42,20 @@ void Task450::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma573
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x1.size(), x0.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x7, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x7, x6)]);
-      sort_indices<2,3,0,1,0,1,1,2>(i1data, i1data_sorted, c2.size(), a1.size(), x7.size(), x6.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), c2.size(), a1.size(), x7.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -87,19 +86,18 @@ void Task452::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    gemm.reserve(x2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size());
     // tensor label: I109
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -114,23 +112,22 @@ void Task453::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -145,21 +142,20 @@ void Task454::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma5
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: I112
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, c1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, c1, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), a2.size(), c1.size(), x3.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a2.size(), c1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -174,19 +170,18 @@ void Task455::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size()*x3.size(), x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c1.size(), x3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, x2.size(), c3.size());
-    dgemm_("T", "N", a2.size()*c1.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*x3.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -201,19 +196,18 @@ void Task456::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*x3.size(), x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,2,1>(i1data, i1data_sorted, x2.size(), c3.size());
-    dgemm_("T", "N", c1.size()*a2.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*x3.size());
+    sort_indices<0,1,0,1,2,1>(i1data.get(), gemm.b(), x2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -228,21 +222,20 @@ void Task457::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(a2.size()*x3.size(), x2.size()*c1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x3.size());
+      gemm.reserve(c4.size()*c3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c3.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c1, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c1, c3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c4.size(), c1.size(), c3.size());
-      dgemm_("T", "N", a2.size()*x3.size(), x2.size()*c1.size(), c4.size()*c3.size(),
-             1.0, i0data_sorted, c4.size()*c3.size(), i1data_sorted, c4.size()*c3.size(),
-             1.0, odata_sorted, a2.size()*x3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), c1.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size(), x2.size(), c1.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -257,21 +250,20 @@ void Task458::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(a2.size()*x3.size(), x2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*c3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c4.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c1, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c1, c3)]);
-      sort_indices<3,1,0,2,0,1,-2,1>(i1data, i1data_sorted, x2.size(), c4.size(), c1.size(), c3.size());
-      dgemm_("T", "N", a2.size()*x3.size(), x2.size()*c1.size(), c4.size()*c3.size(),
-             1.0, i0data_sorted, c4.size()*c3.size(), i1data_sorted, c4.size()*c3.size(),
-             1.0, odata_sorted, a2.size()*x3.size());
+      sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), c1.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size(), x2.size(), c1.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -286,21 +278,20 @@ void Task459::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a3, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a3, c1, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a3.size(), c1.size(), x3.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a3.size(), c1.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, a3, a2)]);
-      sort_indices<1,2,0,3,0,1,-1,1>(i1data, i1data_sorted, x2.size(), c4.size(), a3.size(), a2.size());
-      dgemm_("T", "N", c1.size()*x3.size(), x2.size()*a2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+      sort_indices<0,3,1,2,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -315,21 +306,20 @@ void Task460::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c1.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, a4, c3)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, x2.size(), a2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", c1.size()*x3.size(), x2.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x2.size(), a2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -344,21 +334,20 @@ void Task461::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c4, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c4.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, a3, a2)]);
-      sort_indices<2,1,0,3,0,1,2,1>(i1data, i1data_sorted, x2.size(), c4.size(), a3.size(), a2.size());
-      dgemm_("T", "N", c1.size()*x3.size(), x2.size()*a2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+      sort_indices<0,3,2,1,0,1,2,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -373,21 +362,20 @@ void Task462::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, a4, c3)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, x2.size(), a2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", c1.size()*x3.size(), x2.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), a2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -402,21 +390,20 @@ void Task463::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x3, x2, c3)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, a4.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -431,21 +418,20 @@ void Task464::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, c1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, c1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, c1, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x3, x2, c3)]);
-      sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, a4.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), a4.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, a2, c1, x3);
 }
@@ -460,21 +446,20 @@ void Task465::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I118
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, a2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, a2, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), a2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), a2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -489,19 +474,18 @@ void Task466::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a2.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), x2.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c3.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size());
-    dgemm_("T", "N", x3.size()*a2.size()*x2.size(), c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*a2.size()*x2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -516,19 +500,18 @@ void Task467::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c1.size()*x2.size(), a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c1.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a3.size(), a2.size());
-    dgemm_("T", "N", x3.size()*c1.size()*x2.size(), a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c1.size()*x2.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x2.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -543,19 +526,18 @@ void Task468::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(a2.size()*x3.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x3.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3)]);
-    sort_indices<1,0,0,1,-2,1>(i1data, i1data_sorted, c1.size(), c3.size());
-    dgemm_("T", "N", a2.size()*x3.size()*x2.size(), c1.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a2.size()*x3.size()*x2.size());
+    sort_indices<0,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, a2.size(), x3.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -570,19 +552,18 @@ void Task469::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size()*x2.size(), a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x3, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), x3.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, a3.size(), a2.size());
-    dgemm_("T", "N", c1.size()*x3.size()*x2.size(), a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*x3.size()*x2.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), a3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -597,19 +578,18 @@ void Task470::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c1.size()*a2.size(), x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), a2.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c1.size(), a2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, a3.size(), x2.size());
-    dgemm_("T", "N", x3.size()*c1.size()*a2.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c1.size()*a2.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), a2.size(), x2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -624,19 +604,18 @@ void Task471::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a2.size()*c1.size(), x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), a3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a3.size(), x2.size());
-    dgemm_("T", "N", x3.size()*a2.size()*c1.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a2.size()*c1.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size(), c1.size(), x2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -651,21 +630,20 @@ void Task472::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c4, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c4, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c4.size(), x2.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c4.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, a3, a2)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size(), a3.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c1.size()*a2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -680,21 +658,20 @@ void Task473::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c3.size(), x2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c3.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, a4, c3)]);
-      sort_indices<2,3,0,1,0,1,-2,1>(i1data, i1data_sorted, c1.size(), a2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c1.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -709,21 +686,20 @@ void Task474::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a3, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a3.size(), x3.size(), x2.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a3.size(), x3.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, a3, a2)]);
-      sort_indices<1,2,0,3,0,1,-2,1>(i1data, i1data_sorted, c1.size(), c4.size(), a3.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c1.size()*a2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -738,21 +714,20 @@ void Task475::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), x3.size(), x2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), x3.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a2, a4, c3)]);
-      sort_indices<3,2,0,1,0,1,4,1>(i1data, i1data_sorted, c1.size(), a2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c1.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), a2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -767,21 +742,20 @@ void Task476::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a2.size());
       // tensor label: I958
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -817,21 +791,20 @@ void Task478::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I961
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, x3, x2)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -867,21 +840,20 @@ void Task480::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c4, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c4.size(), a2.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c4.size(), a2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, a3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, a3, x2)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c4.size(), a3.size(), x2.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x3.size()*x2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), a3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -896,21 +868,20 @@ void Task481::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), a3.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, a3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, a3, x2)]);
-      sort_indices<1,2,0,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), c4.size(), a3.size(), x2.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x3.size()*x2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,3,1,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), a3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -925,21 +896,20 @@ void Task482::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a2.size(), x2.size()*c1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c3.size(), a2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c3.size(), a2.size());
       // tensor label: I1006
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, c1, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, c1, c3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), c1.size(), c3.size());
-      dgemm_("T", "N", x3.size()*a2.size(), x2.size()*c1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*a2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), c1.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -975,21 +945,20 @@ void Task484::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a2.size(), x2.size()*c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I1009
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, c1, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, c1, c3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), c1.size(), c3.size());
-      dgemm_("T", "N", x3.size()*a2.size(), x2.size()*c1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*a2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), c1.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -1025,21 +994,20 @@ void Task486::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c1.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c1, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c1, a3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c1.size(), a3.size());
+      gemm.reserve(a4.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c1.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, a3, a2)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, a4.size(), x2.size(), a3.size(), a2.size());
-      dgemm_("T", "N", x3.size()*c1.size(), x2.size()*a2.size(), a4.size()*a3.size(),
-             1.0, i0data_sorted, a4.size()*a3.size(), i1data_sorted, a4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*c1.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x2.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -1054,21 +1022,20 @@ void Task487::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, a2, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, a2, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, a2, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c1.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c1, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c1, a4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c1.size(), a4.size());
+      gemm.reserve(a4.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c1.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, a3, a2)]);
-      sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, a4.size(), x2.size(), a3.size(), a2.size());
-      dgemm_("T", "N", x3.size()*c1.size(), x2.size()*a2.size(), a4.size()*a3.size(),
-             1.0, i0data_sorted, a4.size()*a3.size(), i1data_sorted, a4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*c1.size());
+      sort_indices<1,3,2,0,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), c1.size(), x2.size(), a2.size());
   out()->add_block(odata, c1, x3, a2, x2);
 }
@@ -1083,19 +1050,18 @@ void Task488::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size());
+    gemm.reserve(x2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x2.size());
     // tensor label: I130
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x2, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), a2.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1110,23 +1076,22 @@ void Task489::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a2.size());
   out()->add_block(odata, a2, x2, x1, x0);
 }
@@ -1164,21 +1129,20 @@ void Task491::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), 1, odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a2.size());
       // tensor label: h1
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,-4,1>(i1data, i1data_sorted, a4.size(), c3.size());
-      dgemm_("T", "N", c1.size()*a2.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,1,0,1,-4,1>(i1data.get(), gemm.b(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, c1, a2);
 }
@@ -1191,21 +1155,20 @@ void Task492::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), 1, odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a4.size());
       // tensor label: h1
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<1,0,0,1,8,1>(i1data, i1data_sorted, a4.size(), c3.size());
-      dgemm_("T", "N", c1.size()*a2.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<1,0,0,1,8,1>(i1data.get(), gemm.b(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, c1, a2);
 }
@@ -1218,23 +1181,22 @@ void Task493::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c5 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c5, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c5, a2)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c5.size(), a2.size());
+        gemm.reserve(c5.size()*a4.size()*c3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c5.size(), a2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c5, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c5, a4, c3)]);
-        sort_indices<3,2,1,0,0,1,-8,1>(i1data, i1data_sorted, c1.size(), c5.size(), a4.size(), c3.size());
-        dgemm_("T", "N", a2.size(), c1.size(), c5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, c5.size()*a4.size()*c3.size(), i1data_sorted, c5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,3,2,1,0,1,-8,1>(i1data.get(), gemm.b(), c1.size(), c5.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
   out()->add_block(odata, c1, a2);
 }
@@ -1247,23 +1209,22 @@ void Task494::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c5 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c5, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c5, a4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c5.size(), a4.size());
+        gemm.reserve(c5.size()*a4.size()*c3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c5.size(), a4.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c5, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c5, a4, c3)]);
-        sort_indices<3,1,2,0,0,1,4,1>(i1data, i1data_sorted, c1.size(), c5.size(), a4.size(), c3.size());
-        dgemm_("T", "N", a2.size(), c1.size(), c5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, c5.size()*a4.size()*c3.size(), i1data_sorted, c5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,3,1,2,0,1,4,1>(i1data.get(), gemm.b(), c1.size(), c5.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
   out()->add_block(odata, c1, a2);
 }
@@ -1276,23 +1237,22 @@ void Task495::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a5, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a5, c3, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a5.size(), c3.size(), a4.size());
+        gemm.reserve(a5.size()*a4.size()*c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a5.size(), c3.size(), a4.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a2, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a2, a4, c3)]);
-        sort_indices<0,3,2,1,0,1,8,1>(i1data, i1data_sorted, a5.size(), a2.size(), a4.size(), c3.size());
-        dgemm_("T", "N", c1.size(), a2.size(), a5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, a5.size()*a4.size()*c3.size(), i1data_sorted, a5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<1,0,3,2,0,1,8,1>(i1data.get(), gemm.b(), a5.size(), a2.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, c1, a2);
 }
@@ -1305,23 +1265,22 @@ void Task496::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size(), a2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a5 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, a5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, a5)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), a5.size());
+        gemm.reserve(a5.size()*a4.size()*c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), a5.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a2, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a2, a4, c3)]);
-        sort_indices<2,3,0,1,0,1,-4,1>(i1data, i1data_sorted, a5.size(), a2.size(), a4.size(), c3.size());
-        dgemm_("T", "N", c1.size(), a2.size(), a5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, a5.size()*a4.size()*c3.size(), i1data_sorted, a5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<1,2,3,0,0,1,-4,1>(i1data.get(), gemm.b(), a5.size(), a2.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size());
   out()->add_block(odata, c1, a2);
 }
@@ -1336,23 +1295,22 @@ void Task497::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, x2, c3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, x2, c3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), x2.size(), c3.size());
+        gemm.reserve(c3.size()*x3.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), x2.size(), c3.size());
         // tensor label: I840
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x3, x2, x1, x0)]);
-        sort_indices<2,3,1,0,4,5,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x3.size(), x2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), c3.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, c3.size()*x3.size()*x2.size(), i1data_sorted, c3.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,4,5,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1369,21 +1327,20 @@ void Task498::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size()*x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma107
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x5, x2, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x5, x2, x4, x1, x0)]);
-      sort_indices<1,3,0,2,4,5,0,1,1,1>(i0data, i0data_sorted, x3.size(), x5.size(), x2.size(), x4.size(), x1.size(), x0.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,2,4,5,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x5.size(), x2.size(), x4.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c3, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c3, x4)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x5.size(), c3.size(), x4.size());
-      dgemm_("T", "N", x3.size()*x2.size()*x1.size()*x0.size(), c1.size()*c3.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x3.size()*x2.size()*x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c3.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x3, x2, x1, x0);
 }
@@ -1398,23 +1355,22 @@ void Task499::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, a2, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, a2, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x4.size(), a2.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), a2.size(), x3.size(), x2.size());
         // tensor label: I843
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x4, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x4, x3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i1data, i1data_sorted, c1.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -44,23 +44,22 @@ void Task500::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x4, x3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x4, x3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x4, x3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x4.size()*x3.size()*x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma278
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x4, x5, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x4, x5, x3, x2, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,4,5,6,7,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c1, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c1, x5)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
-        dgemm_("T", "N", x4.size()*x3.size()*x2.size()*x1.size()*x0.size(), c1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x4.size()*x3.size()*x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x7.size(), x6.size(), c1.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x4.size(), x3.size(), x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x4, x3, x2, x1, x0);
 }
@@ -75,23 +74,22 @@ void Task501::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x3, x2, a2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x3, x2, a2)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x4.size(), x3.size(), x2.size(), a2.size());
+        gemm.reserve(x2.size()*x4.size()*x3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x3.size(), x2.size(), a2.size());
         // tensor label: I846
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x4, x3, x1, x0)]);
-        sort_indices<2,3,1,0,4,5,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), x2.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x2.size()*x4.size()*x3.size(), i1data_sorted, x2.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,4,5,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -108,23 +106,22 @@ void Task502::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x4, x3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x4, x3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x4, x3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x4.size()*x3.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma100
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x2, x5, x4, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,4,5,6,7,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c1, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c1, x5)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
-        dgemm_("T", "N", x2.size()*x4.size()*x3.size()*x1.size()*x0.size(), c1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x2.size()*x4.size()*x3.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x7.size(), x6.size(), c1.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x2.size(), x4.size(), x3.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x4, x3, x1, x0);
 }
@@ -139,21 +136,20 @@ void Task503::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size(), c1.size(), a2.size());
+      gemm.reserve(c3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size(), c1.size(), a2.size());
       // tensor label: I849
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), c3.size()*x2.size(),
-             1.0, i0data_sorted, c3.size()*x2.size(), i1data_sorted, c3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -168,23 +164,22 @@ void Task504::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x2, x1, x0);
 }
@@ -199,21 +194,20 @@ void Task505::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2, c1, c3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2, c1, c3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size(), c1.size(), c3.size());
+      gemm.reserve(c3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size(), c1.size(), c3.size());
       // tensor label: I852
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), x1.size()*x0.size(), c3.size()*x2.size(),
-             1.0, i0data_sorted, c3.size()*x2.size(), i1data_sorted, c3.size()*x2.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -228,23 +222,22 @@ void Task506::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x2, x1, x0);
 }
@@ -259,21 +252,20 @@ void Task507::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x5)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x5.size());
+      gemm.reserve(c3.size()*x5.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c1.size(), x5.size());
       // tensor label: I855
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x5, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), x1.size()*x0.size(), c3.size()*x5.size(),
-             1.0, i0data_sorted, c3.size()*x5.size(), i1data_sorted, c3.size()*x5.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -288,23 +280,22 @@ void Task508::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma221
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x5, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x5, x3, x2, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x4.size(), c3.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), c3.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x1, x0);
 }
@@ -319,23 +310,22 @@ void Task509::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma104
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, x2, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, x2, c3)]);
-        sort_indices<2,0,1,3,0,1,-1,2>(i1data, i1data_sorted, x4.size(), x3.size(), x2.size(), c3.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<3,2,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), x2.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x1, x0);
 }
@@ -350,21 +340,20 @@ void Task510::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x5.size());
+      gemm.reserve(c3.size()*x5.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x5.size());
       // tensor label: I858
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x5, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), c3.size()*x5.size(),
-             1.0, i0data_sorted, c3.size()*x5.size(), i1data_sorted, c3.size()*x5.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -379,23 +368,22 @@ void Task511::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma221
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x5, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x5, x3, x2, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x4.size(), c3.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x4.size(), c3.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x1, x0);
 }
@@ -410,23 +398,22 @@ void Task512::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma104
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, x2, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, x2, c3)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x4.size(), x3.size(), x2.size(), c3.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), x4.size(), x3.size(), x2.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x1, x0);
 }
@@ -441,23 +428,22 @@ void Task513::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c3, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c3, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c3.size(), x4.size());
+        gemm.reserve(c3.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c3.size(), x4.size());
         // tensor label: I885
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x5, x4, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x5, x4, x1, x0)]);
-        sort_indices<2,1,3,0,4,5,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), c3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c3.size()*x5.size()*x4.size(), i1data_sorted, c3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,4,5,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -474,21 +460,20 @@ void Task514::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma240
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I886
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x5, x4, x1, x0);
 }
@@ -526,21 +511,20 @@ void Task516::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma7
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x2, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x2, x4, x1, x0)]);
-      sort_indices<1,2,0,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,3,4,5,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, x2, c3)]);
-      sort_indices<1,2,0,3,0,1,1,2>(i1data, i1data_sorted, c1.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,2>(i1data.get(), gemm.b(), c1.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x5, x4, x1, x0);
 }
@@ -557,21 +541,20 @@ void Task517::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), c3.size()*c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma296
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x3, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x3, x4, x1, x0)]);
-      sort_indices<1,2,0,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x3.size(), x4.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,3,4,5,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x3.size(), x4.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c3, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c3, c1, x2)]);
-      sort_indices<3,0,1,2,0,1,-1,2>(i1data, i1data_sorted, x3.size(), c3.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), c3.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), c3.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<5,4,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), c3.size(), c1.size());
   out()->add_block(odata, c1, c3, x5, x4, x1, x0);
 }
@@ -586,25 +569,24 @@ void Task518::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma240
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
           // tensor label: I888
           std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3, x2, x5, c1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3, x2, x5, c1, x4)]);
-          sort_indices<3,5,1,2,0,4,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size(), x2.size(), x5.size(), c1.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<0,4,3,5,1,2,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x3.size(), x2.size(), x5.size(), c1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -621,19 +603,18 @@ void Task519::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x3, x2, x5, c1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x3, x2, x5, c1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x3, x2, x5, c1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*c1.size()*x4.size(), a2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c1, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c1.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c1.size(), x4.size());
     // tensor label: I889
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2, x3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a2.size(), x3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*c1.size()*x4.size(), a2.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*c1.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a2.size(), x3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c1.size(), x4.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, a2, x3, x2, x5, c1, x4);
 }
@@ -671,19 +652,18 @@ void Task521::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x3, x2, x5, c1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x3, x2, x5, c1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x3, x2, x5, c1, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), a2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x5.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), x5.size(), x4.size());
     // tensor label: I919
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2, x3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a2.size(), x3.size(), x2.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), a2.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a2.size(), x3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,1,0,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, a2, x3, x2, x5, c1, x4);
 }
@@ -724,25 +704,24 @@ void Task523::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma7
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x2, x4, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x2, x4, x1, x0)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x2.size(), x4.size(), x1.size(), x0.size());
           // tensor label: I894
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a2, x5, c1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a2, x5, c1, x4)]);
-          sort_indices<3,0,1,5,2,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a2.size(), x5.size(), c1.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<2,4,3,0,1,5,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), a2.size(), x5.size(), c1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -759,19 +738,18 @@ void Task524::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, a2, x5, c1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, a2, x5, c1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, a2, x5, c1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*c1.size()*x4.size(), x3.size()*x2.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c1, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c1.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c1.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, x2, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, x2, a2)]);
-    sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, a3.size(), x3.size(), x2.size(), a2.size());
-    dgemm_("T", "N", x5.size()*c1.size()*x4.size(), x3.size()*x2.size()*a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*c1.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,-1,2>(i1data.get(), gemm.b(), a3.size(), x3.size(), x2.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c1.size(), x4.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, x3, x2, a2, x5, c1, x4);
 }
@@ -786,25 +764,24 @@ void Task525::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x4 : *range_[1]) {
           // tensor label: Gamma296
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x3, x4, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x3, x4, x1, x0)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x3.size(), x4.size(), x1.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x3.size(), x4.size(), x1.size(), x0.size());
           // tensor label: I900
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, x2, x5, c1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, x2, x5, c1, x4)]);
-          sort_indices<3,2,0,5,1,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), x2.size(), x5.size(), c1.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<1,4,3,2,0,5,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), x2.size(), x5.size(), c1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -821,19 +798,18 @@ void Task526::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2, x2, x5, c1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2, x2, x5, c1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2, x2, x5, c1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*c1.size()*x4.size(), x3.size()*a2.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c1, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c1.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c1.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x3.size(), a2.size(), a3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*c1.size()*x4.size(), x3.size()*a2.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*c1.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), a2.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c1.size(), x4.size(), x3.size(), a2.size(), x2.size());
   out()->add_block(odata, x3, a2, x2, x5, c1, x4);
 }
@@ -848,23 +824,22 @@ void Task527::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x5, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x5.size(), x4.size());
+        gemm.reserve(c3.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x5.size(), x4.size());
         // tensor label: I915
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x5, x4, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x5, x4, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), c3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c3.size()*x5.size()*x4.size(), i1data_sorted, c3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -881,21 +856,20 @@ void Task528::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma240
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I916
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x5, x4, x1, x0);
 }
@@ -938,21 +912,20 @@ void Task530::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma4
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-      sort_indices<2,3,0,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, x2, c3)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, c1.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), c1.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x5, x4, x1, x0);
 }
@@ -967,25 +940,24 @@ void Task531::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         for (auto& x3 : *range_[1]) {
           // tensor label: Gamma4
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
           // tensor label: I924
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a2, c1, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a2, c1, x5, x4)]);
-          sort_indices<4,5,1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a2.size(), c1.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<2,3,4,5,1,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), a2.size(), c1.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1002,19 +974,18 @@ void Task532::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, a2, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, a2, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, a2, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), x3.size()*x2.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x5.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), x5.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, x2, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, x2, a2)]);
-    sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, a3.size(), x3.size(), x2.size(), a2.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size()*x2.size()*a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,2>(i1data.get(), gemm.b(), a3.size(), x3.size(), x2.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, x3, x2, a2, c1, x5, x4);
 }
@@ -1029,23 +1000,22 @@ void Task533::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), c1.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a2, x6, x5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a2, x6, x5)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x7.size(), a2.size(), x6.size(), x5.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a2.size(), x6.size(), x5.size());
         // tensor label: I945
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x7, x6, x5, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x7, x6, x5, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i1data, i1data_sorted, c1.size(), x7.size(), x6.size(), x5.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a2.size(), c1.size()*x1.size()*x0.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, a2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x7.size(), x6.size(), x5.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1062,23 +1032,22 @@ void Task534::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x7, x6, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x7, x6, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x7, x6, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x5.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma312
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x4, x6, x5, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x4, x6, x5, x3, x2, x1, x0)]);
-        sort_indices<1,4,5,0,2,3,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x4.size(), x6.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,2,3,6,7,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x4.size(), x6.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,-1,2>(i1data, i1data_sorted, c1.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x7.size()*x6.size()*x5.size()*x1.size()*x0.size(), c1.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x6.size()*x5.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,-1,2>(i1data.get(), gemm.b(), c1.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x7, x6, x5, x1, x0);
 }
@@ -1095,23 +1064,22 @@ void Task535::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x7, x6, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x7, x6, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x7, x6, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x5.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma313
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x2, x6, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x2, x6, x5, x4, x3, x1, x0)]);
-        sort_indices<1,4,5,0,2,3,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x2.size(), x6.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,2,3,6,7,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x2.size(), x6.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, c1, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, c1, x2)]);
-        sort_indices<3,0,1,2,0,1,-1,2>(i1data, i1data_sorted, x4.size(), x3.size(), c1.size(), x2.size());
-        dgemm_("T", "N", x7.size()*x6.size()*x5.size()*x1.size()*x0.size(), c1.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x6.size()*x5.size()*x1.size()*x0.size());
+        sort_indices<2,3,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), c1.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x7, x6, x5, x1, x0);
 }
@@ -1126,21 +1094,20 @@ void Task536::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size(), c1.size(), a2.size());
+      gemm.reserve(a3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size(), c1.size(), a2.size());
       // tensor label: I951
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), a3.size()*x2.size(),
-             1.0, i0data_sorted, a3.size()*x2.size(), i1data_sorted, a3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1155,23 +1122,22 @@ void Task537::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,2,1>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,2,1>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x2, x1, x0);
 }
@@ -1186,21 +1152,20 @@ void Task538::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2, a3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2, a3, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size(), a3.size(), a2.size());
+      gemm.reserve(a3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x2.size(), a3.size(), a2.size());
       // tensor label: I954
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), a3.size()*x2.size(),
-             1.0, i0data_sorted, a3.size()*x2.size(), i1data_sorted, a3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1215,23 +1180,22 @@ void Task539::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x2, x1, x0);
 }
@@ -1246,21 +1210,20 @@ void Task540::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c1.size(), a2.size());
+      gemm.reserve(a3.size()*x5.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c1.size(), a2.size());
       // tensor label: I993
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x5, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), a3.size()*x5.size(),
-             1.0, i0data_sorted, a3.size()*x5.size(), i1data_sorted, a3.size()*x5.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1275,23 +1238,22 @@ void Task541::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma240
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x1, x0);
 }
@@ -1306,23 +1268,22 @@ void Task542::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, a3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, a3, x2)]);
-        sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x4.size(), x3.size(), a3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), x4.size(), x3.size(), a3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x1, x0);
 }
@@ -1337,21 +1298,20 @@ void Task543::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, a3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), a3.size());
+      gemm.reserve(a3.size()*x5.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c1.size(), a3.size());
       // tensor label: I996
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x5, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), x1.size()*x0.size(), a3.size()*x5.size(),
-             1.0, i0data_sorted, a3.size()*x5.size(), i1data_sorted, a3.size()*x5.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1366,23 +1326,22 @@ void Task544::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma240
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,-1,2>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,-1,2>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x1, x0);
 }
@@ -1397,23 +1356,22 @@ void Task545::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, a3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, a3, x2)]);
-        sort_indices<3,0,1,2,0,1,-1,2>(i1data, i1data_sorted, x4.size(), x3.size(), a3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<2,3,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), a3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x1, x0);
 }
@@ -1428,25 +1386,24 @@ void Task546::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma338
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x4, x2, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x4, x2, x1, x0)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x4.size(), x2.size(), x1.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x4.size(), x2.size(), x1.size(), x0.size());
           // tensor label: I1023
           std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, x2, x5, a2, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, x2, x5, a2, x4)]);
-          sort_indices<3,1,5,2,0,4,0,1,1,1>(i1data, i1data_sorted, c1.size(), x3.size(), x2.size(), x5.size(), a2.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), c1.size()*a2.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<0,4,3,1,5,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), x2.size(), x5.size(), a2.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), a2.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -1463,19 +1420,18 @@ void Task547::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x3, x2, x5, a2, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x3, x2, x5, a2, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x3, x2, x5, a2, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a2.size()*x4.size(), c1.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), x4.size(), a3.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x3.size(), a3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*a2.size()*x4.size(), c1.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a2.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a2.size(), x4.size(), c1.size(), x3.size(), x2.size());
   out()->add_block(odata, c1, x3, x2, x5, a2, x4);
 }
@@ -1490,21 +1446,20 @@ void Task548::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma569
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x0.size());
       // tensor label: I1717
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, c1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), c1.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
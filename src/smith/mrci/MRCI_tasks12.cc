@@ -42,21 +42,20 @@ void Task550::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma573
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x1.size(), x0.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x1.size(), x0.size());
       // tensor label: I1725
       std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a2, c1, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a2, c1, x6)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x7.size(), a2.size(), c1.size(), x6.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x7.size(), a2.size(), c1.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, a2);
 }
@@ -108,23 +107,22 @@ void Task553::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma48
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x3, x4, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x3, x4, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x5.size()*x4.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
         // tensor label: I145
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x5, a1, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x5, a1, x4)]);
-        sort_indices<1,0,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x5.size(), a1.size(), x4.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, x3.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<2,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x5.size(), a1.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -139,19 +137,18 @@ void Task554::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x5, a1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, a1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, a1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size()*x4.size(), x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c2.size(), x4.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size());
-    dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, x5, a1, x4);
 }
@@ -166,21 +163,20 @@ void Task555::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x5, a1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, a1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, a1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x3.size()*a1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c3, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c3, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c3.size(), x4.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c3.size(), x4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c3, a2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c3, a2, a1)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c3.size(), a2.size(), a1.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x3.size()*a1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c3.size(), a2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, x3, x5, a1, x4);
 }
@@ -195,21 +191,20 @@ void Task556::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x5, a1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x5, a1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x5, a1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c2.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, c2)]);
-      sort_indices<3,0,1,2,0,1,1,2>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), c2.size());
-      dgemm_("T", "N", x5.size()*a1.size(), x4.size()*x3.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*a1.size());
+      sort_indices<1,2,3,0,0,1,1,2>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, x5, a1, x4);
 }
@@ -224,23 +219,22 @@ void Task557::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma49
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x5.size()*x4.size());
+        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I148
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x5, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x5, x4)]);
-        sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x5.size(), x4.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, x3.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x5.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -255,19 +249,18 @@ void Task558::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x5, x4), 0.0);
+  GemmBatch<double> gemm(a1.size()*x5.size()*x4.size(), x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+    gemm.reserve(c2.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x5.size(), x4.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, x3.size(), c2.size());
-    dgemm_("T", "N", a1.size()*x5.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, a1.size()*x5.size()*x4.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), c2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, a1, x5, x4);
 }
@@ -282,21 +275,20 @@ void Task559::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x5, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x3.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), x4.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), x4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, a3, c2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a1.size(), a3.size(), c2.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x3.size()*a1.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), a3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, x3, a1, x5, x4);
 }
@@ -311,21 +303,20 @@ void Task560::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x5, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x3.size()*a1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x5.size(), x4.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x5.size(), x4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c3, a2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c3, a2, a1)]);
-      sort_indices<1,2,0,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), c3.size(), a2.size(), a1.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x3.size()*a1.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<0,3,1,2,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), c3.size(), a2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, x3, a1, x5, x4);
 }
@@ -340,21 +331,20 @@ void Task561::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x5, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x3.size()*a1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x5.size(), x4.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x5.size(), x4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, a3, c2)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), a3.size(), c2.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x3.size()*a1.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), a3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, x3, a1, x5, x4);
 }
@@ -369,21 +359,20 @@ void Task562::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x5, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), a1.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, c2)]);
-      sort_indices<0,3,1,2,0,1,-1,2>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), c2.size());
-      dgemm_("T", "N", x5.size()*a1.size(), x4.size()*x3.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,-1,2>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, a1, x5, x4);
 }
@@ -398,23 +387,22 @@ void Task563::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: I151
         std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -429,19 +417,18 @@ void Task564::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), a1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), x4.size(), x3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), a1.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), a1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -456,19 +443,18 @@ void Task565::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size()*x4.size(), x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, a2.size(), x3.size());
-    dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), a2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -483,21 +469,20 @@ void Task566::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), a1.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), a1.size());
       // tensor label: I1075
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x4, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x4, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x4.size(), x3.size());
-      dgemm_("T", "N", x5.size()*a1.size(), x4.size()*x3.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x4.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -533,21 +518,20 @@ void Task568::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I1078
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x4, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x4, x3)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x4.size(), x3.size());
-      dgemm_("T", "N", x5.size()*a1.size(), x4.size()*x3.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*a1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x4.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -583,21 +567,20 @@ void Task570::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a2 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c3, a2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c3.size(), a2.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c3.size(), a2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, a2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, a2, x3)]);
-      sort_indices<1,2,0,3,0,1,-1,2>(i1data, i1data_sorted, x4.size(), c3.size(), a2.size(), x3.size());
-      dgemm_("T", "N", x5.size()*a1.size(), x4.size()*x3.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x5.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), c3.size(), a2.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -612,21 +595,20 @@ void Task571::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x3.size()*a1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, x4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, x4, a3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), x4.size(), a3.size());
+      gemm.reserve(a3.size()*a2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), x4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, a2, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, a2, a1)]);
-      sort_indices<2,0,1,3,0,1,2,1>(i1data, i1data_sorted, a3.size(), x3.size(), a2.size(), a1.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x3.size()*a1.size(), a3.size()*a2.size(),
-             1.0, i0data_sorted, a3.size()*a2.size(), i1data_sorted, a3.size()*a2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<1,3,2,0,0,1,2,1>(i1data.get(), gemm.b(), a3.size(), x3.size(), a2.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x3);
 }
@@ -641,19 +623,18 @@ void Task572::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma51
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
     // tensor label: I154
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size());
-    dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -666,21 +647,20 @@ void Task573::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), 1, odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a1.size());
       // tensor label: h1
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a3.size(), c2.size());
-      dgemm_("T", "N", x3.size()*a1.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), a3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, x3, a1);
 }
@@ -693,21 +673,20 @@ void Task574::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), 1, odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a3.size());
       // tensor label: h1
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2)]);
-      sort_indices<1,0,0,1,2,1>(i1data, i1data_sorted, a3.size(), c2.size());
-      dgemm_("T", "N", x3.size()*a1.size(), 1, a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), a3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, x3, a1);
 }
@@ -720,23 +699,22 @@ void Task575::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       for (auto& c4 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, a1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
+        gemm.reserve(c4.size()*a3.size()*c2.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), a1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, a3, c2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, a3, c2)]);
-        sort_indices<3,2,1,0,0,1,-4,1>(i1data, i1data_sorted, x3.size(), c4.size(), a3.size(), c2.size());
-        dgemm_("T", "N", a1.size(), x3.size(), c4.size()*a3.size()*c2.size(),
-               1.0, i0data_sorted, c4.size()*a3.size()*c2.size(), i1data_sorted, c4.size()*a3.size()*c2.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,3,2,1,0,1,-4,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), a3.size(), c2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x3.size());
   out()->add_block(odata, x3, a1);
 }
@@ -749,23 +727,22 @@ void Task576::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& c4 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, a3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a3.size());
+        gemm.reserve(c4.size()*a3.size()*c2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), a3.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, a3, c2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, a3, c2)]);
-        sort_indices<3,1,2,0,0,1,2,1>(i1data, i1data_sorted, x3.size(), c4.size(), a3.size(), c2.size());
-        dgemm_("T", "N", a1.size(), x3.size(), c4.size()*a3.size()*c2.size(),
-               1.0, i0data_sorted, c4.size()*a3.size()*c2.size(), i1data_sorted, c4.size()*a3.size()*c2.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,3,1,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), a3.size(), c2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), x3.size());
   out()->add_block(odata, x3, a1);
 }
@@ -778,23 +755,22 @@ void Task577::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a3 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c2, a3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c2, a3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c2.size(), a3.size());
+        gemm.reserve(a4.size()*a3.size()*c2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c2.size(), a3.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, a3, c2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, a3, c2)]);
-        sort_indices<0,3,2,1,0,1,2,1>(i1data, i1data_sorted, a4.size(), a1.size(), a3.size(), c2.size());
-        dgemm_("T", "N", x3.size(), a1.size(), a4.size()*a3.size()*c2.size(),
-               1.0, i0data_sorted, a4.size()*a3.size()*c2.size(), i1data_sorted, a4.size()*a3.size()*c2.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,0,3,2,0,1,2,1>(i1data.get(), gemm.b(), a4.size(), a1.size(), a3.size(), c2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, x3, a1);
 }
@@ -807,23 +783,22 @@ void Task578::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1), 0.0);
+  GemmBatch<double> gemm(x3.size(), a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a4.size());
+        gemm.reserve(a4.size()*a3.size()*c2.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a4.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, a3, c2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, a3, c2)]);
-        sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, a4.size(), a1.size(), a3.size(), c2.size());
-        dgemm_("T", "N", x3.size(), a1.size(), a4.size()*a3.size()*c2.size(),
-               1.0, i0data_sorted, a4.size()*a3.size()*c2.size(), i1data_sorted, a4.size()*a3.size()*c2.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), a1.size(), a3.size(), c2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size());
   out()->add_block(odata, x3, a1);
 }
@@ -838,23 +813,22 @@ void Task579::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& c2 : *range_[0]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, a1, x3, c2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, a1, x3, c2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x4.size(), a1.size(), x3.size(), c2.size());
+        gemm.reserve(c2.size()*x3.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), a1.size(), x3.size(), c2.size());
         // tensor label: I1026
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x4, x0, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x4, x0, x2, x1)]);
-        sort_indices<2,1,0,3,4,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x4.size(), x0.size(), x2.size(), x1.size());
-        dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), c2.size()*x3.size()*x4.size(),
-               1.0, i0data_sorted, c2.size()*x3.size()*x4.size(), i1data_sorted, c2.size()*x3.size()*x4.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<3,4,5,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x4.size(), x0.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -871,23 +845,22 @@ void Task580::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, x4, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, x4, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, x4, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x3.size()*x4.size()*x0.size()*x2.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma339
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x3, x5, x4, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x3, x5, x4, x0, x2, x1)]);
-        sort_indices<0,1,3,2,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x3.size(), x5.size(), x4.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,4,5,6,7,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x3.size(), x5.size(), x4.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c2, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c2, x5)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x7.size(), x6.size(), c2.size(), x5.size());
-        dgemm_("T", "N", x3.size()*x4.size()*x0.size()*x2.size()*x1.size(), c2.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x3.size()*x4.size()*x0.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x7.size(), x6.size(), c2.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x3.size(), x4.size(), x0.size(), x2.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x3, x4, x0, x2, x1);
 }
@@ -902,23 +875,22 @@ void Task581::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma340
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x5, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x5, x3, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x4.size(), x5.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x4.size()*x3.size()*x5.size());
+        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x5.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I1029
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, a1, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, a1, x5)]);
-        sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x4.size(), x3.size(), a1.size(), x5.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x4.size()*x3.size()*x5.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x5.size(), i1data_sorted, x4.size()*x3.size()*x5.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<2,0,3,1,0,1,1,1>(i1data.get(), gemm.b(), x4.size(), x3.size(), a1.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -933,21 +905,20 @@ void Task582::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, x3, a1, x5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, x3, a1, x5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, x3, a1, x5), 0.0);
+  GemmBatch<double> gemm(a1.size()*x5.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, x5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, x5)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), x5.size());
+      gemm.reserve(c3.size()*c2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), x5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, x3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, x3, c2)]);
-      sort_indices<3,1,0,2,0,1,-1,1>(i1data, i1data_sorted, x4.size(), c3.size(), x3.size(), c2.size());
-      dgemm_("T", "N", a1.size()*x5.size(), x4.size()*x3.size(), c3.size()*c2.size(),
-             1.0, i0data_sorted, c3.size()*c2.size(), i1data_sorted, c3.size()*c2.size(),
-             1.0, odata_sorted, a1.size()*x5.size());
+      sort_indices<0,2,3,1,0,1,-1,1>(i1data.get(), gemm.b(), x4.size(), c3.size(), x3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a1.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x4, x3, a1, x5);
 }
@@ -962,23 +933,22 @@ void Task583::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& c2 : *range_[0]) {
       for (auto& x6 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, c2, x6);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a1, c2, x6)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x7.size(), a1.size(), c2.size(), x6.size());
+        gemm.reserve(c2.size()*x7.size()*x6.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a1.size(), c2.size(), x6.size());
         // tensor label: I1032
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x7, x0, x6, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x7, x0, x6, x2, x1)]);
-        sort_indices<1,0,3,2,4,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), x7.size(), x0.size(), x6.size(), x2.size(), x1.size());
-        dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), c2.size()*x7.size()*x6.size(),
-               1.0, i0data_sorted, c2.size()*x7.size()*x6.size(), i1data_sorted, c2.size()*x7.size()*x6.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<2,4,5,1,0,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x7.size(), x0.size(), x6.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -995,23 +965,22 @@ void Task584::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x0, x6, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x0, x6, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x0, x6, x2, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x0.size()*x6.size()*x2.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma341
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x5, x6, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x5, x6, x4, x3, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x5.size(), x6.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<0,1,3,6,7,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x5.size(), x6.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, c2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, c2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x5.size(), c2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x7.size()*x0.size()*x6.size()*x2.size()*x1.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x7.size()*x0.size()*x6.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), c2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x0.size(), x6.size(), x2.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x0, x6, x2, x1);
 }
@@ -1028,23 +997,22 @@ void Task585::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x0, x6, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x0, x6, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x0, x6, x2, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x0.size()*x6.size()*x2.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma342
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x3, x6, x5, x4, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x3, x6, x5, x4, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x3.size(), x6.size(), x5.size(), x4.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<0,1,3,6,7,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x3.size(), x6.size(), x5.size(), x4.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x3, c2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x3, c2)]);
-        sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), x3.size(), c2.size());
-        dgemm_("T", "N", x7.size()*x0.size()*x6.size()*x2.size()*x1.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x7.size()*x0.size()*x6.size()*x2.size()*x1.size());
+        sort_indices<3,2,0,1,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), x3.size(), c2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x0.size(), x6.size(), x2.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x0, x6, x2, x1);
 }
@@ -1059,23 +1027,22 @@ void Task586::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& x7 : *range_[1]) {
       for (auto& x6 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x7, x6);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x7, x6)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x7.size(), x6.size());
+        gemm.reserve(c2.size()*x7.size()*x6.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x7.size(), x6.size());
         // tensor label: I1044
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x7, x6, x0, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x7, x6, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), x7.size(), x6.size(), x0.size(), x2.size(), x1.size());
-        dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), c2.size()*x7.size()*x6.size(),
-               1.0, i0data_sorted, c2.size()*x7.size()*x6.size(), i1data_sorted, c2.size()*x7.size()*x6.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<3,4,5,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x7.size(), x6.size(), x0.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -1092,23 +1059,22 @@ void Task587::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x6, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x6, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x6, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x0.size()*x2.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma345
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x5, x0, x4, x3, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<0,1,3,6,7,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, c2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, c2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x5.size(), c2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x7.size()*x6.size()*x0.size()*x2.size()*x1.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x7.size()*x6.size()*x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), c2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x0.size(), x2.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x6, x0, x2, x1);
 }
@@ -1125,23 +1091,22 @@ void Task588::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x6, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x6, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x6, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x0.size()*x2.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma346
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x5, x4, x3, x0, x2, x1)]);
-        sort_indices<2,3,4,0,1,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<0,1,5,6,7,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x3, c2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x3, c2)]);
-        sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, x5.size(), x4.size(), x3.size(), c2.size());
-        dgemm_("T", "N", x7.size()*x6.size()*x0.size()*x2.size()*x1.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x7.size()*x6.size()*x0.size()*x2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), x3.size(), c2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x0.size(), x2.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x6, x0, x2, x1);
 }
@@ -1156,6 +1121,7 @@ void Task589::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
@@ -1163,20 +1129,18 @@ void Task589::Task_local::compute() {
           for (auto& x3 : *range_[1]) {
             // tensor label: Gamma349
             std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x4, x3, x2, x1);
-            std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x4, x3, x2, x1)]);
-            sort_indices<0,2,3,4,5,1,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
+            gemm.reserve(x4.size()*x3.size()*x7.size()*x6.size()*x5.size());
+            sort_indices<1,6,7,0,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
             // tensor label: I1056
             std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x4, x3, x7, x6, x5);
-            std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x4, x3, x7, x6, x5)]);
-            sort_indices<3,4,5,1,2,0,0,1,1,1>(i1data, i1data_sorted, a1.size(), x4.size(), x3.size(), x7.size(), x6.size(), x5.size());
-            dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x4.size()*x3.size()*x7.size()*x6.size()*x5.size(),
-                   1.0, i0data_sorted, x4.size()*x3.size()*x7.size()*x6.size()*x5.size(), i1data_sorted, x4.size()*x3.size()*x7.size()*x6.size()*x5.size(),
-                   1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+            sort_indices<0,3,4,5,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x4.size(), x3.size(), x7.size(), x6.size(), x5.size());
+            gemm.commit();
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -1193,19 +1157,18 @@ void Task590::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x4, x3, x7, x6, x5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x4, x3, x7, x6, x5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x4, x3, x7, x6, x5), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x5.size(), a1.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a2, x6, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a2, x6, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), a2.size(), x6.size(), x5.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a2.size(), x6.size(), x5.size());
     // tensor label: I1057
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, a1, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, a1, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), a1.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x7.size()*x6.size()*x5.size(), a1.size()*x4.size()*x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x7.size()*x6.size()*x5.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), a1.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, a1, x4, x3, x7, x6, x5);
 }
@@ -1243,19 +1206,18 @@ void Task592::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x4, x3, x7, x6, x5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x4, x3, x7, x6, x5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x4, x3, x7, x6, x5), 0.0);
+  GemmBatch<double> gemm(x7.size()*a1.size()*x6.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, x6, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a1, x6, a2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x7.size(), a1.size(), x6.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a1.size(), x6.size(), a2.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x5, x4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x5, x4, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), x5.size(), x4.size(), x3.size());
-    dgemm_("T", "N", x7.size()*a1.size()*x6.size(), x5.size()*x4.size()*x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x7.size()*a1.size()*x6.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x5.size(), x4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,4,5,0,2,3,1,1,1,1>(odata_sorted, odata, x7.size(), a1.size(), x6.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, a1, x4, x3, x7, x6, x5);
 }
@@ -1270,6 +1232,7 @@ void Task593::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x6 : *range_[1]) {
@@ -1277,20 +1240,18 @@ void Task593::Task_local::compute() {
           for (auto& x3 : *range_[1]) {
             // tensor label: Gamma350
             std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x4, x6, x5, x3, x0, x2, x1);
-            std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x4, x6, x5, x3, x0, x2, x1)]);
-            sort_indices<0,1,2,3,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x4.size(), x6.size(), x5.size(), x3.size(), x0.size(), x2.size(), x1.size());
+            gemm.reserve(x4.size()*x3.size()*x7.size()*x6.size()*x5.size());
+            sort_indices<5,6,7,0,1,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x4.size(), x6.size(), x5.size(), x3.size(), x0.size(), x2.size(), x1.size());
             // tensor label: I1059
             std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, a1, x7, x6, x5);
-            std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, a1, x7, x6, x5)]);
-            sort_indices<3,0,4,5,1,2,0,1,1,1>(i1data, i1data_sorted, x4.size(), x3.size(), a1.size(), x7.size(), x6.size(), x5.size());
-            dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x4.size()*x3.size()*x7.size()*x6.size()*x5.size(),
-                   1.0, i0data_sorted, x4.size()*x3.size()*x7.size()*x6.size()*x5.size(), i1data_sorted, x4.size()*x3.size()*x7.size()*x6.size()*x5.size(),
-                   1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+            sort_indices<2,3,0,4,5,1,0,1,1,1>(i1data.get(), gemm.b(), x4.size(), x3.size(), a1.size(), x7.size(), x6.size(), x5.size());
+            gemm.commit();
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -1307,19 +1268,18 @@ void Task594::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, x3, a1, x7, x6, x5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, x3, a1, x7, x6, x5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, x3, a1, x7, x6, x5), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x5.size(), x4.size()*x3.size()*a1.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a2, x6, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a2, x6, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), a2.size(), x6.size(), x5.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a2.size(), x6.size(), x5.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x4, x3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x4, x3, a1)]);
-    sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, a2.size(), x4.size(), x3.size(), a1.size());
-    dgemm_("T", "N", x7.size()*x6.size()*x5.size(), x4.size()*x3.size()*a1.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x7.size()*x6.size()*x5.size());
+    sort_indices<1,2,3,0,0,1,1,2>(i1data.get(), gemm.b(), a2.size(), x4.size(), x3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), x4.size(), x3.size(), a1.size());
   out()->add_block(odata, x4, x3, a1, x7, x6, x5);
 }
@@ -1334,6 +1294,7 @@ void Task595::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x6 : *range_[1]) {
@@ -1341,20 +1302,18 @@ void Task595::Task_local::compute() {
           for (auto& x4 : *range_[1]) {
             // tensor label: Gamma351
             std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x3, x6, x5, x4, x0, x2, x1);
-            std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x3, x6, x5, x4, x0, x2, x1)]);
-            sort_indices<0,1,2,3,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x3.size(), x6.size(), x5.size(), x4.size(), x0.size(), x2.size(), x1.size());
+            gemm.reserve(x4.size()*x3.size()*x7.size()*x6.size()*x5.size());
+            sort_indices<5,6,7,0,1,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x3.size(), x6.size(), x5.size(), x4.size(), x0.size(), x2.size(), x1.size());
             // tensor label: I1062
             std::unique_ptr<double[]> i1data = in(1)->get_block(x4, a1, x3, x7, x6, x5);
-            std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, a1, x3, x7, x6, x5)]);
-            sort_indices<3,2,4,5,0,1,0,1,1,1>(i1data, i1data_sorted, x4.size(), a1.size(), x3.size(), x7.size(), x6.size(), x5.size());
-            dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x4.size()*x3.size()*x7.size()*x6.size()*x5.size(),
-                   1.0, i0data_sorted, x4.size()*x3.size()*x7.size()*x6.size()*x5.size(), i1data_sorted, x4.size()*x3.size()*x7.size()*x6.size()*x5.size(),
-                   1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+            sort_indices<1,3,2,4,5,0,0,1,1,1>(i1data.get(), gemm.b(), x4.size(), a1.size(), x3.size(), x7.size(), x6.size(), x5.size());
+            gemm.commit();
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -1371,19 +1330,18 @@ void Task596::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, a1, x3, x7, x6, x5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, a1, x3, x7, x6, x5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, a1, x3, x7, x6, x5), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x5.size(), x4.size()*a1.size()*x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a2, x6, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a2, x6, x5)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), a2.size(), x6.size(), x5.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a2.size(), x6.size(), x5.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x4, a1, a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, a1, a2, x3)]);
-    sort_indices<2,0,1,3,0,1,-1,2>(i1data, i1data_sorted, x4.size(), a1.size(), a2.size(), x3.size());
-    dgemm_("T", "N", x7.size()*x6.size()*x5.size(), x4.size()*a1.size()*x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x7.size()*x6.size()*x5.size());
+    sort_indices<0,1,3,2,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), a1.size(), a2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x5.size(), x4.size(), a1.size(), x3.size());
   out()->add_block(odata, x4, a1, x3, x7, x6, x5);
 }
@@ -1398,23 +1356,22 @@ void Task597::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma359
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x4, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x4, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x4.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x4.size()*x3.size()*x5.size());
+        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x4.size(), x0.size(), x2.size(), x1.size());
         // tensor label: I1086
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, x5, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, x5, a1)]);
-        sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x4.size(), x3.size(), x5.size(), a1.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x4.size()*x3.size()*x5.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x5.size(), i1data_sorted, x4.size()*x3.size()*x5.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<3,2,1,0,0,1,1,1>(i1data.get(), gemm.b(), x4.size(), x3.size(), x5.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -1429,21 +1386,20 @@ void Task598::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x4, x3, x5, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x4, x3, x5, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x4, x3, x5, a1), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c3.size(), a1.size());
+      gemm.reserve(c3.size()*a2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c3.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, a2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, a2, x3)]);
-      sort_indices<2,1,0,3,0,1,1,2>(i1data, i1data_sorted, x4.size(), c3.size(), a2.size(), x3.size());
-      dgemm_("T", "N", x5.size()*a1.size(), x4.size()*x3.size(), c3.size()*a2.size(),
-             1.0, i0data_sorted, c3.size()*a2.size(), i1data_sorted, c3.size()*a2.size(),
-             1.0, odata_sorted, x5.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), c3.size(), a2.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size());
   out()->add_block(odata, x4, x3, x5, a1);
 }
@@ -1458,6 +1414,7 @@ void Task599::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
@@ -1465,20 +1422,18 @@ void Task599::Task_local::compute() {
           for (auto& x4 : *range_[1]) {
             // tensor label: Gamma366
             std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x3, x5, x4, x2, x1);
-            std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x3, x5, x4, x2, x1)]);
-            sort_indices<0,2,3,4,5,1,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x3.size(), x5.size(), x4.size(), x2.size(), x1.size());
+            gemm.reserve(x5.size()*x4.size()*x3.size()*x7.size()*x6.size());
+            sort_indices<1,6,7,0,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x3.size(), x5.size(), x4.size(), x2.size(), x1.size());
             // tensor label: I1107
             std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x3, x7, a1, x6);
-            std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x3, x7, a1, x6)]);
-            sort_indices<3,5,2,0,1,4,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x3.size(), x7.size(), a1.size(), x6.size());
-            dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size()*x7.size()*x6.size(),
-                   1.0, i0data_sorted, x5.size()*x4.size()*x3.size()*x7.size()*x6.size(), i1data_sorted, x5.size()*x4.size()*x3.size()*x7.size()*x6.size(),
-                   1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+            sort_indices<4,3,5,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x3.size(), x7.size(), a1.size(), x6.size());
+            gemm.commit();
           }
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
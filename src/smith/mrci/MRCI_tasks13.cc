@@ -44,19 +44,18 @@ void Task600::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x5, x4, x3, x7, a1, x6), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x5, x4, x3, x7, a1, x6)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x5, x4, x3, x7, a1, x6), 0.0);
+  GemmBatch<double> gemm(x7.size()*a1.size()*x6.size(), x5.size()*x4.size()*x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, x6, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a1, x6, a2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x7.size(), a1.size(), x6.size(), a2.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a1.size(), x6.size(), a2.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, a2, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), a2.size(), x3.size());
-    dgemm_("T", "N", x7.size()*a1.size()*x6.size(), x5.size()*x4.size()*x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, x7.size()*a1.size()*x6.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), a2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x7.size(), a1.size(), x6.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x5, x4, x3, x7, a1, x6);
 }
@@ -71,23 +70,22 @@ void Task601::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma556
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, x6, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, x6, x5)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x7.size(), a1.size(), x6.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -102,23 +100,22 @@ void Task602::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x9 : *range_[1]) {
     for (auto& x8 : *range_[1]) {
       for (auto& x7 : *range_[1]) {
         // tensor label: Gamma557
         std::unique_ptr<double[]> i0data = in(0)->get_block(x9, x0, x8, x7, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x9, x0, x8, x7, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x9.size(), x0.size(), x8.size(), x7.size(), x2.size(), x1.size());
+        gemm.reserve(x9.size()*x8.size()*x7.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x9.size(), x0.size(), x8.size(), x7.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x9, a1, x8, x7);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x9, a1, x8, x7)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x9.size(), a1.size(), x8.size(), x7.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x9.size()*x8.size()*x7.size(),
-               1.0, i0data_sorted, x9.size()*x8.size()*x7.size(), i1data_sorted, x9.size()*x8.size()*x7.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x9.size(), a1.size(), x8.size(), x7.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -154,19 +151,18 @@ void Task604::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size()*c3.size(), a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x1.size());
     // tensor label: I163
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), x1.size());
-    dgemm_("T", "N", c1.size()*a4.size()*c3.size(), a2.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*a4.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -179,19 +175,18 @@ void Task605::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a2)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, x0.size(), a2.size());
-    dgemm_("T", "N", x1.size(), a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a2.size());
   out()->add_block(odata, a2, x1);
 }
@@ -206,19 +201,18 @@ void Task606::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x1.size());
     // tensor label: I166
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x1.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), a4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -231,19 +225,18 @@ void Task607::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, a4)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, x0.size(), a4.size());
-    dgemm_("T", "N", x1.size(), a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), a4.size());
   out()->add_block(odata, a4, x1);
 }
@@ -281,21 +274,20 @@ void Task609::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I170
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a4.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size());
   out()->add_block(odata, a4, c1);
 }
@@ -354,21 +346,20 @@ void Task612::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I173
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a2.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size());
   out()->add_block(odata, a2, c1);
 }
@@ -404,19 +395,18 @@ void Task614::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size()*a2.size(), c3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c5, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c5, a2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c5.size(), a2.size());
+    gemm.reserve(c5.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c5.size(), a2.size());
     // tensor label: I181
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c5)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), c5.size());
-    dgemm_("T", "N", c1.size()*a4.size()*a2.size(), c3.size(), c5.size(),
-           1.0, i0data_sorted, c5.size(), i1data_sorted, c5.size(),
-           1.0, odata_sorted, c1.size()*a4.size()*a2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -443,21 +433,20 @@ void Task616::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
+  GemmBatch<double> gemm(1, c3.size()*c5.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1243
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c5, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), c5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", 1, c3.size()*c5.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c3, c5);
 }
@@ -496,21 +485,20 @@ void Task618::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
+  GemmBatch<double> gemm(1, c3.size()*c5.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x0, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x0, c5)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size(), x0.size(), c5.size());
-      dgemm_("T", "N", 1, c3.size()*c5.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size(), x0.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c3, c5);
 }
@@ -525,19 +513,18 @@ void Task619::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*a4.size(), c3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c5, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c5, a4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c5.size(), a4.size());
+    gemm.reserve(c5.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c5.size(), a4.size());
     // tensor label: I183
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c5)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), c5.size());
-    dgemm_("T", "N", c1.size()*a2.size()*a4.size(), c3.size(), c5.size(),
-           1.0, i0data_sorted, c5.size(), i1data_sorted, c5.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*a4.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), a4.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -564,21 +551,20 @@ void Task621::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
+  GemmBatch<double> gemm(1, c3.size()*c5.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1246
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c5, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), c5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", 1, c3.size()*c5.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c3, c5);
 }
@@ -617,21 +603,20 @@ void Task623::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c5), 0.0);
+  GemmBatch<double> gemm(1, c3.size()*c5.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x0, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x0, c5)]);
-      sort_indices<2,1,0,3,0,1,-2,1>(i1data, i1data_sorted, c3.size(), x1.size(), x0.size(), c5.size());
-      dgemm_("T", "N", 1, c3.size()*c5.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-2,1>(i1data.get(), gemm.b(), c3.size(), x1.size(), x0.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c3.size(), c5.size());
   out()->add_block(odata, c3, c5);
 }
@@ -646,19 +631,18 @@ void Task624::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size()*a2.size(), a4.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a5, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a5, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a5.size(), c3.size(), a2.size());
+    gemm.reserve(a5.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a5.size(), c3.size(), a2.size());
     // tensor label: I185
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a4)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a5.size(), a4.size());
-    dgemm_("T", "N", c1.size()*c3.size()*a2.size(), a4.size(), a5.size(),
-           1.0, i0data_sorted, a5.size(), i1data_sorted, a5.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -685,21 +669,20 @@ void Task626::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(1, a5.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1249
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a4, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a5.size(), a4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", 1, a5.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), a4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
   out()->add_block(odata, a5, a4);
 }
@@ -738,21 +721,20 @@ void Task628::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(1, a5.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, x1, x0, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, x1, x0, a4)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, a5.size(), x1.size(), x0.size(), a4.size());
-      dgemm_("T", "N", 1, a5.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), a5.size(), x1.size(), x0.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
   out()->add_block(odata, a5, a4);
 }
@@ -767,19 +749,18 @@ void Task629::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), a4.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, a5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, a5)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), a5.size());
+    gemm.reserve(a5.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), a5.size());
     // tensor label: I187
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a4)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a5.size(), a4.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), a4.size(), a5.size(),
-           1.0, i0data_sorted, a5.size(), i1data_sorted, a5.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -806,21 +787,20 @@ void Task631::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(1, a5.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1252
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a4, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a5.size(), a4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", 1, a5.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), a4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
   out()->add_block(odata, a5, a4);
 }
@@ -859,21 +839,20 @@ void Task633::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, a4), 0.0);
+  GemmBatch<double> gemm(1, a5.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma12
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, x1, x0, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, x1, x0, a4)]);
-      sort_indices<2,1,0,3,0,1,2,1>(i1data, i1data_sorted, a5.size(), x1.size(), x0.size(), a4.size());
-      dgemm_("T", "N", 1, a5.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<0,3,2,1,0,1,2,1>(i1data.get(), gemm.b(), a5.size(), x1.size(), x0.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a5.size(), a4.size());
   out()->add_block(odata, a5, a4);
 }
@@ -888,19 +867,18 @@ void Task634::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c1.size()*a2.size(), c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), a2.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c1.size(), a2.size());
     // tensor label: I189
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
-    dgemm_("T", "N", a4.size()*c1.size()*a2.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a4.size()*c1.size()*a2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -913,19 +891,18 @@ void Task635::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-    sort_indices<1,0,0,1,-2,1>(i1data, i1data_sorted, c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,-2,1>(i1data.get(), gemm.b(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
   out()->add_block(odata, c3, x1);
 }
@@ -940,19 +917,18 @@ void Task636::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size()*a4.size(), c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, a4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), a4.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size(), c1.size(), a4.size());
     // tensor label: I192
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size());
-    dgemm_("T", "N", a2.size()*c1.size()*a4.size(), c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*a4.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), a4.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -965,19 +941,18 @@ void Task637::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size());
-    dgemm_("T", "N", x1.size(), c3.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x1.size(), c3.size());
   out()->add_block(odata, c3, x1);
 }
@@ -992,19 +967,18 @@ void Task638::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c3.size()*a2.size(), c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a4, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a4, c3, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a4.size(), c3.size(), a2.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a4.size(), c3.size(), a2.size());
     // tensor label: I1116
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size());
-    dgemm_("T", "N", a4.size()*c3.size()*a2.size(), c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, a4.size()*c3.size()*a2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1017,23 +991,22 @@ void Task639::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma10
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -1048,19 +1021,18 @@ void Task640::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c3.size()*a4.size(), c1.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2, c3, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2, c3, a4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size(), c3.size(), a4.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a2.size(), c3.size(), a4.size());
     // tensor label: I1119
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size());
-    dgemm_("T", "N", a2.size()*c3.size()*a4.size(), c1.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, a2.size()*c3.size()*a4.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), a4.size(), c1.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1073,23 +1045,22 @@ void Task641::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma10
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,2,1>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size());
   out()->add_block(odata, c1, x0);
 }
@@ -1104,19 +1075,18 @@ void Task642::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size()*c3.size(), a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x3.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x3.size());
     // tensor label: I1122
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
-    dgemm_("T", "N", c1.size()*a4.size()*c3.size(), a2.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, c1.size()*a4.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1129,23 +1099,22 @@ void Task643::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a2.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma5
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x2.size(), a2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", x3.size(), a2.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x2.size(), a2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size());
   out()->add_block(odata, a2, x3);
 }
@@ -1158,23 +1127,22 @@ void Task644::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma197
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, a2)]);
-        sort_indices<2,0,1,3,0,1,-1,2>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), a2.size());
-        dgemm_("T", "N", x3.size(), a2.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<3,2,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x2.size(), x1.size(), x0.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a2.size());
   out()->add_block(odata, a2, x3);
 }
@@ -1189,19 +1157,18 @@ void Task645::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x3.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x3.size());
     // tensor label: I1125
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x3.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), a4.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1214,23 +1181,22 @@ void Task646::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma5
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a4, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a4, x1, x0)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), a4.size(), x1.size(), x0.size());
-        dgemm_("T", "N", x3.size(), a4.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a4.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a4.size());
   out()->add_block(odata, a4, x3);
 }
@@ -1243,23 +1209,22 @@ void Task647::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma197
         std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, x0, a4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, x0, a4)]);
-        sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x1.size(), x0.size(), a4.size());
-        dgemm_("T", "N", x3.size(), a4.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<3,2,0,1,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), x1.size(), x0.size(), a4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), a4.size());
   out()->add_block(odata, a4, x3);
 }
@@ -1274,21 +1239,20 @@ void Task648::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c5, a4, c1, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c5, a4, c1, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c5.size(), a4.size(), c1.size(), x1.size());
+      gemm.reserve(c5.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c5.size(), a4.size(), c1.size(), x1.size());
       // tensor label: I1134
       std::unique_ptr<double[]> i1data = in(1)->get_block(c5, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c5, c3, a2, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, c5.size(), c3.size(), a2.size(), x1.size());
-      dgemm_("T", "N", a4.size()*c1.size(), c3.size()*a2.size(), c5.size()*x1.size(),
-             1.0, i0data_sorted, c5.size()*x1.size(), i1data_sorted, c5.size()*x1.size(),
-             1.0, odata_sorted, a4.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c5.size(), c3.size(), a2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1303,19 +1267,18 @@ void Task649::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3, a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3, a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3, a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c5.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I1135
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c5, c3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c5, c3, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c5.size(), c3.size(), a2.size());
-    dgemm_("T", "N", x1.size(), c5.size()*c3.size()*a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c5.size(), c3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c5.size(), c3.size(), a2.size());
   out()->add_block(odata, c5, c3, a2, x1);
 }
@@ -63,21 +63,20 @@ void Task651::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c5, a2, c1, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c5, a2, c1, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c5.size(), a2.size(), c1.size(), x1.size());
+      gemm.reserve(c5.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c5.size(), a2.size(), c1.size(), x1.size());
       // tensor label: I1137
       std::unique_ptr<double[]> i1data = in(1)->get_block(c5, c3, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c5, c3, a4, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, c5.size(), c3.size(), a4.size(), x1.size());
-      dgemm_("T", "N", a2.size()*c1.size(), c3.size()*a4.size(), c5.size()*x1.size(),
-             1.0, i0data_sorted, c5.size()*x1.size(), i1data_sorted, c5.size()*x1.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c5.size(), c3.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -92,19 +91,18 @@ void Task652::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3, a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3, a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3, a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c5.size()*c3.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I1138
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c5, c3, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c5, c3, a4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c5.size(), c3.size(), a4.size());
-    dgemm_("T", "N", x1.size(), c5.size()*c3.size()*a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c5.size(), c3.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c5.size(), c3.size(), a4.size());
   out()->add_block(odata, c5, c3, a4, x1);
 }
@@ -140,21 +138,20 @@ void Task654::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c5, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c5, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c5.size(), x1.size());
+      gemm.reserve(c5.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c5.size(), x1.size());
       // tensor label: I1146
       std::unique_ptr<double[]> i1data = in(1)->get_block(c5, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c5, c3, a2, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, c5.size(), c3.size(), a2.size(), x1.size());
-      dgemm_("T", "N", c1.size()*a4.size(), c3.size()*a2.size(), c5.size()*x1.size(),
-             1.0, i0data_sorted, c5.size()*x1.size(), i1data_sorted, c5.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c5.size(), c3.size(), a2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -169,19 +166,18 @@ void Task655::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3, a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3, a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3, a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c5.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I1147
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c5, c3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c5, c3, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c5.size(), c3.size(), a2.size());
-    dgemm_("T", "N", x1.size(), c5.size()*c3.size()*a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c5.size(), c3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c5.size(), c3.size(), a2.size());
   out()->add_block(odata, c5, c3, a2, x1);
 }
@@ -217,21 +213,20 @@ void Task657::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c5, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c5, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c5.size(), x1.size());
+      gemm.reserve(c5.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c5.size(), x1.size());
       // tensor label: I1149
       std::unique_ptr<double[]> i1data = in(1)->get_block(c5, c3, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c5, c3, a4, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, c5.size(), c3.size(), a4.size(), x1.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*a4.size(), c5.size()*x1.size(),
-             1.0, i0data_sorted, c5.size()*x1.size(), i1data_sorted, c5.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), c5.size(), c3.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -246,19 +241,18 @@ void Task658::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c3, a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c3, a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c3, a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c5.size()*c3.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x0.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: I1150
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, c5, c3, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, c5, c3, a4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x0.size(), c5.size(), c3.size(), a4.size());
-    dgemm_("T", "N", x1.size(), c5.size()*c3.size()*a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), c5.size(), c3.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c5.size(), c3.size(), a4.size());
   out()->add_block(odata, c5, c3, a4, x1);
 }
@@ -294,21 +288,20 @@ void Task660::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*a2.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a4, a5, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a4, a5, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a4.size(), a5.size(), a2.size());
+      gemm.reserve(a5.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a4.size(), a5.size(), a2.size());
       // tensor label: I1158
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a5, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a5, c3, x0)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), x0.size());
-      dgemm_("T", "N", a4.size()*a2.size(), c1.size()*c3.size(), a5.size()*x0.size(),
-             1.0, i0data_sorted, a5.size()*x0.size(), i1data_sorted, a5.size()*x0.size(),
-             1.0, odata_sorted, a4.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size(), c1.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -323,19 +316,18 @@ void Task661::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a5, c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a5, c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a5, c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size()*a5.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a5, c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a5, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,2,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c1.size()*a5.size()*c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size(), a5.size(), c3.size());
   out()->add_block(odata, c1, a5, c3, x0);
 }
@@ -350,21 +342,20 @@ void Task662::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*a4.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, a2, a5, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, a2, a5, a4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x0.size(), a2.size(), a5.size(), a4.size());
+      gemm.reserve(a5.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), a2.size(), a5.size(), a4.size());
       // tensor label: I1161
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a5, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a5, c3, x0)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), x0.size());
-      dgemm_("T", "N", a2.size()*a4.size(), c1.size()*c3.size(), a5.size()*x0.size(),
-             1.0, i0data_sorted, a5.size()*x0.size(), i1data_sorted, a5.size()*x0.size(),
-             1.0, odata_sorted, a2.size()*a4.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, a2.size(), a4.size(), c1.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -379,19 +370,18 @@ void Task663::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a5, c3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a5, c3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a5, c3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c1.size()*a5.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma12
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x1.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a5, c3, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a5, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a5.size(), c3.size(), x1.size());
-    dgemm_("T", "N", x0.size(), c1.size()*a5.size()*c3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a5.size(), c3.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c1.size(), a5.size(), c3.size());
   out()->add_block(odata, c1, a5, c3, x0);
 }
@@ -406,21 +396,20 @@ void Task664::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c1.size(), x2.size());
       // tensor label: I1164
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", a4.size()*c1.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a4.size()*c1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -435,21 +424,20 @@ void Task665::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I1165
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a2.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a2.size());
   out()->add_block(odata, c3, a2, x3, x2);
 }
@@ -485,21 +473,20 @@ void Task667::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x0, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x0, a2)]);
-      sort_indices<1,2,0,3,0,1,1,2>(i1data, i1data_sorted, c3.size(), x1.size(), x0.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a2.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,2>(i1data.get(), gemm.b(), c3.size(), x1.size(), x0.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a2.size());
   out()->add_block(odata, c3, a2, x3, x2);
 }
@@ -514,21 +501,20 @@ void Task668::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c3, x0)]);
-      sort_indices<3,0,1,2,0,1,-1,2>(i1data, i1data_sorted, x1.size(), a2.size(), c3.size(), x0.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a2.size()*c3.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,2,3,0,0,1,-1,2>(i1data.get(), gemm.b(), x1.size(), a2.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a2.size(), c3.size());
   out()->add_block(odata, c3, a2, x3, x2);
 }
@@ -543,21 +529,20 @@ void Task669::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: I1167
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), x3.size(), x2.size());
-      dgemm_("T", "N", a2.size()*c1.size(), c3.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -572,21 +557,20 @@ void Task670::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I1168
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a4.size());
   out()->add_block(odata, c3, a4, x3, x2);
 }
@@ -627,21 +611,20 @@ void Task672::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x0, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x0, a4)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, c3.size(), x1.size(), x0.size(), a4.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), c3.size(), x1.size(), x0.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a4.size());
   out()->add_block(odata, c3, a4, x3, x2);
 }
@@ -656,19 +639,18 @@ void Task673::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), a4.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, c5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, c5)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), c5.size());
+    gemm.reserve(c5.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), c5.size());
     // tensor label: I1188
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c5)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), c5.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), a4.size(), c5.size(),
-           1.0, i0data_sorted, c5.size(), i1data_sorted, c5.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -681,21 +663,20 @@ void Task674::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c5), 0.0);
+  GemmBatch<double> gemm(1, a4.size()*c5.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1189
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a4, c5, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a4, c5, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a4.size(), c5.size(), x0.size());
-      dgemm_("T", "N", 1, a4.size()*c5.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a4.size(), c5.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a4.size(), c5.size());
   out()->add_block(odata, a4, c5);
 }
@@ -731,19 +712,18 @@ void Task676::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size()*c3.size(), a2.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, c5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, c5)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), c5.size());
+    gemm.reserve(c5.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), c5.size());
     // tensor label: I1191
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c5)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), c5.size());
-    dgemm_("T", "N", c1.size()*a4.size()*c3.size(), a2.size(), c5.size(),
-           1.0, i0data_sorted, c5.size(), i1data_sorted, c5.size(),
-           1.0, odata_sorted, c1.size()*a4.size()*c3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -756,21 +736,20 @@ void Task677::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c5), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c5)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c5), 0.0);
+  GemmBatch<double> gemm(1, a2.size()*c5.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1192
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a2, c5, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a2, c5, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a2.size(), c5.size(), x0.size());
-      dgemm_("T", "N", 1, a2.size()*c5.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a2.size(), c5.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c5.size());
   out()->add_block(odata, a2, c5);
 }
@@ -806,19 +785,18 @@ void Task679::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c3.size()*a4.size()*a2.size(), c1.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, a5, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, a5, a2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), a5.size(), a2.size());
+    gemm.reserve(a5.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), a5.size(), a2.size());
     // tensor label: I1194
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, c1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a5.size(), c1.size());
-    dgemm_("T", "N", c3.size()*a4.size()*a2.size(), c1.size(), a5.size(),
-           1.0, i0data_sorted, a5.size(), i1data_sorted, a5.size(),
-           1.0, odata_sorted, c3.size()*a4.size()*a2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), c1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, c3.size(), a4.size(), a2.size(), c1.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -831,21 +809,20 @@ void Task680::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, c1), 0.0);
+  GemmBatch<double> gemm(1, a5.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1195
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a5, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a5, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a5.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a5.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a5.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a5.size(), c1.size());
   out()->add_block(odata, a5, c1);
 }
@@ -881,19 +858,18 @@ void Task682::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size()*a4.size(), c1.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, a5, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, a5, a4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), a5.size(), a4.size());
+    gemm.reserve(a5.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), a5.size(), a4.size());
     // tensor label: I1197
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, c1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, c1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a5.size(), c1.size());
-    dgemm_("T", "N", c3.size()*a2.size()*a4.size(), c1.size(), a5.size(),
-           1.0, i0data_sorted, a5.size(), i1data_sorted, a5.size(),
-           1.0, odata_sorted, c3.size()*a2.size()*a4.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), c1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,3,2,0,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), a4.size(), c1.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -906,21 +882,20 @@ void Task683::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, c1), 0.0);
+  GemmBatch<double> gemm(1, a5.size()*c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma32
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-      sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
       // tensor label: I1198
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a5, c1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a5, c1, x0)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x1.size(), a5.size(), c1.size(), x0.size());
-      dgemm_("T", "N", 1, a5.size()*c1.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, 1);
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x1.size(), a5.size(), c1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, a5.size(), c1.size());
   out()->add_block(odata, a5, c1);
 }
@@ -956,21 +931,20 @@ void Task685::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), x3.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), x3.size(), x2.size());
       // tensor label: I1200
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", c1.size()*a4.size(), c3.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -985,21 +959,20 @@ void Task686::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I1201
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a2.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a2.size());
   out()->add_block(odata, c3, a2, x3, x2);
 }
@@ -1040,21 +1013,20 @@ void Task688::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x0, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x0, a2)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, c3.size(), x1.size(), x0.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a2.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), c3.size(), x1.size(), x0.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a2.size());
   out()->add_block(odata, c3, a2, x3, x2);
 }
@@ -1069,21 +1041,20 @@ void Task689::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: I1203
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), x3.size(), x2.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1098,21 +1069,20 @@ void Task690::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I1204
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a4.size());
   out()->add_block(odata, c3, a4, x3, x2);
 }
@@ -1153,21 +1123,20 @@ void Task692::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x0, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x0, a4)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size(), x0.size(), a4.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c3.size()*a4.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size(), x0.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c3.size(), a4.size());
   out()->add_block(odata, c3, a4, x3, x2);
 }
@@ -1182,19 +1151,18 @@ void Task693::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size()*a2.size(), a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c3.size(), a2.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c3.size(), a2.size());
     // tensor label: I1236
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", c1.size()*c3.size()*a2.size(), a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1207,23 +1175,22 @@ void Task694::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a4.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -1238,19 +1205,18 @@ void Task695::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size()*a4.size(), a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x0, c3, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x0, c3, a4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x0.size(), c3.size(), a4.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x0.size(), c3.size(), a4.size());
     // tensor label: I1239
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x0)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, a2.size(), x0.size());
-    dgemm_("T", "N", c1.size()*c3.size()*a4.size(), a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a4.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,2,1,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a4.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1263,23 +1229,22 @@ void Task696::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a2.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a2.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a2.size());
   out()->add_block(odata, a2, x0);
 }
@@ -1294,21 +1259,20 @@ void Task697::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c6 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a5, c6, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a5, c6, a4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a5.size(), c6.size(), a4.size());
+      gemm.reserve(c6.size()*a5.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a5.size(), c6.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c6, a5, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c6, a5, a2)]);
-      sort_indices<2,1,0,3,0,1,-8,1>(i1data, i1data_sorted, c3.size(), c6.size(), a5.size(), a2.size());
-      dgemm_("T", "N", c1.size()*a4.size(), c3.size()*a2.size(), c6.size()*a5.size(),
-             1.0, i0data_sorted, c6.size()*a5.size(), i1data_sorted, c6.size()*a5.size(),
-             1.0, odata_sorted, c1.size()*a4.size());
+      sort_indices<0,3,2,1,0,1,-8,1>(i1data.get(), gemm.b(), c3.size(), c6.size(), a5.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1323,21 +1287,20 @@ void Task698::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& c6 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c6, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c6, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c6.size(), a5.size());
+      gemm.reserve(c6.size()*a5.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c6.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c6, a5, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c6, a5, a2)]);
-      sort_indices<1,2,0,3,0,1,4,1>(i1data, i1data_sorted, c3.size(), c6.size(), a5.size(), a2.size());
-      dgemm_("T", "N", c1.size()*a4.size(), c3.size()*a2.size(), c6.size()*a5.size(),
-             1.0, i0data_sorted, c6.size()*a5.size(), i1data_sorted, c6.size()*a5.size(),
-             1.0, odata_sorted, c1.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,4,1>(i1data.get(), gemm.b(), c3.size(), c6.size(), a5.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -1352,21 +1315,20 @@ void Task699::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c6 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a5, c6, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a5, c6, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a5.size(), c6.size(), a2.size());
+      gemm.reserve(c6.size()*a5.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a5.size(), c6.size(), a2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c6, a5, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c6, a5, a4)]);
-      sort_indices<2,1,0,3,0,1,4,1>(i1data, i1data_sorted, c3.size(), c6.size(), a5.size(), a4.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*a4.size(), c6.size()*a5.size(),
-             1.0, i0data_sorted, c6.size()*a5.size(), i1data_sorted, c6.size()*a5.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,3,2,1,0,1,4,1>(i1data.get(), gemm.b(), c3.size(), c6.size(), a5.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -42,21 +42,20 @@ void Task700::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& c6 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c6, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c6, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c6.size(), a5.size());
+      gemm.reserve(c6.size()*a5.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c6.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c6, a5, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c6, a5, a4)]);
-      sort_indices<1,2,0,3,0,1,-8,1>(i1data, i1data_sorted, c3.size(), c6.size(), a5.size(), a4.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*a4.size(), c6.size()*a5.size(),
-             1.0, i0data_sorted, c6.size()*a5.size(), i1data_sorted, c6.size()*a5.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,3,1,2,0,1,-8,1>(i1data.get(), gemm.b(), c3.size(), c6.size(), a5.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -71,21 +70,20 @@ void Task701::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& a6 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a6, c5, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a6, c5, a4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a6.size(), c5.size(), a4.size());
+      gemm.reserve(a6.size()*c5.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a6.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, a6, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, a6, c5)]);
-      sort_indices<2,3,0,1,0,1,4,1>(i1data, i1data_sorted, c3.size(), a2.size(), a6.size(), c5.size());
-      dgemm_("T", "N", c1.size()*a4.size(), c3.size()*a2.size(), a6.size()*c5.size(),
-             1.0, i0data_sorted, a6.size()*c5.size(), i1data_sorted, a6.size()*c5.size(),
-             1.0, odata_sorted, c1.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,4,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), a6.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -100,21 +98,20 @@ void Task702::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a6 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c5, a6);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c5, a6)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c5.size(), a6.size());
+      gemm.reserve(a6.size()*c5.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c5.size(), a6.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, a6, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, a6, c5)]);
-      sort_indices<3,2,0,1,0,1,-8,1>(i1data, i1data_sorted, c3.size(), a2.size(), a6.size(), c5.size());
-      dgemm_("T", "N", c1.size()*a4.size(), c3.size()*a2.size(), a6.size()*c5.size(),
-             1.0, i0data_sorted, a6.size()*c5.size(), i1data_sorted, a6.size()*c5.size(),
-             1.0, odata_sorted, c1.size()*a4.size());
+      sort_indices<0,1,3,2,0,1,-8,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), a6.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -129,21 +126,20 @@ void Task703::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& a6 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a6, c5, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a6, c5, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a6.size(), c5.size(), a2.size());
+      gemm.reserve(a6.size()*c5.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a6.size(), c5.size(), a2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, a6, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, a6, c5)]);
-      sort_indices<2,3,0,1,0,1,-8,1>(i1data, i1data_sorted, c3.size(), a4.size(), a6.size(), c5.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*a4.size(), a6.size()*c5.size(),
-             1.0, i0data_sorted, a6.size()*c5.size(), i1data_sorted, a6.size()*c5.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,1,2,3,0,1,-8,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), a6.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -158,21 +154,20 @@ void Task704::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a6 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c5, a6);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c5, a6)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c5.size(), a6.size());
+      gemm.reserve(a6.size()*c5.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c5.size(), a6.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, a6, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, a6, c5)]);
-      sort_indices<3,2,0,1,0,1,16,1>(i1data, i1data_sorted, c3.size(), a4.size(), a6.size(), c5.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*a4.size(), a6.size()*c5.size(),
-             1.0, i0data_sorted, a6.size()*c5.size(), i1data_sorted, a6.size()*c5.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,1,3,2,0,1,16,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), a6.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -187,19 +182,18 @@ void Task705::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c1.size()*a2.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c1, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c1.size(), a2.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c1.size(), a2.size());
     // tensor label: I1310
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x3.size());
-    dgemm_("T", "N", a4.size()*c1.size()*a2.size(), c3.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, a4.size()*c1.size()*a2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -212,23 +206,22 @@ void Task706::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma29
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,0,1,-1,1>(i1data, i1data_sorted, c3.size(), x2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", x3.size(), c3.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), x2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c3.size());
   out()->add_block(odata, c3, x3);
 }
@@ -241,23 +234,22 @@ void Task707::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, c3, x0)]);
-        sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x2.size(), x1.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x3.size(), c3.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<2,3,0,1,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), x1.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c3.size());
   out()->add_block(odata, c3, x3);
 }
@@ -272,19 +264,18 @@ void Task708::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size()*a4.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, a4)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), a4.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), a4.size());
     // tensor label: I1313
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x3.size());
-    dgemm_("T", "N", a2.size()*c1.size()*a4.size(), c3.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, a2.size()*c1.size()*a4.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), a4.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -297,23 +288,22 @@ void Task709::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       for (auto& x0 : *range_[1]) {
         // tensor label: Gamma29
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,0,1,1,2>(i1data, i1data_sorted, c3.size(), x2.size(), x1.size(), x0.size());
-        dgemm_("T", "N", x3.size(), c3.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), c3.size(), x2.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c3.size());
   out()->add_block(odata, c3, x3);
 }
@@ -326,23 +316,22 @@ void Task710::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x3), 0.0);
+  GemmBatch<double> gemm(x3.size(), c3.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x1, c3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x1, c3, x0)]);
-        sort_indices<3,0,1,2,0,1,1,2>(i1data, i1data_sorted, x2.size(), x1.size(), c3.size(), x0.size());
-        dgemm_("T", "N", x3.size(), c3.size(), x2.size()*x1.size()*x0.size(),
-               1.0, i0data_sorted, x2.size()*x1.size()*x0.size(), i1data_sorted, x2.size()*x1.size()*x0.size(),
-               1.0, odata_sorted, x3.size());
+        sort_indices<2,3,0,1,0,1,1,2>(i1data.get(), gemm.b(), x2.size(), x1.size(), c3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x3.size(), c3.size());
   out()->add_block(odata, c3, x3);
 }
@@ -357,21 +346,20 @@ void Task711::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*a2.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c5, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c5, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c5.size(), a2.size());
+      gemm.reserve(c5.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c5.size(), a2.size());
       // tensor label: I1322
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, c5, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, c5, x1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), c5.size(), x1.size());
-      dgemm_("T", "N", a4.size()*a2.size(), c1.size()*c3.size(), c5.size()*x1.size(),
-             1.0, i0data_sorted, c5.size()*x1.size(), i1data_sorted, c5.size()*x1.size(),
-             1.0, odata_sorted, a4.size()*a2.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), c5.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size(), c1.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -386,19 +374,18 @@ void Task712::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, c5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, c5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, c5, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c1.size()*c3.size()*c5.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c3, c5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c3, c5)]);
-    sort_indices<1,0,2,3,0,1,-1,1>(i1data, i1data_sorted, c1.size(), x0.size(), c3.size(), c5.size());
-    dgemm_("T", "N", x1.size(), c1.size()*c3.size()*c5.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c3.size(), c5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), c3.size(), c5.size());
   out()->add_block(odata, c1, c3, c5, x1);
 }
@@ -413,21 +400,20 @@ void Task713::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*a4.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c5, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c5, a4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size(), c5.size(), a4.size());
       // tensor label: I1325
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, c5, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, c5, x1)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), c5.size(), x1.size());
-      dgemm_("T", "N", a2.size()*a4.size(), c1.size()*c3.size(), c5.size()*x1.size(),
-             1.0, i0data_sorted, c5.size()*x1.size(), i1data_sorted, c5.size()*x1.size(),
-             1.0, odata_sorted, a2.size()*a4.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), c5.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, a2.size(), a4.size(), c1.size(), c3.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -442,19 +428,18 @@ void Task714::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, c5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, c5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, c5, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), c1.size()*c3.size()*c5.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, c3, c5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, c3, c5)]);
-    sort_indices<1,0,2,3,0,1,2,1>(i1data, i1data_sorted, c1.size(), x0.size(), c3.size(), c5.size());
-    dgemm_("T", "N", x1.size(), c1.size()*c3.size()*c5.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), c3.size(), c5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), c1.size(), c3.size(), c5.size());
   out()->add_block(odata, c1, c3, c5, x1);
 }
@@ -469,21 +454,20 @@ void Task715::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a4.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a5, c1, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a5, c1, a4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c1.size(), a4.size());
+      gemm.reserve(a5.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c1.size(), a4.size());
       // tensor label: I1328
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, c3, a2, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a5.size(), c3.size(), a2.size(), x1.size());
-      dgemm_("T", "N", c1.size()*a4.size(), c3.size()*a2.size(), a5.size()*x1.size(),
-             1.0, i0data_sorted, a5.size()*x1.size(), i1data_sorted, a5.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a4.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), c3.size(), a2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), a4.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -498,19 +482,18 @@ void Task716::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, c3, a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, c3, a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, c3, a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a5.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I1329
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, x0, c3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, x0, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a5.size(), x0.size(), c3.size(), a2.size());
-    dgemm_("T", "N", x1.size(), a5.size()*c3.size()*a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), x0.size(), c3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), a5.size(), c3.size(), a2.size());
   out()->add_block(odata, a5, c3, a2, x1);
 }
@@ -546,21 +529,20 @@ void Task718::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a4.size()*c1.size(), c3.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c1, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c1, a5)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c1.size(), a5.size());
+      gemm.reserve(a5.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c1.size(), a5.size());
       // tensor label: I1331
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, c3, a2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, c3, a2, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a5.size(), c3.size(), a2.size(), x1.size());
-      dgemm_("T", "N", a4.size()*c1.size(), c3.size()*a2.size(), a5.size()*x1.size(),
-             1.0, i0data_sorted, a5.size()*x1.size(), i1data_sorted, a5.size()*x1.size(),
-             1.0, odata_sorted, a4.size()*c1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), c3.size(), a2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, a4.size(), c1.size(), c3.size(), a2.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -575,19 +557,18 @@ void Task719::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, c3, a2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, c3, a2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, c3, a2, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a5.size()*c3.size()*a2.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I1332
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, x0, c3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, x0, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a5.size(), x0.size(), c3.size(), a2.size());
-    dgemm_("T", "N", x1.size(), a5.size()*c3.size()*a2.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), x0.size(), c3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), a5.size(), c3.size(), a2.size());
   out()->add_block(odata, a5, c3, a2, x1);
 }
@@ -623,21 +604,20 @@ void Task721::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a5, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a5, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c1.size(), a2.size());
+      gemm.reserve(a5.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c1.size(), a2.size());
       // tensor label: I1334
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, c3, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, c3, a4, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a5.size(), c3.size(), a4.size(), x1.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*a4.size(), a5.size()*x1.size(),
-             1.0, i0data_sorted, a5.size()*x1.size(), i1data_sorted, a5.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), c3.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -652,19 +632,18 @@ void Task722::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, c3, a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, c3, a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, c3, a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a5.size()*c3.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I1335
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, x0, c3, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, x0, c3, a4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a5.size(), x0.size(), c3.size(), a4.size());
-    dgemm_("T", "N", x1.size(), a5.size()*c3.size()*a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), x0.size(), c3.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), a5.size(), c3.size(), a4.size());
   out()->add_block(odata, a5, c3, a4, x1);
 }
@@ -700,21 +679,20 @@ void Task724::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c1, a4, c3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c1, a4, c3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c1, a4, c3), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c1, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c1, a5)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c1.size(), a5.size());
+      gemm.reserve(a5.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size(), c1.size(), a5.size());
       // tensor label: I1337
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, c3, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, c3, a4, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a5.size(), c3.size(), a4.size(), x1.size());
-      dgemm_("T", "N", a2.size()*c1.size(), c3.size()*a4.size(), a5.size()*x1.size(),
-             1.0, i0data_sorted, a5.size()*x1.size(), i1data_sorted, a5.size()*x1.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), c3.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), a4.size());
   out()->add_block(odata, a2, c1, a4, c3);
 }
@@ -729,19 +707,18 @@ void Task725::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a5, c3, a4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a5, c3, a4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a5, c3, a4, x1), 0.0);
+  GemmBatch<double> gemm(x1.size(), a5.size()*c3.size()*a4.size(), odata_sorted.get());
   for (auto& x0 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x0.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I1338
     std::unique_ptr<double[]> i1data = in(1)->get_block(a5, x0, c3, a4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, x0, c3, a4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a5.size(), x0.size(), c3.size(), a4.size());
-    dgemm_("T", "N", x1.size(), a5.size()*c3.size()*a4.size(), x0.size(),
-           1.0, i0data_sorted, x0.size(), i1data_sorted, x0.size(),
-           1.0, odata_sorted, x1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), x0.size(), c3.size(), a4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x1.size(), a5.size(), c3.size(), a4.size());
   out()->add_block(odata, a5, c3, a4, x1);
 }
@@ -793,19 +770,18 @@ void Task728::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), a3.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size());
     // tensor label: I195
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c2, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c2, x1, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c2.size(), x1.size(), x0.size());
-    dgemm_("T", "N", a1.size(), a3.size()*c2.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c2.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -820,21 +796,20 @@ void Task729::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I196
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c2.size());
   out()->add_block(odata, a3, c2, x1, x0);
 }
@@ -870,19 +845,18 @@ void Task731::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size(), a1.size()*c2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size());
     // tensor label: I198
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c2, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c2, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), c2.size(), x0.size(), x1.size());
-    dgemm_("T", "N", a3.size(), a1.size()*c2.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c2.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -897,21 +871,20 @@ void Task732::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -926,21 +899,20 @@ void Task733::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, a1, c2, x0, x1);
 }
@@ -978,23 +950,22 @@ void Task735::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size());
   out()->add_block(odata, a3, x0);
 }
@@ -1032,23 +1003,22 @@ void Task737::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size());
   out()->add_block(odata, a1, x0);
 }
@@ -1063,19 +1033,18 @@ void Task738::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size()*a1.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, a1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), a1.size());
     // tensor label: I213
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", c2.size()*a3.size()*a1.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c2.size()*a3.size()*a1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1088,19 +1057,18 @@ void Task739::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c4)]);
-    sort_indices<0,1,0,1,-4,1>(i1data, i1data_sorted, x1.size(), c4.size());
-    dgemm_("T", "N", x0.size(), c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,-4,1>(i1data.get(), gemm.b(), x1.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1113,23 +1081,22 @@ void Task740::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-2,1>(i1data, i1data_sorted, x3.size(), c4.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1142,23 +1109,22 @@ void Task741::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma29
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, c4)]);
-        sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), c4.size());
-        dgemm_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1173,19 +1139,18 @@ void Task742::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size()*a3.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, a3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a3.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), a3.size());
     // tensor label: I216
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", c2.size()*a1.size()*a3.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c2.size()*a1.size()*a3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1198,19 +1163,18 @@ void Task743::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c4)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, x1.size(), c4.size());
-    dgemm_("T", "N", x0.size(), c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1223,23 +1187,22 @@ void Task744::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), c4.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1252,23 +1215,22 @@ void Task745::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma29
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, c4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, c4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), c4.size());
-        dgemm_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -1283,19 +1245,18 @@ void Task746::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size(), c2.size()*a3.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I219
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, a3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, a3, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), a3.size(), a1.size());
-    dgemm_("T", "N", x0.size(), c2.size()*a3.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), a3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), c2.size(), a3.size(), a1.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1310,19 +1271,18 @@ void Task747::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a3.size()*a1.size(), c2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a1.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size());
-    dgemm_("T", "N", x1.size()*a3.size()*a1.size(), c2.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size()*a3.size()*a1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -1337,19 +1297,18 @@ void Task748::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a1.size()*a3.size(), c2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c4, a3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a3.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c4.size(), a3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4)]);
-    sort_indices<1,0,0,1,-2,1>(i1data, i1data_sorted, c2.size(), c4.size());
-    dgemm_("T", "N", x1.size()*a1.size()*a3.size(), c2.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size()*a1.size()*a3.size());
+    sort_indices<0,1,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,2,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), a3.size(), c2.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -1364,19 +1323,18 @@ void Task749::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*c2.size()*a3.size(), a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, a4.size(), a1.size());
-    dgemm_("T", "N", x1.size()*c2.size()*a3.size(), a1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*c2.size()*a3.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), a4.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a3.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -42,19 +42,18 @@ void Task750::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a3.size()*c2.size(), a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a4.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a4.size(), a1.size());
-    dgemm_("T", "N", x1.size()*a3.size()*c2.size(), a1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*a3.size()*c2.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -69,19 +68,18 @@ void Task751::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*c2.size()*a1.size(), a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a1.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a4.size(), a3.size());
-    dgemm_("T", "N", x1.size()*c2.size()*a1.size(), a3.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*c2.size()*a1.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -96,19 +94,18 @@ void Task752::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a1.size()*c2.size(), a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a4.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, a4.size(), a3.size());
-    dgemm_("T", "N", x1.size()*a1.size()*c2.size(), a3.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*a1.size()*c2.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), a4.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -123,21 +120,20 @@ void Task753::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c5, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c5, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c5.size(), a3.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c5.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c5, a4, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c5, a4, a1)]);
-      sort_indices<2,1,0,3,0,1,2,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a1.size());
-      dgemm_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,2,1,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -152,21 +148,20 @@ void Task754::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c5, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c5, a4, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c5, a4, a1)]);
-      sort_indices<1,2,0,3,0,1,-4,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a1.size());
-      dgemm_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,-4,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -181,21 +176,20 @@ void Task755::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c5, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c5, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c5.size(), a1.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c5.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c5, a4, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c5, a4, a3)]);
-      sort_indices<2,1,0,3,0,1,-4,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a3.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,-4,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -210,21 +204,20 @@ void Task756::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c5, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c5, a4, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c5, a4, a3)]);
-      sort_indices<1,2,0,3,0,1,2,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a3.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -239,21 +232,20 @@ void Task757::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a5, c4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a5, c4, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a5.size(), c4.size(), a3.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a5.size(), c4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,-4,1>(i1data, i1data_sorted, x1.size(), a1.size(), a5.size(), c4.size());
-      dgemm_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,-4,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -268,21 +260,20 @@ void Task758::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,8,1>(i1data, i1data_sorted, x1.size(), a1.size(), a5.size(), c4.size());
-      dgemm_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,3,2,0,1,8,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -297,21 +288,20 @@ void Task759::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a5, c4, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a5, c4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a5.size(), c4.size(), a1.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a5.size(), c4.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,2,1>(i1data, i1data_sorted, x1.size(), a3.size(), a5.size(), c4.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -326,21 +316,20 @@ void Task760::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,-4,1>(i1data, i1data_sorted, x1.size(), a3.size(), a5.size(), c4.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,3,2,0,1,-4,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -355,21 +344,20 @@ void Task761::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c5, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c5, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c5.size(), a3.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c5.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c5, a4, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c5, a4, a1)]);
-      sort_indices<2,1,0,3,0,1,-2,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a1.size());
-      dgemm_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,3,2,1,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -384,21 +372,20 @@ void Task762::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c5, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c5, a4, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c5, a4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a1.size());
-      dgemm_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -413,21 +400,20 @@ void Task763::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c5, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c5, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c5.size(), a1.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c5.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c5, a4, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c5, a4, a3)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a3.size());
-      dgemm_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -442,21 +428,20 @@ void Task764::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c5, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c5, a4, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c5, a4, a3)]);
-      sort_indices<1,2,0,3,0,1,-2,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a3.size());
-      dgemm_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -471,21 +456,20 @@ void Task765::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a5, c4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a5, c4, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c4.size(), a3.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), a5.size(), c4.size());
-      dgemm_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -500,21 +484,20 @@ void Task766::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c4, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,-2,1>(i1data, i1data_sorted, c2.size(), a1.size(), a5.size(), c4.size());
-      dgemm_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -529,21 +512,20 @@ void Task767::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a5, c4, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a5, c4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c4.size(), a1.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c4.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,-2,1>(i1data, i1data_sorted, c2.size(), a3.size(), a5.size(), c4.size());
-      dgemm_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -558,21 +540,20 @@ void Task768::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c4, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a3, a5, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a3, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,4,1>(i1data, i1data_sorted, c2.size(), a3.size(), a5.size(), c4.size());
-      dgemm_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,1,3,2,0,1,4,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -587,21 +568,20 @@ void Task769::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*c2.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a5, c2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a5, c2, a4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c2.size(), a4.size());
+      gemm.reserve(a5.size()*a4.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c2.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a1, a4, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a1, a4, a3)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, a5.size(), a1.size(), a4.size(), a3.size());
-      dgemm_("T", "N", x1.size()*c2.size(), a1.size()*a3.size(), a5.size()*a4.size(),
-             1.0, i0data_sorted, a5.size()*a4.size(), i1data_sorted, a5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*c2.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), a5.size(), a1.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -616,21 +596,20 @@ void Task770::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*c2.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a4, c2, a5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a4, c2, a5)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a5.size());
+      gemm.reserve(a5.size()*a4.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a1, a4, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a1, a4, a3)]);
-      sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, a5.size(), a1.size(), a4.size(), a3.size());
-      dgemm_("T", "N", x1.size()*c2.size(), a1.size()*a3.size(), a5.size()*a4.size(),
-             1.0, i0data_sorted, a5.size()*a4.size(), i1data_sorted, a5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,-1,1>(i1data.get(), gemm.b(), a5.size(), a1.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -645,19 +624,18 @@ void Task771::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size(), a1.size()*a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x1.size());
     // tensor label: I237
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a3, x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a3, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size());
-    dgemm_("T", "N", c2.size(), a1.size()*a3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a3.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -672,21 +650,20 @@ void Task772::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a3, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a3)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a3.size());
   out()->add_block(odata, a1, a3, x0, x1);
 }
@@ -701,21 +678,20 @@ void Task773::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*a3.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1, x1, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1, x1, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size(), x1.size(), a3.size());
+      gemm.reserve(x1.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size(), x1.size(), a3.size());
       // tensor label: I1355
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x2, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
-      dgemm_("T", "N", a1.size()*a3.size(), c2.size()*x0.size(), x1.size()*x2.size(),
-             1.0, i0data_sorted, x1.size()*x2.size(), i1data_sorted, x1.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*a3.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x2.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -730,23 +706,22 @@ void Task774::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma24
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x2, x0);
 }
@@ -761,21 +736,20 @@ void Task775::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a3, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a3, c2, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c4.size(), a3.size(), c2.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a3.size(), c2.size(), x3.size());
       // tensor label: I1358
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a3.size()*c2.size(), a1.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -790,21 +764,20 @@ void Task776::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a1.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, x1, c4)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), a1.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a1.size(), c4.size());
   out()->add_block(odata, a1, c4, x3, x0);
 }
@@ -819,21 +792,20 @@ void Task777::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a1, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a1, c2, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c4.size(), a1.size(), c2.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a1.size(), c2.size(), x3.size());
       // tensor label: I1361
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a1.size()*c2.size(), a3.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -848,21 +820,20 @@ void Task778::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a3.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma5
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a3, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a3, x1, c4)]);
-      sort_indices<0,2,1,3,0,1,-1,1>(i1data, i1data_sorted, x2.size(), a3.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), a3.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a3.size(), c4.size());
   out()->add_block(odata, a3, c4, x3, x0);
 }
@@ -877,21 +848,20 @@ void Task779::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), x3.size());
       // tensor label: I1364
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -906,21 +876,20 @@ void Task780::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a1.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, x1, c4)]);
-      sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, x2.size(), a1.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,-2,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a1.size(), c4.size());
   out()->add_block(odata, a1, c4, x3, x0);
 }
@@ -935,21 +904,20 @@ void Task781::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), x3.size());
       // tensor label: I1367
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -964,21 +932,20 @@ void Task782::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a3.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a3, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a3, x1, c4)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), a3.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a3.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a3.size(), c4.size());
   out()->add_block(odata, a3, c4, x3, x0);
 }
@@ -993,21 +960,20 @@ void Task783::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), x4.size());
       // tensor label: I1370
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x0.size());
-      dgemm_("T", "N", a3.size()*c2.size(), a1.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1022,23 +988,22 @@ void Task784::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma49
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x0);
 }
@@ -1053,23 +1018,22 @@ void Task785::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma240
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, a1)]);
-        sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), a1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<3,0,1,2,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x0);
 }
@@ -1084,21 +1048,20 @@ void Task786::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c2.size(), x4.size());
       // tensor label: I1373
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x5, x0, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x5, x0, x4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), x5.size(), x0.size(), x4.size());
-      dgemm_("T", "N", a1.size()*c2.size(), a3.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x5.size(), x0.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1113,23 +1076,22 @@ void Task787::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x0, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x0, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x0, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma48
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x3, x4, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x3, x4, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x3.size(), x4.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x4.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), a3.size());
   out()->add_block(odata, a3, x5, x0, x4);
 }
@@ -1144,23 +1106,22 @@ void Task788::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x0, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x0, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x0, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size(), a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma230
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4, x3, x2)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, a3)]);
-        sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), a3.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x4.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x4.size());
+        sort_indices<3,2,0,1,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), a3.size());
   out()->add_block(odata, a3, x5, x0, x4);
 }
@@ -1175,21 +1136,20 @@ void Task789::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, c4, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, c4, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), c4.size(), c2.size(), a1.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), c4.size(), c2.size(), a1.size());
       // tensor label: I1382
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c4, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c4, x0, x1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), c4.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c4.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1204,21 +1164,20 @@ void Task790::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a3.size()*c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c4, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c4, x2)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c4.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a3.size()*c4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c4.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a3.size(), c4.size());
   out()->add_block(odata, a3, c4, x0, x1);
 }
@@ -1233,21 +1192,20 @@ void Task791::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c4.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), a3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c4.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c4.size(), a3.size());
   out()->add_block(odata, a3, c4, x0, x1);
 }
@@ -1262,21 +1220,20 @@ void Task792::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, c4, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, c4, c2, a3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), c4.size(), c2.size(), a3.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), c4.size(), c2.size(), a3.size());
       // tensor label: I1385
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c4, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c4, x0, x1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), c4.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c4.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1291,21 +1248,20 @@ void Task793::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c4, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c4, x2)]);
-      sort_indices<0,3,1,2,0,1,2,1>(i1data, i1data_sorted, x3.size(), a1.size(), c4.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c4.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c4.size());
   out()->add_block(odata, a1, c4, x0, x1);
 }
@@ -1320,21 +1276,20 @@ void Task794::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c4.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-2,1>(i1data, i1data_sorted, c4.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c4.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), c4.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c4.size(), a1.size());
   out()->add_block(odata, a1, c4, x0, x1);
 }
@@ -1349,21 +1304,20 @@ void Task795::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, c4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, c4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), c4.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), c4.size());
       // tensor label: I1388
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, c4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, c4, x1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a1.size()*c2.size(), a3.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1378,21 +1332,20 @@ void Task796::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I1389
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c4, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c4, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c4.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*c4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c4.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), c4.size());
   out()->add_block(odata, a3, c4, x1, x0);
 }
@@ -1428,21 +1381,20 @@ void Task798::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, c4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, c4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), c4.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), c4.size());
       // tensor label: I1391
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, c4, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, c4, x0, x1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), c4.size(), x0.size(), x1.size());
-      dgemm_("T", "N", a3.size()*c2.size(), a1.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c4.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1457,21 +1409,20 @@ void Task799::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, c4, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, c4, x2)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a1.size(), c4.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), c4.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c4.size());
   out()->add_block(odata, a1, c4, x0, x1);
 }
@@ -42,21 +42,20 @@ void Task800::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, c4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c4.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c4.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c4.size(), a1.size());
   out()->add_block(odata, a1, c4, x0, x1);
 }
@@ -71,21 +70,20 @@ void Task801::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*a1.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, a4, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, a4, a1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), a4.size(), a1.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), a4.size(), a1.size());
       // tensor label: I1394
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c2, x0, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", a3.size()*a1.size(), c2.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, a3.size()*a1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -100,21 +98,20 @@ void Task802::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a4.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a4.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a4.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a4.size(), c2.size());
   out()->add_block(odata, a4, c2, x0, x1);
 }
@@ -129,21 +126,20 @@ void Task803::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a4, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a4, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a4.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a4.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a4.size());
   out()->add_block(odata, a4, c2, x0, x1);
 }
@@ -158,21 +154,20 @@ void Task804::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*a3.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, a4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, a4, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), a4.size(), a3.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), a4.size(), a3.size());
       // tensor label: I1397
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c2, x1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a1.size()*a3.size(), c2.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, a1.size()*a3.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -187,21 +182,20 @@ void Task805::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a4.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I1398
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a4.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a4.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a4.size(), c2.size());
   out()->add_block(odata, a4, c2, x1, x0);
 }
@@ -237,21 +231,20 @@ void Task807::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x5.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x5.size(), x4.size());
       // tensor label: I1400
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x5, x4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -266,23 +259,22 @@ void Task808::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma49
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x0);
 }
@@ -297,23 +289,22 @@ void Task809::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma240
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, a1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, a1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), a1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x0);
 }
@@ -328,21 +319,20 @@ void Task810::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x5.size(), x4.size());
       // tensor label: I1403
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x5, x4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x5.size(), x4.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -357,23 +347,22 @@ void Task811::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma49
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x4, x0);
 }
@@ -388,23 +377,22 @@ void Task812::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma240
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, a3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, a3)]);
-        sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), a3.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<3,0,1,2,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x4, x0);
 }
@@ -419,21 +407,20 @@ void Task813::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x2.size(), x1.size());
       // tensor label: I1430
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -448,23 +435,22 @@ void Task814::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a3.size());
   out()->add_block(odata, a3, x0, x2, x1);
 }
@@ -479,21 +465,20 @@ void Task815::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x2.size(), x1.size());
       // tensor label: I1433
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -508,23 +493,22 @@ void Task816::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -539,21 +523,20 @@ void Task817::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2, x1, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2, x1, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size(), x1.size(), a1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size(), x1.size(), a1.size());
       // tensor label: I1436
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2, x1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -568,23 +551,22 @@ void Task818::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x2, x1, x0);
 }
@@ -599,21 +581,20 @@ void Task819::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2, x1, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2, x1, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size(), x1.size(), a3.size());
+      gemm.reserve(x1.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size(), x1.size(), a3.size());
       // tensor label: I1439
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x1, x2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x1.size(), x2.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), x1.size()*x2.size(),
-             1.0, i0data_sorted, x1.size()*x2.size(), i1data_sorted, x1.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -628,23 +609,22 @@ void Task820::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma31
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, x2);
 }
@@ -659,21 +639,20 @@ void Task821::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size(), c2.size(), x1.size());
+      gemm.reserve(x1.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size(), c2.size(), x1.size());
       // tensor label: I1442
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x1, x2, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x1, x2, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x1.size(), x2.size(), x0.size());
-      dgemm_("T", "N", a1.size()*c2.size(), a3.size()*x0.size(), x1.size()*x2.size(),
-             1.0, i0data_sorted, x1.size()*x2.size(), i1data_sorted, x1.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x1.size(), x2.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -688,23 +667,22 @@ void Task822::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma471
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x1, x4, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x1, x4, x3, x2, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x1.size(), x4.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x1, x2, x0);
 }
@@ -719,21 +697,20 @@ void Task823::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a3, c2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a3, c2, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), a3.size(), c2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a3.size(), c2.size(), x1.size());
       // tensor label: I1445
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", a3.size()*c2.size(), a1.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -748,23 +725,22 @@ void Task824::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -779,21 +755,20 @@ void Task825::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x1, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x1.size(), c2.size(), a1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x1.size(), c2.size(), a1.size());
       // tensor label: I1448
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -808,23 +783,22 @@ void Task826::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a3.size());
   out()->add_block(odata, a3, x0, x2, x1);
 }
@@ -839,21 +813,20 @@ void Task827::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x1, c2, a3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x1.size(), c2.size(), a3.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x1.size(), c2.size(), a3.size());
       // tensor label: I1451
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -868,23 +841,22 @@ void Task828::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -899,19 +871,18 @@ void Task829::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size()*a1.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, a4, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, a4, a1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), a4.size(), a1.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), a4.size(), a1.size());
     // tensor label: I1454
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", c2.size()*a3.size()*a1.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c2.size()*a3.size()*a1.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -924,23 +895,22 @@ void Task830::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,2,1>(i1data, i1data_sorted, x3.size(), a4.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -955,19 +925,18 @@ void Task831::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size()*a3.size(), x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, a4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, a4, a3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), a4.size(), a3.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), a4.size(), a3.size());
     // tensor label: I1457
     std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), x0.size());
-    dgemm_("T", "N", c2.size()*a1.size()*a3.size(), x0.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, c2.size()*a1.size()*a3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -980,23 +949,22 @@ void Task832::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma51
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a4.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x0.size(), a4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), a4.size());
   out()->add_block(odata, a4, x0);
 }
@@ -1011,21 +979,20 @@ void Task833::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*a1.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a3, c5, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a3, c5, a1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a3.size(), c5.size(), a1.size());
+      gemm.reserve(c5.size()*c4.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a3.size(), c5.size(), a1.size());
       // tensor label: I1472
       std::unique_ptr<double[]> i1data = in(1)->get_block(c5, c2, c4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c5, c2, c4, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c5.size(), c2.size(), c4.size(), x0.size());
-      dgemm_("T", "N", a3.size()*a1.size(), c2.size()*x0.size(), c5.size()*c4.size(),
-             1.0, i0data_sorted, c5.size()*c4.size(), i1data_sorted, c5.size()*c4.size(),
-             1.0, odata_sorted, a3.size()*a1.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), c5.size(), c2.size(), c4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1040,19 +1007,18 @@ void Task834::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c2, c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c2, c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c2, c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c5.size()*c2.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c5, c2, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c5, c2, c4)]);
-    sort_indices<0,1,2,3,0,1,4,1>(i1data, i1data_sorted, x1.size(), c5.size(), c2.size(), c4.size());
-    dgemm_("T", "N", x0.size(), c5.size()*c2.size()*c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,4,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), c2.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c5.size(), c2.size(), c4.size());
   out()->add_block(odata, c5, c2, c4, x0);
 }
@@ -1067,21 +1033,20 @@ void Task835::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*a3.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a1, c5, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a1, c5, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a1.size(), c5.size(), a3.size());
+      gemm.reserve(c5.size()*c4.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a1.size(), c5.size(), a3.size());
       // tensor label: I1475
       std::unique_ptr<double[]> i1data = in(1)->get_block(c5, c2, c4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c5, c2, c4, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c5.size(), c2.size(), c4.size(), x0.size());
-      dgemm_("T", "N", a1.size()*a3.size(), c2.size()*x0.size(), c5.size()*c4.size(),
-             1.0, i0data_sorted, c5.size()*c4.size(), i1data_sorted, c5.size()*c4.size(),
-             1.0, odata_sorted, a1.size()*a3.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), c5.size(), c2.size(), c4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1096,19 +1061,18 @@ void Task836::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c5, c2, c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c5, c2, c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c5, c2, c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c5.size()*c2.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, c5, c2, c4);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, c5, c2, c4)]);
-    sort_indices<0,1,2,3,0,1,-2,1>(i1data, i1data_sorted, x1.size(), c5.size(), c2.size(), c4.size());
-    dgemm_("T", "N", x0.size(), c5.size()*c2.size()*c4.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,-2,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), c2.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), c5.size(), c2.size(), c4.size());
   out()->add_block(odata, c5, c2, c4, x0);
 }
@@ -1123,21 +1087,20 @@ void Task837::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*a1.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c4, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c4, a1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c4.size(), a1.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c4.size(), a1.size());
       // tensor label: I1502
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4, x3, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a3.size()*a1.size(), c2.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a3.size(), a1.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1152,21 +1115,20 @@ void Task838::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c2.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I1503
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c2.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c4.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c2.size(), c4.size());
   out()->add_block(odata, c2, c4, x3, x0);
 }
@@ -1202,21 +1164,20 @@ void Task840::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c2.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x2, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x2, x1, c4)]);
-      sort_indices<1,2,0,3,0,1,1,2>(i1data, i1data_sorted, c2.size(), x2.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c2.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,2>(i1data.get(), gemm.b(), c2.size(), x2.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c2.size(), c4.size());
   out()->add_block(odata, c2, c4, x3, x0);
 }
@@ -1231,21 +1192,20 @@ void Task841::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c4.size()*c2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c2, x1)]);
-      sort_indices<3,0,1,2,0,1,-1,2>(i1data, i1data_sorted, x2.size(), c4.size(), c2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c4.size()*c2.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,-1,2>(i1data.get(), gemm.b(), x2.size(), c4.size(), c2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c4.size(), c2.size());
   out()->add_block(odata, c2, c4, x3, x0);
 }
@@ -1260,21 +1220,20 @@ void Task842::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*a3.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c4, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c4.size(), a3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c4.size(), a3.size());
       // tensor label: I1505
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4, x3, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a1.size()*a3.size(), c2.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a1.size()*a3.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1289,21 +1248,20 @@ void Task843::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c2.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I1506
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c2.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c4.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c2.size(), c4.size());
   out()->add_block(odata, c2, c4, x3, x0);
 }
@@ -1344,21 +1302,20 @@ void Task845::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c2.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x2, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x2, x1, c4)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, c2.size(), x2.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c2.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), c2.size(), x2.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c2.size(), c4.size());
   out()->add_block(odata, c2, c4, x3, x0);
 }
@@ -1373,21 +1330,20 @@ void Task846::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c2, a3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c2.size(), a3.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c2.size(), a3.size());
       // tensor label: I1508
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, x3, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size(), x3.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a1.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -1402,21 +1358,20 @@ void Task847::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a1, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a1, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a1, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I1509
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a1.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a1.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a1.size());
   out()->add_block(odata, a4, a1, x3, x0);
 }
@@ -1452,21 +1407,20 @@ void Task849::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a1, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a1, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a1, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, x1, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, x1, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), x1.size(), a1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a1.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), x1.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a1.size());
   out()->add_block(odata, a4, a1, x3, x0);
 }
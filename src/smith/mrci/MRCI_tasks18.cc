@@ -42,21 +42,20 @@ void Task850::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a1, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a1, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a1, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a1.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, a4, x1)]);
-      sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x2.size(), a1.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a1.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a1.size(), a4.size());
   out()->add_block(odata, a4, a1, x3, x0);
 }
@@ -71,21 +70,20 @@ void Task851::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a4.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a4.size());
       // tensor label: I1511
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, x3, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a3.size()*c2.size(), a1.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a1.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -100,21 +98,20 @@ void Task852::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a1, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a1, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a1, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I1512
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a1.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a1.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a1.size());
   out()->add_block(odata, a4, a1, x3, x0);
 }
@@ -150,21 +147,20 @@ void Task854::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a1, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a1, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a1, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, x1, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, x1, a1)]);
-      sort_indices<1,2,0,3,0,1,-1,2>(i1data, i1data_sorted, a4.size(), x2.size(), x1.size(), a1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a1.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,-1,2>(i1data.get(), gemm.b(), a4.size(), x2.size(), x1.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a1.size());
   out()->add_block(odata, a4, a1, x3, x0);
 }
@@ -179,21 +175,20 @@ void Task855::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a1, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a1, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a1, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a1.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, a4, x1)]);
-      sort_indices<3,0,1,2,0,1,1,2>(i1data, i1data_sorted, x2.size(), a1.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a1.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,2>(i1data.get(), gemm.b(), x2.size(), a1.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a1.size(), a4.size());
   out()->add_block(odata, a4, a1, x3, x0);
 }
@@ -208,21 +203,20 @@ void Task856::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c2.size(), a1.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c2.size(), a1.size());
       // tensor label: I1514
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3, x3, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), a3.size(), x3.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a3.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -237,21 +231,20 @@ void Task857::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a3, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a3, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a3, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I1515
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a3.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a3.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a3.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a3.size());
   out()->add_block(odata, a4, a3, x3, x0);
 }
@@ -287,21 +280,20 @@ void Task859::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a3, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a3, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a3, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, x1, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, x1, a3)]);
-      sort_indices<1,2,0,3,0,1,-1,2>(i1data, i1data_sorted, a4.size(), x2.size(), x1.size(), a3.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a3.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,-1,2>(i1data.get(), gemm.b(), a4.size(), x2.size(), x1.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a3.size());
   out()->add_block(odata, a4, a3, x3, x0);
 }
@@ -316,21 +308,20 @@ void Task860::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a3, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a3, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a3, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a3.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a3, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a3, a4, x1)]);
-      sort_indices<3,0,1,2,0,1,1,2>(i1data, i1data_sorted, x2.size(), a3.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a3.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,2>(i1data.get(), gemm.b(), x2.size(), a3.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a3.size(), a4.size());
   out()->add_block(odata, a4, a3, x3, x0);
 }
@@ -345,21 +336,20 @@ void Task861::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a4.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a4.size());
       // tensor label: I1517
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3, x3, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), a3.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a1.size()*c2.size(), a3.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a3.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -374,21 +364,20 @@ void Task862::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a3, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a3, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a3, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I1518
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a3, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a3.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a3.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a3.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a3.size());
   out()->add_block(odata, a4, a3, x3, x0);
 }
@@ -429,21 +418,20 @@ void Task864::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a3, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a3, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a3, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, x1, a3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, x1, a3)]);
-      sort_indices<2,1,0,3,0,1,1,2>(i1data, i1data_sorted, a4.size(), x2.size(), x1.size(), a3.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a3.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,2>(i1data.get(), gemm.b(), a4.size(), x2.size(), x1.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a3.size());
   out()->add_block(odata, a4, a3, x3, x0);
 }
@@ -458,21 +446,20 @@ void Task865::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*a3.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a3.size());
       // tensor label: I1604
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x5, x0, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x5, x0, x4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), x5.size(), x0.size(), x4.size());
-      dgemm_("T", "N", a1.size()*a3.size(), c2.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, a1.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x5.size(), x0.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -487,23 +474,22 @@ void Task866::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x5, x0, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x5, x0, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x5, x0, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size(), c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,-1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x4.size(), c2.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x4.size());
+        sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), c2.size());
   out()->add_block(odata, c2, x5, x0, x4);
 }
@@ -518,23 +504,22 @@ void Task867::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x5, x0, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x5, x0, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x5, x0, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size(), c2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma526
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c2, x1)]);
-        sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x4.size(), c2.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x4.size());
+        sort_indices<2,3,0,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), c2.size());
   out()->add_block(odata, c2, x5, x0, x4);
 }
@@ -549,21 +534,20 @@ void Task868::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, x1, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, a4.size(), x1.size(), c2.size(), a1.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), x1.size(), c2.size(), a1.size());
       // tensor label: I1610
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a4, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a4, x0, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), a4.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a4.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -578,21 +562,20 @@ void Task869::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a3.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, a4)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), a4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a3.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a3.size(), a4.size());
   out()->add_block(odata, a3, a4, x0, x1);
 }
@@ -607,21 +590,20 @@ void Task870::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, x1, c2, a3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, a4.size(), x1.size(), c2.size(), a3.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), x1.size(), c2.size(), a3.size());
       // tensor label: I1613
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a4, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a4, x0, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), a4.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a4.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -636,21 +618,20 @@ void Task871::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a4)]);
-      sort_indices<0,2,1,3,0,1,4,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,4,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a4.size());
   out()->add_block(odata, a1, a4, x0, x1);
 }
@@ -665,21 +646,20 @@ void Task872::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1, a4, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x1, a4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size(), a4.size(), a1.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x1.size(), a4.size(), a1.size());
       // tensor label: I1616
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a4, x1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -694,21 +674,20 @@ void Task873::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, a4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, a4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, a4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a3.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, x2, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, x2, a4)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), a4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a3.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a3.size(), a4.size());
   out()->add_block(odata, a3, a4, x1, x0);
 }
@@ -723,21 +702,20 @@ void Task874::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x1, a4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x1, a4, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size(), a4.size(), a3.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x1.size(), a4.size(), a3.size());
       // tensor label: I1619
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a4, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a4, x0, x1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), a4.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a4.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -752,21 +730,20 @@ void Task875::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, a4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, a4)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a4.size());
   out()->add_block(odata, a1, a4, x0, x1);
 }
@@ -781,19 +758,18 @@ void Task876::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma562
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size());
     // tensor label: I1701
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -829,19 +805,18 @@ void Task878::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     // tensor label: Gamma564
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size());
+    gemm.reserve(x5.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size());
     // tensor label: I1705
     std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x5.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x5.size(),
-           1.0, i0data_sorted, x5.size(), i1data_sorted, x5.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, c2, x0, a1);
 }
@@ -898,19 +873,18 @@ void Task881::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(a2.size(), a1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size());
+    gemm.reserve(x2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size());
     // tensor label: I240
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x2, x1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x2.size(), x1.size());
-    dgemm_("T", "N", a2.size(), a1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), a1.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -925,23 +899,22 @@ void Task882::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), a1.size());
   out()->add_block(odata, a1, x0, x2, x1);
 }
@@ -956,21 +929,20 @@ void Task883::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma51
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: I243
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, a1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, a1, a2)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), a1.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), x3.size(), a1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -985,19 +957,18 @@ void Task884::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size()*a2.size(), x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, a2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), a2.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), a2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, x2.size(), c3.size());
-    dgemm_("T", "N", x3.size()*a1.size()*a2.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*a2.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), a2.size(), x2.size());
   out()->add_block(odata, x2, x3, a1, a2);
 }
@@ -1012,19 +983,18 @@ void Task885::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size()*x2.size(), a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), a3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, a3.size(), a2.size());
-    dgemm_("T", "N", x3.size()*a1.size()*x2.size(), a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*x2.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), a3.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, x3, a1, a2);
 }
@@ -1039,21 +1009,20 @@ void Task886::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c4, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c4.size(), a3.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, a3, a2)]);
-      sort_indices<1,2,0,3,0,1,-1,1>(i1data, i1data_sorted, x2.size(), c4.size(), a3.size(), a2.size());
-      dgemm_("T", "N", x3.size()*a1.size(), x2.size()*a2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, x3, a1, a2);
 }
@@ -1068,21 +1037,20 @@ void Task887::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c3.size(), a1.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c3.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, a4, c3)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, x2.size(), a2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", x3.size()*a1.size(), x2.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), a2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, x3, a1, a2);
 }
@@ -1097,21 +1065,20 @@ void Task888::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x3, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x3, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x3, a1, a2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, a4, c3)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, x2.size(), a2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", x3.size()*a1.size(), x2.size()*a2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x2.size(), a2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, x3, a1, a2);
 }
@@ -1126,23 +1093,22 @@ void Task889::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size(), a2.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c3, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c3, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c3.size(), x4.size());
+        gemm.reserve(c3.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c3.size(), x4.size());
         // tensor label: I1622
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x5, x0, x4, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x5, x0, x4, x1)]);
-        sort_indices<2,1,4,0,3,5,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x5.size(), x0.size(), x4.size(), x1.size());
-        dgemm_("T", "N", a1.size(), a2.size()*x0.size()*x1.size(), c3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c3.size()*x5.size()*x4.size(), i1data_sorted, c3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,3,5,2,1,4,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x5.size(), x0.size(), x4.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -1159,21 +1125,20 @@ void Task890::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x5, x0, x4, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x5, x0, x4, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x5, x0, x4, x1), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size()*x1.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma531
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x2, x4, x3, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x2, x4, x3, x1)]);
-      sort_indices<2,4,0,1,3,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x2.size(), x4.size(), x3.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,3,5,2,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x2.size(), x4.size(), x3.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, x2, c3)]);
-      sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a2.size(), x2.size(), c3.size());
-      dgemm_("T", "N", x5.size()*x0.size()*x4.size()*x1.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x0.size()*x4.size()*x1.size());
+      sort_indices<1,3,2,0,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), x1.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x5, x0, x4, x1);
 }
@@ -1188,23 +1153,22 @@ void Task891::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size(), a2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x5, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x5.size(), x4.size());
+        gemm.reserve(c3.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), x5.size(), x4.size());
         // tensor label: I1625
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c3, x5, x4, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c3, x5, x4, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i1data, i1data_sorted, a2.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a1.size(), a2.size()*x1.size()*x0.size(), c3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c3.size()*x5.size()*x4.size(), i1data_sorted, c3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -1221,21 +1185,20 @@ void Task892::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), a2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma532
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x1, x2, x0)]);
-      sort_indices<2,4,0,1,3,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,3,5,2,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, x2, c3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), x2.size(), c3.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), a2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), a2.size(), c3.size());
   out()->add_block(odata, a2, c3, x5, x4, x1, x0);
 }
@@ -1250,23 +1213,22 @@ void Task893::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size(), a2.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, x6, x5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a1, x6, x5)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a1.size(), x6.size(), x5.size());
         // tensor label: I1628
         std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x7, x0, x6, x5, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x7, x0, x6, x5, x1)]);
-        sort_indices<1,3,4,0,2,5,0,1,1,1>(i1data, i1data_sorted, a2.size(), x7.size(), x0.size(), x6.size(), x5.size(), x1.size());
-        dgemm_("T", "N", a1.size(), a2.size()*x0.size()*x1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,2,5,1,3,4,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x7.size(), x0.size(), x6.size(), x5.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -1283,23 +1245,22 @@ void Task894::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x7, x0, x6, x5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x7, x0, x6, x5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x7, x0, x6, x5, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), a2.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma533
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x4, x1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x4, x1, x3, x2)]);
-        sort_indices<4,6,7,0,1,2,3,5,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,5,4,6,7,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, a2, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, a2, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x4.size(), a2.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), a2.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x0.size()*x6.size()*x5.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), a2.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x0.size(), x6.size(), x5.size(), x1.size(), a2.size());
   out()->add_block(odata, a2, x7, x0, x6, x5, x1);
 }
@@ -1316,23 +1277,22 @@ void Task895::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x7, x0, x6, x5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x7, x0, x6, x5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x7, x0, x6, x5, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), a2.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma349
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x4, x3, x2, x1)]);
-        sort_indices<4,5,6,0,1,2,3,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,7,4,5,6,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, x2, a2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, x2, a2)]);
-        sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, x4.size(), x3.size(), x2.size(), a2.size());
-        dgemm_("T", "N", x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), a2.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x0.size()*x6.size()*x5.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), x2.size(), a2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x0.size(), x6.size(), x5.size(), x1.size(), a2.size());
   out()->add_block(odata, a2, x7, x0, x6, x5, x1);
 }
@@ -1347,21 +1307,20 @@ void Task896::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1, a3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1, a3, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size(), a3.size(), a2.size());
+      gemm.reserve(a3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size(), a3.size(), a2.size());
       // tensor label: I1634
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x1, x2, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x1, x2, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x1.size(), x2.size(), x0.size());
-      dgemm_("T", "N", a1.size()*a2.size(), x1.size()*x0.size(), a3.size()*x2.size(),
-             1.0, i0data_sorted, a3.size()*x2.size(), i1data_sorted, a3.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*a2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x1.size(), x2.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -1376,23 +1335,22 @@ void Task897::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma471
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x1, x4, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x1, x4, x3, x2, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x1.size(), x4.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x1, x2, x0);
 }
@@ -1407,21 +1365,20 @@ void Task898::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size()*a2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c3, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c3.size(), a2.size());
+      gemm.reserve(c3.size()*x5.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c3.size(), a2.size());
       // tensor label: I1640
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x5, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x5, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x5.size(), x0.size(), x1.size());
-      dgemm_("T", "N", a1.size()*a2.size(), x0.size()*x1.size(), c3.size()*x5.size(),
-             1.0, i0data_sorted, c3.size()*x5.size(), i1data_sorted, c3.size()*x5.size(),
-             1.0, odata_sorted, a1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x5.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -1436,23 +1393,22 @@ void Task899::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x0, x1), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x1.size(), c3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma526
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x4.size(), c3.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x1.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), c3.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x1.size(), c3.size());
   out()->add_block(odata, c3, x5, x0, x1);
 }
@@ -42,23 +42,22 @@ void Task900::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x0, x1), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x1.size(), c3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma50
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, x2, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, x2, c3)]);
-        sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, x4.size(), x3.size(), x2.size(), c3.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x1.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), x2.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x1.size(), c3.size());
   out()->add_block(odata, c3, x5, x0, x1);
 }
@@ -73,21 +72,20 @@ void Task901::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: I1646
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, x3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, x3, a1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), a2.size(), x3.size(), a1.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*a1.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a2.size(), x3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -102,21 +100,20 @@ void Task902::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a2, x3, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a2, x3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a2, x3, a1), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), x2.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c4, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c4.size(), a1.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c4.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, a3, a2)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c4.size(), a3.size(), a2.size());
-      dgemm_("T", "N", x3.size()*a1.size(), x2.size()*a2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), a2.size());
   out()->add_block(odata, x2, a2, x3, a1);
 }
@@ -131,25 +128,24 @@ void Task903::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma526
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1, x3, x2)]);
-          sort_indices<0,2,4,5,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<1,3,0,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size(), x3.size(), x2.size());
           // tensor label: I1658
           std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3, x2, x5, a1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3, x2, x5, a1, x4)]);
-          sort_indices<3,5,1,2,0,4,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size(), x2.size(), x5.size(), a1.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), a2.size()*a1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<0,4,3,5,1,2,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x3.size(), x2.size(), x5.size(), a1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -166,19 +162,18 @@ void Task904::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x3, x2, x5, a1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x3, x2, x5, a1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x3, x2, x5, a1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size()*x4.size(), a2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a3.size());
     // tensor label: I1659
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a2, x3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a2, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a2.size(), x3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*a1.size()*x4.size(), a2.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a2.size(), x3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), a2.size(), x3.size(), x2.size());
   out()->add_block(odata, a2, x3, x2, x5, a1, x4);
 }
@@ -214,25 +209,24 @@ void Task906::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma50
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x2, x1);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x2, x1)]);
-          sort_indices<0,2,3,4,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<1,5,0,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
           // tensor label: I1661
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a2, x5, a1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a2, x5, a1, x4)]);
-          sort_indices<3,5,0,1,2,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a2.size(), x5.size(), a1.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), a2.size()*a1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<2,4,3,5,0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), a2.size(), x5.size(), a1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -249,19 +243,18 @@ void Task907::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, a2, x5, a1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, a2, x5, a1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, a2, x5, a1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size()*x4.size(), x3.size()*x2.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a3.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, x2, a2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, x2, a2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x3.size(), x2.size(), a2.size());
-    dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size()*x2.size()*a2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x3.size(), x2.size(), a2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size(), x2.size(), a2.size());
   out()->add_block(odata, x3, x2, a2, x5, a1, x4);
 }
@@ -276,25 +269,24 @@ void Task908::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, a2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         for (auto& x3 : *range_[1]) {
           // tensor label: Gamma545
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x2, x3, x1);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x2, x3, x1)]);
-          sort_indices<0,2,3,4,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x2.size(), x3.size(), x1.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<1,5,0,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x2.size(), x3.size(), x1.size());
           // tensor label: I1664
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, x2, x5, a1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, x2, x5, a1, x4)]);
-          sort_indices<3,5,2,0,1,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), x2.size(), x5.size(), a1.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), a2.size()*a1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<1,4,3,5,2,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), x2.size(), x5.size(), a1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, a2);
 }
@@ -311,19 +303,18 @@ void Task909::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a2, x2, x5, a1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a2, x2, x5, a1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a2, x2, x5, a1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size()*x4.size(), x3.size()*a2.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a3.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a2.size(), a3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*a1.size()*x4.size(), x3.size()*a2.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), x3.size(), a2.size(), x2.size());
   out()->add_block(odata, x3, a2, x2, x5, a1, x4);
 }
@@ -354,21 +345,20 @@ void Task911::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: I261
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x1, x0);
 }
@@ -383,21 +373,20 @@ void Task912::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x3, c4, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x3, c4, x2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), x3.size(), c4.size(), x2.size());
+      gemm.reserve(c4.size()*c3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x3.size(), c4.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, c2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, c2, c3)]);
-      sort_indices<3,1,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), c4.size(), c2.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c1.size()*c2.size(), c4.size()*c3.size(),
-             1.0, i0data_sorted, c4.size()*c3.size(), i1data_sorted, c4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), c2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x3, x2);
 }
@@ -412,21 +401,20 @@ void Task913::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x3, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c2.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, a4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), a4.size());
+      gemm.reserve(a4.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c2.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x3, a3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x3, a3, x2)]);
-      sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, a4.size(), x3.size(), a3.size(), x2.size());
-      dgemm_("T", "N", c1.size()*c2.size(), x3.size()*x2.size(), a4.size()*a3.size(),
-             1.0, i0data_sorted, a4.size()*a3.size(), i1data_sorted, a4.size()*a3.size(),
-             1.0, odata_sorted, c1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,-2,1>(i1data.get(), gemm.b(), a4.size(), x3.size(), a3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, c1, c2, x3, x2);
 }
@@ -441,21 +429,20 @@ void Task914::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma548
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x1, x4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x1.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size(), x1.size(), x4.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, c2, x4)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x1, x0);
 }
@@ -470,21 +457,20 @@ void Task915::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma549
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x7, x1, x6);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x7, x1, x6)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x7.size(), x1.size(), x6.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x7.size(), x1.size(), x6.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x7, c2, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x7, c2, x6)]);
-      sort_indices<1,3,0,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), x7.size(), c2.size(), x6.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*c2.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), x7.size(), c2.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), c2.size());
   out()->add_block(odata, c1, c2, x1, x0);
 }
@@ -515,21 +501,20 @@ void Task917::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, a2, a4), 0.0);
+  GemmBatch<double> gemm(a2.size()*a4.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, x0, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, x0, a4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), x0.size(), a4.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size(), x0.size(), a4.size());
       // tensor label: I1113
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x1, x0)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a2.size()*a4.size(), c1.size()*c3.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, a2.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a2.size(), a4.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, a2, a4);
 }
@@ -544,21 +529,20 @@ void Task918::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c3, x2)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x1, x0);
 }
@@ -573,21 +557,20 @@ void Task919::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, a2, a4), 0.0);
+  GemmBatch<double> gemm(a4.size()*a2.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& c6 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c5, a4, c6, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c5, a4, c6, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c5.size(), a4.size(), c6.size(), a2.size());
+      gemm.reserve(c6.size()*c5.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c5.size(), a4.size(), c6.size(), a2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c6, c3, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c6, c3, c5)]);
-      sort_indices<3,1,0,2,0,1,8,1>(i1data, i1data_sorted, c1.size(), c6.size(), c3.size(), c5.size());
-      dgemm_("T", "N", a4.size()*a2.size(), c1.size()*c3.size(), c6.size()*c5.size(),
-             1.0, i0data_sorted, c6.size()*c5.size(), i1data_sorted, c6.size()*c5.size(),
-             1.0, odata_sorted, a4.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,8,1>(i1data.get(), gemm.b(), c1.size(), c6.size(), c3.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, a4.size(), a2.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, a2, a4);
 }
@@ -602,21 +585,20 @@ void Task920::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, a2, a4), 0.0);
+  GemmBatch<double> gemm(a2.size()*a4.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& c6 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c5, a2, c6, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c5, a2, c6, a4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c5.size(), a2.size(), c6.size(), a4.size());
+      gemm.reserve(c6.size()*c5.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c5.size(), a2.size(), c6.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c6, c3, c5);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c6, c3, c5)]);
-      sort_indices<3,1,0,2,0,1,-4,1>(i1data, i1data_sorted, c1.size(), c6.size(), c3.size(), c5.size());
-      dgemm_("T", "N", a2.size()*a4.size(), c1.size()*c3.size(), c6.size()*c5.size(),
-             1.0, i0data_sorted, c6.size()*c5.size(), i1data_sorted, c6.size()*c5.size(),
-             1.0, odata_sorted, a2.size()*a4.size());
+      sort_indices<0,2,3,1,0,1,-4,1>(i1data.get(), gemm.b(), c1.size(), c6.size(), c3.size(), c5.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a2.size(), a4.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, a2, a4);
 }
@@ -631,21 +613,20 @@ void Task921::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, a2, a4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, a2, a4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, a2, a4), 0.0);
+  GemmBatch<double> gemm(a2.size()*a4.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, x2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, x2, a4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), x2.size(), a4.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), x2.size(), a4.size());
       // tensor label: I1352
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", a2.size()*a4.size(), c1.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a2.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a2.size(), a4.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, a2, a4);
 }
@@ -660,21 +641,20 @@ void Task922::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c1.size()*c3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x0 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x1, c3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x1, c3, x0)]);
-      sort_indices<1,3,0,2,0,1,-2,1>(i1data, i1data_sorted, c1.size(), x1.size(), c3.size(), x0.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c1.size()*c3.size(), x1.size()*x0.size(),
-             1.0, i0data_sorted, x1.size()*x0.size(), i1data_sorted, x1.size()*x0.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,-2,1>(i1data.get(), gemm.b(), c1.size(), x1.size(), c3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c1.size(), c3.size());
   out()->add_block(odata, c1, c3, x3, x2);
 }
@@ -799,21 +779,20 @@ void Task928::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c4, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c4.size(), a2.size());
+      gemm.reserve(c4.size()*c3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), c4.size(), a2.size());
       // tensor label: I1637
       std::unique_ptr<double[]> i1data = in(1)->get_block(c4, c3, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, c3, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), c3.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a1.size()*a2.size(), x1.size()*x0.size(), c4.size()*c3.size(),
-             1.0, i0data_sorted, c4.size()*c3.size(), i1data_sorted, c4.size()*c3.size(),
-             1.0, odata_sorted, a1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), c3.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, a1, a2);
 }
@@ -828,21 +807,20 @@ void Task929::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c4.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, x2, c3)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), c4.size(), x2.size(), c3.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c4.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c4.size(), c3.size());
   out()->add_block(odata, c4, c3, x1, x0);
 }
@@ -857,21 +835,20 @@ void Task930::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a1, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma503
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x2.size(), x0.size());
       // tensor label: I1670
       std::unique_ptr<double[]> i1data = in(1)->get_block(a1, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a1.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a1.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), a2.size());
   out()->add_block(odata, x1, x0, a1, a2);
 }
@@ -886,21 +863,20 @@ void Task931::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a2, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, a2, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a2, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, x2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, x2, a4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), x2.size(), a4.size());
+      gemm.reserve(a4.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), x2.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a1, a3, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a1, a3, a2)]);
-      sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, a4.size(), a1.size(), a3.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x2.size(), a1.size()*a2.size(), a4.size()*a3.size(),
-             1.0, i0data_sorted, a4.size()*a3.size(), i1data_sorted, a4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<1,3,2,0,0,1,-2,1>(i1data.get(), gemm.b(), a4.size(), a1.size(), a3.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), a1.size(), a2.size());
   out()->add_block(odata, a1, a2, x3, x2);
 }
@@ -915,21 +891,20 @@ void Task932::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a1, a2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma566
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x1.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, a2)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, x1, x0, a1, a2);
 }
@@ -944,21 +919,20 @@ void Task933::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a1, a2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*a2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma567
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x1.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, x6, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, x6, a2)]);
-      sort_indices<0,2,1,3,0,1,-1,1>(i1data, i1data_sorted, x7.size(), a1.size(), x6.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*a2.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-1,1>(i1data.get(), gemm.b(), x7.size(), a1.size(), x6.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a2.size());
   out()->add_block(odata, x1, x0, a1, a2);
 }
@@ -989,19 +963,18 @@ void Task936::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size());
     // tensor label: Gamma5
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, x1, x0)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
-    dgemm_("T", "N", c1.size(), x2.size()*x1.size()*x0.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, c1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), x3.size(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -1016,23 +989,22 @@ void Task937::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), x4.size(), x3.size());
         // tensor label: Gamma104
         std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x5, x4, x3, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,2>(i1data, i1data_sorted, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
-        dgemm_("T", "N", c1.size(), x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -1047,23 +1019,22 @@ void Task938::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c1.size(), x3.size());
         // tensor label: Gamma4
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
-        dgemm_("T", "N", c1.size(), x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -1119,21 +1090,20 @@ void Task941::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: Gamma29
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, c2, a1);
 }
@@ -1148,21 +1118,20 @@ void Task942::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x3, x2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x3, x2, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), x3.size(), x2.size(), a1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x3.size(), x2.size(), a1.size());
       // tensor label: Gamma25
       std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x3, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,-1,2>(i1data, i1data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,-1,2>(i1data.get(), gemm.b(), x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, c2, a1);
 }
@@ -1177,21 +1146,20 @@ void Task943::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c2, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: Gamma27
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,2>(i1data, i1data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
-      dgemm_("T", "N", a1.size()*c2.size(), x0.size()*x1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<1,2,0,3,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, x1, x0, c2, a1);
 }
@@ -1206,21 +1174,20 @@ void Task944::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c2.size(), a1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c2.size(), a1.size());
       // tensor label: Gamma29
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, c2, a1);
 }
@@ -1276,21 +1243,20 @@ void Task947::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: Gamma29
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, c1, a2);
 }
@@ -1305,21 +1271,20 @@ void Task948::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, x2, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), x2.size(), a2.size());
+      gemm.reserve(x2.size()*x3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), x2.size(), a2.size());
       // tensor label: Gamma5
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, x3, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,2>(i1data, i1data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,1,0,0,1,1,2>(i1data.get(), gemm.b(), x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, c1, a2);
 }
@@ -1334,21 +1299,20 @@ void Task949::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c1.size());
   out()->add_block(odata, x1, x0, c1, a2);
 }
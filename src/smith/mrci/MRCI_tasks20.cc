@@ -42,21 +42,20 @@ void Task950::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), c1.size(), a2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), c1.size(), a2.size());
       // tensor label: Gamma29
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, c1, a2);
 }
@@ -87,19 +86,18 @@ void Task952::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x2, x1, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x2, x1, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x2, x1, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size());
+    gemm.reserve(x3.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size());
     // tensor label: Gamma51
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0, x2, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0, x2, x1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
-    dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size(), x2.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, x0, x2, x1, a1);
 }
@@ -114,23 +112,22 @@ void Task953::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x2, x1, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x2, x1, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x2, x1, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), x3.size());
         // tensor label: Gamma50
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,2>(i1data, i1data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, x0, x2, x1, a1);
 }
@@ -145,23 +142,22 @@ void Task954::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x2, x1, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x2, x1, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x2, x1, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, a1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), a1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), a1.size());
         // tensor label: Gamma49
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<0,1,2,3,4,5,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
-        dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<3,4,5,0,1,2,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, x0, x2, x1, a1);
 }
@@ -192,21 +188,20 @@ void Task956::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, c1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, c1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, c1, c2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c2, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c2.size(), x2.size());
       // tensor label: Gamma0
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
-      dgemm_("T", "N", c1.size()*c2.size(), x0.size()*x1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*c2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x1, c1, c2);
 }
@@ -237,19 +232,18 @@ void Task958::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*c1.size()*a2.size(), x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1, c1, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1, c1, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size(), c1.size(), a2.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size(), c1.size(), a2.size());
     // tensor label: Gamma12
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,2,1>(i1data, i1data_sorted, x0.size(), x1.size());
-    dgemm_("T", "N", c3.size()*c1.size()*a2.size(), x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c3.size()*c1.size()*a2.size());
+    sort_indices<0,1,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, c3, c1, a2);
 }
@@ -264,19 +258,18 @@ void Task959::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, c1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, c1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, c1, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size()*a2.size(), x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size(), c3.size(), a2.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size(), c3.size(), a2.size());
     // tensor label: Gamma12
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size());
-    dgemm_("T", "N", c1.size()*c3.size()*a2.size(), x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a2.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
   out()->add_block(odata, x0, c3, c1, a2);
 }
@@ -344,19 +337,18 @@ void Task963::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), a3.size()*c2.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a3, c2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
-    dgemm_("T", "N", x0.size(), a3.size()*c2.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), c2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, x0.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, a3, c2, a1, x0);
 }
@@ -371,19 +363,18 @@ void Task964::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c2, a1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, c2, a1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c2, a1, x0), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size()*a3.size(), x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a1, c2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a3.size());
     // tensor label: Gamma32
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, x1.size(), x0.size());
-    dgemm_("T", "N", a1.size()*c2.size()*a3.size(), x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a1.size()*c2.size()*a3.size());
+    sort_indices<1,0,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, a3, c2, a1, x0);
 }
@@ -414,21 +405,20 @@ void Task966::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, a1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size()*a2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), a2.size());
       // tensor label: Gamma51
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", a1.size()*a2.size(), x0.size()*x1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*a2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x1, a1, a2);
 }
@@ -459,21 +449,20 @@ void Task969::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, c1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, c1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, c1, c2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c2, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c2.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c2.size(), x2.size());
       // tensor label: Gamma0
       std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,2,1>(i1data, i1data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
-      dgemm_("T", "N", c1.size()*c2.size(), x0.size()*x1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*c2.size());
+      sort_indices<0,2,1,3,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x1, c1, c2);
 }
@@ -504,23 +493,22 @@ void Task971::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, x1, x0, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, x1, x0, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, x1, x0, c1), 0.0);
+  GemmBatch<double> gemm(c1.size(), x2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c1.size(), x3.size());
         // tensor label: Gamma4
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
-        dgemm_("T", "N", c1.size(), x2.size()*x1.size()*x0.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, c1.size(), x2.size(), x1.size(), x0.size());
   out()->add_block(odata, x2, x1, x0, c1);
 }
@@ -551,19 +539,18 @@ void Task973::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, c1), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size()*c1.size(), x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c1, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c1, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c1.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c1.size(), x1.size());
     // tensor label: Gamma12
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, x0.size(), x1.size());
-    dgemm_("T", "N", c3.size()*a2.size()*c1.size(), x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c3.size()*a2.size()*c1.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, x0, c3, a2, c1);
 }
@@ -578,19 +565,18 @@ void Task974::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, c3, a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, c3, a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, c3, a2, c1), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, x1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), x1.size());
     // tensor label: Gamma12
     std::unique_ptr<double[]> i1data = in(1)->get_block(x0, x1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x0, x1)]);
-    sort_indices<1,0,0,1,2,1>(i1data, i1data_sorted, x0.size(), x1.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<0,1,0,1,2,1>(i1data.get(), gemm.b(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, x0, c3, a2, c1);
 }
@@ -621,21 +607,20 @@ void Task976::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, a1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, a1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, a1, c2), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), x2.size());
       // tensor label: Gamma27
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
-      dgemm_("T", "N", a1.size()*c2.size(), x0.size()*x1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x1, a1, c2);
 }
@@ -650,21 +635,20 @@ void Task977::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, a1, c2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, a1, c2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, a1, c2), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x3.size(), x2.size());
       // tensor label: Gamma29
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, x0, x1, a1, c2);
 }
@@ -695,21 +679,20 @@ void Task979::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, c1), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), x2.size());
       // tensor label: Gamma29
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<2,3,0,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, a2, c1);
 }
@@ -724,21 +707,20 @@ void Task980::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x1, x0, a2, c1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x1, x0, a2, c1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x1, x0, a2, c1), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x3.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x3.size(), x2.size());
       // tensor label: Gamma29
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), x1.size()*x0.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<2,3,0,1,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), x1.size(), x0.size());
   out()->add_block(odata, x1, x0, a2, c1);
 }
@@ -769,23 +751,22 @@ void Task982::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x2, x1, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x2, x1, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x2, x1, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), x0.size()*x2.size()*x1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), x3.size());
         // tensor label: Gamma50
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x0, x4, x3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x0, x4, x3, x2, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i1data, i1data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", a1.size(), x0.size()*x2.size()*x1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), x0.size(), x2.size(), x1.size());
   out()->add_block(odata, x0, x2, x1, a1);
 }
@@ -853,19 +834,18 @@ void Task986::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a3, c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a3, c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a3, c2, a1), 0.0);
+  GemmBatch<double> gemm(a3.size()*c2.size()*a1.size(), x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a3, c2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a3, c2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a1.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a1.size());
     // tensor label: Gamma32
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, x1.size(), x0.size());
-    dgemm_("T", "N", a3.size()*c2.size()*a1.size(), x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, a3.size()*c2.size()*a1.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), x1.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, x0, a3, c2, a1);
 }
@@ -880,19 +860,18 @@ void Task987::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, a3, c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, a3, c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, a3, c2, a1), 0.0);
+  GemmBatch<double> gemm(x0.size(), a1.size()*c2.size()*a3.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma32
     std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: t2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x1, a1, c2, a3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x1, a1, c2, a3)]);
-    sort_indices<0,1,2,3,0,1,2,1>(i1data, i1data_sorted, x1.size(), a1.size(), c2.size(), a3.size());
-    dgemm_("T", "N", x0.size(), a1.size()*c2.size()*a3.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), c2.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, x0.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, x0, a3, c2, a1);
 }
@@ -923,21 +902,20 @@ void Task989::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x0, x1, a1, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x0, x1, a1, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x0, x1, a1, a2), 0.0);
+  GemmBatch<double> gemm(a1.size()*a2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, a2)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), a2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), a2.size());
       // tensor label: Gamma51
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,2,1>(i1data, i1data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", a1.size()*a2.size(), x0.size()*x1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*a2.size());
+      sort_indices<1,3,0,2,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a1.size(), a2.size(), x0.size(), x1.size());
   out()->add_block(odata, x0, x1, a1, a2);
 }
@@ -1839,21 +1839,20 @@ void Task110::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma0
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: I1
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), c1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c2.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), c1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -1868,19 +1867,18 @@ void Task111::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size()*x2.size(), c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x3, c3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x3, c3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x3.size(), c3.size(), x2.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x3.size(), c3.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,-2,1>(i1data, i1data_sorted, c2.size(), c3.size());
-    dgemm_("T", "N", c1.size()*x3.size()*x2.size(), c2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*x3.size()*x2.size());
+    sort_indices<0,1,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), c2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -1895,21 +1893,20 @@ void Task112::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size(), x2.size()*c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c1.size(), x3.size());
       // tensor label: I280
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, c2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, c2, c3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), c2.size(), c3.size());
-      dgemm_("T", "N", c1.size()*x3.size(), x2.size()*c2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), c2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), c2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -1945,21 +1942,20 @@ void Task114::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x3, x2), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size(), c2.size()*x2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x2, a4, c3)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), x2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", c1.size()*x3.size(), c2.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), x2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), c2.size(), x2.size());
   out()->add_block(odata, c2, c1, x3, x2);
 }
@@ -1974,19 +1970,18 @@ void Task115::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(c2.size(), c1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    gemm.reserve(x2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size());
     // tensor label: I4
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x1, x2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x1.size(), x2.size());
-    dgemm_("T", "N", c2.size(), c1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c2.size(), c1.size(), x0.size(), x1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2001,23 +1996,22 @@ void Task116::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma1
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x0, x1, x2);
 }
@@ -2032,21 +2026,20 @@ void Task117::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: I7
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c1, c2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c1, c2, x3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c1.size(), c2.size(), x3.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c2.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c1.size(), c2.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c2.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2061,19 +2054,18 @@ void Task118::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c1, c2, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*c2.size()*x3.size(), x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c2.size(), x3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a3.size(), x2.size());
-    dgemm_("T", "N", c1.size()*c2.size()*x3.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*c2.size()*x3.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, c1, c2, x3);
 }
@@ -2088,21 +2080,20 @@ void Task119::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c1, c2, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*x3.size(), x2.size()*c2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, c2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, c2, c3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), c2.size(), c3.size());
-      dgemm_("T", "N", c1.size()*x3.size(), x2.size()*c2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c1.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), c2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), x3.size(), x2.size(), c2.size());
   out()->add_block(odata, x2, c1, c2, x3);
 }
@@ -2117,25 +2108,24 @@ void Task120::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma80
           std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x1, x4, x3, x2)]);
-          sort_indices<1,3,4,5,0,2,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<0,2,1,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I249
           std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, c1, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, c1, x5, x4)]);
-          sort_indices<4,5,1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), c1.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), c2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<0,3,4,5,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), c1.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), c1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2152,19 +2142,18 @@ void Task121::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, x2, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, x2, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, x2, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), c2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c3, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c3, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c3.size(), x4.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), c3.size(), x4.size());
     // tensor label: I250
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3, x3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3, x3, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size(), x3.size(), x2.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), c2.size()*x3.size()*x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c3.size(), x3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, x3, x2, c1, x5, x4);
 }
@@ -2200,25 +2189,24 @@ void Task123::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x3 : *range_[1]) {
           // tensor label: Gamma81
           std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x2, x4, x1, x3);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x2, x4, x1, x3)]);
-          sort_indices<1,2,3,5,0,4,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x2.size(), x4.size(), x1.size(), x3.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<0,4,1,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size(), x2.size(), x4.size(), x1.size(), x3.size());
           // tensor label: I252
           std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, c1, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, c1, x5, x4)]);
-          sort_indices<4,2,5,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), c1.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), c2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<0,3,4,2,5,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), c1.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), c1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2235,19 +2223,18 @@ void Task124::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, x2, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, x2, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, x2, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), c2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c3, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c3, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c3.size(), x4.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), c3.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, c3)]);
-    sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), c3.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), c2.size()*x3.size()*x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, x3, x2, c1, x5, x4);
 }
@@ -2262,25 +2249,24 @@ void Task125::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma82
           std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5, x3, x4, x1, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5, x3, x4, x1, x2)]);
-          sort_indices<1,2,3,5,0,4,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size(), x3.size(), x4.size(), x1.size(), x2.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<0,4,1,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size(), x3.size(), x4.size(), x1.size(), x2.size());
           // tensor label: I255
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2, x2, c1, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2, x2, c1, x5, x4)]);
-          sort_indices<4,0,5,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c2.size(), x2.size(), c1.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), c2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<1,3,4,0,5,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c2.size(), x2.size(), c1.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), c1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2297,19 +2283,18 @@ void Task126::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c2, x2, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c2, x2, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c2, x2, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), x3.size()*c2.size()*x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c3, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c3, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c3.size(), x4.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), c3.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c3, c2, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c3, c2, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c3.size(), c2.size(), x2.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size()*c2.size()*x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c3.size(), c2.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size(), c2.size(), x2.size());
   out()->add_block(odata, x3, c2, x2, c1, x5, x4);
 }
@@ -2324,23 +2309,22 @@ void Task127::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(c1.size(), c2.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, c1, x5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, c1, x5)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), c1.size(), x5.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), c1.size(), x5.size());
         // tensor label: I264
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x7, x6, x0, x5, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x7, x6, x0, x5, x1)]);
-        sort_indices<1,2,4,0,3,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), x7.size(), x6.size(), x0.size(), x5.size(), x1.size());
-        dgemm_("T", "N", c1.size(), c2.size()*x0.size()*x1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, c1.size());
+        sort_indices<0,3,5,1,2,4,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x7.size(), x6.size(), x0.size(), x5.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2357,23 +2341,22 @@ void Task128::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x6, x0, x5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x6, x0, x5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x6, x0, x5, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x0.size()*x5.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma85
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x0, x5, x1, x4, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x0, x5, x1, x4, x3, x2)]);
-        sort_indices<5,6,7,0,1,2,3,4,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,4,5,6,7,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x0.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,2>(i1data, i1data_sorted, c2.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x7.size()*x6.size()*x0.size()*x5.size()*x1.size(), c2.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x6.size()*x0.size()*x5.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), c2.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x0.size(), x5.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x6, x0, x5, x1);
 }
@@ -2390,23 +2373,22 @@ void Task129::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x6, x0, x5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x6, x0, x5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x6, x0, x5, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x6.size()*x0.size()*x5.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma86
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x0, x5, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x0, x5, x4, x3, x1, x2)]);
-        sort_indices<4,5,7,0,1,2,3,6,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x0.size(), x5.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,6,4,5,7,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x0.size(), x5.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, c2, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, c2, x2)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x4.size(), x3.size(), c2.size(), x2.size());
-        dgemm_("T", "N", x7.size()*x6.size()*x0.size()*x5.size()*x1.size(), c2.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x6.size()*x0.size()*x5.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), c2.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x6.size(), x0.size(), x5.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x6, x0, x5, x1);
 }
@@ -2421,21 +2403,20 @@ void Task130::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(c1.size()*c2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2, c2, c3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2, c2, c3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size(), c2.size(), c3.size());
+      gemm.reserve(c3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x2.size(), c2.size(), c3.size());
       // tensor label: I270
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x0, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x0, x2)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size(), x0.size(), x2.size());
-      dgemm_("T", "N", c1.size()*c2.size(), x1.size()*x0.size(), c3.size()*x2.size(),
-             1.0, i0data_sorted, c3.size()*x2.size(), i1data_sorted, c3.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*c2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size(), x0.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2450,23 +2431,22 @@ void Task131::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1, x0, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1, x0, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1, x0, x2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size()*x2.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma87
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x0, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x0, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x0.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x0.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x0.size()*x2.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x0.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), x2.size(), c3.size());
   out()->add_block(odata, c3, x1, x0, x2);
 }
@@ -2481,21 +2461,20 @@ void Task132::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(c1.size()*c2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& x5 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, c2, x5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, c2, x5)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), c2.size(), x5.size());
+      gemm.reserve(a3.size()*x5.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), c2.size(), x5.size());
       // tensor label: I273
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x1, x5, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x1, x5, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x1.size(), x5.size(), x0.size());
-      dgemm_("T", "N", c1.size()*c2.size(), x1.size()*x0.size(), a3.size()*x5.size(),
-             1.0, i0data_sorted, a3.size()*x5.size(), i1data_sorted, a3.size()*x5.size(),
-             1.0, odata_sorted, c1.size()*c2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x1.size(), x5.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2510,23 +2489,22 @@ void Task133::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x1, x5, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x1, x5, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x1, x5, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x5.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma88
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x5, x0, x4, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x5, x0, x4, x3, x2)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x5.size(), x0.size(), x4.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,-1,2>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x1.size()*x5.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x1.size()*x5.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,-1,2>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x5.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x1, x5, x0);
 }
@@ -2541,23 +2519,22 @@ void Task134::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x1, x5, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x1, x5, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x1, x5, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x5.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma89
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x5, x4, x3, x0, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x5, x4, x3, x0, x2)]);
-        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data, i0data_sorted, x1.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, a3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, a3, x2)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x4.size(), x3.size(), a3.size(), x2.size());
-        dgemm_("T", "N", x1.size()*x5.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x1.size()*x5.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), a3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x5.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x1, x5, x0);
 }
@@ -2572,25 +2549,24 @@ void Task135::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x3 : *range_[1]) {
           // tensor label: Gamma94
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x0, x4, x1, x3);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x0, x4, x1, x3)]);
-          sort_indices<0,1,3,5,2,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x0.size(), x4.size(), x1.size(), x3.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<2,4,0,1,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x0.size(), x4.size(), x1.size(), x3.size());
           // tensor label: I291
           std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, x5, c1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, x5, c1, x4)]);
-          sort_indices<3,2,5,1,0,4,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), x5.size(), c1.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), c2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<0,4,3,2,5,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), x5.size(), c1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), c1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2607,19 +2583,18 @@ void Task136::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, x2, x5, c1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, x2, x5, c1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, x2, x5, c1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*c1.size()*x4.size(), c2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c1, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c1, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c1.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c1.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), a3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*c1.size()*x4.size(), c2.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*c1.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c1.size(), x4.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, x3, x2, x5, c1, x4);
 }
@@ -2634,25 +2609,24 @@ void Task137::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma87
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x0, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x0, x2)]);
-          sort_indices<0,1,3,5,2,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x0.size(), x2.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<2,4,0,1,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x0.size(), x2.size());
           // tensor label: I294
           std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, c1, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, c1, x5, x4)]);
-          sort_indices<4,5,1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), c1.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), c2.size()*c1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<0,3,4,5,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), c1.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), c1.size());
   out()->add_block(odata, c2, c1, x0, x1);
 }
@@ -2669,19 +2643,18 @@ void Task138::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, x2, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, x2, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, x2, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), c2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a3, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a3, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a3.size(), x5.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a3.size(), x5.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), x3.size(), a3.size(), x2.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), c2.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, x3, x2, c1, x5, x4);
 }
@@ -2712,23 +2685,22 @@ void Task140::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: Gamma3
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x3, x4, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x3, x4, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x5.size()*x4.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x3.size(), x4.size(), x1.size(), x0.size());
         // tensor label: I10
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c1, x5, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c1, x5, x4)]);
-        sort_indices<2,0,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), c1.size(), x5.size(), x4.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, x3.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c1.size(), x5.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -2743,19 +2715,18 @@ void Task141::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x5, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x5, c2, x4)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x5.size(), c2.size(), x4.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x5.size(), c2.size(), x4.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c2)]);
-    sort_indices<1,0,0,1,2,1>(i1data, i1data_sorted, x3.size(), c2.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<0,1,0,1,2,1>(i1data.get(), gemm.b(), x3.size(), c2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, c1, x5, x4);
 }
@@ -2770,21 +2741,20 @@ void Task142::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x3.size()*c1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x5, c3, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x5, c3, x4)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), x5.size(), c3.size(), x4.size());
+      gemm.reserve(c3.size()*c2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x5.size(), c3.size(), x4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c3, c1, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c3, c1, c2)]);
-      sort_indices<3,1,0,2,0,1,-2,1>(i1data, i1data_sorted, x3.size(), c3.size(), c1.size(), c2.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x3.size()*c1.size(), c3.size()*c2.size(),
-             1.0, i0data_sorted, c3.size()*c2.size(), i1data_sorted, c3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), c3.size(), c1.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
   out()->add_block(odata, x3, c1, x5, x4);
 }
@@ -2799,21 +2769,20 @@ void Task143::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, c1, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, c1, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, c1, x5, x4), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size(), x4.size()*x3.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c1, x5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c1, x5)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c1.size(), x5.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c1.size(), x5.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, c2)]);
-      sort_indices<3,0,1,2,0,1,1,2>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), c2.size());
-      dgemm_("T", "N", c1.size()*x5.size(), x4.size()*x3.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, c1.size()*x5.size());
+      sort_indices<1,2,3,0,0,1,1,2>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, x3, c1, x5, x4);
 }
@@ -2828,23 +2797,22 @@ void Task144::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: I13
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x3)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x2, x1, x0);
 }
@@ -2859,19 +2827,18 @@ void Task145::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x3.size(), c1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, c2, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
+    gemm.reserve(c2.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), c2.size(), x3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c2)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, c1.size(), c2.size());
-    dgemm_("T", "N", x5.size()*x4.size()*x3.size(), c1.size(), c2.size(),
-           1.0, i0data_sorted, c2.size(), i1data_sorted, c2.size(),
-           1.0, odata_sorted, x5.size()*x4.size()*x3.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), c2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -2886,19 +2853,18 @@ void Task146::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(c1.size()*x5.size()*x4.size(), x3.size(), odata_sorted.get());
   for (auto& a2 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+    gemm.reserve(a2.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x5.size(), x4.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a2.size(), x3.size());
-    dgemm_("T", "N", c1.size()*x5.size()*x4.size(), x3.size(), a2.size(),
-           1.0, i0data_sorted, a2.size(), i1data_sorted, a2.size(),
-           1.0, odata_sorted, c1.size()*x5.size()*x4.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c1.size(), x5.size(), x4.size(), x3.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -2913,21 +2879,20 @@ void Task147::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), c1.size()*x3.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c2 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, x4)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), x4.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), x4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, a3, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, a3, c2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c1.size(), x3.size(), a3.size(), c2.size());
-      dgemm_("T", "N", x5.size()*x4.size(), c1.size()*x3.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), a3.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), c1.size(), x3.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -2942,21 +2907,20 @@ void Task148::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x3), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size(), x3.size()*c1.size(), odata_sorted.get());
   for (auto& c2 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x5, x4)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x5.size(), x4.size());
+      gemm.reserve(a3.size()*c2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x5.size(), x4.size());
       // tensor label: I370
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, c1, c2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, c1, c2)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), x3.size(), c1.size(), c2.size());
-      dgemm_("T", "N", x5.size()*x4.size(), x3.size()*c1.size(), a3.size()*c2.size(),
-             1.0, i0data_sorted, a3.size()*c2.size(), i1data_sorted, a3.size()*c2.size(),
-             1.0, odata_sorted, x5.size()*x4.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x3.size(), c1.size(), c2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x3.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x3);
 }
@@ -42,21 +42,20 @@ void Task250::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c3.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, a2, c3, c4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, a2, c3, c4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a2.size(), c3.size(), c4.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a2.size(), c3.size(), c4.size());
       // tensor label: I402
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, x1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c3.size(), c1.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, a2.size()*c3.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -71,21 +70,20 @@ void Task251::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c1.size()*c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, c4, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, c4, x2)]);
-      sort_indices<1,3,0,2,0,1,2,1>(i1data, i1data_sorted, c1.size(), x3.size(), c4.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c1.size()*c4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,2,1>(i1data.get(), gemm.b(), c1.size(), x3.size(), c4.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c1.size(), c4.size());
   out()->add_block(odata, c1, c4, x1, x0);
 }
@@ -100,21 +98,20 @@ void Task252::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x2.size(), x1.size());
       // tensor label: I405
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -129,23 +126,22 @@ void Task253::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), c3.size());
   out()->add_block(odata, c3, x0, x2, x1);
 }
@@ -160,21 +156,20 @@ void Task254::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x2.size(), x1.size());
       // tensor label: I408
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -189,23 +184,22 @@ void Task255::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), c1.size());
   out()->add_block(odata, c1, x0, x2, x1);
 }
@@ -220,21 +214,20 @@ void Task256::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2, x1, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size(), x1.size(), a2.size());
+      gemm.reserve(x1.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x2.size(), x1.size(), a2.size());
       // tensor label: I411
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0, x1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0, x1, x2)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size(), x1.size(), x2.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), x1.size()*x2.size(),
-             1.0, i0data_sorted, x1.size()*x2.size(), i1data_sorted, x1.size()*x2.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size(), x1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -249,23 +242,22 @@ void Task257::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma1
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x1, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), c3.size());
   out()->add_block(odata, c3, x0, x1, x2);
 }
@@ -280,21 +272,20 @@ void Task258::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x2, x1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x2, x1, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), x2.size(), x1.size(), a2.size());
+      gemm.reserve(x1.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x2.size(), x1.size(), a2.size());
       // tensor label: I414
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x1, x0, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x1, x0, x2)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x1.size(), x0.size(), x2.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), x1.size()*x2.size(),
-             1.0, i0data_sorted, x1.size()*x2.size(), i1data_sorted, x1.size()*x2.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x1.size(), x0.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -309,23 +300,22 @@ void Task259::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x1, x0, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x1, x0, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x1, x0, x2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size()*x2.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma87
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x0, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x0, x2)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x0.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x0.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x0.size()*x2.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x0.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), x2.size(), c1.size());
   out()->add_block(odata, c1, x1, x0, x2);
 }
@@ -340,21 +330,20 @@ void Task260::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2, c1, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2, c1, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size(), c1.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size(), c1.size(), x1.size());
       // tensor label: I417
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", a2.size()*c1.size(), c3.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -369,23 +358,22 @@ void Task261::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), c3.size());
   out()->add_block(odata, c3, x0, x2, x1);
 }
@@ -400,21 +388,20 @@ void Task262::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c3.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a2, c3, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a2, c3, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), a2.size(), c3.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a2.size(), c3.size(), x1.size());
       // tensor label: I420
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x0, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", a2.size()*c3.size(), c1.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, a2.size()*c3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -429,23 +416,22 @@ void Task263::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x0.size()*x1.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma137
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x0, x1)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x0.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x0.size()*x1.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x0.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x0.size(), x1.size(), c1.size());
   out()->add_block(odata, c1, x2, x0, x1);
 }
@@ -460,21 +446,20 @@ void Task264::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x1, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x1.size(), c1.size(), a2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x1.size(), c1.size(), a2.size());
       // tensor label: I423
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -489,23 +474,22 @@ void Task265::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), c3.size());
   out()->add_block(odata, c3, x0, x2, x1);
 }
@@ -520,21 +504,20 @@ void Task266::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x1, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x1, c3, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x1.size(), c3.size(), a2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x1.size(), c3.size(), a2.size());
       // tensor label: I426
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x0, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x0, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), x0.size(), x2.size(), x1.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x0.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -549,23 +532,22 @@ void Task267::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x0, x2, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x0, x2, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x0, x2, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x2.size()*x1.size(), c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c1, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c1, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x5.size(), x4.size(), c1.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x2.size()*x1.size(), c1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x5.size(), x4.size(), c1.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x2.size(), x1.size(), c1.size());
   out()->add_block(odata, c1, x0, x2, x1);
 }
@@ -580,19 +562,18 @@ void Task268::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size()*a2.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, c4, c3, a2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, c4, c3, a2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), c4.size(), c3.size(), a2.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), c4.size(), c3.size(), a2.size());
     // tensor label: I429
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", c1.size()*c3.size()*a2.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c1.size()*c3.size()*a2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -605,23 +586,22 @@ void Task269::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma10
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c4, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c4.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c4.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -636,19 +616,18 @@ void Task270::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size()*c3.size(), x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: v2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c3, c4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c3, c4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c3.size(), c4.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c3.size(), c4.size());
     // tensor label: I432
     std::unique_ptr<double[]> i1data = in(1)->get_block(c4, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, x0)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), x0.size());
-    dgemm_("T", "N", c1.size()*a2.size()*c3.size(), x0.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, c1.size()*a2.size()*c3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -661,23 +640,22 @@ void Task271::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<double> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma10
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c4, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c4, x1)]);
-        sort_indices<0,1,3,2,0,1,-2,1>(i1data, i1data_sorted, x3.size(), x2.size(), c4.size(), x1.size());
-        dgemm_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<2,0,1,3,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c4.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -692,21 +670,20 @@ void Task272::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c3.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c3, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c3.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c3.size(), x3.size());
       // tensor label: I435
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, x0, x3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size(), x0.size(), x3.size());
-      dgemm_("T", "N", a2.size()*c3.size(), c1.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a2.size()*c3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), x0.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -721,21 +698,20 @@ void Task273::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), c1.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma197
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I436
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x0.size()*x3.size(), c1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), c1.size(), c4.size());
   out()->add_block(odata, c1, c4, x0, x3);
 }
@@ -776,21 +752,20 @@ void Task275::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), c1.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma0
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, c4)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x0.size()*x3.size(), c1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), c1.size(), x2.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), c1.size(), c4.size());
   out()->add_block(odata, c1, c4, x0, x3);
 }
@@ -805,21 +780,20 @@ void Task276::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, c4, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), c4.size(), x3.size());
       // tensor label: I438
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, x0, x3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size(), x0.size(), x3.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), x0.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -834,21 +808,20 @@ void Task277::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), c1.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma197
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I439
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, c4, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, c4, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c1.size(), c4.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x0.size()*x3.size(), c1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), c4.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), c1.size(), c4.size());
   out()->add_block(odata, c1, c4, x0, x3);
 }
@@ -884,21 +857,20 @@ void Task279::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c1.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, x1, c4)]);
-      sort_indices<2,1,0,3,0,1,1,2>(i1data, i1data_sorted, c1.size(), x2.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,2>(i1data.get(), gemm.b(), c1.size(), x2.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c1.size(), c4.size());
   out()->add_block(odata, c1, c4, x0, x3);
 }
@@ -913,21 +885,20 @@ void Task280::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c4.size()*c1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma155
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x0, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x0.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c1, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c1, x1)]);
-      sort_indices<0,3,1,2,0,1,-1,2>(i1data, i1data_sorted, x2.size(), c4.size(), c1.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c4.size()*c1.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,-1,2>(i1data.get(), gemm.b(), x2.size(), c4.size(), c1.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c4.size(), c1.size());
   out()->add_block(odata, c1, c4, x0, x3);
 }
@@ -942,21 +913,20 @@ void Task281::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a2, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a2, c1, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c4.size(), a2.size(), c1.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a2.size(), c1.size(), x3.size());
       // tensor label: I441
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c4, x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c4, x0, x3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), c4.size(), x0.size(), x3.size());
-      dgemm_("T", "N", a2.size()*c1.size(), c3.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c4.size(), x0.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -971,21 +941,20 @@ void Task282::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), c3.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma197
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I442
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c4, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c4, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), c4.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x0.size()*x3.size(), c3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c4.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), c3.size(), c4.size());
   out()->add_block(odata, c3, c4, x0, x3);
 }
@@ -1021,21 +990,20 @@ void Task284::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c3.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, x1, c4)]);
-      sort_indices<2,1,0,3,0,1,1,2>(i1data, i1data_sorted, c3.size(), x2.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,1,2>(i1data.get(), gemm.b(), c3.size(), x2.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c3.size(), c4.size());
   out()->add_block(odata, c3, c4, x0, x3);
 }
@@ -1050,21 +1018,20 @@ void Task285::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c4.size()*c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma155
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x0, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x0.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c3, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c3, x1)]);
-      sort_indices<0,3,1,2,0,1,-1,2>(i1data, i1data_sorted, x2.size(), c4.size(), c3.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c4.size()*c3.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,-1,2>(i1data.get(), gemm.b(), x2.size(), c4.size(), c3.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c4.size(), c3.size());
   out()->add_block(odata, c3, c4, x0, x3);
 }
@@ -1079,21 +1046,20 @@ void Task286::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*c1.size(), a2.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c1, x3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c1.size(), x3.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c1.size(), x3.size());
       // tensor label: I444
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a2, x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a2, x0, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), a2.size(), x0.size(), x3.size());
-      dgemm_("T", "N", c3.size()*c1.size(), a2.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, c3.size()*c1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a2.size(), x0.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1108,21 +1074,20 @@ void Task287::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a2, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a2, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a2, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), a4.size()*a2.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma197
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I445
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a2, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a2, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a2.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x0.size()*x3.size(), a4.size()*a2.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a2.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), a4.size(), a2.size());
   out()->add_block(odata, a4, a2, x0, x3);
 }
@@ -1158,21 +1123,20 @@ void Task289::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a2, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a2, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a2, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a4.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, x1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, x1, a2)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, a4.size(), x2.size(), x1.size(), a2.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a4.size()*a2.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), a4.size(), x2.size(), x1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a4.size(), a2.size());
   out()->add_block(odata, a4, a2, x0, x3);
 }
@@ -1187,21 +1151,20 @@ void Task290::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a2, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a2, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a2, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), a2.size()*a4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma155
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x0, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x0.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a2, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a2, a4, x1)]);
-      sort_indices<0,3,1,2,0,1,1,2>(i1data, i1data_sorted, x2.size(), a2.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), a2.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,2>(i1data.get(), gemm.b(), x2.size(), a2.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a2.size(), a4.size());
   out()->add_block(odata, a4, a2, x0, x3);
 }
@@ -1216,21 +1179,20 @@ void Task291::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, c4, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), c4.size(), x3.size());
       // tensor label: I447
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c4, x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c4, x0, x3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), c4.size(), x0.size(), x3.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c4.size(), x0.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1245,21 +1207,20 @@ void Task292::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), c3.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma197
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I448
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, c4, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, c4, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c3.size(), c4.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x0.size()*x3.size(), c3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), c4.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), c3.size(), c4.size());
   out()->add_block(odata, c3, c4, x0, x3);
 }
@@ -1295,21 +1256,20 @@ void Task294::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c3.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, x1, c4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, x1, c4)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, c3.size(), x2.size(), x1.size(), c4.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), x2.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c3.size(), c4.size());
   out()->add_block(odata, c3, c4, x0, x3);
 }
@@ -1324,21 +1284,20 @@ void Task295::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, c4, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, c4, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, c4, x0, x3), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c4.size()*c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma155
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x0, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x0.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c3, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c3, x1)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c4.size(), c3.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c4.size()*c3.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), c3.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c4.size(), c3.size());
   out()->add_block(odata, c3, c4, x0, x3);
 }
@@ -1353,21 +1312,20 @@ void Task296::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size(), a2.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a4, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a4, c3, x3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), a4.size(), c3.size(), x3.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a4.size(), c3.size(), x3.size());
       // tensor label: I450
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a2, x0, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a2, x0, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), a2.size(), x0.size(), x3.size());
-      dgemm_("T", "N", c1.size()*c3.size(), a2.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, c1.size()*c3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a2.size(), x0.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1382,21 +1340,20 @@ void Task297::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a2, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a2, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a2, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), a4.size()*a2.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma197
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x2, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x2.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x2.size(), x1.size());
       // tensor label: I451
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, a2, x2, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, a2, x2, x1)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a2.size(), x2.size(), x1.size());
-      dgemm_("T", "N", x0.size()*x3.size(), a4.size()*a2.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a2.size(), x2.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), a4.size(), a2.size());
   out()->add_block(odata, a4, a2, x0, x3);
 }
@@ -1437,21 +1394,20 @@ void Task299::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, a2, x0, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, a2, x0, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, a2, x0, x3), 0.0);
+  GemmBatch<double> gemm(x0.size()*x3.size(), a4.size()*a2.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma0
       std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3, x1, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size(), x1.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, x1, a2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, x1, a2)]);
-      sort_indices<2,1,0,3,0,1,1,2>(i1data, i1data_sorted, a4.size(), x2.size(), x1.size(), a2.size());
-      dgemm_("T", "N", x0.size()*x3.size(), a4.size()*a2.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x0.size()*x3.size());
+      sort_indices<0,3,2,1,0,1,1,2>(i1data.get(), gemm.b(), a4.size(), x2.size(), x1.size(), a2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x3.size(), a4.size(), a2.size());
   out()->add_block(odata, a4, a2, x0, x3);
 }
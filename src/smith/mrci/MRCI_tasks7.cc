@@ -42,21 +42,20 @@ void Task300::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c3.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c3, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c3, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c3.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c3.size(), x4.size());
       // tensor label: I537
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x0, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x0, x4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x0.size(), x4.size());
-      dgemm_("T", "N", a2.size()*c3.size(), c1.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, a2.size()*c3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x0.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -71,23 +70,22 @@ void Task301::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x0, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x0, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x0, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma176
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x0, x4, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x0, x4, x2, x1)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x0.size(), x4.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x0.size(), x4.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,2>(i1data, i1data_sorted, c1.size(), x3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x4.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x4.size());
+        sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), c1.size(), x3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), c1.size());
   out()->add_block(odata, c1, x5, x0, x4);
 }
@@ -102,23 +100,22 @@ void Task302::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x0, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x0, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x0, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size(), c1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma178
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x1, x0, x4, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x1, x0, x4, x3, x2)]);
-        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x1.size(), x0.size(), x4.size(), x3.size(), x2.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x1.size(), x0.size(), x4.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<3,0,1,2,0,1,1,2>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x4.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x4.size());
+        sort_indices<2,3,0,1,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), c1.size());
   out()->add_block(odata, c1, x5, x0, x4);
 }
@@ -133,21 +130,20 @@ void Task303::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a2, c1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a2, c1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a2.size(), c1.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a2.size(), c1.size(), x4.size());
       // tensor label: I540
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x5, x4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x5.size(), x4.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), c3.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -162,23 +158,22 @@ void Task304::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x3, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,-1,2>(i1data, i1data_sorted, c3.size(), x3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,-1,2>(i1data.get(), gemm.b(), c3.size(), x3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x4, x0);
 }
@@ -193,23 +188,22 @@ void Task305::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma179
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x0, x1)]);
-        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x4, x0);
 }
@@ -224,21 +218,20 @@ void Task306::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*c1.size(), a2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1, c1, c4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1, c1, c4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size(), c1.size(), c4.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size(), c1.size(), c4.size());
       // tensor label: I549
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c4, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c4, x0, x1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), c4.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c3.size()*c1.size(), a2.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, c3.size()*c1.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c4.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, c3.size(), c1.size(), a2.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -253,21 +246,20 @@ void Task307::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c4, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c4, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c4, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a2.size()*c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I550
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c4, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c4, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c4.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a2.size()*c4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c4.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a2.size(), c4.size());
   out()->add_block(odata, a2, c4, x0, x1);
 }
@@ -303,21 +295,20 @@ void Task309::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, x1, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, a4.size(), x1.size(), c1.size(), a2.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), x1.size(), c1.size(), a2.size());
       // tensor label: I552
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, x1, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c3.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -332,21 +323,20 @@ void Task310::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a4.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a4.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a4.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a4.size(), c3.size());
   out()->add_block(odata, a4, c3, x1, x0);
 }
@@ -361,21 +351,20 @@ void Task311::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,2,1>(i1data, i1data_sorted, c3.size(), a4.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a4.size());
   out()->add_block(odata, a4, c3, x1, x0);
 }
@@ -390,21 +379,20 @@ void Task312::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size(), a2.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, c3, c4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1, c3, c4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size(), c3.size(), c4.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size(), c3.size(), c4.size());
       // tensor label: I555
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, c4, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, c4, x1, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, a2.size(), c4.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*c3.size(), a2.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*c3.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), c4.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -419,21 +407,20 @@ void Task313::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a2.size()*c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a2, c4, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a2, c4, x2)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x3.size(), a2.size(), c4.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a2.size()*c4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), a2.size(), c4.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a2.size(), c4.size());
   out()->add_block(odata, a2, c4, x1, x0);
 }
@@ -448,21 +435,20 @@ void Task314::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, c4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, c4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, c4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c4.size()*a2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c4, a2, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c4, a2, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), a2.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c4.size()*a2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a2.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c4.size(), a2.size());
   out()->add_block(odata, a2, c4, x1, x0);
 }
@@ -477,21 +463,20 @@ void Task315::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x1, a4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x1, a4, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c1.size(), x1.size(), a4.size(), a2.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x1.size(), a4.size(), a2.size());
       // tensor label: I558
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, x1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c3.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -506,21 +491,20 @@ void Task316::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a4.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, c3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, c3, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a4.size(), c3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a4.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), c3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a4.size(), c3.size());
   out()->add_block(odata, a4, c3, x1, x0);
 }
@@ -535,21 +519,20 @@ void Task317::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c3, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c3, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c3.size(), a4.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c3.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c3.size(), a4.size());
   out()->add_block(odata, a4, c3, x1, x0);
 }
@@ -564,21 +547,20 @@ void Task318::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(a4, x1, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a4, x1, c3, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, a4.size(), x1.size(), c3.size(), a2.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), a4.size(), x1.size(), c3.size(), a2.size());
       // tensor label: I561
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1, x1, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c1.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -593,21 +575,20 @@ void Task319::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a4.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a4.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a4.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a4.size(), c1.size());
   out()->add_block(odata, a4, c1, x1, x0);
 }
@@ -622,21 +603,20 @@ void Task320::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1, x1, x0), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c1.size()*a4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c1.size(), a4.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c1.size()*a4.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,2,1,0,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c1.size(), a4.size());
   out()->add_block(odata, a4, c1, x1, x0);
 }
@@ -651,21 +631,20 @@ void Task321::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, x1, a4, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, x1, a4, a2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), x1.size(), a4.size(), a2.size());
+      gemm.reserve(a4.size()*x1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), x1.size(), a4.size(), a2.size());
       // tensor label: I564
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c1, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c1, x0, x1)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), c1.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), a4.size()*x1.size(),
-             1.0, i0data_sorted, a4.size()*x1.size(), i1data_sorted, a4.size()*x1.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c1.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -680,21 +659,20 @@ void Task322::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a4, c1, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a4, c1, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a4, c1, x0, x1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a4.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: I565
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a4, c1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a4, c1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), a4.size(), c1.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a4.size()*c1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a4.size(), c1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a4.size(), c1.size());
   out()->add_block(odata, a4, c1, x0, x1);
 }
@@ -730,21 +708,20 @@ void Task324::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a2, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a2, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a2.size(), x5.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a2.size(), x5.size(), x4.size());
       // tensor label: I567
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x5, x4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), x5.size(), x4.size(), x0.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -759,23 +736,22 @@ void Task325::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x3, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,-1,2>(i1data, i1data_sorted, c1.size(), x3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,-1,2>(i1data.get(), gemm.b(), c1.size(), x3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x0);
 }
@@ -790,23 +766,22 @@ void Task326::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma179
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x0, x1)]);
-        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c1, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c1, x1)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x3.size(), x2.size(), c1.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), c1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), c1.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), c1.size());
   out()->add_block(odata, c1, x5, x4, x0);
 }
@@ -821,21 +796,20 @@ void Task327::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, a2, x5, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, a2, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c1.size(), a2.size(), x5.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), a2.size(), x5.size(), x4.size());
       // tensor label: I570
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x5, x4, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x5.size(), x4.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -850,23 +824,22 @@ void Task328::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma132
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x0, x3, x2, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x0, x3, x2, x1)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x3, x2, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x3, x2, x1)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i1data, i1data_sorted, c3.size(), x3.size(), x2.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x4, x0);
 }
@@ -881,23 +854,22 @@ void Task329::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x4, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x4, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma179
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x0, x1)]);
-        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x0.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x0.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, c3, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, c3, x1)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), c3.size(), x1.size());
-        dgemm_("T", "N", x5.size()*x4.size()*x0.size(), c3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), c3.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x4, x0);
 }
@@ -912,21 +884,20 @@ void Task330::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*c3.size(), a2.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c1, x2, c3, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c1, x2, c3, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, c1.size(), x2.size(), c3.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), c1.size(), x2.size(), c3.size(), x1.size());
       // tensor label: I597
       std::unique_ptr<double[]> i1data = in(1)->get_block(a2, x2, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a2, x2, x0, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, a2.size(), x2.size(), x0.size(), x1.size());
-      dgemm_("T", "N", c1.size()*c3.size(), a2.size()*x0.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, c1.size()*c3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), a2.size(), x2.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c1.size(), c3.size(), a2.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -941,23 +912,22 @@ void Task331::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a2, x2, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a2, x2, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a2, x2, x0, x1), 0.0);
+  GemmBatch<double> gemm(x2.size()*x0.size()*x1.size(), a2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma196
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x0, x1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x0, x1)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x0.size(), x1.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x0.size(), x1.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a2, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a2, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a2.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x0.size()*x1.size(), a2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x0.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a2.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x0.size(), x1.size(), a2.size());
   out()->add_block(odata, a2, x2, x0, x1);
 }
@@ -972,21 +942,20 @@ void Task332::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c3.size()*a2.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c3, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c3, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c3.size(), a2.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c3.size(), a2.size());
       // tensor label: I642
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, x3, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", c3.size()*a2.size(), c1.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, c3.size()*a2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c3.size(), a2.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1001,21 +970,20 @@ void Task333::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c1.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, a4, x1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, c1.size(), x2.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c1.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), x2.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c1.size(), a4.size());
   out()->add_block(odata, c1, a4, x3, x0);
 }
@@ -1030,21 +998,20 @@ void Task334::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c3.size(), c1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c3, a4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c3.size(), a4.size());
       // tensor label: I645
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, a4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, a4, x3, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c1.size(), a4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c3.size(), c1.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, a2.size()*c3.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c1.size(), a4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c3.size(), c1.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1059,21 +1026,20 @@ void Task335::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, a4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, a4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, a4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c1.size()*a4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma10
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x0, x1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x0, x1)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x0.size(), x1.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x0.size(), x1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c1, x2, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c1, x2, a4, x1)]);
-      sort_indices<1,3,0,2,0,1,-1,1>(i1data, i1data_sorted, c1.size(), x2.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c1.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,-1,1>(i1data.get(), gemm.b(), c1.size(), x2.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c1.size(), a4.size());
   out()->add_block(odata, c1, a4, x3, x0);
 }
@@ -1088,21 +1054,20 @@ void Task336::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(c1.size()*a2.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c1, a2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c1, a2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c1.size(), a2.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c1.size(), a2.size());
       // tensor label: I648
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x3, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", c1.size()*a2.size(), c3.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, c1.size()*a2.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c1.size(), a2.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1117,21 +1082,20 @@ void Task337::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, a4, x1)]);
-      sort_indices<3,1,0,2,0,1,-2,1>(i1data, i1data_sorted, c3.size(), x2.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c3.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,2,3,1,0,1,-2,1>(i1data.get(), gemm.b(), c3.size(), x2.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c3.size(), a4.size());
   out()->add_block(odata, c3, a4, x3, x0);
 }
@@ -1146,21 +1110,20 @@ void Task338::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(a2.size()*c1.size(), c3.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a2, c1, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a2, c1, a4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a2.size(), c1.size(), a4.size());
+      gemm.reserve(a4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a2.size(), c1.size(), a4.size());
       // tensor label: I651
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a4, x3, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a4, x3, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), a4.size(), x3.size(), x0.size());
-      dgemm_("T", "N", a2.size()*c1.size(), c3.size()*x0.size(), a4.size()*x3.size(),
-             1.0, i0data_sorted, a4.size()*x3.size(), i1data_sorted, a4.size()*x3.size(),
-             1.0, odata_sorted, a2.size()*c1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a2.size(), c1.size(), c3.size(), x0.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1175,21 +1138,20 @@ void Task339::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, a4, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, a4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, a4, x3, x0), 0.0);
+  GemmBatch<double> gemm(x3.size()*x0.size(), c3.size()*a4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma18
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x1, x0, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x1, x0, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x1.size(), x0.size(), x2.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x1.size(), x0.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, a4, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, a4, x1)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), x2.size(), a4.size(), x1.size());
-      dgemm_("T", "N", x3.size()*x0.size(), c3.size()*a4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x2.size(), a4.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), c3.size(), a4.size());
   out()->add_block(odata, c3, a4, x3, x0);
 }
@@ -1204,19 +1166,18 @@ void Task340::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     // tensor label: Gamma552
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x3)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x3.size());
+    gemm.reserve(x3.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x3.size());
     // tensor label: I1681
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x3.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x3.size(),
-           1.0, i0data_sorted, x3.size(), i1data_sorted, x3.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1252,19 +1213,18 @@ void Task342::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c1, c3, x0, a2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c1, c3, x0, a2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c1, c3, x0, a2), 0.0);
+  GemmBatch<double> gemm(x0.size(), c3.size()*a2.size()*c1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     // tensor label: Gamma554
     std::unique_ptr<double[]> i0data = in(0)->get_block(x0, x5);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x0, x5)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, x0.size(), x5.size());
+    gemm.reserve(x5.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), x0.size(), x5.size());
     // tensor label: I1685
     std::unique_ptr<double[]> i1data = in(1)->get_block(c3, a2, c1, x5);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, a2, c1, x5)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, c3.size(), a2.size(), c1.size(), x5.size());
-    dgemm_("T", "N", x0.size(), c3.size()*a2.size()*c1.size(), x5.size(),
-           1.0, i0data_sorted, x5.size(), i1data_sorted, x5.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), a2.size(), c1.size(), x5.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), c3.size(), a2.size(), c1.size());
   out()->add_block(odata, c1, c3, x0, a2);
 }
@@ -1316,19 +1276,18 @@ void Task345::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size());
+    gemm.reserve(x2.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size());
     // tensor label: I73
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x2, x0)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
-    dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, a1.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x2.size(), x0.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1343,23 +1302,22 @@ void Task346::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma24
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x2, x0);
 }
@@ -1374,21 +1332,20 @@ void Task347::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma25
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: I76
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, c2, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, c2, x3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), a1.size(), c2.size(), x3.size());
-      dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), c2.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1403,19 +1360,18 @@ void Task348::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size()*x3.size(), x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c2, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c2, x3)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c2.size(), x3.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), c2.size(), x3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, x2.size(), c3.size());
-    dgemm_("T", "N", a1.size()*c2.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a1.size()*c2.size()*x3.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, a1, c2, x3);
 }
@@ -1430,21 +1386,20 @@ void Task349::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
+  GemmBatch<double> gemm(a1.size()*x3.size(), x2.size()*c2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a1, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a1, c3, x3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a1.size(), c3.size(), x3.size());
+      gemm.reserve(c4.size()*c3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a1.size(), c3.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c2, c3)]);
-      sort_indices<1,3,0,2,0,1,-1,1>(i1data, i1data_sorted, x2.size(), c4.size(), c2.size(), c3.size());
-      dgemm_("T", "N", a1.size()*x3.size(), x2.size()*c2.size(), c4.size()*c3.size(),
-             1.0, i0data_sorted, c4.size()*c3.size(), i1data_sorted, c4.size()*c3.size(),
-             1.0, odata_sorted, a1.size()*x3.size());
+      sort_indices<0,2,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), c2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, a1.size(), x3.size(), x2.size(), c2.size());
   out()->add_block(odata, x2, a1, c2, x3);
 }
@@ -42,21 +42,20 @@ void Task350::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
+  GemmBatch<double> gemm(c2.size()*x3.size(), x2.size()*a1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a3, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a3, c2, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a3.size(), c2.size(), x3.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a3.size(), c2.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, a3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, a3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), c4.size(), a3.size(), a1.size());
-      dgemm_("T", "N", c2.size()*x3.size(), x2.size()*a1.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c2.size()*x3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), a3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size(), x2.size(), a1.size());
   out()->add_block(odata, x2, a1, c2, x3);
 }
@@ -71,21 +70,20 @@ void Task351::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
+  GemmBatch<double> gemm(c2.size()*x3.size(), x2.size()*a1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c2, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c2, x3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c2.size(), x3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c2.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, a4, c3)]);
-      sort_indices<3,2,0,1,0,1,-2,1>(i1data, i1data_sorted, x2.size(), a1.size(), a4.size(), c3.size());
-      dgemm_("T", "N", c2.size()*x3.size(), x2.size()*a1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*x3.size());
+      sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size(), x2.size(), a1.size());
   out()->add_block(odata, x2, a1, c2, x3);
 }
@@ -100,21 +98,20 @@ void Task352::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
+  GemmBatch<double> gemm(c2.size()*x3.size(), x2.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), x3.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c3.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, a1, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, a1, a4, c3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, x2.size(), a1.size(), a4.size(), c3.size());
-      dgemm_("T", "N", c2.size()*x3.size(), x2.size()*a1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size(), x2.size(), a1.size());
   out()->add_block(odata, x2, a1, c2, x3);
 }
@@ -129,21 +126,20 @@ void Task353::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, a1, c2, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, a1, c2, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, a1, c2, x3), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c3.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x3, x2, c3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, a1, c2, x3);
 }
@@ -158,21 +154,20 @@ void Task354::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma5
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: I79
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c2, a1, x3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c2, a1, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c2.size(), a1.size(), x3.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x2.size()*x3.size(),
-             1.0, i0data_sorted, x2.size()*x3.size(), i1data_sorted, x2.size()*x3.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c2.size(), a1.size(), x3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -187,19 +182,18 @@ void Task355::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2, a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2, a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2, a1, x3), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size()*x3.size(), x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, x3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, x3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), x3.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), x3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c3)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, x2.size(), c3.size());
-    dgemm_("T", "N", c2.size()*a1.size()*x3.size(), x2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, c2.size()*a1.size()*x3.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, c2, a1, x3);
 }
@@ -214,21 +208,20 @@ void Task356::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2, a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2, a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2, a1, x3), 0.0);
+  GemmBatch<double> gemm(a1.size()*x3.size(), x2.size()*c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c4, x3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*c3.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), c4.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, c2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, c2, c3)]);
-      sort_indices<3,1,0,2,0,1,1,1>(i1data, i1data_sorted, x2.size(), c4.size(), c2.size(), c3.size());
-      dgemm_("T", "N", a1.size()*x3.size(), x2.size()*c2.size(), c4.size()*c3.size(),
-             1.0, i0data_sorted, c4.size()*c3.size(), i1data_sorted, c4.size()*c3.size(),
-             1.0, odata_sorted, a1.size()*x3.size());
+      sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), c2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, a1.size(), x3.size(), x2.size(), c2.size());
   out()->add_block(odata, x2, c2, a1, x3);
 }
@@ -243,21 +236,20 @@ void Task357::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2, a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2, a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2, a1, x3), 0.0);
+  GemmBatch<double> gemm(c2.size()*x3.size(), x2.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, x3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x2, c4, a3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x2, c4, a3, a1)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x2.size(), c4.size(), a3.size(), a1.size());
-      dgemm_("T", "N", c2.size()*x3.size(), x2.size()*a1.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c2.size()*x3.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), c4.size(), a3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size(), x2.size(), a1.size());
   out()->add_block(odata, x2, c2, a1, x3);
 }
@@ -272,21 +264,20 @@ void Task358::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x2, c2, a1, x3), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x2, c2, a1, x3)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x2, c2, a1, x3), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x3, x2, c3)]);
-      sort_indices<3,0,1,2,0,1,-1,1>(i1data, i1data_sorted, a4.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<1,2,3,0,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, x2, c2, a1, x3);
 }
@@ -301,21 +292,20 @@ void Task359::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma27
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x0, x1, x2)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: I82
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, a1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, a1, x2)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), a1.size(), x2.size());
-      dgemm_("T", "N", x0.size()*x1.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), a1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -330,19 +320,18 @@ void Task360::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size()*x2.size(), c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), x2.size());
+    gemm.reserve(c3.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, c2.size(), c3.size());
-    dgemm_("T", "N", x3.size()*a1.size()*x2.size(), c2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*x2.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), c2.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -357,19 +346,18 @@ void Task361::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c2.size()*x2.size(), a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size());
-    dgemm_("T", "N", x3.size()*c2.size()*x2.size(), a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c2.size()*x2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), c2.size(), x2.size(), a1.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -384,19 +372,18 @@ void Task362::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size()*c2.size(), x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c2, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c2, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c2.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c2.size(), a3.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size());
-    dgemm_("T", "N", x3.size()*a1.size()*c2.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*a1.size()*c2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), c2.size(), x2.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -411,21 +398,20 @@ void Task363::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c4, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c4, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c4.size(), x2.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c4.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4, a3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4, a3, a1)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), c4.size(), a3.size(), a1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), c4.size(), a3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -440,21 +426,20 @@ void Task364::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, c4, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, c4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a1.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, a3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, a3, x2)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, x3.size(), c4.size(), a3.size(), x2.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x3.size()*x2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), a3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -469,21 +454,20 @@ void Task365::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), x2.size()*c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), c3.size(), a4.size());
       // tensor label: I823
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, c2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, c2, c3)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), c2.size(), c3.size());
-      dgemm_("T", "N", x3.size()*a1.size(), x2.size()*c2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), c2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), c2.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -519,21 +503,20 @@ void Task367::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), c2.size()*x2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c3.size(), a1.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c3.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x2, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x2, a4, c3)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), x2.size(), a4.size(), c3.size());
-      dgemm_("T", "N", x3.size()*a1.size(), c2.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), x2.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), c2.size(), x2.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -548,21 +531,20 @@ void Task368::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, a1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, a1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, a1, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c2.size(), x2.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a4.size());
+      gemm.reserve(a4.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, a3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, a3, a1)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), a3.size(), a1.size());
-      dgemm_("T", "N", x3.size()*c2.size(), x2.size()*a1.size(), a4.size()*a3.size(),
-             1.0, i0data_sorted, a4.size()*a3.size(), i1data_sorted, a4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), a3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x3.size(), c2.size(), x2.size(), a1.size());
   out()->add_block(odata, c2, x3, a1, x2);
 }
@@ -577,21 +559,20 @@ void Task369::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma29
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I88
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -606,19 +587,18 @@ void Task370::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(a1.size()*x3.size()*x2.size(), c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x3.size(), x2.size());
+    gemm.reserve(c3.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), x3.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size());
-    dgemm_("T", "N", a1.size()*x3.size()*x2.size(), c2.size(), c3.size(),
-           1.0, i0data_sorted, c3.size(), i1data_sorted, c3.size(),
-           1.0, odata_sorted, a1.size()*x3.size()*x2.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, a1.size(), x3.size(), x2.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -633,19 +613,18 @@ void Task371::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(c2.size()*x3.size()*x2.size(), a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x3, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x3, x2)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x3.size(), x2.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x3.size(), x2.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a3.size(), a1.size());
-    dgemm_("T", "N", c2.size()*x3.size()*x2.size(), a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c2.size()*x3.size()*x2.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), x3.size(), x2.size(), a1.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -660,19 +639,18 @@ void Task372::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c2.size()*a1.size(), x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a3, c2, a1);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a3, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a3.size(), c2.size(), a1.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a3.size(), c2.size(), a1.size());
     // tensor label: h1
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a3.size(), x2.size());
-    dgemm_("T", "N", x3.size()*c2.size()*a1.size(), x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x3.size()*c2.size()*a1.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, x3.size(), c2.size(), a1.size(), x2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -687,21 +665,20 @@ void Task373::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c3.size(), x2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c3.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, a4, c3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), a4.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -716,21 +693,20 @@ void Task374::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c4, a3, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c4, a3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c4.size(), a3.size(), x3.size(), x2.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a3.size(), x3.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c4, a3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c4, a3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size(), a3.size(), a1.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c4.size(), a3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -745,21 +721,20 @@ void Task375::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*x2.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), x3.size(), x2.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), x3.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, a4, c3)]);
-      sort_indices<3,2,0,1,0,1,-2,1>(i1data, i1data_sorted, c2.size(), a1.size(), a4.size(), c3.size());
-      dgemm_("T", "N", x3.size()*x2.size(), c2.size()*a1.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*x2.size());
+      sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x2.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -774,21 +749,20 @@ void Task376::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c3.size(), a1.size());
       // tensor label: I772
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, x3, x2)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -824,21 +798,20 @@ void Task378::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), a4.size());
       // tensor label: I775
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3, x3, x2)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a4.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x3.size()*x2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -874,21 +847,20 @@ void Task380::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x3.size()*x2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c4, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c4, a3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a3.size());
+      gemm.reserve(c4.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c4, a3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c4, a3, x2)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), c4.size(), a3.size(), x2.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x3.size()*x2.size(), c4.size()*a3.size(),
-             1.0, i0data_sorted, c4.size()*a3.size(), i1data_sorted, c4.size()*a3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), a3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,2,3,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -903,21 +875,20 @@ void Task381::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*a1.size(), x2.size()*c2.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c3.size(), a1.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c3.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, c2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, c2, c3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i1data, i1data_sorted, a4.size(), x2.size(), c2.size(), c3.size());
-      dgemm_("T", "N", x3.size()*a1.size(), x2.size()*c2.size(), a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, x3.size()*a1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), c2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x3.size(), a1.size(), x2.size(), c2.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -932,21 +903,20 @@ void Task382::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1, x3, x2), 0.0);
+  GemmBatch<double> gemm(x3.size()*c2.size(), x2.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a4, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a4, c2, a3)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x3.size(), a4.size(), c2.size(), a3.size());
+      gemm.reserve(a4.size()*a3.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a4.size(), c2.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, x2, a3, a1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, x2, a3, a1)]);
-      sort_indices<0,2,1,3,0,1,-1,1>(i1data, i1data_sorted, a4.size(), x2.size(), a3.size(), a1.size());
-      dgemm_("T", "N", x3.size()*c2.size(), x2.size()*a1.size(), a4.size()*a3.size(),
-             1.0, i0data_sorted, a4.size()*a3.size(), i1data_sorted, a4.size()*a3.size(),
-             1.0, odata_sorted, x3.size()*c2.size());
+      sort_indices<1,3,0,2,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), x2.size(), a3.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,3,0,2,1,1,1,1>(odata_sorted, odata, x3.size(), c2.size(), x2.size(), a1.size());
   out()->add_block(odata, c2, a1, x3, x2);
 }
@@ -961,19 +931,18 @@ void Task383::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size(), a1.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size());
+    gemm.reserve(x2.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size());
     // tensor label: I94
     std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x0, x1, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x0, x1, x2)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), x0.size(), x1.size(), x2.size());
-    dgemm_("T", "N", c2.size(), a1.size()*x0.size()*x1.size(), x2.size(),
-           1.0, i0data_sorted, x2.size(), i1data_sorted, x2.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x0.size(), x1.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x0.size(), x1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -988,23 +957,22 @@ void Task384::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma31
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a1.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), a1.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), a1.size());
   out()->add_block(odata, a1, x0, x1, x2);
 }
@@ -1042,21 +1010,20 @@ void Task386::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), 1, odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a1.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c3.size(), a1.size());
       // tensor label: h1
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<0,1,0,1,2,1>(i1data, i1data_sorted, a4.size(), c3.size());
-      dgemm_("T", "N", c2.size()*a1.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,0,1,2,1>(i1data.get(), gemm.b(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
   out()->add_block(odata, c2, a1);
 }
@@ -1069,21 +1036,20 @@ void Task387::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), 1, odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, a4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), a4.size());
+      gemm.reserve(a4.size()*c3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), a4.size());
       // tensor label: h1
       std::unique_ptr<double[]> i1data = in(1)->get_block(a4, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a4, c3)]);
-      sort_indices<1,0,0,1,-4,1>(i1data, i1data_sorted, a4.size(), c3.size());
-      dgemm_("T", "N", c2.size()*a1.size(), 1, a4.size()*c3.size(),
-             1.0, i0data_sorted, a4.size()*c3.size(), i1data_sorted, a4.size()*c3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<1,0,0,1,-4,1>(i1data.get(), gemm.b(), a4.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
   out()->add_block(odata, c2, a1);
 }
@@ -1096,23 +1062,22 @@ void Task388::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       for (auto& c5 : *range_[0]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a4, c5, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a4, c5, a1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, c3.size(), a4.size(), c5.size(), a1.size());
+        gemm.reserve(c5.size()*a4.size()*c3.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a4.size(), c5.size(), a1.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c5, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c5, a4, c3)]);
-        sort_indices<3,2,1,0,0,1,4,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), c3.size());
-        dgemm_("T", "N", a1.size(), c2.size(), c5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, c5.size()*a4.size()*c3.size(), i1data_sorted, c5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,3,2,1,0,1,4,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
   out()->add_block(odata, c2, a1);
 }
@@ -1125,23 +1090,22 @@ void Task389::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& c5 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c5, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c5, a4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c5.size(), a4.size());
+        gemm.reserve(c5.size()*a4.size()*c3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), c5.size(), a4.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c5, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c5, a4, c3)]);
-        sort_indices<3,1,2,0,0,1,-2,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), c3.size());
-        dgemm_("T", "N", a1.size(), c2.size(), c5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, c5.size()*a4.size()*c3.size(), i1data_sorted, c5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,3,1,2,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size());
   out()->add_block(odata, c2, a1);
 }
@@ -1154,23 +1118,22 @@ void Task390::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size(), a1.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a4 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a5, c3, a4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a5, c3, a4)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), a5.size(), c3.size(), a4.size());
+        gemm.reserve(a5.size()*a4.size()*c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a5.size(), c3.size(), a4.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a1, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a1, a4, c3)]);
-        sort_indices<0,3,2,1,0,1,-4,1>(i1data, i1data_sorted, a5.size(), a1.size(), a4.size(), c3.size());
-        dgemm_("T", "N", c2.size(), a1.size(), a5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, a5.size()*a4.size()*c3.size(), i1data_sorted, a5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<1,0,3,2,0,1,-4,1>(i1data.get(), gemm.b(), a5.size(), a1.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
   out()->add_block(odata, c2, a1);
 }
@@ -1183,23 +1146,22 @@ void Task391::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a1), 0.0);
+  GemmBatch<double> gemm(c2.size(), a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c3 : *range_[0]) {
       for (auto& a5 : *range_[2]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a4, c3, a5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a4, c3, a5)]);
-        sort_indices<1,2,3,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c3.size(), a5.size());
+        gemm.reserve(a5.size()*a4.size()*c3.size());
+        sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c3.size(), a5.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a5, a1, a4, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a5, a1, a4, c3)]);
-        sort_indices<2,3,0,1,0,1,2,1>(i1data, i1data_sorted, a5.size(), a1.size(), a4.size(), c3.size());
-        dgemm_("T", "N", c2.size(), a1.size(), a5.size()*a4.size()*c3.size(),
-               1.0, i0data_sorted, a5.size()*a4.size()*c3.size(), i1data_sorted, a5.size()*a4.size()*c3.size(),
-               1.0, odata_sorted, c2.size());
+        sort_indices<1,2,3,0,0,1,2,1>(i1data.get(), gemm.b(), a5.size(), a1.size(), a4.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<0,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size());
   out()->add_block(odata, c2, a1);
 }
@@ -1214,23 +1176,22 @@ void Task392::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& c3 : *range_[0]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x3, a1, x2, c3);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x3, a1, x2, c3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), a1.size(), x2.size(), c3.size());
+        gemm.reserve(c3.size()*x2.size()*x3.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), a1.size(), x2.size(), c3.size());
         // tensor label: I654
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3, x1, x2, x3, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3, x1, x2, x3, x0)]);
-        sort_indices<4,3,1,0,2,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size(), x1.size(), x2.size(), x3.size(), x0.size());
-        dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), c3.size()*x2.size()*x3.size(),
-               1.0, i0data_sorted, c3.size()*x2.size()*x3.size(), i1data_sorted, c3.size()*x2.size()*x3.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,2,5,4,3,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c3.size(), x1.size(), x2.size(), x3.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1247,21 +1208,20 @@ void Task393::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3, x1, x2, x3, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3, x1, x2, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3, x1, x2, x3, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x3.size()*x0.size(), c2.size()*c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma215
       std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x5, x2, x4, x3, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x5, x2, x4, x3, x0)]);
-      sort_indices<1,3,0,2,4,5,0,1,1,1>(i0data, i0data_sorted, x1.size(), x5.size(), x2.size(), x4.size(), x3.size(), x0.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,2,4,5,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x5.size(), x2.size(), x4.size(), x3.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x5, c3, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x5, c3, x4)]);
-      sort_indices<1,3,0,2,0,1,2,1>(i1data, i1data_sorted, c2.size(), x5.size(), c3.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x2.size()*x3.size()*x0.size(), c2.size()*c3.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x1.size()*x2.size()*x3.size()*x0.size());
+      sort_indices<0,2,1,3,0,1,2,1>(i1data.get(), gemm.b(), c2.size(), x5.size(), c3.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x3.size(), x0.size(), c2.size(), c3.size());
   out()->add_block(odata, c2, c3, x1, x2, x3, x0);
 }
@@ -1276,23 +1236,22 @@ void Task394::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, a1, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, a1, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x4.size(), a1.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), a1.size(), x3.size(), x2.size());
         // tensor label: I657
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x4, x0, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x4, x0, x3, x2)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x4.size(), x0.size(), x3.size(), x2.size());
-        dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x4.size(), x0.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1309,23 +1268,22 @@ void Task395::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x4, x0, x3, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x4, x0, x3, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x4, x0, x3, x2), 0.0);
+  GemmBatch<double> gemm(x1.size()*x4.size()*x0.size()*x3.size()*x2.size(), c2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma216
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x1, x5, x4, x0, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x1, x5, x4, x0, x3, x2)]);
-        sort_indices<0,1,3,2,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x1.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,4,5,6,7,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x1.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c2, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c2, x5)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x7.size(), x6.size(), c2.size(), x5.size());
-        dgemm_("T", "N", x1.size()*x4.size()*x0.size()*x3.size()*x2.size(), c2.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x1.size()*x4.size()*x0.size()*x3.size()*x2.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x7.size(), x6.size(), c2.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x1.size(), x4.size(), x0.size(), x3.size(), x2.size(), c2.size());
   out()->add_block(odata, c2, x1, x4, x0, x3, x2);
 }
@@ -1340,23 +1298,22 @@ void Task396::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: v2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x3, x2, a1);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x3, x2, a1)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x4.size(), x3.size(), x2.size(), a1.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x3.size(), x2.size(), a1.size());
         // tensor label: I660
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x1, x4, x3, x2, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x1, x4, x3, x2, x0)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x4.size(), x3.size(), x2.size(), x0.size());
-        dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x4.size(), x3.size(), x2.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1373,23 +1330,22 @@ void Task397::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x4, x3, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x4, x3, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x4, x3, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x4.size()*x3.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: Gamma217
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x6, x1, x5, x4, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x6, x1, x5, x4, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,6,7,0,1,1,1>(i0data, i0data_sorted, x7.size(), x6.size(), x1.size(), x5.size(), x4.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<2,4,5,6,7,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x6.size(), x1.size(), x5.size(), x4.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x7, x6, c2, x5);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, x6, c2, x5)]);
-        sort_indices<0,1,3,2,0,1,-1,2>(i1data, i1data_sorted, x7.size(), x6.size(), c2.size(), x5.size());
-        dgemm_("T", "N", x1.size()*x4.size()*x3.size()*x2.size()*x0.size(), c2.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, x1.size()*x4.size()*x3.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,2>(i1data.get(), gemm.b(), x7.size(), x6.size(), c2.size(), x5.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x1.size(), x4.size(), x3.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x4, x3, x2, x0);
 }
@@ -1404,21 +1360,20 @@ void Task398::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, c3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, c3, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), c3.size(), c2.size(), a1.size());
+      gemm.reserve(c3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), c3.size(), c2.size(), a1.size());
       // tensor label: I663
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x2, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), c3.size()*x2.size(),
-             1.0, i0data_sorted, c3.size()*x2.size(), i1data_sorted, c3.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1433,23 +1388,22 @@ void Task399::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma4
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x2, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x2, x3, x1, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x2.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x2, x1, x0);
 }
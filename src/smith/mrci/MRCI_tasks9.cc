@@ -42,21 +42,20 @@ void Task400::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x2, a1, c2, c3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, a1, c2, c3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size(), c2.size(), c3.size());
+      gemm.reserve(c3.size()*x2.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size(), c2.size(), c3.size());
       // tensor label: I666
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x2, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x2, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size(), x2.size(), x0.size());
-      dgemm_("T", "N", a1.size()*c2.size(), x1.size()*x0.size(), c3.size()*x2.size(),
-             1.0, i0data_sorted, c3.size()*x2.size(), i1data_sorted, c3.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size(), x2.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -71,23 +70,22 @@ void Task401::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1, x2, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1, x2, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x2.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma24
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, x4, c3, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, x4, c3, x3)]);
-        sort_indices<0,1,3,2,0,1,1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c3.size(), x3.size());
-        dgemm_("T", "N", x1.size()*x2.size()*x0.size(), c3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c3.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x1, x2, x0);
 }
@@ -102,21 +100,20 @@ void Task402::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, c2, x5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, c2, x5)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), c2.size(), x5.size());
+      gemm.reserve(c3.size()*x5.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), c2.size(), x5.size());
       // tensor label: I669
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x1, x5, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x1, x5, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x1.size(), x5.size(), x0.size());
-      dgemm_("T", "N", a1.size()*c2.size(), x1.size()*x0.size(), c3.size()*x5.size(),
-             1.0, i0data_sorted, c3.size()*x5.size(), i1data_sorted, c3.size()*x5.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x1.size(), x5.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -131,23 +128,22 @@ void Task403::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1, x5, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1, x5, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1, x5, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x5.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma220
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x5, x4, x0, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x5, x4, x0, x3, x2)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x5.size(), x4.size(), x0.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x4.size(), c3.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x1.size()*x5.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x1.size()*x5.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), c3.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x5.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x1, x5, x0);
 }
@@ -162,23 +158,22 @@ void Task404::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x1, x5, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x1, x5, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x1, x5, x0), 0.0);
+  GemmBatch<double> gemm(x1.size()*x5.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma222
         std::unique_ptr<double[]> i0data = in(0)->get_block(x1, x5, x4, x3, x2, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x1, x5, x4, x3, x2, x0)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x1.size(), x5.size(), x4.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x5.size(), x4.size(), x3.size(), x2.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, x2, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, x2, c3)]);
-        sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, x4.size(), x3.size(), x2.size(), c3.size());
-        dgemm_("T", "N", x1.size()*x5.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x1.size()*x5.size()*x0.size());
+        sort_indices<3,0,1,2,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), x2.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x5.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x1, x5, x0);
 }
@@ -193,21 +188,20 @@ void Task405::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a1, c3, x5);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a1, c3, x5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c3.size(), x5.size());
+      gemm.reserve(c3.size()*x5.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c3.size(), x5.size());
       // tensor label: I672
       std::unique_ptr<double[]> i1data = in(1)->get_block(c3, x5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c3, x5, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, c3.size(), x5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), c3.size()*x5.size(),
-             1.0, i0data_sorted, c3.size()*x5.size(), i1data_sorted, c3.size()*x5.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), c3.size(), x5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -222,23 +216,22 @@ void Task406::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma221
         std::unique_ptr<double[]> i0data = in(0)->get_block(x4, x5, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x4, x5, x3, x2, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x4.size(), x5.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, c3, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, c3, x3, x2)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x4.size(), c3.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), c3.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x1, x0);
 }
@@ -253,23 +246,22 @@ void Task407::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma104
         std::unique_ptr<double[]> i0data = in(0)->get_block(x2, x5, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x2, x5, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x5.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, x2, c3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, x2, c3)]);
-        sort_indices<2,0,1,3,0,1,-1,2>(i1data, i1data_sorted, x4.size(), x3.size(), x2.size(), c3.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), c3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<3,2,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), x2.size(), c3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), c3.size());
   out()->add_block(odata, c3, x5, x1, x0);
 }
@@ -284,23 +276,22 @@ void Task408::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& c3 : *range_[0]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c3, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c3, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c3.size(), x4.size());
+        gemm.reserve(c3.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c3.size(), x4.size());
         // tensor label: I699
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3, x5, x0, x1, x4);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3, x5, x0, x1, x4)]);
-        sort_indices<2,1,5,0,3,4,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size(), x5.size(), x0.size(), x1.size(), x4.size());
-        dgemm_("T", "N", a1.size(), c2.size()*x0.size()*x1.size(), c3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c3.size()*x5.size()*x4.size(), i1data_sorted, c3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,3,4,2,1,5,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c3.size(), x5.size(), x0.size(), x1.size(), x4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,3,2,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -317,21 +308,20 @@ void Task409::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3, x5, x0, x1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3, x5, x0, x1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3, x5, x0, x1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x1.size()*x4.size(), c2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma230
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4, x3, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4, x3, x2)]);
-      sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
       // tensor label: I700
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x5.size()*x0.size()*x1.size()*x4.size(), c2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x0.size()*x1.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x1.size(), x4.size(), c2.size(), c3.size());
   out()->add_block(odata, c2, c3, x5, x0, x1, x4);
 }
@@ -369,21 +359,20 @@ void Task411::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3, x5, x0, x1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3, x5, x0, x1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3, x5, x0, x1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size()*x1.size(), c2.size()*c3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: Gamma232
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x2, x4, x1, x3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x2, x4, x1, x3)]);
-      sort_indices<2,5,0,1,3,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x2.size(), x4.size(), x1.size(), x3.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,3,4,2,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x2.size(), x4.size(), x1.size(), x3.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, c3)]);
-      sort_indices<2,1,0,3,0,1,-1,2>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", x5.size()*x0.size()*x4.size()*x1.size(), c2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x0.size()*x4.size()*x1.size());
+      sort_indices<0,3,2,1,0,1,-1,2>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,3,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), x1.size(), c2.size(), c3.size());
   out()->add_block(odata, c2, c3, x5, x0, x1, x4);
 }
@@ -400,21 +389,20 @@ void Task412::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3, x5, x0, x1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3, x5, x0, x1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3, x5, x0, x1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x4.size()*x1.size(), c3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma234
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x3, x4, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x3, x4, x1, x2)]);
-      sort_indices<2,5,0,1,3,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x3.size(), x4.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,3,4,2,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x3.size(), x4.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,1,2>(i1data, i1data_sorted, x3.size(), c3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x5.size()*x0.size()*x4.size()*x1.size(), c3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x0.size()*x4.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), c3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<5,4,0,1,3,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x4.size(), x1.size(), c3.size(), c2.size());
   out()->add_block(odata, c2, c3, x5, x0, x1, x4);
 }
@@ -429,25 +417,24 @@ void Task413::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma230
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4, x3, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4, x3, x2)]);
-          sort_indices<0,3,4,5,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<1,2,0,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
           // tensor label: I702
           std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x3, x2, x5, c2, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x3, x2, x5, c2, x4)]);
-          sort_indices<3,5,1,2,0,4,0,1,1,1>(i1data, i1data_sorted, a1.size(), x3.size(), x2.size(), x5.size(), c2.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<0,4,3,5,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x3.size(), x2.size(), x5.size(), c2.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -464,19 +451,18 @@ void Task414::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x3, x2, x5, c2, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x3, x2, x5, c2, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x3, x2, x5, c2, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*c2.size()*x4.size(), a1.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), x4.size());
     // tensor label: I703
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*c2.size()*x4.size(), a1.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*c2.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a1.size(), x3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c2.size(), x4.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, a1, x3, x2, x5, c2, x4);
 }
@@ -512,25 +498,24 @@ void Task416::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma233
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x3, x1, x4, x2, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x3, x1, x4, x2, x0)]);
-          sort_indices<0,1,3,4,2,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x3.size(), x1.size(), x4.size(), x2.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<2,5,0,1,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x3.size(), x1.size(), x4.size(), x2.size(), x0.size());
           // tensor label: I708
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a1, x5, c2, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a1, x5, c2, x4)]);
-          sort_indices<3,0,5,1,2,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a1.size(), x5.size(), c2.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<2,4,3,0,5,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), a1.size(), x5.size(), c2.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -547,19 +532,18 @@ void Task417::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, a1, x5, c2, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, a1, x5, c2, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, a1, x5, c2, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*c2.size()*x4.size(), x3.size()*x2.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, x2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, x2, a1)]);
-    sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, a3.size(), x3.size(), x2.size(), a1.size());
-    dgemm_("T", "N", x5.size()*c2.size()*x4.size(), x3.size()*x2.size()*a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*c2.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,2>(i1data.get(), gemm.b(), a3.size(), x3.size(), x2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c2.size(), x4.size(), x3.size(), x2.size(), a1.size());
   out()->add_block(odata, x3, x2, a1, x5, c2, x4);
 }
@@ -574,25 +558,24 @@ void Task418::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         for (auto& x3 : *range_[1]) {
           // tensor label: Gamma235
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x1, x4, x3, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x1, x4, x3, x0)]);
-          sort_indices<0,1,3,4,2,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x1.size(), x4.size(), x3.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<2,5,0,1,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x1.size(), x4.size(), x3.size(), x0.size());
           // tensor label: I714
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, x5, c2, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, x5, c2, x4)]);
-          sort_indices<3,2,5,0,1,4,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x5.size(), c2.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<1,4,3,2,5,0,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x5.size(), c2.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -609,19 +592,18 @@ void Task419::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, x2, x5, c2, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x2, x5, c2, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x2, x5, c2, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*c2.size()*x4.size(), x3.size()*a1.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a1.size(), a3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*c2.size()*x4.size(), x3.size()*a1.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*c2.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), c2.size(), x4.size(), x3.size(), a1.size(), x2.size());
   out()->add_block(odata, x3, a1, x2, x5, c2, x4);
 }
@@ -636,23 +618,22 @@ void Task420::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x1.size()*x0.size(), odata_sorted.get());
   for (auto& c3 : *range_[0]) {
     for (auto& x5 : *range_[1]) {
       for (auto& x4 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(c3, a1, x5, x4);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c3, a1, x5, x4)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, c3.size(), a1.size(), x5.size(), x4.size());
+        gemm.reserve(c3.size()*x5.size()*x4.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), c3.size(), a1.size(), x5.size(), x4.size());
         // tensor label: I729
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3, x5, x4, x1, x0);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3, x5, x4, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
-        dgemm_("T", "N", a1.size(), c2.size()*x1.size()*x0.size(), c3.size()*x5.size()*x4.size(),
-               1.0, i0data_sorted, c3.size()*x5.size()*x4.size(), i1data_sorted, c3.size()*x5.size()*x4.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c3.size(), x5.size(), x4.size(), x1.size(), x0.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -669,21 +650,20 @@ void Task421::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), c2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma240
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-      sort_indices<2,3,0,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,4,5,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: I730
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, c3, x3, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, c3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), c3.size(), x3.size(), x2.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), c2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), c2.size(), c3.size());
   out()->add_block(odata, c2, c3, x5, x4, x1, x0);
 }
@@ -721,21 +701,20 @@ void Task423::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x1.size()*x0.size(), c2.size()*c3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-      sort_indices<3,4,0,1,2,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,2,5,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, c3);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, c3)]);
-      sort_indices<1,2,0,3,0,1,1,2>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), c3.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x1.size()*x0.size(), c2.size()*c3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x1.size()*x0.size());
+      sort_indices<0,3,1,2,0,1,1,2>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), c3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<4,5,0,1,2,3,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x1.size(), x0.size(), c2.size(), c3.size());
   out()->add_block(odata, c2, c3, x5, x4, x1, x0);
 }
@@ -752,21 +731,20 @@ void Task424::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, c3, x5, x4, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, c3, x5, x4, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, c3, x5, x4, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x4.size()*x0.size()*x1.size(), c3.size()*c2.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma244
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x1, x2);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x1, x2)]);
-      sort_indices<2,5,0,1,3,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<0,1,3,4,2,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
       // tensor label: v2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x3, c3, c2, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, c3, c2, x2)]);
-      sort_indices<0,3,1,2,0,1,-1,2>(i1data, i1data_sorted, x3.size(), c3.size(), c2.size(), x2.size());
-      dgemm_("T", "N", x5.size()*x4.size()*x0.size()*x1.size(), c3.size()*c2.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x5.size()*x4.size()*x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), c3.size(), c2.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<5,4,0,1,3,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), x1.size(), c3.size(), c2.size());
   out()->add_block(odata, c2, c3, x5, x4, x1, x0);
 }
@@ -781,25 +759,24 @@ void Task425::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma240
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-          sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<4,5,0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
           // tensor label: I732
           std::unique_ptr<double[]> i1data = in(1)->get_block(a1, x3, x2, c2, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a1, x3, x2, c2, x5, x4)]);
-          sort_indices<4,5,1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x3.size(), x2.size(), c2.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<0,3,4,5,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x3.size(), x2.size(), c2.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -816,19 +793,18 @@ void Task426::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x3, x2, c2, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a1, x3, x2, c2, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x3, x2, c2, x5, x4), 0.0);
+  GemmBatch<double> gemm(c2.size()*x5.size()*x4.size(), a1.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x5.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x5.size(), x4.size());
     // tensor label: I733
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, a1, x3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, a1, x3, x2)]);
-    sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), a1.size(), x3.size(), x2.size());
-    dgemm_("T", "N", c2.size()*x5.size()*x4.size(), a1.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c2.size()*x5.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), a1.size(), x3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), x5.size(), x4.size(), a1.size(), x3.size(), x2.size());
   out()->add_block(odata, a1, x3, x2, c2, x5, x4);
 }
@@ -864,25 +840,24 @@ void Task428::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma24
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-          sort_indices<0,1,3,4,2,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<2,5,0,1,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
           // tensor label: I738
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, x2, a1, c2, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, x2, a1, c2, x5, x4)]);
-          sort_indices<4,5,0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), a1.size(), c2.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x1.size()*x0.size(), a1.size()*c2.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x1.size()*x0.size());
+          sort_indices<2,3,4,5,0,1,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), a1.size(), c2.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -899,19 +874,18 @@ void Task429::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, x2, a1, c2, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, x2, a1, c2, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, x2, a1, c2, x5, x4), 0.0);
+  GemmBatch<double> gemm(c2.size()*x5.size()*x4.size(), x3.size()*x2.size()*a1.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x5.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x5.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x3, x2, a1);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x3, x2, a1)]);
-    sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, a3.size(), x3.size(), x2.size(), a1.size());
-    dgemm_("T", "N", c2.size()*x5.size()*x4.size(), x3.size()*x2.size()*a1.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c2.size()*x5.size()*x4.size());
+    sort_indices<1,2,3,0,0,1,-1,2>(i1data.get(), gemm.b(), a3.size(), x3.size(), x2.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), x5.size(), x4.size(), x3.size(), x2.size(), a1.size());
   out()->add_block(odata, x3, x2, a1, c2, x5, x4);
 }
@@ -926,25 +900,24 @@ void Task430::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         for (auto& x2 : *range_[1]) {
           // tensor label: Gamma244
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x0, x1, x2);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x0, x1, x2)]);
-          sort_indices<0,1,2,5,3,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<3,4,0,1,2,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x1.size(), x2.size());
           // tensor label: I744
           std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, x2, c2, x5, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, x2, c2, x5, x4)]);
-          sort_indices<4,5,0,2,1,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), c2.size(), x5.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<1,3,4,5,0,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), c2.size(), x5.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -961,19 +934,18 @@ void Task431::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(x3, a1, x2, c2, x5, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(x3, a1, x2, c2, x5, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(x3, a1, x2, c2, x5, x4), 0.0);
+  GemmBatch<double> gemm(c2.size()*x5.size()*x4.size(), x3.size()*a1.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(c2, a3, x5, x4);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, a3, x5, x4)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x5.size(), x4.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x5.size(), x4.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(x3, a1, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x3, a1, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,1,2>(i1data, i1data_sorted, x3.size(), a1.size(), a3.size(), x2.size());
-    dgemm_("T", "N", c2.size()*x5.size()*x4.size(), x3.size()*a1.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, c2.size()*x5.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, c2.size(), x5.size(), x4.size(), x3.size(), a1.size(), x2.size());
   out()->add_block(odata, x3, a1, x2, c2, x5, x4);
 }
@@ -988,23 +960,22 @@ void Task432::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size(), c2.size()*x0.size()*x1.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       for (auto& x5 : *range_[1]) {
         // tensor label: t2
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, a1, x6, x5);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, a1, x6, x5)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x7.size(), a1.size(), x6.size(), x5.size());
+        gemm.reserve(x7.size()*x6.size()*x5.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), a1.size(), x6.size(), x5.size());
         // tensor label: I759
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x7, x0, x6, x5, x1);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x7, x0, x6, x5, x1)]);
-        sort_indices<1,3,4,0,2,5,0,1,1,1>(i1data, i1data_sorted, c2.size(), x7.size(), x0.size(), x6.size(), x5.size(), x1.size());
-        dgemm_("T", "N", a1.size(), c2.size()*x0.size()*x1.size(), x7.size()*x6.size()*x5.size(),
-               1.0, i0data_sorted, x7.size()*x6.size()*x5.size(), i1data_sorted, x7.size()*x6.size()*x5.size(),
-               1.0, odata_sorted, a1.size());
+        sort_indices<0,2,5,1,3,4,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x7.size(), x0.size(), x6.size(), x5.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,3,2,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1021,23 +992,22 @@ void Task433::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x0, x6, x5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x0, x6, x5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x0, x6, x5, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma250
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x1, x4, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x1, x4, x3, x2)]);
-        sort_indices<5,6,7,0,1,2,3,4,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,4,5,6,7,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x1.size(), x4.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,2>(i1data, i1data_sorted, c2.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), c2.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x0.size()*x6.size()*x5.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), c2.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x0.size(), x6.size(), x5.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x0, x6, x5, x1);
 }
@@ -1054,23 +1024,22 @@ void Task434::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x7, x0, x6, x5, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x7, x0, x6, x5, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x7, x0, x6, x5, x1), 0.0);
+  GemmBatch<double> gemm(x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), c2.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma251
         std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x6, x5, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x6, x5, x4, x3, x1, x2)]);
-        sort_indices<4,5,7,0,1,2,3,6,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,6,4,5,7,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x6.size(), x5.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, c2, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, c2, x2)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x4.size(), x3.size(), c2.size(), x2.size());
-        dgemm_("T", "N", x7.size()*x0.size()*x6.size()*x5.size()*x1.size(), c2.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x7.size()*x0.size()*x6.size()*x5.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), c2.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<5,0,1,2,3,4,1,1,1,1>(odata_sorted, odata, x7.size(), x0.size(), x6.size(), x5.size(), x1.size(), c2.size());
   out()->add_block(odata, c2, x7, x0, x6, x5, x1);
 }
@@ -1085,21 +1054,20 @@ void Task435::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(a3, x2, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(a3, x2, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, a3.size(), x2.size(), c2.size(), a1.size());
+      gemm.reserve(a3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), a3.size(), x2.size(), c2.size(), a1.size());
       // tensor label: I765
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x2, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x2.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), a3.size()*x2.size(),
-             1.0, i0data_sorted, a3.size()*x2.size(), i1data_sorted, a3.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x2.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1114,23 +1082,22 @@ void Task436::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x2, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x2, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x2, x1, x0), 0.0);
+  GemmBatch<double> gemm(x2.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x2.size()*x1.size()*x0.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x2.size()*x1.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x2.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x2, x1, x0);
 }
@@ -1145,21 +1112,20 @@ void Task437::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: v2
       std::unique_ptr<double[]> i0data = in(0)->get_block(c2, x2, a3, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(c2, x2, a3, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), x2.size(), a3.size(), a1.size());
+      gemm.reserve(a3.size()*x2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x2.size(), a3.size(), a1.size());
       // tensor label: I768
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x0, x1, x2);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x0, x1, x2)]);
-      sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a3.size(), x0.size(), x1.size(), x2.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x0.size()*x1.size(), a3.size()*x2.size(),
-             1.0, i0data_sorted, a3.size()*x2.size(), i1data_sorted, a3.size()*x2.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<1,2,3,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x0.size(), x1.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,3,2,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x0.size(), x1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1174,23 +1140,22 @@ void Task438::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x0, x1, x2), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x0, x1, x2)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x0, x1, x2), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size()*x2.size(), a3.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma31
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<0,2,3,1,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<1,4,5,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: t2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a3, x4, x3);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a3, x4, x3)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x5.size(), a3.size(), x4.size(), x3.size());
-        dgemm_("T", "N", x0.size()*x1.size()*x2.size(), a3.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x0.size()*x1.size()*x2.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x5.size(), a3.size(), x4.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), x2.size(), a3.size());
   out()->add_block(odata, a3, x0, x1, x2);
 }
@@ -1205,21 +1170,20 @@ void Task439::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(c2.size()*a1.size(), x1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a3, c2, a1);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a3, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), a3.size(), c2.size(), a1.size());
+      gemm.reserve(a3.size()*x5.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a3.size(), c2.size(), a1.size());
       // tensor label: I807
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x5, x1, x0);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x5, x1, x0)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x5.size(), x1.size(), x0.size());
-      dgemm_("T", "N", c2.size()*a1.size(), x1.size()*x0.size(), a3.size()*x5.size(),
-             1.0, i0data_sorted, a3.size()*x5.size(), i1data_sorted, a3.size()*x5.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x5.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), x0.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1234,23 +1198,22 @@ void Task440::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma240
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,-1,2>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<0,1,2,3,0,1,-1,2>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x1, x0);
 }
@@ -1265,23 +1228,22 @@ void Task441::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x1, x0), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x1, x0), 0.0);
+  GemmBatch<double> gemm(x5.size()*x1.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma252
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x2, x4, x3, x1, x0);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x2, x4, x3, x1, x0)]);
-        sort_indices<1,2,3,0,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,4,5,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x2.size(), x4.size(), x3.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, a3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, a3, x2)]);
-        sort_indices<3,0,1,2,0,1,-1,2>(i1data, i1data_sorted, x4.size(), x3.size(), a3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x1.size()*x0.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x1.size()*x0.size());
+        sort_indices<2,3,0,1,0,1,-1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), a3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x1.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x1, x0);
 }
@@ -1296,21 +1258,20 @@ void Task442::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(a1.size()*c2.size(), x0.size()*x1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& a3 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, c2, a3);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, c2, a3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), c2.size(), a3.size());
+      gemm.reserve(a3.size()*x5.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), c2.size(), a3.size());
       // tensor label: I810
       std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x5, x0, x1);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x5, x0, x1)]);
-      sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x5.size(), x0.size(), x1.size());
-      dgemm_("T", "N", a1.size()*c2.size(), x0.size()*x1.size(), a3.size()*x5.size(),
-             1.0, i0data_sorted, a3.size()*x5.size(), i1data_sorted, a3.size()*x5.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<2,3,1,0,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x5.size(), x0.size(), x1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,3,2,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), x0.size(), x1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1325,23 +1286,22 @@ void Task443::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x0, x1), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x1.size(), a3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma230
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4, x3, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4, x3, x2)]);
-        sort_indices<3,4,5,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,2,3,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size(), x3.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(a3, x4, x3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(a3, x4, x3, x2)]);
-        sort_indices<1,2,3,0,0,1,1,2>(i1data, i1data_sorted, a3.size(), x4.size(), x3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x1.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x1.size());
+        sort_indices<0,1,2,3,0,1,1,2>(i1data.get(), gemm.b(), a3.size(), x4.size(), x3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x1.size(), a3.size());
   out()->add_block(odata, a3, x5, x0, x1);
 }
@@ -1356,23 +1316,22 @@ void Task444::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x0, x1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(a3, x5, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x0, x1), 0.0);
+  GemmBatch<double> gemm(x5.size()*x0.size()*x1.size(), a3.size(), odata_sorted.get());
   for (auto& x4 : *range_[1]) {
     for (auto& x3 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         // tensor label: Gamma31
         std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x3, x1, x2);
-        std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x3, x1, x2)]);
-        sort_indices<2,3,5,0,1,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
+        gemm.reserve(x4.size()*x3.size()*x2.size());
+        sort_indices<0,1,4,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x3.size(), x1.size(), x2.size());
         // tensor label: v2
         std::unique_ptr<double[]> i1data = in(1)->get_block(x4, x3, a3, x2);
-        std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x4, x3, a3, x2)]);
-        sort_indices<0,1,3,2,0,1,1,2>(i1data, i1data_sorted, x4.size(), x3.size(), a3.size(), x2.size());
-        dgemm_("T", "N", x5.size()*x0.size()*x1.size(), a3.size(), x4.size()*x3.size()*x2.size(),
-               1.0, i0data_sorted, x4.size()*x3.size()*x2.size(), i1data_sorted, x4.size()*x3.size()*x2.size(),
-               1.0, odata_sorted, x5.size()*x0.size()*x1.size());
+        sort_indices<2,0,1,3,0,1,1,2>(i1data.get(), gemm.b(), x4.size(), x3.size(), a3.size(), x2.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x0.size(), x1.size(), a3.size());
   out()->add_block(odata, a3, x5, x0, x1);
 }
@@ -1387,25 +1346,24 @@ void Task445::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x2 : *range_[1]) {
         for (auto& x3 : *range_[1]) {
           // tensor label: Gamma276
           std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x4, x2, x1, x3);
-          std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x4, x2, x1, x3)]);
-          sort_indices<0,2,3,5,1,4,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x4.size(), x2.size(), x1.size(), x3.size());
+          gemm.reserve(x3.size()*x2.size()*x5.size()*x4.size());
+          sort_indices<1,4,0,2,3,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x4.size(), x2.size(), x1.size(), x3.size());
           // tensor label: I837
           std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, x2, x5, a1, x4);
-          std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, x2, x5, a1, x4)]);
-          sort_indices<3,5,2,1,0,4,0,1,1,1>(i1data, i1data_sorted, c2.size(), x3.size(), x2.size(), x5.size(), a1.size(), x4.size());
-          dgemm_("T", "N", x0.size()*x1.size(), c2.size()*a1.size(), x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, i0data_sorted, x3.size()*x2.size()*x5.size()*x4.size(), i1data_sorted, x3.size()*x2.size()*x5.size()*x4.size(),
-                 1.0, odata_sorted, x0.size()*x1.size());
+          sort_indices<0,4,3,5,2,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), x2.size(), x5.size(), a1.size(), x4.size());
+          gemm.commit();
         }
       }
     }
   }
+  gemm.compute();
   sort_indices<2,1,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1422,19 +1380,18 @@ void Task446::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x3, x2, x5, a1, x4), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x3, x2, x5, a1, x4)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x3, x2, x5, a1, x4), 0.0);
+  GemmBatch<double> gemm(x5.size()*a1.size()*x4.size(), c2.size()*x3.size()*x2.size(), odata_sorted.get());
   for (auto& a3 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<double[]> i0data = in(0)->get_block(x5, a1, x4, a3);
-    std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, a1, x4, a3)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), a1.size(), x4.size(), a3.size());
+    gemm.reserve(a3.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), a1.size(), x4.size(), a3.size());
     // tensor label: v2
     std::unique_ptr<double[]> i1data = in(1)->get_block(c2, x3, a3, x2);
-    std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, x3, a3, x2)]);
-    sort_indices<2,0,1,3,0,1,-2,1>(i1data, i1data_sorted, c2.size(), x3.size(), a3.size(), x2.size());
-    dgemm_("T", "N", x5.size()*a1.size()*x4.size(), c2.size()*x3.size()*x2.size(), a3.size(),
-           1.0, i0data_sorted, a3.size(), i1data_sorted, a3.size(),
-           1.0, odata_sorted, x5.size()*a1.size()*x4.size());
+    sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), c2.size(), x3.size(), a3.size(), x2.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,4,5,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), a1.size(), x4.size(), c2.size(), x3.size(), x2.size());
   out()->add_block(odata, c2, x3, x2, x5, a1, x4);
 }
@@ -1449,21 +1406,20 @@ void Task447::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma568
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x0, x1, x4);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x0, x1, x4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x5.size(), x0.size(), x1.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x0.size(), x1.size(), x4.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x5, a1, c2, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x5, a1, c2, x4)]);
-      sort_indices<0,3,1,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), a1.size(), c2.size(), x4.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), a1.size(), c2.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1478,21 +1434,20 @@ void Task448::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x1.size()*x0.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: Gamma569
       std::unique_ptr<double[]> i0data = in(0)->get_block(x5, x4, x1, x0);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x5, x4, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x0.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(c2, a1, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
-      dgemm_("T", "N", x1.size()*x0.size(), c2.size()*a1.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), x5.size(), x4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -1507,21 +1462,20 @@ void Task449::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x0, a1), 0.0);
   std::unique_ptr<double[]> odata_sorted(new double[out()->get_size(c2, x1, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x0, a1), 0.0);
+  GemmBatch<double> gemm(x0.size()*x1.size(), a1.size()*c2.size(), odata_sorted.get());
   for (auto& x7 : *range_[1]) {
     for (auto& x6 : *range_[1]) {
       // tensor label: Gamma572
       std::unique_ptr<double[]> i0data = in(0)->get_block(x7, x0, x1, x6);
-      std::unique_ptr<double[]> i0data_sorted(new double[in(0)->get_size(x7, x0, x1, x6)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x7.size(), x0.size(), x1.size(), x6.size());
+      gemm.reserve(x7.size()*x6.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x7.size(), x0.size(), x1.size(), x6.size());
       // tensor label: t2
       std::unique_ptr<double[]> i1data = in(1)->get_block(x7, a1, c2, x6);
-      std::unique_ptr<double[]> i1data_sorted(new double[in(1)->get_size(x7, a1, c2, x6)]);
-      sort_indices<0,3,1,2,0,1,-1,2>(i1data, i1data_sorted, x7.size(), a1.size(), c2.size(), x6.size());
-      dgemm_("T", "N", x0.size()*x1.size(), a1.size()*c2.size(), x7.size()*x6.size(),
-             1.0, i0data_sorted, x7.size()*x6.size(), i1data_sorted, x7.size()*x6.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,-1,2>(i1data.get(), gemm.b(), x7.size(), a1.size(), c2.size(), x6.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<3,1,0,2,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, x0, a1);
 }
@@ -25,13 +25,39 @@
 #include <bagel_config.h>
 #ifdef COMPILE_SMITH
 
+#include <cxxabi.h>
+#include <cstdlib>
+#include <typeinfo>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#ifdef HAVE_MKL_H
+  #include "mkl_service.h"
+#endif
 #include <src/smith/queue.h>
+#include <src/util/parallel/resources.h>
 #include <src/util/parallel/mpi_interface.h>
+#include <src/util/parallel/profiler.h>
 
 using namespace std;
 using namespace bagel;
 using namespace bagel::SMITH;
 
+// profiler regions are named after the generated task class (e.g., CASPT2::Task35)
+static string task_name(const Task& task) {
+  int status;
+  char* name = abi::__cxa_demangle(typeid(task).name(), nullptr, nullptr, &status);
+  string out = status == 0 ? string(name) : string(typeid(task).name());
+  free(name);
+  const size_t pos = out.find("SMITH::");
+  return pos == string::npos ? out : out.substr(pos+7);
+}
+
+
 shared_ptr<Task> Queue::next_compute() {
   auto i = tasklist_.begin();
   for ( ; i != tasklist_.end(); ++i)
@@ -39,11 +65,18 @@ shared_ptr<Task> Queue::next_compute() {
 
   assert(i != tasklist_.end());
   shared_ptr<Task> out = *i;
+  Profiler::Region region("SMITH::Queue");
   // execute
-  out->compute();
+  {
+    Profiler::Region task(Profiler::enabled() ? task_name(*out) : string());
+    out->compute();
+  }
 
   // synchronize. This only works because add_block is local...
-  mpi__->barrier();
+  {
+    Profiler::Region barrier("barrier");
+    mpi__->barrier();
+  }
 
   // delete dependency (to remove intermediate storages)
   for (auto& j : tasklist_) j->delete_dep(out);
@@ -52,4 +85,243 @@ shared_ptr<Task> Queue::next_compute() {
   return out;
 }
 
+
+double Queue::compute() {
+  using Iter = list<shared_ptr<Task>>::iterator;
+  const int ntask = tasklist_.size();
+  if (ntask == 0) return 0.0;
+
+  // dependency graph: number of unfinished dependencies and the list of successors of each task
+  vector<shared_ptr<Task>> task;
+  vector<Iter> position;
+  unordered_map<const Task*, int> index;
+  for (auto i = tasklist_.begin(); i != tasklist_.end(); ++i) {
+    index.emplace(i->get(), task.size());
+    task.push_back(*i);
+    position.push_back(i);
+  }
+  vector<int> ndep(ntask, 0);
+  vector<vector<int>> next(ntask);
+  for (int i = 0; i != ntask; ++i)
+    for (auto& j : task[i]->depend()) {
+      if (j->done()) continue;
+      auto iter = index.find(j.get());
+      if (iter == index.end())
+        throw logic_error("SMITH::Queue::compute: a task depends on a task that is not in the queue");
+      ++ndep[i];
+      next[iter->second].push_back(i);
+    }
+
+  // Memory plan. An intermediate tensor is allocated when the first task that writes to it is started, and is released
+  // when the tasks that write to it and their successors (which read it) are all done.
+  vector<size_t> bytes;
+  // number of unfinished tasks that hold each tensor
+  vector<int> nuser;
+  // tensors allocated by and held by each task
+  vector<vector<int>> alloc(ntask), hold(ntask);
+  {
+    unordered_map<const void*, int> tensor;
+    vector<set<int>> users;
+    for (int i = 0; i != ntask; ++i)
+      for (auto& t : task[i]->allocation()) {
+        auto iter = tensor.find(t.first);
+        if (iter == tensor.end()) {
+          iter = tensor.emplace(t.first, bytes.size()).first;
+          bytes.push_back(t.second);
+          users.emplace_back();
+        }
+        if (find(alloc[i].begin(), alloc[i].end(), iter->second) == alloc[i].end())
+          alloc[i].push_back(iter->second);
+        users[iter->second].insert(i);
+        users[iter->second].insert(next[i].begin(), next[i].end());
+      }
+    for (int t = 0; t != bytes.size(); ++t) {
+      nuser.push_back(users[t].size());
+      for (auto& i : users[t])
+        hold[i].push_back(t);
+    }
+  }
+  const size_t budget = memory_budget_ * mpi__->size();
+  vector<char> live(bytes.size(), 0);
+  size_t live_bytes = 0LU;
+  auto new_bytes = [&](const int i) {
+    size_t out = 0LU;
+    for (auto& t : alloc[i])
+      if (!live[t]) out += bytes[t];
+    return out;
+  };
+
+  // With more than one process, the tasks are executed in waves: a task is released only after all of its dependencies
+  // are done on all the processes, which requires a barrier. One barrier per wave replaces one barrier per task.
+  const bool waves = mpi__->size() > 1;
+
+  // shared with the worker threads
+  mutex mut;
+  condition_variable work, finish;
+  deque<int> runnable;
+  vector<int> finished;
+  bool stop = false;
+  exception_ptr error;
+
+  auto run = [&task](const int i) {
+    Profiler::Region region(Profiler::enabled() ? task_name(*task[i]) : string());
+    task[i]->compute();
+  };
+
+  auto worker = [&]() {
+    unique_lock<mutex> lock(mut);
+    while (true) {
+      work.wait(lock, [&]() { return stop || !runnable.empty(); });
+      if (stop) return;
+      const int i = runnable.front();
+      runnable.pop_front();
+      lock.unlock();
+      exception_ptr e;
+      try {
+        run(i);
+      } catch (...) {
+        e = current_exception();
+      }
+      lock.lock();
+      if (e && !error) error = e;
+      finished.push_back(i);
+      finish.notify_one();
+    }
+  };
+
+  // the calling thread runs the collective parts and the serial tasks, and keeps track of the dependencies
+  double sum = 0.0;
+  auto scheduler = [&]() {
+    int ndone = 0;
+    // number of tasks released and not yet processed as done
+    int nflight = 0;
+    vector<int> wave;
+    // tasks that are ready but held back because of the memory budget
+    vector<int> pending;
+
+    // Tasks that do not allocate new tensors are started first so that the subtrees that have been started are finished
+    // before new ones are opened. Others are started as long as the estimated memory fits in the budget.
+    // The decisions only depend on the state at the end of a wave, and hence are identical on all processes.
+    auto release = [&](vector<int>& ready) {
+      vector<pair<bool,int>> order;
+      for (auto& i : pending) order.emplace_back(new_bytes(i) != 0LU, i);
+      for (auto& i : ready)   order.emplace_back(new_bytes(i) != 0LU, i);
+      sort(order.begin(), order.end());
+      pending.clear();
+      ready.clear();
+
+      for (auto& o : order) {
+        const int i = o.second;
+        const size_t nb = new_bytes(i);
+        if (budget && live_bytes + nb > budget && nflight != 0) {
+          pending.push_back(i);
+          continue;
+        }
+        for (auto& t : alloc[i])
+          if (!live[t]) {
+            live[t] = 1;
+            live_bytes += bytes[t];
+          }
+        ++nflight;
+        if (task[i]->concurrent()) {
+          task[i]->prepare();
+          lock_guard<mutex> lock(mut);
+          runnable.push_back(i);
+          work.notify_one();
+        } else {
+          run(i);
+          lock_guard<mutex> lock(mut);
+          finished.push_back(i);
+        }
+      }
+    };
+
+    // deletes the dependency to remove intermediate storages; done in the same order on all processes
+    auto complete = [&](const int i, vector<int>& ready) {
+      sum += task[i]->target();
+      for (auto& j : next[i]) {
+        task[j]->delete_dep(task[i]);
+        if (--ndep[j] == 0) ready.push_back(j);
+      }
+      for (auto& t : hold[i])
+        if (--nuser[t] == 0 && live[t]) {
+          live[t] = 0;
+          live_bytes -= bytes[t];
+        }
+      tasklist_.erase(position[i]);
+      task[i].reset();
+      ++ndone;
+    };
+
+    vector<int> ready;
+    for (int i = 0; i != ntask; ++i)
+      if (ndep[i] == 0) ready.push_back(i);
+    if (ready.empty())
+      throw logic_error("SMITH::Queue::compute: dependencies of the tasks are cyclic");
+    release(ready);
+
+    while (ndone != ntask) {
+      unique_lock<mutex> lock(mut);
+      if (error) break;
+      if (!finished.empty()) {
+        vector<int> done;
+        swap(done, finished);
+        lock.unlock();
+        nflight -= done.size();
+        if (waves) {
+          wave.insert(wave.end(), done.begin(), done.end());
+          if (nflight != 0) continue;
+          {
+            Profiler::Region barrier("barrier");
+            mpi__->barrier();
+          }
+          sort(wave.begin(), wave.end());
+          for (auto& i : wave) complete(i, ready);
+          wave.clear();
+        } else {
+          for (auto& i : done) complete(i, ready);
+        }
+        if (ndone != ntask && ready.empty() && pending.empty() && nflight == 0)
+          throw logic_error("SMITH::Queue::compute: dependencies of the tasks are cyclic");
+        release(ready);
+      } else if (!runnable.empty()) {
+        const int i = runnable.front();
+        runnable.pop_front();
+        lock.unlock();
+        run(i);
+        lock.lock();
+        finished.push_back(i);
+      } else {
+        finish.wait(lock, [&]() { return error || !finished.empty() || !runnable.empty(); });
+      }
+    }
+  };
+
+  Profiler::Region region("SMITH::Queue");
+#ifdef HAVE_MKL_H
+  const int mkl_num = mkl_get_max_threads();
+  mkl_set_num_threads(1);
+#endif
+  resources__->pool().run([&](const int id) {
+    if (id != 0) {
+      worker();
+      return;
+    }
+    try {
+      scheduler();
+    } catch (...) {
+      lock_guard<mutex> lock(mut);
+      if (!error) error = current_exception();
+    }
+    lock_guard<mutex> lock(mut);
+    stop = true;
+    work.notify_all();
+  }, resources__->max_num_threads());
+#ifdef HAVE_MKL_H
+  mkl_set_num_threads(mkl_num);
+#endif
+  if (error) rethrow_exception(error);
+  return sum;
+}
+
 #endif
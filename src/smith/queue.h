@@ -45,12 +45,20 @@ class Queue {
   protected:
     std::list<std::shared_ptr<Task>> tasklist_;
 
+    // estimated memory per process for the intermediate tensors (in bytes) that compute() tries to stay within; 0 means unlimited
+    size_t memory_budget_;
+
   public:
-    Queue() {}
-    Queue(const std::list<std::shared_ptr<Task>>& d) : tasklist_(d) { }
+    Queue(const size_t budget = 0LU) : memory_budget_(budget) { }
+    Queue(const std::list<std::shared_ptr<Task>>& d, const size_t budget = 0LU) : tasklist_(d), memory_budget_(budget) { }
 
     std::shared_ptr<Task> next_compute();
 
+    // Computes all the tasks and returns the sum of their targets. Tasks are scheduled by their dependencies:
+    // concurrent tasks are run on the thread pool as soon as their dependencies are done, while the collective
+    // parts are run on the calling thread in the same order on all processes.
+    double compute();
+
     void add_task(std::shared_ptr<Task> a) { tasklist_.push_back(a); }
 
     void insert(std::shared_ptr<Queue> b) {
@@ -83,8 +83,7 @@ void RelCASA::RelCASA::solve() {
       set_rdm(jst, istate);
       s = sall_[istate]->at(jst);
       shared_ptr<Queue> sourceq = make_sourceq(false, jst == istate);
-      while(!sourceq->done())
-        sourceq->next_compute();
+      sourceq->compute();
     }
   }
 
@@ -112,8 +111,7 @@ void RelCASA::RelCASA::solve() {
           set_rdm(jst, ist);
           s = init_residual();
           shared_ptr<Queue> sourceq = make_sourceq(false, jst == ist);
-          while(!sourceq->done())
-            sourceq->next_compute();
+          sourceq->compute();
           sist->at(jst) = s;
         }
       }
@@ -233,8 +231,7 @@ vector<shared_ptr<MultiTensor_<complex<double>>>> RelCASA::RelCASA::solve_linear
           const double e0save = e0_;
           e0_ = e0all_[i] - e0all_[ist];
           shared_ptr<Queue> queue = make_residualq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           diagonal(r, t2, jst == ist);
           e0_ = e0save;
         }
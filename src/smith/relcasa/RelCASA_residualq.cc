@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> RelCASA::RelCASA::make_residualq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto residualq = make_shared<Queue>();
+  auto residualq = make_shared<Queue>(info_->memory_budget());
   auto tensor40 = vector<shared_ptr<Tensor>>{r};
   auto task40 = make_shared<Task40>(tensor40, reset);
   residualq->add_task(task40);
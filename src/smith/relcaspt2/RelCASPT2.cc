@@ -79,8 +79,7 @@ void RelCASPT2::RelCASPT2::solve() {
       set_rdm(jst, istate);
       s = sall_[istate]->at(jst);
       shared_ptr<Queue> sourceq = make_sourceq(false, jst == istate);
-      while(!sourceq->done())
-        sourceq->next_compute();
+      sourceq->compute();
     }
   }
 
@@ -110,8 +109,7 @@ void RelCASPT2::RelCASPT2::solve() {
             set_rdm(jst, ist);
             t2 = t2all_[jstate]->at(ist);
             shared_ptr<Queue> normq = make_normq(true, jst == ist);
-            while (!normq->done())
-              normq->next_compute();
+            normq->compute();
             nn += conj(dot_product_transpose(n, t2all_[istate]->at(jst)));
           }
         }
@@ -144,8 +142,7 @@ void RelCASPT2::RelCASPT2::solve() {
           set_rdm(jst, ist);
           s = init_residual();
           shared_ptr<Queue> sourceq = make_sourceq(false, jst == ist);
-          while(!sourceq->done())
-            sourceq->next_compute();
+          sourceq->compute();
           sist->at(jst) = s;
         }
       }
@@ -264,8 +261,7 @@ vector<shared_ptr<MultiTensor_<complex<double>>>> RelCASPT2::RelCASPT2::solve_li
           // compute residuals named r for each K
           e0_ = e0all_[i] - info_->shift();
           shared_ptr<Queue> queue = make_residualq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           diagonal(r, t2, jst == ist);
         }
       }
@@ -107,9 +107,7 @@ class RelCASPT2 : public SpinFreeMethod<std::complex<double>> {
     void load_t2all(std::shared_ptr<MultiTensor> t2in, const int ist);
 
     double accumulate(std::shared_ptr<Queue> queue) {
-      double sum = 0.0;
-      while (!queue->done())
-        sum += queue->next_compute()->target();
+      double sum = queue->compute();
       mpi__->allreduce(&sum, 1);
       return sum;
     }
@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> RelCASPT2::RelCASPT2::make_sourceq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto sourceq = make_shared<Queue>();
+  auto sourceq = make_shared<Queue>(info_->memory_budget());
   auto tensor203 = vector<shared_ptr<Tensor>>{s};
   auto task203 = make_shared<Task203>(tensor203, reset);
   sourceq->add_task(task203);
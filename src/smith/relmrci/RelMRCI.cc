@@ -75,8 +75,7 @@ void RelMRCI::RelMRCI::solve() {
       set_rdm(jst, istate);
       s = sall_[istate]->at(jst);
       auto queue = make_sourceq(false, jst == istate);
-      while (!queue->done())
-        queue->next_compute();
+      queue->compute();
     }
   }
 
@@ -129,8 +128,7 @@ void RelMRCI::RelMRCI::solve() {
           t2 = t2all_[istate]->at(ist);
           n  = nall_[istate]->at(jst);
           auto queue = make_normq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
         }
       }
 
@@ -149,8 +147,7 @@ void RelMRCI::RelMRCI::solve() {
           t2 = t2all_[istate]->at(ist);
           r = rtmp->at(jst);
           auto queue = make_residualq(false, jst == ist);
-          while (!queue->done())
-            queue->next_compute();
+          queue->compute();
           diagonal(r, t2);
         }
       }
@@ -167,8 +164,7 @@ void RelMRCI::RelMRCI::solve() {
             t2 = m->at(ist);
             n  = rtmp->at(jst);
             auto queue = make_normq(false, jst == ist);
-            while (!queue->done())
-              queue->next_compute();
+            queue->compute();
           }
         }
       }
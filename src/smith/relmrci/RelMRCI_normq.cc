@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> RelMRCI::RelMRCI::make_normq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto normq = make_shared<Queue>();
+  auto normq = make_shared<Queue>(info_->memory_budget());
   auto tensor754 = vector<shared_ptr<Tensor>>{n};
   auto task754 = make_shared<Task754>(tensor754, reset);
   normq->add_task(task754);
@@ -36,7 +36,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> RelMRCI::RelMRCI::make_residualq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto residualq = make_shared<Queue>();
+  auto residualq = make_shared<Queue>(info_->memory_budget());
   auto tensor83 = vector<shared_ptr<Tensor>>{r};
   auto task83 = make_shared<Task83>(tensor83, reset);
   residualq->add_task(task83);
@@ -37,7 +37,7 @@ using namespace bagel::SMITH;
 shared_ptr<Queue> RelMRCI::RelMRCI::make_sourceq(const bool reset, const bool diagonal) {
 
   array<shared_ptr<const IndexRange>,3> pindex = {{rclosed_, ractive_, rvirt_}};
-  auto sourceq = make_shared<Queue>();
+  auto sourceq = make_shared<Queue>(info_->memory_budget());
   auto tensor727 = vector<shared_ptr<Tensor>>{s};
   auto task727 = make_shared<Task727>(tensor727, reset);
   sourceq->add_task(task727);
@@ -40,23 +40,22 @@ void Task550::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma33
         std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-        std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x3, x0, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x3, c4, x2, x1);
-        std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x3, c4, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,1>(i1data, i1data_sorted, x3.size(), c4.size(), x2.size(), x1.size());
-        zgemm3m_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<1,0,2,3,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), c4.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -69,23 +68,22 @@ void Task551::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x0.size(), c4.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma24
         std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-        std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x3, x2, x1, x0)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x3, x2, x1, c4);
-        std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x3, x2, x1, c4)]);
-        sort_indices<0,1,2,3,0,1,1,1>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), c4.size());
-        zgemm3m_("T", "N", x0.size(), c4.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x0.size());
+        sort_indices<3,0,1,2,0,1,1,1>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), c4.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<1,0,1,1,1,1>(odata_sorted, odata, x0.size(), c4.size());
   out()->add_block(odata, c4, x0);
 }
@@ -100,19 +98,18 @@ void Task552::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x0.size(), c2.size()*a3.size()*a1.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: Gamma27
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, x0);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, x0)]);
-    sort_indices<0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), x0.size());
+    gemm.reserve(x1.size());
+    sort_indices<1,0,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x0.size());
     // tensor label: I153
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, x1, a3, a1);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, x1, a3, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), a3.size(), a1.size());
-    zgemm3m_("T", "N", x0.size(), c2.size()*a3.size()*a1.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, x0.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), a3.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,2,0,3,1,1,1,1>(odata_sorted, odata, x0.size(), c2.size(), a3.size(), a1.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -127,19 +124,18 @@ void Task553::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a3.size()*a1.size(), c2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a3, c4, a1);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a3, c4, a1)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a1.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a1.size());
     // tensor label: h1
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, c4);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, c4)]);
-    sort_indices<1,0,0,1,1,1>(i1data, i1data_sorted, c2.size(), c4.size());
-    zgemm3m_("T", "N", x1.size()*a3.size()*a1.size(), c2.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size()*a3.size()*a1.size());
+    sort_indices<0,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), a1.size(), c2.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -154,19 +150,18 @@ void Task554::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a1.size()*a3.size(), c2.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     // tensor label: t2
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a1, c4, a3);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a1, c4, a3)]);
-    sort_indices<2,0,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a3.size());
+    gemm.reserve(c4.size());
+    sort_indices<0,1,3,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c4.size(), a3.size());
     // tensor label: h1
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, c4);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, c4)]);
-    sort_indices<1,0,0,1,-1,1>(i1data, i1data_sorted, c2.size(), c4.size());
-    zgemm3m_("T", "N", x1.size()*a1.size()*a3.size(), c2.size(), c4.size(),
-           1.0, i0data_sorted, c4.size(), i1data_sorted, c4.size(),
-           1.0, odata_sorted, x1.size()*a1.size()*a3.size());
+    sort_indices<0,1,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), c4.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<3,0,2,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), a3.size(), c2.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -181,19 +176,18 @@ void Task555::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*c2.size()*a3.size(), a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a4, c2, a3);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a4, c2, a3)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a3.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a3.size());
     // tensor label: h1
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a4, a1);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a4, a1)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a1.size());
-    zgemm3m_("T", "N", x1.size()*c2.size()*a3.size(), a1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*c2.size()*a3.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,2,3,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a3.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -208,19 +202,18 @@ void Task556::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a3.size()*c2.size(), a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a3, c2, a4);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a3, c2, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c2.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c2.size(), a4.size());
     // tensor label: h1
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a4, a1);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a4, a1)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a4.size(), a1.size());
-    zgemm3m_("T", "N", x1.size()*a3.size()*c2.size(), a1.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*a3.size()*c2.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), a1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -235,19 +228,18 @@ void Task557::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*c2.size()*a1.size(), a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a4, c2, a1);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a4, c2, a1)]);
-    sort_indices<1,0,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a1.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,2,3,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a1.size());
     // tensor label: h1
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a4, a3);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a4, a3)]);
-    sort_indices<0,1,0,1,-1,1>(i1data, i1data_sorted, a4.size(), a3.size());
-    zgemm3m_("T", "N", x1.size()*c2.size()*a1.size(), a3.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*c2.size()*a1.size());
+    sort_indices<1,0,0,1,-1,1>(i1data.get(), gemm.b(), a4.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -262,19 +254,18 @@ void Task558::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a1.size()*c2.size(), a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     // tensor label: t2
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a1, c2, a4);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a1, c2, a4)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), a4.size());
+    gemm.reserve(a4.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), a4.size());
     // tensor label: h1
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a4, a3);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a4, a3)]);
-    sort_indices<0,1,0,1,1,1>(i1data, i1data_sorted, a4.size(), a3.size());
-    zgemm3m_("T", "N", x1.size()*a1.size()*c2.size(), a3.size(), a4.size(),
-           1.0, i0data_sorted, a4.size(), i1data_sorted, a4.size(),
-           1.0, odata_sorted, x1.size()*a1.size()*c2.size());
+    sort_indices<1,0,0,1,1,1>(i1data.get(), gemm.b(), a4.size(), a3.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -289,21 +280,20 @@ void Task559::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a4, c5, a3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a4, c5, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c5.size(), a3.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c5.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, c5, a4, a1);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, c5, a4, a1)]);
-      sort_indices<2,1,0,3,0,1,2,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a1.size());
-      zgemm3m_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,2,1,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -318,21 +308,20 @@ void Task560::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a3, c5, a4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a3, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, c5, a4, a1);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, c5, a4, a1)]);
-      sort_indices<1,2,0,3,0,1,-2,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a1.size());
-      zgemm3m_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,-2,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -347,21 +336,20 @@ void Task561::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a4, c5, a1);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a4, c5, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a4.size(), c5.size(), a1.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a4.size(), c5.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, c5, a4, a3);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, c5, a4, a3)]);
-      sort_indices<2,1,0,3,0,1,-2,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a3.size());
-      zgemm3m_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,-2,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -376,21 +364,20 @@ void Task562::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a1, c5, a4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a1, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, c5, a4, a3);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, c5, a4, a3)]);
-      sort_indices<1,2,0,3,0,1,2,1>(i1data, i1data_sorted, x1.size(), c5.size(), a4.size(), a3.size());
-      zgemm3m_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -405,21 +392,20 @@ void Task563::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a5, c4, a3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a5, c4, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a5.size(), c4.size(), a3.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a5.size(), c4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, a1, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, a1, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,-2,1>(i1data, i1data_sorted, x1.size(), a1.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,-2,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -434,21 +420,20 @@ void Task564::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a3.size(), x1.size()*a1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a3, c4, a5);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a3, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, a1, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, a1, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,2,1>(i1data, i1data_sorted, x1.size(), a1.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", c2.size()*a3.size(), x1.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,1,3,2,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,1,3,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), x1.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -463,21 +448,20 @@ void Task565::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a5, c4, a1);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a5, c4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, c2.size(), a5.size(), c4.size(), a1.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a5.size(), c4.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, a3, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, a3, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,2,1>(i1data, i1data_sorted, x1.size(), a3.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,2,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -492,21 +476,20 @@ void Task566::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a1.size(), x1.size()*a3.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a1, c4, a5);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a1, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x1, a3, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x1, a3, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,-2,1>(i1data, i1data_sorted, x1.size(), a3.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", c2.size()*a1.size(), x1.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,1,3,2,0,1,-2,1>(i1data.get(), gemm.b(), x1.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), x1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -521,21 +504,20 @@ void Task567::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a4, c5, a3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a4, c5, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c5.size(), a3.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c5.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, c5, a4, a1);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, c5, a4, a1)]);
-      sort_indices<2,1,0,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a1.size());
-      zgemm3m_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,3,2,1,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -550,21 +532,20 @@ void Task568::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a3, c5, a4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a3, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, c5, a4, a1);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, c5, a4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a1.size());
-      zgemm3m_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a1.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -579,21 +560,20 @@ void Task569::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& c5 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a4, c5, a1);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a4, c5, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c5.size(), a1.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c5.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, c5, a4, a3);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, c5, a4, a3)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a3.size());
-      zgemm3m_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -608,21 +588,20 @@ void Task570::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& c5 : *range_[0]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a1, c5, a4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a1, c5, a4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c5.size(), a4.size());
+      gemm.reserve(c5.size()*a4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c5.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, c5, a4, a3);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, c5, a4, a3)]);
-      sort_indices<1,2,0,3,0,1,-1,1>(i1data, i1data_sorted, c2.size(), c5.size(), a4.size(), a3.size());
-      zgemm3m_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), c5.size()*a4.size(),
-             1.0, i0data_sorted, c5.size()*a4.size(), i1data_sorted, c5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), c5.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -637,21 +616,20 @@ void Task571::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a5, c4, a3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a5, c4, a3)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c4.size(), a3.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c4.size(), a3.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, a1, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, a1, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a1.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -666,21 +644,20 @@ void Task572::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a3.size(), c2.size()*a1.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a3, c4, a5);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a3, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a3.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a3.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, a1, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, a1, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a1.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", x1.size()*a3.size(), c2.size()*a1.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a3.size());
+      sort_indices<0,1,3,2,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a1.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,1,3,1,1,1,1>(odata_sorted, odata, x1.size(), a3.size(), c2.size(), a1.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -695,21 +672,20 @@ void Task573::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a5, c4, a1);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a5, c4, a1)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c4.size(), a1.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c4.size(), a1.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, a3, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, a3, a5, c4)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c2.size(), a3.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -724,21 +700,20 @@ void Task574::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*a1.size(), c2.size()*a3.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a1, c4, a5);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a1, c4, a5)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c4.size(), a5.size());
+      gemm.reserve(a5.size()*c4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c4.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, a3, a5, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, a3, a5, c4)]);
-      sort_indices<3,2,0,1,0,1,1,1>(i1data, i1data_sorted, c2.size(), a3.size(), a5.size(), c4.size());
-      zgemm3m_("T", "N", x1.size()*a1.size(), c2.size()*a3.size(), a5.size()*c4.size(),
-             1.0, i0data_sorted, a5.size()*c4.size(), i1data_sorted, a5.size()*c4.size(),
-             1.0, odata_sorted, x1.size()*a1.size());
+      sort_indices<0,1,3,2,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), a3.size(), a5.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,0,3,1,1,1,1,1>(odata_sorted, odata, x1.size(), a1.size(), c2.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -753,21 +728,20 @@ void Task575::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*c2.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& a5 : *range_[2]) {
     for (auto& a4 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a5, c2, a4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a5, c2, a4)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a5.size(), c2.size(), a4.size());
+      gemm.reserve(a5.size()*a4.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a5.size(), c2.size(), a4.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a5, a1, a4, a3);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a5, a1, a4, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i1data, i1data_sorted, a5.size(), a1.size(), a4.size(), a3.size());
-      zgemm3m_("T", "N", x1.size()*c2.size(), a1.size()*a3.size(), a5.size()*a4.size(),
-             1.0, i0data_sorted, a5.size()*a4.size(), i1data_sorted, a5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*c2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i1data.get(), gemm.b(), a5.size(), a1.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -782,21 +756,20 @@ void Task576::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, a3, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, a3, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, a3, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*c2.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& a4 : *range_[2]) {
     for (auto& a5 : *range_[2]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a4, c2, a5);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a4, c2, a5)]);
-      sort_indices<1,3,0,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a4.size(), c2.size(), a5.size());
+      gemm.reserve(a5.size()*a4.size());
+      sort_indices<0,2,1,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a4.size(), c2.size(), a5.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a5, a1, a4, a3);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a5, a1, a4, a3)]);
-      sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, a5.size(), a1.size(), a4.size(), a3.size());
-      zgemm3m_("T", "N", x1.size()*c2.size(), a1.size()*a3.size(), a5.size()*a4.size(),
-             1.0, i0data_sorted, a5.size()*a4.size(), i1data_sorted, a5.size()*a4.size(),
-             1.0, odata_sorted, x1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,-1,1>(i1data.get(), gemm.b(), a5.size(), a1.size(), a4.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, x1.size(), c2.size(), a1.size(), a3.size());
   out()->add_block(odata, c2, x1, a3, a1);
 }
@@ -811,19 +784,18 @@ void Task577::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size(), a1.size()*a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     // tensor label: h1
     std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, x1);
-    std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, x1)]);
-    sort_indices<1,0,0,1,1,1>(i0data, i0data_sorted, c2.size(), x1.size());
+    gemm.reserve(x1.size());
+    sort_indices<0,1,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), x1.size());
     // tensor label: I171
     std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a1, a3, x0, x1);
-    std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a1, a3, x0, x1)]);
-    sort_indices<3,0,1,2,0,1,1,1>(i1data, i1data_sorted, a1.size(), a3.size(), x0.size(), x1.size());
-    zgemm3m_("T", "N", c2.size(), a1.size()*a3.size()*x0.size(), x1.size(),
-           1.0, i0data_sorted, x1.size(), i1data_sorted, x1.size(),
-           1.0, odata_sorted, c2.size());
+    sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), a3.size(), x0.size(), x1.size());
+    gemm.commit();
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -838,21 +810,20 @@ void Task578::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, a3, x0, x1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a1, a3, x0, x1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, a3, x0, x1), 0.0);
+  GemmBatch<std::complex<double>> gemm(x0.size()*x1.size(), a1.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma33
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x3, x0, x2, x1);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x3, x0, x2, x1)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x0.size(), x2.size(), x1.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x0.size(), x2.size(), x1.size());
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x3, a1, x2, a3);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x3, a1, x2, a3)]);
-      sort_indices<0,2,1,3,0,1,-2,1>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), a3.size());
-      zgemm3m_("T", "N", x0.size()*x1.size(), a1.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x0.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,-2,1>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), a3.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x0.size(), x1.size(), a1.size(), a3.size());
   out()->add_block(odata, a1, a3, x0, x1);
 }
@@ -867,21 +838,20 @@ void Task579::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(a1.size()*a3.size(), c2.size()*x0.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x2, a1, x1, a3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x2, a1, x1, a3)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), a1.size(), x1.size(), a3.size());
+      gemm.reserve(x1.size()*x2.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), a1.size(), x1.size(), a3.size());
       // tensor label: I980
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c2, x1, x2, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c2, x1, x2, x0)]);
-      sort_indices<2,1,0,3,0,1,1,1>(i1data, i1data_sorted, c2.size(), x1.size(), x2.size(), x0.size());
-      zgemm3m_("T", "N", a1.size()*a3.size(), c2.size()*x0.size(), x1.size()*x2.size(),
-             1.0, i0data_sorted, x1.size()*x2.size(), i1data_sorted, x1.size()*x2.size(),
-             1.0, odata_sorted, a1.size()*a3.size());
+      sort_indices<0,3,2,1,0,1,1,1>(i1data.get(), gemm.b(), c2.size(), x1.size(), x2.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,1,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), a3.size(), c2.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -896,23 +866,22 @@ void Task580::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, x1, x2, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, x1, x2, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, x1, x2, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*x2.size()*x0.size(), c2.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       for (auto& x3 : *range_[1]) {
         // tensor label: Gamma317
         std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x5, x4, x1, x3, x2, x0);
-        std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x5, x4, x1, x3, x2, x0)]);
-        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
+        gemm.reserve(x5.size()*x4.size()*x3.size());
+        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x1.size(), x3.size(), x2.size(), x0.size());
         // tensor label: t2
         std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x5, x4, c2, x3);
-        std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x5, x4, c2, x3)]);
-        sort_indices<0,1,3,2,0,1,-1,1>(i1data, i1data_sorted, x5.size(), x4.size(), c2.size(), x3.size());
-        zgemm3m_("T", "N", x1.size()*x2.size()*x0.size(), c2.size(), x5.size()*x4.size()*x3.size(),
-               1.0, i0data_sorted, x5.size()*x4.size()*x3.size(), i1data_sorted, x5.size()*x4.size()*x3.size(),
-               1.0, odata_sorted, x1.size()*x2.size()*x0.size());
+        sort_indices<2,0,1,3,0,1,-1,1>(i1data.get(), gemm.b(), x5.size(), x4.size(), c2.size(), x3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x1.size(), x2.size(), x0.size(), c2.size());
   out()->add_block(odata, c2, x1, x2, x0);
 }
@@ -927,21 +896,20 @@ void Task581::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(a3.size()*c2.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c4, a3, c2, x3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c4, a3, c2, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c4.size(), a3.size(), c2.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a3.size(), c2.size(), x3.size());
       // tensor label: I983
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a1, c4, x3, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a1, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c4.size(), x3.size(), x0.size());
-      zgemm3m_("T", "N", a3.size()*c2.size(), a1.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a3.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,0,3,2,1,1,1,1>(odata_sorted, odata, a3.size(), c2.size(), a1.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -956,21 +924,20 @@ void Task582::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x3, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a1, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x3, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x3.size()*x0.size(), a1.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma318
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x2, a1, x1, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x2, a1, x1, c4)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), a1.size(), x1.size(), c4.size());
-      zgemm3m_("T", "N", x3.size()*x0.size(), a1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a1.size(), c4.size());
   out()->add_block(odata, a1, c4, x3, x0);
 }
@@ -985,21 +952,20 @@ void Task583::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(a1.size()*c2.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c4, a1, c2, x3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c4, a1, c2, x3)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, c4.size(), a1.size(), c2.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), c4.size(), a1.size(), c2.size(), x3.size());
       // tensor label: I986
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a3, c4, x3, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a3, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c4.size(), x3.size(), x0.size());
-      zgemm3m_("T", "N", a1.size()*c2.size(), a3.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -1014,21 +980,20 @@ void Task584::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, x3, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a3, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, x3, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x3.size()*x0.size(), a3.size()*c4.size(), odata_sorted.get());
   for (auto& x2 : *range_[1]) {
     for (auto& x1 : *range_[1]) {
       // tensor label: Gamma5
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x2, x3, x1, x0);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x2, x3, x1, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x2.size(), x3.size(), x1.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x2.size(), x3.size(), x1.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x2, a3, x1, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x2, a3, x1, c4)]);
-      sort_indices<0,2,1,3,0,1,-1,1>(i1data, i1data_sorted, x2.size(), a3.size(), x1.size(), c4.size());
-      zgemm3m_("T", "N", x3.size()*x0.size(), a3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,0,2,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), a3.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a3.size(), c4.size());
   out()->add_block(odata, a3, c4, x3, x0);
 }
@@ -1043,21 +1008,20 @@ void Task585::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a3, c4, x3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a3, c4, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), c4.size(), x3.size());
       // tensor label: I989
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a1, c4, x3, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a1, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), c4.size(), x3.size(), x0.size());
-      zgemm3m_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -1072,21 +1036,20 @@ void Task586::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, c4, x3, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a1, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, c4, x3, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x3.size()*x0.size(), a1.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma318
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x2, a1, x1, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x2, a1, x1, c4)]);
-      sort_indices<2,0,1,3,0,1,-1,1>(i1data, i1data_sorted, x2.size(), a1.size(), x1.size(), c4.size());
-      zgemm3m_("T", "N", x3.size()*x0.size(), a1.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,-1,1>(i1data.get(), gemm.b(), x2.size(), a1.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a1.size(), c4.size());
   out()->add_block(odata, a1, c4, x3, x0);
 }
@@ -1101,21 +1064,20 @@ void Task587::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& c4 : *range_[0]) {
     for (auto& x3 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a1, c4, x3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a1, c4, x3)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), c4.size(), x3.size());
+      gemm.reserve(c4.size()*x3.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), c4.size(), x3.size());
       // tensor label: I992
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a3, c4, x3, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a3, c4, x3, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), c4.size(), x3.size(), x0.size());
-      zgemm3m_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), c4.size()*x3.size(),
-             1.0, i0data_sorted, c4.size()*x3.size(), i1data_sorted, c4.size()*x3.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), c4.size(), x3.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -1130,21 +1092,20 @@ void Task588::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, c4, x3, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a3, c4, x3, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, c4, x3, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x3.size()*x0.size(), a3.size()*c4.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma318
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, x3, x2, x0);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, x3, x2, x0)]);
-      sort_indices<0,2,1,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), x3.size(), x2.size(), x0.size());
+      gemm.reserve(x2.size()*x1.size());
+      sort_indices<1,3,0,2,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), x3.size(), x2.size(), x0.size());
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x2, a3, x1, c4);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x2, a3, x1, c4)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, x2.size(), a3.size(), x1.size(), c4.size());
-      zgemm3m_("T", "N", x3.size()*x0.size(), a3.size()*c4.size(), x2.size()*x1.size(),
-             1.0, i0data_sorted, x2.size()*x1.size(), i1data_sorted, x2.size()*x1.size(),
-             1.0, odata_sorted, x3.size()*x0.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), x2.size(), a3.size(), x1.size(), c4.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x3.size(), x0.size(), a3.size(), c4.size());
   out()->add_block(odata, a3, c4, x3, x0);
 }
@@ -1159,21 +1120,20 @@ void Task589::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a3, x5, x4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a3, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a3.size(), x5.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a3.size(), x5.size(), x4.size());
       // tensor label: I995
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a1, x5, x4, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a1, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a1.size(), x5.size(), x4.size(), x0.size());
-      zgemm3m_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a1.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -1188,23 +1148,22 @@ void Task590::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x5.size()*x4.size()*x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma31
         std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x3, a1, x2, x1);
-        std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x3, a1, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,1,2>(i1data, i1data_sorted, x3.size(), a1.size(), x2.size(), x1.size());
-        zgemm3m_("T", "N", x5.size()*x4.size()*x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), a1.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x0);
 }
@@ -1219,23 +1178,22 @@ void Task591::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a1, x5, x4, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a1, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a1, x5, x4, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x5.size()*x4.size()*x0.size(), a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma193
         std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x3, x2, x1, a1);
-        std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x3, x2, x1, a1)]);
-        sort_indices<0,1,2,3,0,1,1,2>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), a1.size());
-        zgemm3m_("T", "N", x5.size()*x4.size()*x0.size(), a1.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<3,0,1,2,0,1,1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), a1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a1.size());
   out()->add_block(odata, a1, x5, x4, x0);
 }
@@ -1250,21 +1208,20 @@ void Task592::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x5 : *range_[1]) {
     for (auto& x4 : *range_[1]) {
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(c2, a1, x5, x4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(c2, a1, x5, x4)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i0data, i0data_sorted, c2.size(), a1.size(), x5.size(), x4.size());
+      gemm.reserve(x5.size()*x4.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i0data.get(), gemm.a(), c2.size(), a1.size(), x5.size(), x4.size());
       // tensor label: I998
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(a3, x5, x4, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(a3, x5, x4, x0)]);
-      sort_indices<1,2,0,3,0,1,1,1>(i1data, i1data_sorted, a3.size(), x5.size(), x4.size(), x0.size());
-      zgemm3m_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), x5.size()*x4.size(),
-             1.0, i0data_sorted, x5.size()*x4.size(), i1data_sorted, x5.size()*x4.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<0,3,1,2,0,1,1,1>(i1data.get(), gemm.b(), a3.size(), x5.size(), x4.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -1279,23 +1236,22 @@ void Task593::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x4, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x4, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x5.size()*x4.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma31
         std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x5, x4, x3, x0, x2, x1);
-        std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x5, x4, x3, x0, x2, x1)]);
-        sort_indices<2,4,5,0,1,3,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,3,2,4,5,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x0.size(), x2.size(), x1.size());
         // tensor label: v2
         std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x3, a3, x2, x1);
-        std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x3, a3, x2, x1)]);
-        sort_indices<0,2,3,1,0,1,-1,2>(i1data, i1data_sorted, x3.size(), a3.size(), x2.size(), x1.size());
-        zgemm3m_("T", "N", x5.size()*x4.size()*x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<1,0,2,3,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), a3.size(), x2.size(), x1.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x4, x0);
 }
@@ -1310,23 +1266,22 @@ void Task594::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(a3, x5, x4, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(a3, x5, x4, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(a3, x5, x4, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x5.size()*x4.size()*x0.size(), a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       for (auto& x1 : *range_[1]) {
         // tensor label: Gamma193
         std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x5, x4, x3, x2, x1, x0);
-        std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x5, x4, x3, x2, x1, x0)]);
-        sort_indices<2,3,4,0,1,5,0,1,1,1>(i0data, i0data_sorted, x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
+        gemm.reserve(x3.size()*x2.size()*x1.size());
+        sort_indices<0,1,5,2,3,4,0,1,1,1>(i0data.get(), gemm.a(), x5.size(), x4.size(), x3.size(), x2.size(), x1.size(), x0.size());
         // tensor label: v2
         std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(x3, x2, x1, a3);
-        std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(x3, x2, x1, a3)]);
-        sort_indices<0,1,2,3,0,1,-1,2>(i1data, i1data_sorted, x3.size(), x2.size(), x1.size(), a3.size());
-        zgemm3m_("T", "N", x5.size()*x4.size()*x0.size(), a3.size(), x3.size()*x2.size()*x1.size(),
-               1.0, i0data_sorted, x3.size()*x2.size()*x1.size(), i1data_sorted, x3.size()*x2.size()*x1.size(),
-               1.0, odata_sorted, x5.size()*x4.size()*x0.size());
+        sort_indices<3,0,1,2,0,1,-1,2>(i1data.get(), gemm.b(), x3.size(), x2.size(), x1.size(), a3.size());
+        gemm.commit();
       }
     }
   }
+  gemm.compute();
   sort_indices<3,0,1,2,1,1,1,1>(odata_sorted, odata, x5.size(), x4.size(), x0.size(), a3.size());
   out()->add_block(odata, a3, x5, x4, x0);
 }
@@ -1341,21 +1296,20 @@ void Task595::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a1.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, c4, c2, a1);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, c4, c2, a1)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), c4.size(), c2.size(), a1.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), c4.size(), c2.size(), a1.size());
       // tensor label: I1007
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c4, a3, x1, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c4, a3, x1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a3.size(), x1.size(), x0.size());
-      zgemm3m_("T", "N", c2.size()*a1.size(), a3.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a1.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a3.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,2,3,1,1,1,1,1>(odata_sorted, odata, c2.size(), a1.size(), a3.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -1370,21 +1324,20 @@ void Task596::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, a3, x1, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c4, a3, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, a3, x1, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*x0.size(), c4.size()*a3.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c4, a3, x3, x2);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c4, a3, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,1,1>(i1data, i1data_sorted, c4.size(), a3.size(), x3.size(), x2.size());
-      zgemm3m_("T", "N", x1.size()*x0.size(), c4.size()*a3.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a3.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c4.size(), a3.size());
   out()->add_block(odata, c4, a3, x1, x0);
 }
@@ -1399,21 +1352,20 @@ void Task597::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(c2.size()*a3.size(), a1.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, c4, c2, a3);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, c4, c2, a3)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x1.size(), c4.size(), c2.size(), a3.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), c4.size(), c2.size(), a3.size());
       // tensor label: I1010
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c4, a1, x1, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c4, a1, x1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a1.size(), x1.size(), x0.size());
-      zgemm3m_("T", "N", c2.size()*a3.size(), a1.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, c2.size()*a3.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a1.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<0,1,3,2,1,1,1,1>(odata_sorted, odata, c2.size(), a3.size(), a1.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
@@ -1428,21 +1380,20 @@ void Task598::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c4, a1, x1, x0), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c4, a1, x1, x0)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c4, a1, x1, x0), 0.0);
+  GemmBatch<std::complex<double>> gemm(x1.size()*x0.size(), c4.size()*a1.size(), odata_sorted.get());
   for (auto& x3 : *range_[1]) {
     for (auto& x2 : *range_[1]) {
       // tensor label: Gamma24
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x3, x2, x1, x0);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x3, x2, x1, x0)]);
-      sort_indices<0,1,2,3,0,1,1,1>(i0data, i0data_sorted, x3.size(), x2.size(), x1.size(), x0.size());
+      gemm.reserve(x3.size()*x2.size());
+      sort_indices<2,3,0,1,0,1,1,1>(i0data.get(), gemm.a(), x3.size(), x2.size(), x1.size(), x0.size());
       // tensor label: t2
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c4, a1, x3, x2);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c4, a1, x3, x2)]);
-      sort_indices<2,3,0,1,0,1,-1,1>(i1data, i1data_sorted, c4.size(), a1.size(), x3.size(), x2.size());
-      zgemm3m_("T", "N", x1.size()*x0.size(), c4.size()*a1.size(), x3.size()*x2.size(),
-             1.0, i0data_sorted, x3.size()*x2.size(), i1data_sorted, x3.size()*x2.size(),
-             1.0, odata_sorted, x1.size()*x0.size());
+      sort_indices<0,1,2,3,0,1,-1,1>(i1data.get(), gemm.b(), c4.size(), a1.size(), x3.size(), x2.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<2,3,0,1,1,1,1,1>(odata_sorted, odata, x1.size(), x0.size(), c4.size(), a1.size());
   out()->add_block(odata, c4, a1, x1, x0);
 }
@@ -1457,21 +1408,20 @@ void Task599::Task_local::compute() {
   std::fill_n(odata.get(), out()->get_size(c2, a3, x0, a1), 0.0);
   std::unique_ptr<std::complex<double>[]> odata_sorted(new std::complex<double>[out()->get_size(c2, a3, x0, a1)]);
   std::fill_n(odata_sorted.get(), out()->get_size(c2, a3, x0, a1), 0.0);
+  GemmBatch<std::complex<double>> gemm(a1.size()*c2.size(), a3.size()*x0.size(), odata_sorted.get());
   for (auto& x1 : *range_[1]) {
     for (auto& c4 : *range_[0]) {
       // tensor label: v2
       std::unique_ptr<std::complex<double>[]> i0data = in(0)->get_block(x1, a1, c2, c4);
-      std::unique_ptr<std::complex<double>[]> i0data_sorted(new std::complex<double>[in(0)->get_size(x1, a1, c2, c4)]);
-      sort_indices<0,3,1,2,0,1,1,1>(i0data, i0data_sorted, x1.size(), a1.size(), c2.size(), c4.size());
+      gemm.reserve(c4.size()*x1.size());
+      sort_indices<1,2,0,3,0,1,1,1>(i0data.get(), gemm.a(), x1.size(), a1.size(), c2.size(), c4.size());
       // tensor label: I1013
       std::unique_ptr<std::complex<double>[]> i1data = in(1)->get_block(c4, a3, x1, x0);
-      std::unique_ptr<std::complex<double>[]> i1data_sorted(new std::complex<double>[in(1)->get_size(c4, a3, x1, x0)]);
-      sort_indices<2,0,1,3,0,1,1,1>(i1data, i1data_sorted, c4.size(), a3.size(), x1.size(), x0.size());
-      zgemm3m_("T", "N", a1.size()*c2.size(), a3.size()*x0.size(), c4.size()*x1.size(),
-             1.0, i0data_sorted, c4.size()*x1.size(), i1data_sorted, c4.size()*x1.size(),
-             1.0, odata_sorted, a1.size()*c2.size());
+      sort_indices<1,3,2,0,0,1,1,1>(i1data.get(), gemm.b(), c4.size(), a3.size(), x1.size(), x0.size());
+      gemm.commit();
     }
   }
+  gemm.compute();
   sort_indices<1,2,3,0,1,1,1,1>(odata_sorted, odata, a1.size(), c2.size(), a3.size(), x0.size());
   out()->add_block(odata, c2, a3, x0, a1);
 }
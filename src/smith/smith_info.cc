@@ -83,6 +83,8 @@ SMITH_Info<DataType>::SMITH_Info(shared_ptr<const Reference> o, const shared_ptr
   shift_  = idata->get<double>("shift", 0.0);
   davidson_subspace_ = idata->get<int>("davidson_subspace", 10);
   thresh_overlap_ = idata->get<double>("thresh_overlap", 1.0e-9);
+  // in MB
+  memory_budget_ = static_cast<size_t>(idata->get<double>("memory_budget", 0.0) * (1LU << 20));
 
   // enable restart capability
   restart_ = idata->get<bool>("restart", false);
@@ -112,7 +114,7 @@ SMITH_Info<DataType>::SMITH_Info(shared_ptr<const Reference> o, shared_ptr<const
     cimaxchunk_(info->cimaxchunk_), davidson_subspace_(info->davidson_subspace_), grad_(info->grad_),
     do_ms_(info->do_ms_), do_xms_(info->do_xms_), sssr_(info->sssr_),
     shift_diag_(info->shift_diag_), block_diag_fock_(info->block_diag_fock_), restart_(info->restart_),
-    restart_each_iter_(info->restart_each_iter_), thresh_overlap_(info->thresh_overlap_),
+    restart_each_iter_(info->restart_each_iter_), thresh_overlap_(info->thresh_overlap_), memory_budget_(info->memory_budget_),
     state_begin_(info->state_begin_), restart_iter_(info->restart_iter_), aniso_data_(info->aniso_data_), external_rdm_(info->external_rdm_) {
 }
 
@@ -62,6 +62,9 @@ class SMITH_Info {
 
     double thresh_overlap_;
 
+    // memory budget for the intermediate tensors per process (in bytes); 0 means unlimited
+    size_t memory_budget_;
+
     // For restarted jobs
     int state_begin_;
     int restart_iter_;
@@ -77,7 +80,7 @@ class SMITH_Info {
       ar & ref_ & method_ & ncore_ & nfrozenvirt_ & thresh_ & shift_ & maxiter_;
       ar & maxtile_ & cimaxtile_ & cimaxchunk_ & davidson_subspace_ & grad_;
       ar & do_ms_ & do_xms_ & sssr_ & shift_diag_ & block_diag_fock_ & restart_ & restart_each_iter_;
-      ar & thresh_overlap_ & state_begin_ & restart_iter_ & aniso_data_ & external_rdm_;
+      ar & thresh_overlap_ & state_begin_ & restart_iter_ & aniso_data_ & external_rdm_ & memory_budget_;
     }
 
   public:
@@ -116,6 +119,7 @@ class SMITH_Info {
     bool restart_each_iter() const { return restart_each_iter_; }
 
     double thresh_overlap() const { return thresh_overlap_; }
+    size_t memory_budget() const { return memory_budget_; }
 
     template<typename T = DataType, class = typename std::enable_if<std::is_same<T, std::complex<double>>::value>::type>
     bool gaunt() const { return relref()->gaunt(); }
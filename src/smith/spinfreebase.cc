@@ -29,6 +29,7 @@
 #include <src/smith/moint.h>
 #include <src/smith/spinfreebase.h>
 #include <src/smith/smith_util.h>
+#include <src/smith/queue.h>
 
 using namespace std;
 using namespace bagel;
@@ -662,17 +663,25 @@ DataType SpinFreeMethod<DataType>::dot_product_transpose(shared_ptr<const MultiT
 template<typename DataType>
 DataType SpinFreeMethod<DataType>::dot_product_transpose(shared_ptr<const Tensor_<DataType>> r, shared_ptr<const Tensor_<DataType>> t2) const {
   DataType out = 0.0;
-  auto prod = [this, &r, &t2, &out](const Index& i0, const Index& i1, const Index& i2, const Index& i3) {
-    const size_t size = r->get_size(i2, i3, i0, i1);
-    if (r->is_local(i2, i3, i0, i1) && size != 0) {
-      unique_ptr<DataType[]> tmp0 = t2->get_block(i0, i1, i2, i3);
-      unique_ptr<DataType[]> tmp1(new DataType[size]);
-      sort_indices<2,3,0,1,0,1,1,1>(tmp0.get(), tmp1.get(), i0.size(), i1.size(), i2.size(), i3.size());
-
-      out += blas::dot_product(r->get_block(i2, i3, i0, i1).get(), size, tmp1.get());
-    }
+  // the (remote) blocks of t2 are fetched in batches while the previous ones are processed
+  vector<vector<Index>> keys;
+  auto prod = [&r, &keys](const Index& i0, const Index& i1, const Index& i2, const Index& i3) {
+    if (r->is_local(i2, i3, i0, i1) && r->get_size(i2, i3, i0, i1) != 0)
+      keys.push_back({i0, i1, i2, i3});
   };
   loop_over(prod);
+
+  t2->for_each_block(keys, [&r, &keys, &out](const size_t i, unique_ptr<DataType[]> tmp0) {
+    const Index& i0 = keys[i][0];
+    const Index& i1 = keys[i][1];
+    const Index& i2 = keys[i][2];
+    const Index& i3 = keys[i][3];
+    const size_t size = r->get_size(i2, i3, i0, i1);
+    unique_ptr<DataType[]> tmp1(new DataType[size]);
+    sort_indices<2,3,0,1,0,1,1,1>(tmp0.get(), tmp1.get(), i0.size(), i1.size(), i2.size(), i3.size());
+
+    out += blas::dot_product(r->get_block(i2, i3, i0, i1).get(), size, tmp1.get());
+  });
   mpi__->allreduce(&out, 1);
   return out;
 }
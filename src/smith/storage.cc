@@ -133,6 +133,39 @@ unique_ptr<DataType[]> StorageIncore<DataType>::get_block(vector<Index> i) const
 }
 
 
+template<typename DataType>
+shared_ptr<BlockFuture<DataType>> StorageIncore<DataType>::get_block_async(const vector<vector<Index>>& keys) const {
+  // merged requests are limited so that the count fits in int
+  const size_t maxsize = 1LU << 26;
+
+  // (process, offset, size, position in keys) sorted by process and offset
+  vector<tuple<size_t, size_t, size_t, size_t>> loc;
+  loc.reserve(keys.size());
+  for (size_t i = 0; i != keys.size(); ++i) {
+    size_t rank, off, size;
+    tie(rank, off, size) = locate(generate_hash_key(keys[i]));
+    loc.emplace_back(rank, off, size, i);
+  }
+  sort(loc.begin(), loc.end());
+
+  auto out = make_shared<BlockFuture<DataType>>(keys.size());
+  for (auto i = loc.begin(); i != loc.end(); ) {
+    size_t size = get<2>(*i);
+    auto j = i+1;
+    for ( ; j != loc.end() && get<0>(*j) == get<0>(*i) && get<1>(*j) == get<1>(*i)+size && size+get<2>(*j) <= maxsize; ++j)
+      size += get<2>(*j);
+
+    unique_ptr<DataType[]> buf(new DataType[size]);
+    shared_ptr<RMATask<DataType>> task = this->rma_rget(buf.get(), get<0>(*i), get<1>(*i), size);
+    const size_t b = out->add_buffer(move(buf), task);
+    for (auto k = i; k != j; ++k)
+      out->set_block(get<3>(*k), b, get<1>(*k)-get<1>(*i), get<2>(*k));
+    i = j;
+  }
+  return out;
+}
+
+
 template<typename DataType>
 void StorageIncore<DataType>::put_block(const unique_ptr<DataType[]>& dat) {
   rma_put(dat, generate_hash_key());
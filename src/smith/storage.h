@@ -33,6 +33,8 @@
 #include <map>
 #include <unordered_map>
 #include <list>
+#include <tuple>
+#include <vector>
 #include <cassert>
 #include <algorithm>
 #include <numeric>
@@ -83,6 +85,57 @@ namespace {
 }
 
 
+// Blocks requested by get_block_async. The RMA operations are in flight until wait() (or get()) is called.
+template<typename DataType>
+class BlockFuture {
+  protected:
+    std::vector<std::shared_ptr<RMATask<DataType>>> tasks_;
+    std::vector<std::unique_ptr<DataType[]>> buffers_;
+    // number of blocks in each buffer
+    std::vector<int> nblock_;
+    // buffer, offset, and size of each block
+    std::vector<std::tuple<size_t, size_t, size_t>> blocks_;
+    bool done_;
+
+  public:
+    BlockFuture(const size_t n) : blocks_(n), done_(false) { }
+
+    // buf is filled by task (which can be nullptr if buf is ready)
+    size_t add_buffer(std::unique_ptr<DataType[]>&& buf, std::shared_ptr<RMATask<DataType>> task) {
+      tasks_.push_back(task);
+      buffers_.push_back(std::move(buf));
+      nblock_.push_back(0);
+      return buffers_.size()-1;
+    }
+    void set_block(const size_t i, const size_t buffer, const size_t offset, const size_t size) {
+      blocks_[i] = std::make_tuple(buffer, offset, size);
+      ++nblock_[buffer];
+    }
+
+    size_t size() const { return blocks_.size(); }
+
+    void wait() {
+      if (done_) return;
+      for (auto& i : tasks_)
+        if (i) i->wait();
+      done_ = true;
+    }
+
+    // returns the i-th requested block; can be called only once for each block
+    std::unique_ptr<DataType[]> get(const size_t i) {
+      wait();
+      size_t buffer, offset, size;
+      std::tie(buffer, offset, size) = blocks_[i];
+      assert(buffers_[buffer]);
+      if (nblock_[buffer] == 1)
+        return std::move(buffers_[buffer]);
+      std::unique_ptr<DataType[]> out(new DataType[size]);
+      std::copy_n(buffers_[buffer].get()+offset, size, out.get());
+      return out;
+    }
+};
+
+
 template<typename DataType>
 class StorageIncore : public RMAWindow<DataType> {
   public:
@@ -201,6 +254,9 @@ class StorageIncore : public RMAWindow<DataType> {
                                                   const Index& i4, const Index& i5, const Index& i6, const Index& i7) const;
     virtual std::unique_ptr<DataType[]> get_block(std::vector<Index> i) const;
 
+    // Non-blocking get_block for a list of blocks. Blocks that are contiguous on the same process are fetched by one RMA operation.
+    virtual std::shared_ptr<BlockFuture<DataType>> get_block_async(const std::vector<std::vector<Index>>& keys) const;
+
     virtual void put_block(const std::unique_ptr<DataType[]>& dat);
     virtual void put_block(const std::unique_ptr<DataType[]>& dat, const Index& i0);
     virtual void put_block(const std::unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1);
@@ -185,6 +185,30 @@ void StorageKramers<DataType>::add_block(const unique_ptr<DataType[]>& dat, cons
   add_block_(dat, i0, i1, i2, i3, i4, i5, i6, i7);
 }
 
+template<typename DataType>
+shared_ptr<BlockFuture<DataType>> StorageKramers<DataType>::get_block_async(const vector<vector<Index>>& keys) const {
+  auto out = make_shared<BlockFuture<DataType>>(keys.size());
+  for (size_t i = 0; i != keys.size(); ++i) {
+    const vector<Index>& k = keys[i];
+    unique_ptr<DataType[]> data;
+    switch (k.size()) {
+      case 0: data = get_block(); break;
+      case 1: data = get_block(k[0]); break;
+      case 2: data = get_block(k[0], k[1]); break;
+      case 3: data = get_block(k[0], k[1], k[2]); break;
+      case 4: data = get_block(k[0], k[1], k[2], k[3]); break;
+      case 5: data = get_block(k[0], k[1], k[2], k[3], k[4]); break;
+      case 6: data = get_block(k[0], k[1], k[2], k[3], k[4], k[5]); break;
+      case 7: data = get_block(k[0], k[1], k[2], k[3], k[4], k[5], k[6]); break;
+      case 8: data = get_block(k[0], k[1], k[2], k[3], k[4], k[5], k[6], k[7]); break;
+      default: throw logic_error("StorageKramers::get_block_async is implemented up to rank 8");
+    }
+    const size_t size = this->blocksize(k);
+    out->set_block(i, out->add_buffer(move(data), nullptr), 0, size);
+  }
+  return out;
+}
+
 // explicit instantiation
 template class StorageKramers<double>;
 template class StorageKramers<complex<double>>;
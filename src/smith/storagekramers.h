@@ -166,6 +166,9 @@ class StorageKramers : public StorageIncore<DataType> {
                                           const Index& i4, const Index& i5, const Index& i6, const Index& i7) const override;
     std::unique_ptr<DataType[]> get_block(std::vector<Index> i) const override { assert(false); return std::unique_ptr<DataType[]>(); }
 
+    // blocks in other sectors are generated by permutations; these are retrieved synchronously
+    std::shared_ptr<BlockFuture<DataType>> get_block_async(const std::vector<std::vector<Index>>& keys) const override;
+
     void put_block(const std::unique_ptr<DataType[]>& dat) override;
     void put_block(const std::unique_ptr<DataType[]>& dat, const Index& i0) override;
     void put_block(const std::unique_ptr<DataType[]>& dat, const Index& i0, const Index& i1) override;
@@ -29,6 +29,7 @@
 #include <memory>
 #include <src/smith/indexrange.h>
 #include <src/smith/tensor.h>
+#include <src/smith/gemmbatch.h>
 
 namespace bagel {
 namespace SMITH {
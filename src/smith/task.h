@@ -27,14 +27,19 @@
 #define __SRC_SMITH_TASK_H
 
 #include <stddef.h>
+#include <array>
 #include <list>
 #include <memory>
+#include <utility>
+#include <vector>
 #include <algorithm>
 #include <src/smith/storage.h>
 
 namespace bagel {
 namespace SMITH {
 
+template <typename DataType> class Tensor_;
+
 // base class for Task objects
 // assumes that the operation table is static (not adjustable at runtime).
 class Task : public std::enable_shared_from_this<Task> {
@@ -42,17 +47,49 @@ class Task : public std::enable_shared_from_this<Task> {
     std::list<std::shared_ptr<Task>> depend_;
     std::list<std::weak_ptr<Task>> target_;
     bool done_;
+    bool prepared_;
+    // collective part of the task (allocation of the output and initialization of the input tensors)
+    virtual void prepare_() { }
     virtual void compute_() = 0;
 
+    template<typename DataType>
+    static std::vector<std::pair<const void*, size_t>> allocation_of(const std::shared_ptr<Tensor_<DataType>>& t) {
+      std::vector<std::pair<const void*, size_t>> out;
+      if (!t->allocated())
+        out.emplace_back(t.get(), t->size()*sizeof(DataType));
+      return out;
+    }
+    template<typename DataType, size_t N>
+    static std::vector<std::pair<const void*, size_t>> allocation_of(const std::array<std::shared_ptr<Tensor_<DataType>>,N>& t) {
+      std::vector<std::pair<const void*, size_t>> out;
+      for (auto& i : t)
+        if (!i->allocated())
+          out.emplace_back(i.get(), i->size()*sizeof(DataType));
+      return out;
+    }
+
   public:
-    Task() : done_(false) {}
-    Task(std::list<std::shared_ptr<Task>>& d) : depend_(d), done_(false) {}
+    Task() : done_(false), prepared_(false) {}
+    Task(std::list<std::shared_ptr<Task>>& d) : depend_(d), done_(false), prepared_(false) {}
     ~Task() { }
+
+    // has to be called on all the processes in the same order
+    void prepare() {
+      if (!prepared_) prepare_();
+      prepared_ = true;
+    }
     void compute() {
+      prepare();
       compute_();
       done_ = true;
     }
 
+    // true if compute_() only consists of one-sided operations, so that it can be run concurrently with other tasks after prepare()
+    virtual bool concurrent() const { return false; }
+
+    // tensors that are allocated by prepare() and their sizes in bytes (summed over the processes); used to plan the memory
+    virtual std::vector<std::pair<const void*, size_t>> allocation() const { return {}; }
+
     void add_dep(std::shared_ptr<Task> a) {
       depend_.push_back(a);
       a->set_target(this->shared_from_this());
@@ -65,10 +102,15 @@ class Task : public std::enable_shared_from_this<Task> {
 
     void set_target(std::shared_ptr<Task> b) { target_.push_back(b); }
 
-    void initialize() { done_ = false; }
+    void initialize() {
+      done_ = false;
+      prepared_ = false;
+    }
 
     bool done() const { return done_; }
 
+    const std::list<std::shared_ptr<Task>>& depend() const { return depend_; }
+
     bool ready() const { return !done_ && std::all_of(depend_.begin(), depend_.end(), [](std::shared_ptr<Task> o) { return o->done(); }); }
 
     virtual double target() const { return 0.0; }
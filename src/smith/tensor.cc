@@ -138,15 +138,21 @@ shared_ptr<typename Tensor_<DataType>::MatType> Tensor_<DataType>::matrix_3index
   const size_t off2 = o[2].front().offset();
 
   auto out = make_shared<MatType>(o[0].size(), o[1].size()*o[2].size());
+  vector<vector<Index>> keys;
   for (auto& i2 : o[2].range())
     for (auto& i1 : o[1].range())
-      for (auto& i0 : o[0].range()) {
-        auto input = get_block(i0, i1, i2);
-        for (size_t io2 = 0; io2 != i2.size(); ++io2)
-          for (size_t io1 = 0; io1 != i1.size(); ++io1)
-            copy_n(&(input[0+i0.size()*(io1+i1.size()*io2)]),
-                   i0.size(), out->element_ptr(i0.offset()-off0, io1+i1.offset()-off1 + o[1].size()*(io2+i2.offset()-off2)));
-      }
+      for (auto& i0 : o[0].range())
+        keys.push_back({i0, i1, i2});
+
+  for_each_block(keys, [&](const size_t i, unique_ptr<DataType[]> input) {
+    const Index& i0 = keys[i][0];
+    const Index& i1 = keys[i][1];
+    const Index& i2 = keys[i][2];
+    for (size_t io2 = 0; io2 != i2.size(); ++io2)
+      for (size_t io1 = 0; io1 != i1.size(); ++io1)
+        copy_n(&(input[0+i0.size()*(io1+i1.size()*io2)]),
+               i0.size(), out->element_ptr(i0.offset()-off0, io1+i1.offset()-off1 + o[1].size()*(io2+i2.offset()-off2)));
+  });
 
   return out;
 }
@@ -159,9 +165,16 @@ shared_ptr<typename Tensor_<DataType>::MatType> Tensor_<DataType>::matrix() cons
   const int off0 = o[0].front().offset();
   const int off1 = o[1].front().offset();
   auto out = make_shared<MatType>(o[0].size(), o[1].size());
+  vector<vector<Index>> keys;
   for (auto& i1 : o[1].range())
     for (auto& i0 : o[0].range())
-      out->copy_block(i0.offset()-off0, i1.offset()-off1, i0.size(), i1.size(), get_block(i0, i1).get());
+      keys.push_back({i0, i1});
+
+  for_each_block(keys, [&](const size_t i, unique_ptr<DataType[]> data) {
+    const Index& i0 = keys[i][0];
+    const Index& i1 = keys[i][1];
+    out->copy_block(i0.offset()-off0, i1.offset()-off1, i0.size(), i1.size(), data.get());
+  });
 
   return out;
 }
@@ -173,8 +186,13 @@ shared_ptr<typename Tensor_<DataType>::VecType> Tensor_<DataType>::vectorb() con
   assert(o.size() == 1);
 
   auto out = make_shared<VecType>(o[0].size());
+  vector<vector<Index>> keys;
   for (auto& i0 : o[0].range())
-    copy_n(get_block(i0).get(), i0.size(), out->data()+i0.offset());
+    keys.push_back({i0});
+
+  for_each_block(keys, [&](const size_t i, unique_ptr<DataType[]> data) {
+    copy_n(data.get(), keys[i][0].size(), out->data()+keys[i][0].offset());
+  });
 
   return out;
 }
@@ -111,6 +111,8 @@ class Tensor_ {
 
     int rank() const { return rank_; }
     size_t size_alloc() const;
+    // total number of elements (allocated or not)
+    size_t size() const { return data_->size(); }
 
     double norm() const { return std::sqrt(detail::real(dot_product(*this))); }
     double rms() const { return std::sqrt(detail::real(dot_product(*this))/size_alloc()); }
@@ -122,6 +124,27 @@ class Tensor_ {
       return data_->get_block(std::forward<args>(p)...);
     }
 
+    std::shared_ptr<BlockFuture<DataType>> get_block_async(const std::vector<std::vector<Index>>& keys) const {
+      return data_->get_block_async(keys);
+    }
+
+    // Calls f(i, block) for the blocks in keys in order. Blocks are requested in batches, and the next batch is
+    // in flight while f is called for the current one.
+    template<typename F>
+    void for_each_block(const std::vector<std::vector<Index>>& keys, F f, const size_t nbatch = 64) const {
+      auto request = [&](const size_t start) {
+        const size_t end = std::min(start+nbatch, keys.size());
+        return get_block_async(std::vector<std::vector<Index>>(keys.begin()+start, keys.begin()+end));
+      };
+      std::shared_ptr<BlockFuture<DataType>> current = keys.empty() ? nullptr : request(0);
+      for (size_t start = 0; start < keys.size(); start += nbatch) {
+        std::shared_ptr<BlockFuture<DataType>> next = start+nbatch < keys.size() ? request(start+nbatch) : nullptr;
+        for (size_t i = 0; i != current->size(); ++i)
+          f(start+i, current->get(i));
+        current = next;
+      }
+    }
+
     template<typename ...args>
     void put_block(std::unique_ptr<DataType[]>& o, args&& ...p) {
       data_->put_block(o, std::forward<args>(p)...);
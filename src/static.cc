@@ -31,6 +31,8 @@
 #include <src/util/string.h>
 #include <src/util/parallel/mpi_interface.h>
 #include <src/util/parallel/resources.h>
+#include <src/util/parallel/profiler.h>
+#include <src/util/math/mappedmemory.h>
 
 // They are used from other files
 namespace bagel{
@@ -60,10 +62,34 @@ void static_variables() {
 #ifdef _OPENMP
     omp_set_num_threads(num_threads);
 #endif
-    resources = unique_ptr<Resources>(new Resources(num_threads));
+    // size of each integral stack in MB; stacks grow beyond this when needed
+    string sstack_size = getenv_multiple("BAGEL_STACK_SIZE");
+    const size_t stack_size = sstack_size.empty() ? 20000000LU : (lexical_cast<size_t>(sstack_size) << 20)/sizeof(double);
+    resources = unique_ptr<Resources>(new Resources(num_threads, stack_size));
     resources__ = resources.get();
   }
 
+  // hierarchical timing regions are written to the file BAGEL_PROFILE (BAGEL_PROFILE_FORMAT is json or chrome)
+  {
+    const string profile = getenv_multiple("BAGEL_PROFILE");
+    if (!profile.empty()) {
+      const string format = to_lower(getenv_multiple("BAGEL_PROFILE_FORMAT"));
+      if (!format.empty() && format != "json" && format != "chrome")
+        throw runtime_error("BAGEL_PROFILE_FORMAT should be json or chrome");
+      Profiler::enable(profile, format == "chrome" ? Profiler::Format::Chrome : Profiler::Format::JSON);
+    }
+  }
+
+  // DF blocks (and Davidson subspaces if requested) larger than BAGEL_SCRATCH_THRESHOLD (in MB; default 256) are kept in scratch files
+  // in BAGEL_SCRATCH. BAGEL_DF_SCRATCH and BAGEL_DF_SCRATCH_THRESHOLD are also accepted.
+  {
+    const string scratch = getenv_multiple("BAGEL_SCRATCH", "BAGEL_DF_SCRATCH");
+    if (!scratch.empty()) {
+      const string threshold = getenv_multiple("BAGEL_SCRATCH_THRESHOLD", "BAGEL_DF_SCRATCH_THRESHOLD");
+      MappedMemory::enable(scratch, (threshold.empty() ? 256LU : stoul(threshold)) << 20);
+    }
+  }
+
   // rounding mode in std::rint, std::lrint, and std::llrint
   fesetround(FE_TONEAREST);
 }
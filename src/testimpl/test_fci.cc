@@ -26,6 +26,7 @@
 #include <src/ci/fci/harrison.h>
 #include <src/ci/fci/knowles.h>
 #include <src/ci/fci/distfci.h>
+#include <src/util/math/mappedmemory.h>
 
 std::vector<double> fci_energy(std::string inp) {
 
@@ -115,9 +116,21 @@ BOOST_AUTO_TEST_CASE(HARRISON_ZARRABIAN) {
     BOOST_CHECK(compare(fci_energy("hhe_svp_fci_hz_trip"), reference_fci_energy2()));
 }
 
+BOOST_AUTO_TEST_CASE(MIXED_PRECISION) {
+    BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_kh_mixed"), reference_fci_energy()));
+}
+
+BOOST_AUTO_TEST_CASE(DAVIDSON_SCRATCH) {
+    // same as BAGEL_SCRATCH=. with a threshold of one byte, so that all the Davidson vectors are in scratch files
+    MappedMemory::enable(".", 1LU);
+    BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_kh_scratch"), reference_fci_energy()));
+    MappedMemory::enable("", 0LU);
+}
+
 #ifdef HAVE_MPI_H
 BOOST_AUTO_TEST_CASE(DIST_FCI) {
     BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_dist"), reference_fci_energy()));
+    BOOST_CHECK(compare(fci_energy("hf_sto3g_fci_dist_prefetch"), reference_fci_energy()));
 }
 #endif
 
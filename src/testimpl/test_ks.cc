@@ -25,7 +25,6 @@
 #include <sstream>
 #include <src/scf/ks/ks.h>
 #include <src/wfn/reference.h>
-#ifdef HAVE_XC_H
 
 using namespace bagel;
 
@@ -61,9 +60,11 @@ double ks_energy(std::string filename) {
 BOOST_AUTO_TEST_SUITE(TEST_KS)
 
 BOOST_AUTO_TEST_CASE(DF_KS) {
+    BOOST_CHECK(compare(ks_energy("hf_svp_slater"),        -98.94432445));
+    BOOST_CHECK(compare(ks_energy("hf_svp_blyp"),          -100.28234540));
+    BOOST_CHECK(compare(ks_energy("hf_svp_pbe"),           -100.19589615));
+    BOOST_CHECK(compare(ks_energy("hf_svp_pbe0"),          -100.19099504));
     BOOST_CHECK(compare(ks_energy("hf_svp_b3lyp"),         -100.28959774));
 }
 
 BOOST_AUTO_TEST_SUITE_END()
-
-#endif
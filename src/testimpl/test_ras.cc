@@ -101,4 +101,12 @@ BOOST_AUTO_TEST_CASE(RESTRICTED) {
     BOOST_CHECK(compare(ras_energy("hhe_svp_ras_restricted"), reference_ras_energy_hhe_restricted()));
 }
 
+BOOST_AUTO_TEST_CASE(SCREENED_SIGMA) {
+    BOOST_CHECK(compare(ras_energy("h2o_sto3g_ras_screened"), reference_ras_energy_h2o_full()));
+}
+
+BOOST_AUTO_TEST_CASE(MIXED_PRECISION) {
+    BOOST_CHECK(compare(ras_energy("h2o_sto3g_ras_mixed"), reference_ras_energy_h2o_full()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
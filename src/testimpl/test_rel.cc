@@ -71,4 +71,10 @@ BOOST_AUTO_TEST_CASE(DIRAC_FOCK) {
     BOOST_CHECK(compare(rel_energy("hf_svp_breit"),          -99.92755305));
 }
 
+BOOST_AUTO_TEST_CASE(FOCK_REUSE) {
+    BOOST_CHECK(compare(rel_energy("hf_svp_coulomb_reuse"),  -99.93791152));
+    BOOST_CHECK(compare(rel_energy("hf_svp_gaunt_reuse"),    -99.92699858));
+    BOOST_CHECK(compare(rel_energy("hf_svp_breit_reuse"),    -99.92755305));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -45,5 +45,9 @@ BOOST_AUTO_TEST_CASE(CASPT2_Opt) {
     BOOST_CHECK(compare(run_force("lif_svp_xmscaspt2_grad"), reference_xms(), 1.0e-5));
 }
 
+BOOST_AUTO_TEST_CASE(CASPT2_Budget) {
+    BOOST_CHECK(compare(run_force("lif_svp_mscaspt2_grad_budget"), reference_ms(), 1.0e-5));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 #endif
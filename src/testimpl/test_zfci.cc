@@ -110,4 +110,8 @@ BOOST_AUTO_TEST_CASE(ZHARRISON) {
   BOOST_CHECK(compare(relfci_energy("hf_sto3g_relfci_breit"), reference_relfci_energy3()));
 }
 
+BOOST_AUTO_TEST_CASE(MIXED_PRECISION) {
+  BOOST_CHECK(compare(relfci_energy("hf_sto3g_relfci_mixed"), reference_relfci_energy()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -9,12 +9,13 @@
 #include <boost/serialization/split_free.hpp>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/collection_size_type.hpp>
+#include <src/util/math/mappedmemory.h>
 
 namespace bagel {
 
 /// variable size array class *with* capacity info
 template <typename _T,
-          typename _Allocator = std::allocator<_T> >
+          typename _Allocator = MappedAllocator<_T> >
 class varray : private _Allocator {
 public:
 
@@ -404,6 +405,37 @@ inline bool operator!= (const bagel::varray<T>& a,
   return not (a == b);
 }
 
+// found by argument-dependent lookup in btas (the allocator no longer brings std::begin etc. into scope)
+template <typename T, typename A>
+inline auto begin(bagel::varray<T,A>& x) -> decltype(x.begin()) {
+  return x.begin();
+}
+
+template <typename T, typename A>
+inline auto begin(const bagel::varray<T,A>& x) -> decltype(x.begin()) {
+  return x.begin();
+}
+
+template <typename T, typename A>
+inline auto end(bagel::varray<T,A>& x) -> decltype(x.end()) {
+  return x.end();
+}
+
+template <typename T, typename A>
+inline auto end(const bagel::varray<T,A>& x) -> decltype(x.end()) {
+  return x.end();
+}
+
+template <typename T, typename A>
+inline auto cbegin(const bagel::varray<T,A>& x) -> decltype(x.cbegin()) {
+  return x.cbegin();
+}
+
+template <typename T, typename A>
+inline auto cend(const bagel::varray<T,A>& x) -> decltype(x.cend()) {
+  return x.cend();
+}
+
 } // namespace bagel
 
 namespace boost {
@@ -32,6 +32,7 @@
 #include <vector>
 #include <src/util/math/algo.h>
 #include <src/util/math/matrix.h>
+#include <src/util/math/packedvector.h>
 #include <src/util/f77.h>
 #include <src/util/serialization.h>
 
@@ -40,17 +41,51 @@ namespace bagel {
 template <typename T, typename U, class MatType = Matrix>
 class DavidsonDiag_ {
   protected:
+    using DataType = typename VectorBlocks<T>::DataType;
+    // whether the vectors can be stored in single precision or in scratch files
+    static constexpr bool packable = VectorBlocks<T>::supported && VectorBlocks<U>::supported;
+
     struct BasisPair {
       public:
         std::shared_ptr<const T> cc;
         std::shared_ptr<const U> sigma;
+        // used instead of cc and sigma when they are stored in single precision or in scratch files
+        PackedVector<DataType> pcc;
+        PackedVector<DataType> psigma;
+
         BasisPair() { }
         BasisPair(std::shared_ptr<const T> a, std::shared_ptr<const U> b) : cc(a), sigma(b) { }
+
+        bool packed() const { return !cc; }
+        void pack(const bool single, const bool scratch) {
+          pcc = PackedVector<DataType>(*cc, single, scratch);
+          psigma = PackedVector<DataType>(*sigma, single, scratch);
+          cc.reset();
+          sigma.reset();
+        }
+
+        // (cc, o)
+        template<class V>
+        DataType dot_cc(std::shared_ptr<const V> o) const { return packed() ? pcc.dot_product(*o) : cc->dot_product(o); }
+        // o += a * cc and o += a * sigma (copies of the pointers, since some ax_plus_y take them by non-const reference)
+        template<class V>
+        void add_cc_to(const DataType a, std::shared_ptr<V> o) const {
+          if (packed()) { pcc.ax_plus_y_to(a, *o); } else { std::shared_ptr<const T> c = cc; o->ax_plus_y(a, c); }
+        }
+        template<class V>
+        void add_sigma_to(const DataType a, std::shared_ptr<V> o) const {
+          if (packed()) { psigma.ax_plus_y_to(a, *o); } else { std::shared_ptr<const U> s = sigma; o->ax_plus_y(a, s); }
+        }
+
+        void prefetch_cc() const { if (packed()) pcc.prefetch(); }
+        void prefetch_sigma() const { if (packed()) psigma.prefetch(); }
+        void release() const { if (packed()) { pcc.release(); psigma.release(); } }
+
       private:
         // serialization
         friend class boost::serialization::access;
         template<class Archive>
-        void serialize(Archive& ar, const unsigned int) { ar & cc & sigma; }
+        void serialize(Archive& ar, const unsigned int) { ar & cc & sigma & pcc & psigma; }
     };
 
     int nstate_;
@@ -68,12 +103,32 @@ class DavidsonDiag_ {
     // overlap matrix
     std::shared_ptr<MatType> overlap_;
 
+    // in the mixed-precision mode, trial and sigma vectors other than the current solutions are stored in single precision
+    // until the residual norms (rms) become smaller than switch_; the subspace is then rebuilt in double precision (see restart())
+    bool mixed_ = false;
+    double switch_ = 0.0;
+    bool restart_ = false;
+    // if true, trial and sigma vectors other than the current solutions are stored in scratch files (see MappedMemory)
+    bool scratch_ = false;
+
   private:
     // serialization
     friend class boost::serialization::access;
     template<class Archive>
     void serialize(Archive& ar, const unsigned int) {
-      ar & nstate_ & max_ & size_ & basis_ & mat_ & vec_ & eig_ & overlap_;
+      ar & nstate_ & max_ & size_ & basis_ & mat_ & vec_ & eig_ & overlap_ & mixed_ & switch_ & restart_ & scratch_;
+    }
+
+    // residual norm in the same convention as rms() in CI vectors
+    static double rms(const U& o) {
+      double sum = 0.0;
+      size_t size = 0;
+      for (auto& b : VectorBlocks<U>::get(o)) {
+        for (size_t i = 0; i != b.second; ++i)
+          sum += std::norm(b.first[i]);
+        size += b.second;
+      }
+      return size ? std::sqrt(sum / size) : 0.0;
     }
 
   public:
@@ -83,6 +138,22 @@ class DavidsonDiag_ {
       if (max < 2) throw std::runtime_error("Davidson diagonalization requires at least two trial vectors per root.");
     }
 
+    // Turns on the mixed-precision mode, which is kept until the residual norms become smaller than thresh.
+    // Has no effect if the vectors do not expose their elements (see VectorBlocks).
+    void set_mixed_precision(const double thresh) {
+      mixed_ = packable && thresh > 0.0;
+      switch_ = thresh;
+    }
+    bool mixed_precision() const { return mixed_; }
+
+    // Stores the subspace in scratch files. Has effect only if the scratch directory is set (BAGEL_SCRATCH) and the vectors are large enough.
+    void set_scratch(const bool scratch) { scratch_ = packable && scratch && MappedMemory::enabled(); }
+    bool scratch() const { return scratch_; }
+
+    // True when the precision has just been switched back. The caller should then pass the current solutions (civec()) and their
+    // sigma vectors to the next compute(), with which the subspace is rebuilt.
+    bool restart() const { return restart_; }
+
     double compute(std::shared_ptr<const T> cc, std::shared_ptr<const U> cs) {
       assert(nstate_ == 1);
       return compute(std::vector<std::shared_ptr<const T>>{cc},
@@ -90,6 +161,14 @@ class DavidsonDiag_ {
     }
 
     std::vector<double> compute(std::vector<std::shared_ptr<const T>> cc, std::vector<std::shared_ptr<const U>> cs) {
+      if (restart_) {
+        basis_.clear();
+        size_ = 0;
+        mat_.reset();
+        overlap_.reset();
+        restart_ = false;
+      }
+
       // reset the convergence flags
       std::vector<bool> converged(nstate_, false);
 
@@ -114,13 +193,21 @@ class DavidsonDiag_ {
       basis_.insert(basis_.end(), newbasis.begin(), newbasis.end());
       for (auto& ib : newbasis) {
         ++size_;
+        // matrix elements are computed with the stored (possibly rounded) vectors
+        std::shared_ptr<const T> icc = ib->cc;
+        std::shared_ptr<const U> isigma = ib->sigma;
+        if ((mixed_ || scratch_) && size_ > nstate_) {
+          ib->pack(mixed_, scratch_);
+          icc = ib->pcc.unpack(*icc);
+          isigma = ib->psigma.unpack(*isigma);
+        }
         int i = 0;
         for (auto& b : basis_) {
           if (i > size_-1) break;
-          mat_->element(i, size_-1) = b->cc->dot_product(ib->sigma);
+          mat_->element(i, size_-1) = b->dot_cc(isigma);
           mat_->element(size_-1, i) = detail::conj(mat_->element(i, size_-1));
 
-          overlap_->element(i, size_-1) = b->cc->dot_product(ib->cc);
+          overlap_->element(i, size_-1) = b->dot_cc(icc);
           overlap_->element(size_-1, i) = detail::conj(overlap_->element(i, size_-1));
           ++i;
         }
@@ -199,22 +286,34 @@ class DavidsonDiag_ {
       return std::vector<double>(vec_.begin(), vec_.begin()+nstate_);
     }
 
-    // perhaps can be cleaner.
+    // The loops over the subspace are outermost so that each stored vector is read once (and streamed from scratch files if any)
     std::vector<std::shared_ptr<U>> residual() {
       std::vector<std::shared_ptr<U>> out;
-      for (int i = 0; i != nstate_; ++i) {
-        auto tmp = basis_.front()->sigma->clone();
-        int k = 0;
-        for (auto& iv : basis_) {
-          if (std::abs(eig_->element(k++,i)) > 1.0e-16)
-            tmp->ax_plus_y(-vec_(i)*eig_->element(k-1,i), iv->cc);
-        }
-        k = 0;
-        for (auto& iv : basis_) {
-          if (std::abs(eig_->element(k++,i)) > 1.0e-16)
-            tmp->ax_plus_y(eig_->element(k-1,i), iv->sigma);
+      for (int i = 0; i != nstate_; ++i)
+        out.push_back(basis_.front()->sigma->clone());
+      for (int k = 0; k != size_; ++k) {
+        if (k+1 != size_) basis_[k+1]->prefetch_cc();
+        for (int i = 0; i != nstate_; ++i)
+          if (std::abs(eig_->element(k,i)) > 1.0e-16)
+            basis_[k]->add_cc_to(-vec_(i)*eig_->element(k,i), out[i]);
+        basis_[k]->release();
+      }
+      for (int k = 0; k != size_; ++k) {
+        if (k+1 != size_) basis_[k+1]->prefetch_sigma();
+        for (int i = 0; i != nstate_; ++i)
+          if (std::abs(eig_->element(k,i)) > 1.0e-16)
+            basis_[k]->add_sigma_to(eig_->element(k,i), out[i]);
+        basis_[k]->release();
+      }
+      if (mixed_) {
+        double error = 0.0;
+        for (auto& i : out)
+          error = std::max(error, rms(*i));
+        if (error < switch_) {
+          std::cout << "    ** switching to double precision **" << std::endl;
+          mixed_ = false;
+          restart_ = true;
         }
-        out.push_back(tmp);
       }
       return out;
     }
@@ -222,30 +321,32 @@ class DavidsonDiag_ {
     // returns ci vector
     std::vector<std::shared_ptr<T>> civec() {
       std::vector<std::shared_ptr<T>> out;
-      for (int i = 0; i != nstate_; ++i) {
-        auto tmp = basis_.front()->cc->clone();
-        int k = 0;
-        for (auto& iv : basis_) {
-          tmp->ax_plus_y(eig_->element(k++,i), iv->cc);
-        }
-        tmp->synchronize();
-        out.push_back(tmp);
+      for (int i = 0; i != nstate_; ++i)
+        out.push_back(basis_.front()->cc->clone());
+      for (int k = 0; k != size_; ++k) {
+        if (k+1 != size_) basis_[k+1]->prefetch_cc();
+        for (int i = 0; i != nstate_; ++i)
+          basis_[k]->add_cc_to(eig_->element(k,i), out[i]);
+        basis_[k]->release();
       }
+      for (auto& i : out)
+        i->synchronize();
       return out;
     }
 
     // return sigma vector
     std::vector<std::shared_ptr<U>> sigmavec() {
       std::vector<std::shared_ptr<U>> out;
-      for (int i = 0; i != nstate_; ++i) {
-        auto tmp = basis_.front()->sigma->clone();
-        int k = 0;
-        for (auto& iv : basis_) {
-          tmp->ax_plus_y(eig_->element(k++,i), iv->sigma);
-        }
-        tmp->synchronize();
-        out.push_back(tmp);
+      for (int i = 0; i != nstate_; ++i)
+        out.push_back(basis_.front()->sigma->clone());
+      for (int k = 0; k != size_; ++k) {
+        if (k+1 != size_) basis_[k+1]->prefetch_sigma();
+        for (int i = 0; i != nstate_; ++i)
+          basis_[k]->add_sigma_to(eig_->element(k,i), out[i]);
+        basis_[k]->release();
       }
+      for (auto& i : out)
+        i->synchronize();
       return out;
     }
 
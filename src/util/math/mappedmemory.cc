@@ -0,0 +1,138 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: mappedmemory.cc
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include <src/util/math/mappedmemory.h>
+
+using namespace std;
+using namespace bagel;
+
+string MappedMemory::directory_;
+size_t MappedMemory::threshold_ = 0LU;
+atomic<size_t> MappedMemory::nmapped_(0LU);
+thread_local bool MappedMemory::in_scope_ = false;
+
+namespace {
+  mutex mut__;
+  // start address and size of the mapped regions
+  map<const char*, size_t> regions__;
+
+  size_t pagesize() {
+    static const size_t size = sysconf(_SC_PAGESIZE);
+    return size;
+  }
+
+  // madvise requires page-aligned addresses
+  void advise(const void* p, const size_t bytes, const int advice) {
+    if (bytes == 0) return;
+    const size_t start = reinterpret_cast<size_t>(p) / pagesize() * pagesize();
+    const size_t end = reinterpret_cast<size_t>(p) + bytes;
+    madvise(reinterpret_cast<void*>(start), end - start, advice);
+  }
+}
+
+
+void MappedMemory::enable(const string& directory, const size_t threshold) {
+  directory_ = directory;
+  threshold_ = threshold;
+}
+
+
+void* MappedMemory::map(const size_t bytes) {
+  if (!enabled() || bytes < threshold_ || bytes == 0) return nullptr;
+
+  string name = directory_ + "/bagel_scratch_XXXXXX";
+  vector<char> cname(name.begin(), name.end());
+  cname.push_back('\0');
+  const int fd = mkstemp(cname.data());
+  if (fd < 0)
+    throw runtime_error("could not create a scratch file in " + directory_ + ": " + strerror(errno));
+  unlink(cname.data());
+
+  const size_t size = (bytes + pagesize() - 1) / pagesize() * pagesize();
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    throw runtime_error("could not extend a scratch file in " + directory_ + ": " + strerror(errno));
+  }
+  void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+    throw runtime_error(string("could not map a scratch file: ") + strerror(errno));
+  madvise(p, size, MADV_SEQUENTIAL);
+
+  lock_guard<mutex> lock(mut__);
+  regions__.emplace(static_cast<const char*>(p), size);
+  ++nmapped_;
+  return p;
+}
+
+
+bool MappedMemory::unmap_(void* p) {
+  size_t size;
+  {
+    lock_guard<mutex> lock(mut__);
+    auto iter = regions__.find(static_cast<const char*>(p));
+    if (iter == regions__.end()) return false;
+    size = iter->second;
+    regions__.erase(iter);
+    --nmapped_;
+  }
+  munmap(p, size);
+  return true;
+}
+
+
+bool MappedMemory::mapped(const void* p) {
+  if (nmapped_.load(memory_order_relaxed) == 0) return false;
+  const char* c = static_cast<const char*>(p);
+  lock_guard<mutex> lock(mut__);
+  auto iter = regions__.upper_bound(c);
+  if (iter == regions__.begin()) return false;
+  --iter;
+  return c < iter->first + iter->second;
+}
+
+
+void MappedMemory::prefetch(const void* p, const size_t bytes) {
+  if (mapped(p))
+    advise(p, bytes, MADV_WILLNEED);
+}
+
+
+void MappedMemory::release(const void* p, const size_t bytes) {
+  // MADV_DONTNEED would zero out anonymous memory; only file-backed pages are dropped
+  if (!mapped(p)) return;
+  // only whole pages inside the range are dropped
+  const size_t start = (reinterpret_cast<size_t>(p) + pagesize() - 1) / pagesize() * pagesize();
+  const size_t end = (reinterpret_cast<size_t>(p) + bytes) / pagesize() * pagesize();
+  if (end > start)
+    madvise(reinterpret_cast<void*>(start), end - start, MADV_DONTNEED);
+}
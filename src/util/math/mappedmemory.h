@@ -0,0 +1,107 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: mappedmemory.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef __SRC_MATH_MAPPEDMEMORY_H
+#define __SRC_MATH_MAPPEDMEMORY_H
+
+// Scratch-file backed memory. Large allocations made while a MappedMemory::Scope is alive on the calling thread
+// are placed in memory-mapped files in the scratch directory (when enabled), so that their size is limited
+// by the disk rather than by the physical memory. The files are unlinked right after they are created.
+
+#include <stddef.h>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace bagel {
+
+class MappedMemory {
+  protected:
+    static std::string directory_;
+    static size_t threshold_;
+    static std::atomic<size_t> nmapped_;
+    static thread_local bool in_scope_;
+
+    static bool unmap_(void* p);
+
+  public:
+    // allocations larger than threshold (in bytes) within a Scope are mapped to files in directory
+    static void enable(const std::string& directory, const size_t threshold);
+    static bool enabled() { return !directory_.empty(); }
+
+    // returns nullptr if the allocation is not to be mapped
+    static void* map(const size_t bytes);
+    // returns false if p was not allocated by map
+    static bool unmap(void* p) { return nmapped_.load(std::memory_order_relaxed) != 0 && unmap_(p); }
+    static bool mapped(const void* p);
+
+    // hints to the kernel: read ahead (asynchronously) and drop pages from the resident set (data are kept in the file)
+    static void prefetch(const void* p, const size_t bytes);
+    static void release(const void* p, const size_t bytes);
+
+    static bool in_scope() { return in_scope_; }
+
+    class Scope {
+      protected:
+        const bool saved_;
+      public:
+        Scope() : saved_(in_scope_) { in_scope_ = true; }
+        ~Scope() { in_scope_ = saved_; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+};
+
+
+// allocator used by varray (and hence by btas tensors)
+template<typename T>
+class MappedAllocator {
+  public:
+    using value_type = T;
+
+    MappedAllocator() { }
+    template<typename U>
+    MappedAllocator(const MappedAllocator<U>&) { }
+
+    T* allocate(const size_t n) {
+      if (MappedMemory::in_scope())
+        if (void* p = MappedMemory::map(n*sizeof(T)))
+          return static_cast<T*>(p);
+      return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, const size_t n) {
+      if (!MappedMemory::unmap(p))
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const MappedAllocator<T>&, const MappedAllocator<U>&) { return true; }
+template<typename T, typename U>
+bool operator!=(const MappedAllocator<T>&, const MappedAllocator<U>&) { return false; }
+
+}
+
+#endif
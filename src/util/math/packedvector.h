@@ -0,0 +1,180 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: packedvector.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#ifndef __SRC_MATH_PACKEDVECTOR_H
+#define __SRC_MATH_PACKEDVECTOR_H
+
+#include <complex>
+#include <type_traits>
+#include <src/util/math/algo.h>
+#include <src/util/math/mappedmemory.h>
+#include <src/util/serialization.h>
+
+namespace bagel {
+
+// Contiguous blocks of the elements of a vector. Supported are the types that have non-const data() and size() (Civec, RASCivec, ...)
+// and those that consist of such vectors (dvecs() in RelDvec and RelZDvec).
+template<typename T, typename = void>
+struct VectorBlocks {
+  static constexpr bool supported = false;
+  using DataType = double;
+  static std::vector<std::pair<DataType*, size_t>> get(T&) { return {}; }
+  static std::vector<std::pair<const DataType*, size_t>> get(const T&) { return {}; }
+};
+
+template<typename T>
+struct VectorBlocks<T, typename std::enable_if<!std::is_const<typename std::remove_pointer<decltype(std::declval<T&>().data())>::type>::value>::type> {
+  static constexpr bool supported = true;
+  using DataType = typename std::remove_pointer<decltype(std::declval<T&>().data())>::type;
+  static std::vector<std::pair<DataType*, size_t>> get(T& o) { return {{o.data(), o.size()}}; }
+  static std::vector<std::pair<const DataType*, size_t>> get(const T& o) { return {{o.data(), o.size()}}; }
+};
+
+template<typename T>
+struct VectorBlocks<T, typename std::enable_if<std::is_class<decltype(std::declval<T&>().dvecs())>::value>::type> {
+  static constexpr bool supported = true;
+  using DataType = typename std::remove_pointer<decltype(std::declval<T&>().dvecs().begin()->second->data())>::type;
+  static std::vector<std::pair<DataType*, size_t>> get(T& o) {
+    std::vector<std::pair<DataType*, size_t>> out;
+    for (auto& i : o.dvecs())
+      out.emplace_back(i.second->data(), i.second->size());
+    return out;
+  }
+  static std::vector<std::pair<const DataType*, size_t>> get(const T& o) {
+    std::vector<std::pair<const DataType*, size_t>> out;
+    for (auto& i : o.dvecs())
+      out.emplace_back(i.second->data(), i.second->size());
+    return out;
+  }
+};
+
+
+// Stored copy of a vector, in single or double precision, optionally placed in scratch files (see MappedMemory).
+// Products with vectors are accumulated in double precision.
+template<typename DataType>
+class PackedVector {
+  public:
+    using LowType = typename std::conditional<std::is_same<DataType, double>::value, float, std::complex<float>>::type;
+
+  protected:
+    // only one of them is used
+    std::vector<LowType, MappedAllocator<LowType>> low_;
+    std::vector<DataType, MappedAllocator<DataType>> full_;
+
+    template<class S, class T>
+    static void pack_(const T& o, S& out) {
+      const auto blocks = VectorBlocks<T>::get(o);
+      size_t size = 0;
+      for (auto& b : blocks)
+        size += b.second;
+      // allocated once, so that the data are placed in one scratch file
+      out.reserve(size);
+      for (auto& b : blocks)
+        out.insert(out.end(), b.first, b.first+b.second);
+    }
+
+    template<class S, class T>
+    static DataType dot_product_(const S& data, const T& o) {
+      DataType out = 0.0;
+      auto p = data.begin();
+      for (auto& b : VectorBlocks<T>::get(o)) {
+        assert(p+b.second <= data.end());
+        for (size_t i = 0; i != b.second; ++i, ++p)
+          out += detail::conj(static_cast<DataType>(*p)) * b.first[i];
+      }
+      return out;
+    }
+
+    template<class S, class T>
+    static void ax_plus_y_to_(const S& data, const DataType a, T& o) {
+      auto p = data.begin();
+      for (auto& b : VectorBlocks<T>::get(o)) {
+        assert(p+b.second <= data.end());
+        for (size_t i = 0; i != b.second; ++i, ++p)
+          b.first[i] += a * static_cast<DataType>(*p);
+      }
+    }
+
+    template<class S, class T>
+    static void unpack_(const S& data, T& o) {
+      auto p = data.begin();
+      for (auto& b : VectorBlocks<T>::get(o)) {
+        assert(p+b.second <= data.end());
+        std::copy_n(p, b.second, b.first);
+        p += b.second;
+      }
+    }
+
+    const void* ptr() const { return low_.empty() ? static_cast<const void*>(full_.data()) : static_cast<const void*>(low_.data()); }
+    size_t bytes() const { return low_.size()*sizeof(LowType) + full_.size()*sizeof(DataType); }
+
+  private:
+    // serialization
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive& ar, const unsigned int) { ar & low_ & full_; }
+
+  public:
+    PackedVector() { }
+    template<class T>
+    PackedVector(const T& o, const bool single, const bool scratch = false) {
+      std::unique_ptr<MappedMemory::Scope> scope(scratch ? new MappedMemory::Scope() : nullptr);
+      if (single)
+        pack_(o, low_);
+      else
+        pack_(o, full_);
+    }
+
+    size_t size() const { return low_.size() + full_.size(); }
+    bool empty() const { return size() == 0; }
+    bool single() const { return !low_.empty(); }
+
+    // returns (this, o)
+    template<class T>
+    DataType dot_product(const T& o) const { return single() ? dot_product_(low_, o) : dot_product_(full_, o); }
+
+    // o += a * this
+    template<class T>
+    void ax_plus_y_to(const DataType a, T& o) const { if (single()) ax_plus_y_to_(low_, a, o); else ax_plus_y_to_(full_, a, o); }
+
+    // returns a vector in double precision; proto is used to construct it
+    template<class T>
+    std::shared_ptr<T> unpack(const T& proto) const {
+      std::shared_ptr<T> out = proto.clone();
+      if (single())
+        unpack_(low_, *out);
+      else
+        unpack_(full_, *out);
+      return out;
+    }
+
+    // hints for the data in scratch files: to be read soon, and no longer needed in memory
+    void prefetch() const { MappedMemory::prefetch(ptr(), bytes()); }
+    void release() const { MappedMemory::release(ptr(), bytes()); }
+};
+
+}
+
+#endif
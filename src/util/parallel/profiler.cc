@@ -0,0 +1,306 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: profiler.cc
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <src/util/parallel/profiler.h>
+#include <src/util/parallel/mpi_interface.h>
+
+using namespace std;
+using namespace bagel;
+
+bool Profiler::enabled_ = false;
+Profiler::Format Profiler::format_ = Profiler::Format::JSON;
+string Profiler::filename_;
+
+namespace {
+
+using Clock = chrono::steady_clock;
+
+struct Stats {
+  double time = 0.0;
+  double count = 0.0;
+  double flop = 0.0;
+  double bytes = 0.0;
+};
+
+// one complete region for the Chrome trace
+struct Event {
+  string path;
+  double start;
+  double duration;
+};
+
+struct ThreadData {
+  const int id;
+  string base;
+  vector<pair<string, Clock::time_point>> stack;
+  unordered_map<string, Stats> stats;
+  vector<Event> events;
+  ThreadData(const int i) : id(i) { }
+
+  const string& current() const { return stack.empty() ? base : stack.back().first; }
+  string child(const string& name) const { return current().empty() ? name : current() + "/" + name; }
+};
+
+// trace events are capped so that long runs do not exhaust memory
+const size_t max_events__ = 1000000LU;
+
+const Clock::time_point origin__ = Clock::now();
+
+mutex mut__;
+vector<unique_ptr<ThreadData>> threads__;
+
+ThreadData& local() {
+  thread_local ThreadData* data = nullptr;
+  if (!data) {
+    lock_guard<mutex> lock(mut__);
+    threads__.emplace_back(new ThreadData(threads__.size()));
+    data = threads__.back().get();
+  }
+  return *data;
+}
+
+double elapsed(const Clock::time_point& a, const Clock::time_point& b) {
+  return chrono::duration<double>(b - a).count();
+}
+
+string escape(const string& in) {
+  string out;
+  for (auto& c : in) {
+    if (c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+}
+
+
+void Profiler::enable(const string& filename, const Format format) {
+  filename_ = filename;
+  format_ = format;
+  enabled_ = true;
+}
+
+
+void Profiler::start(const string& name) {
+  ThreadData& d = local();
+  d.stack.emplace_back(d.child(name), Clock::now());
+}
+
+
+void Profiler::stop() {
+  ThreadData& d = local();
+  if (d.stack.empty())
+    throw logic_error("Profiler::stop called without a matching start");
+  const Clock::time_point now = Clock::now();
+  const double duration = elapsed(d.stack.back().second, now);
+  Stats& s = d.stats[d.stack.back().first];
+  s.time += duration;
+  s.count += 1.0;
+  if (format_ == Format::Chrome && d.events.size() < max_events__)
+    d.events.push_back({d.stack.back().first, elapsed(origin__, d.stack.back().second), duration});
+  d.stack.pop_back();
+}
+
+
+void Profiler::record(const string& name, const double seconds) {
+  if (!enabled_) return;
+  ThreadData& d = local();
+  const string path = d.child(name);
+  Stats& s = d.stats[path];
+  s.time += seconds;
+  s.count += 1.0;
+  if (format_ == Format::Chrome && d.events.size() < max_events__)
+    d.events.push_back({path, elapsed(origin__, Clock::now()) - seconds, seconds});
+}
+
+
+void Profiler::add_flop(const double flop) {
+  if (!enabled_) return;
+  ThreadData& d = local();
+  if (!d.current().empty())
+    d.stats[d.current()].flop += flop;
+}
+
+
+void Profiler::add_bytes(const double bytes) {
+  if (!enabled_) return;
+  ThreadData& d = local();
+  if (!d.current().empty())
+    d.stats[d.current()].bytes += bytes;
+}
+
+
+string Profiler::current_path() {
+  return enabled_ ? local().current() : string();
+}
+
+
+Profiler::Inherit::Inherit(const string& path) : active_(enabled_) {
+  if (active_) {
+    ThreadData& d = local();
+    saved_ = d.base;
+    d.base = path;
+  }
+}
+
+
+Profiler::Inherit::~Inherit() {
+  if (active_)
+    local().base = saved_;
+}
+
+
+void Profiler::dump() {
+  if (!enabled_) return;
+
+  // merge the threads of this process
+  map<string, Stats> merged;
+  map<string, int> nthread;
+  vector<pair<int, Event>> events;
+  {
+    lock_guard<mutex> lock(mut__);
+    for (auto& t : threads__) {
+      for (auto& i : t->stats) {
+        Stats& s = merged[i.first];
+        s.time += i.second.time;
+        s.count += i.second.count;
+        s.flop += i.second.flop;
+        s.bytes += i.second.bytes;
+        ++nthread[i.first];
+      }
+      for (auto& e : t->events)
+        events.emplace_back(t->id, e);
+    }
+  }
+
+  if (format_ == Format::Chrome) {
+    // one trace per process; chrome://tracing nests complete events by time stamps
+    const string name = filename_ + (mpi__->size() > 1 ? "." + to_string(mpi__->rank()) : "");
+    ofstream fs(name);
+    if (!fs.is_open()) throw runtime_error("could not open " + name);
+    fs << "{ \"traceEvents\" : [" << endl;
+    for (auto i = events.begin(); i != events.end(); ++i) {
+      const string& path = i->second.path;
+      const size_t pos = path.rfind('/');
+      fs << "  { \"name\" : \"" << escape(pos == string::npos ? path : path.substr(pos+1)) << "\", \"cat\" : \"bagel\", \"ph\" : \"X\", "
+         << "\"ts\" : " << fixed << setprecision(3) << i->second.start*1.0e6 << ", \"dur\" : " << i->second.duration*1.0e6 << ", "
+         << "\"pid\" : " << mpi__->rank() << ", \"tid\" : " << i->first << ", \"args\" : { \"path\" : \"" << escape(path) << "\" } }"
+         << (i+1 == events.end() ? "" : ",") << endl;
+    }
+    fs << "] }" << endl;
+    return;
+  }
+
+  // the union of region paths over processes; strings are exchanged as arrays of int
+  set<string> paths;
+  {
+    string mine;
+    for (auto& i : merged)
+      mine += i.first + '\n';
+    const int len = mine.size();
+    vector<int> lens(mpi__->size());
+    mpi__->allgather(&len, 1, lens.data(), 1);
+    const int maxlen = *max_element(lens.begin(), lens.end());
+    vector<int> send(maxlen, 0);
+    copy(mine.begin(), mine.end(), send.begin());
+    vector<int> recv(maxlen*mpi__->size());
+    mpi__->allgather(send.data(), maxlen, recv.data(), maxlen);
+    for (int p = 0; p != mpi__->size(); ++p) {
+      string current;
+      for (int i = 0; i != lens[p]; ++i) {
+        const char c = recv[p*maxlen+i];
+        if (c == '\n') {
+          paths.insert(current);
+          current.clear();
+        } else {
+          current += c;
+        }
+      }
+    }
+  }
+
+  // statistics of all processes in the same order
+  const int nstat = 5;
+  const size_t npath = paths.size();
+  vector<double> send(npath*nstat, 0.0);
+  {
+    double* ptr = send.data();
+    for (auto& i : paths) {
+      auto iter = merged.find(i);
+      if (iter != merged.end()) {
+        ptr[0] = iter->second.time;
+        ptr[1] = iter->second.count;
+        ptr[2] = iter->second.flop;
+        ptr[3] = iter->second.bytes;
+        ptr[4] = nthread[i];
+      }
+      ptr += nstat;
+    }
+  }
+  vector<double> recv(npath*nstat*mpi__->size());
+  mpi__->allgather(send.data(), send.size(), recv.data(), send.size());
+
+  if (mpi__->rank() != 0) return;
+
+  ofstream fs(filename_);
+  if (!fs.is_open()) throw runtime_error("could not open " + filename_);
+  fs << "{" << endl;
+  fs << "  \"nproc\" : " << mpi__->size() << "," << endl;
+  fs << "  \"regions\" : [" << endl;
+  size_t n = 0;
+  for (auto& i : paths) {
+    Stats total;
+    double tmin = numeric_limits<double>::max(), tmax = 0.0, nthr = 0.0;
+    for (int p = 0; p != mpi__->size(); ++p) {
+      const double* ptr = recv.data() + (p*npath + n)*nstat;
+      total.time += ptr[0];
+      total.count += ptr[1];
+      total.flop += ptr[2];
+      total.bytes += ptr[3];
+      nthr = max(nthr, ptr[4]);
+      tmin = min(tmin, ptr[0]);
+      tmax = max(tmax, ptr[0]);
+    }
+    fs << "    { \"path\" : \"" << escape(i) << "\", \"depth\" : " << count(i.begin(), i.end(), '/')
+       << ", \"count\" : " << static_cast<size_t>(total.count) << ", \"threads\" : " << static_cast<int>(nthr) << ", "
+       << scientific << setprecision(6) << "\"time\" : " << total.time << ", \"time_min\" : " << tmin << ", \"time_max\" : " << tmax
+       << ", \"flop\" : " << total.flop << ", \"bytes\" : " << total.bytes
+       << ", \"gflops\" : " << (total.time > 0.0 ? total.flop / total.time * 1.0e-9 : 0.0) << " }"
+       << (++n == npath ? "" : ",") << endl;
+  }
+  fs << "  ]" << endl << "}" << endl;
+}
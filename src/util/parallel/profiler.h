@@ -0,0 +1,100 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: profiler.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef __SRC_PARALLEL_PROFILER_H
+#define __SRC_PARALLEL_PROFILER_H
+
+// Hierarchical timing regions with call counts and flop/byte counters.
+// Regions nest per thread; worker threads of the ThreadPool inherit the region of the thread that started the job.
+// Statistics are accumulated per thread and are summed over threads and MPI processes when dumped.
+// Profiling is off unless BAGEL_PROFILE is set to an output file name (see static.cc).
+//
+//   {
+//     Profiler::Region region("fock");
+//     ...
+//     Profiler::add_flop(2.0*n*n*n);
+//   }
+
+#include <stddef.h>
+#include <string>
+
+namespace bagel {
+
+class Profiler {
+  public:
+    enum class Format { JSON, Chrome };
+
+  protected:
+    static bool enabled_;
+    static Format format_;
+    static std::string filename_;
+
+  public:
+    static bool enabled() { return enabled_; }
+    static void enable(const std::string& filename, const Format format);
+
+    // push and pop a region on the calling thread. Prefer Region below.
+    static void start(const std::string& name);
+    static void stop();
+
+    // adds a completed child region of the current region (used by Timer::tick_print)
+    static void record(const std::string& name, const double seconds);
+
+    // counters are attributed to the innermost region of the calling thread
+    static void add_flop(const double flop);
+    static void add_bytes(const double bytes);
+
+    // "/"-separated path of the innermost region of the calling thread
+    static std::string current_path();
+
+    // writes the file specified in enable(). Has to be called by all MPI processes.
+    static void dump();
+
+    class Region {
+      protected:
+        const bool active_;
+      public:
+        Region(const std::string& name) : active_(enabled_) { if (active_) start(name); }
+        Region(const char* name) : active_(enabled_) { if (active_) start(name); }
+        ~Region() { if (active_) stop(); }
+        Region(const Region&) = delete;
+        Region& operator=(const Region&) = delete;
+    };
+
+    // sets the path that regions opened on this thread are nested under (for the duration of the object)
+    class Inherit {
+      protected:
+        const bool active_;
+        std::string saved_;
+      public:
+        Inherit(const std::string& path);
+        ~Inherit();
+        Inherit(const Inherit&) = delete;
+        Inherit& operator=(const Inherit&) = delete;
+    };
+};
+
+}
+
+#endif
@@ -22,13 +22,29 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <iostream>
+#include <iomanip>
 #include <src/util/parallel/resources.h>
 
 using namespace std;
 using namespace bagel;
 
-StackMem::StackMem() : pointer_(0LU), total_(20000000LU) { // TODO this should not be hardwired
-  stack_area_ = unique_ptr<double[]>(new double[total_]);
+namespace {
+  // the stack bound to this thread
+  struct BoundStack {
+    const Resources* owner = nullptr;
+    shared_ptr<StackMem> stack;
+    bool in_use = false;
+  };
+  thread_local BoundStack bound__;
+
+  // granularity of additional pages (in units of double)
+  const size_t page_unit__ = 1048576LU;
+}
+
+
+StackMem::StackMem(const size_t size) : current_(0LU), pointer_(0LU), peak_(0LU), batch_peak_(0LU) {
+  pages_.push_back(Page{unique_ptr<double[]>(new double[size]), size, 0LU});
 
   // in case we use Libint for ERI
 #ifdef LIBINT_INTERFACE
@@ -42,30 +58,127 @@ StackMem::StackMem() : pointer_(0LU), total_(20000000LU) { // TODO this should n
 }
 
 
-Resources::Resources(const int max) : proc_(make_shared<Process>()), max_num_threads_(max) {
+void StackMem::grow(const size_t size) {
+  // pages after current_ are empty; reuse the next one if it is large enough
+  ++current_;
+  if (current_ == pages_.size() || pages_[current_].size < size) {
+    const size_t newsize = ((size-1)/page_unit__+1) * page_unit__;
+    Page page{unique_ptr<double[]>(new double[newsize]), newsize, 0LU};
+    if (current_ == pages_.size())
+      pages_.push_back(move(page));
+    else
+      pages_[current_] = move(page);
+  }
+  assert(pages_[current_].pointer == 0LU);
+}
+
+
+void StackMem::clear() {
+  for (auto& i : pages_)
+    i.pointer = 0LU;
+  current_ = 0LU;
+  pointer_ = 0LU;
+  peak_ = max(peak_, batch_peak_);
+  batch_peak_ = 0LU;
+}
+
+
+void StackMem::record_peak(const int key) {
+  assert(key >= 0);
+  if (key >= highwater_.size())
+    highwater_.resize(key+1, 0LU);
+  highwater_[key] = max(highwater_[key], batch_peak_);
+  peak_ = max(peak_, batch_peak_);
+  batch_peak_ = pointer_;
+}
+
+
+size_t StackMem::capacity() const {
+  size_t out = 0LU;
+  for (auto& i : pages_)
+    out += i.size;
+  return out;
+}
+
+
+Resources::Resources(const int max, const size_t stack_size) : proc_(make_shared<Process>()), stack_size_(stack_size), max_num_threads_(max), pool_(new ThreadPool(max)) {
 #ifdef LIBINT_INTERFACE
   LIBINT2_PREFIXED_NAME(libint2_static_init)();
 #endif
   for (int i = 0; i != max; ++i)
-    stackmem_[make_shared<StackMem>()].clear();
+    stackmem_.push_back(make_shared<StackMem>(stack_size_));
+  free_ = stackmem_;
 }
 
 
 shared_ptr<StackMem> Resources::get() {
-  for (auto& i : stackmem_) {
-    if (!i.second.test_and_set())
-      return i.first;
+  BoundStack& bound = bound__;
+  if (bound.owner == this && bound.stack && !bound.in_use) {
+    bound.in_use = true;
+    return bound.stack;
+  }
+
+  shared_ptr<StackMem> out;
+  {
+    lock_guard<mutex> lock(mut_);
+    // Stacks are also held when one integral object is not destructed before another is constructed.
+    // Rather than failing, a new stack is created.
+    if (free_.empty()) {
+      stackmem_.push_back(make_shared<StackMem>(stack_size_));
+      free_.push_back(stackmem_.back());
+    }
+    out = free_.back();
+    free_.pop_back();
+  }
+  if (bound.owner != this || !bound.stack) {
+    bound.owner = this;
+    bound.stack = out;
+    bound.in_use = true;
   }
-  // This error most often occurs if we forget to destruct one integral object before constructing another
-  throw runtime_error("Stack Memory exhausted");
-  return nullptr;
+  return out;
 }
 
 
 void Resources::release(shared_ptr<StackMem> o) {
   o->clear();
-  auto iter = stackmem_.find(o);
-  assert(iter != stackmem_.end());
-  iter->second.clear();
+  BoundStack& bound = bound__;
+  if (bound.owner == this && bound.stack == o) {
+    assert(bound.in_use);
+    bound.in_use = false;
+    return;
+  }
+  lock_guard<mutex> lock(mut_);
+  assert(find(free_.begin(), free_.end(), o) == free_.end());
+  free_.push_back(o);
 }
 
+
+bool Resources::stack_grown() const {
+  lock_guard<mutex> lock(mut_);
+  return stackmem_.size() > max_num_threads_
+      || any_of(stackmem_.begin(), stackmem_.end(), [](const shared_ptr<StackMem>& i) { return i->npages() > 1; });
+}
+
+
+void Resources::print_stack_usage() const {
+  lock_guard<mutex> lock(mut_);
+  size_t peak = 0LU;
+  size_t capacity = 0LU;
+  vector<size_t> highwater;
+  for (auto& i : stackmem_) {
+    peak = max(peak, i->peak());
+    capacity = max(capacity, i->capacity());
+    const vector<size_t>& h = i->highwater();
+    if (h.size() > highwater.size())
+      highwater.resize(h.size(), 0LU);
+    for (int j = 0; j != h.size(); ++j)
+      highwater[j] = max(highwater[j], h[j]);
+  }
+  auto mb = [](const size_t n) { return n*sizeof(double)/1.0e6; };
+
+  cout << "    * stack memory: " << stackmem_.size() << " stacks of " << fixed << setprecision(1) << mb(stack_size_) << " MB preset" << endl;
+  cout << "      largest stack " << setw(10) << mb(capacity) << " MB, peak usage " << setw(10) << mb(peak) << " MB" << endl;
+  for (int j = 0; j != highwater.size(); ++j)
+    if (highwater[j])
+      cout << "      L = " << setw(2) << j << "  peak usage " << setw(10) << setprecision(3) << mb(highwater[j]) << " MB" << endl;
+}
@@ -30,51 +30,86 @@
 #include <stddef.h>
 #include <memory>
 #include <atomic>
+#include <mutex>
 #include <vector>
 #include <cassert>
 #include <stdexcept>
 #include <complex>
+#include <algorithm>
 #include <map>
 #ifdef LIBINT_INTERFACE
   #include <libint2.h>
 #endif
 #include <src/util/parallel/process.h>
+#include <src/util/parallel/threadpool.h>
 #include <src/util/constants.h>
 
 namespace bagel {
 
 class StackMem {
   protected:
-    std::unique_ptr<double[]> stack_area_;
+    // the first page is allocated in the constructor; further pages are appended when a request does not fit
+    struct Page {
+      std::unique_ptr<double[]> area;
+      size_t size;
+      size_t pointer;
+    };
+    std::vector<Page> pages_;
+    size_t current_;
+
+    // in units of double, summed over pages
     size_t pointer_;
-    const size_t total_;
+    size_t peak_;
+    size_t batch_peak_;
+    // high-water mark per batch class, see record_peak
+    std::vector<size_t> highwater_;
 
 #ifdef LIBINT_INTERFACE
     std::unique_ptr<Libint_t[]> libint_t_;
 #endif
 
+    void grow(const size_t size);
+
   public:
-    StackMem();
+    StackMem(const size_t size = 20000000LU);
 
     template <typename DataType = double>
     DataType* get(const size_t size) {
-      assert(pointer_ + size < total_);
       assert(size * sizeof(DataType) % sizeof(double) == 0);
-      DataType* out = reinterpret_cast<DataType*> (stack_area_.get() + pointer_);
-      pointer_ += (size * sizeof(DataType) / sizeof(double));
+      const size_t n = size * sizeof(DataType) / sizeof(double);
+      if (pages_[current_].pointer + n > pages_[current_].size)
+        grow(n);
+      Page& page = pages_[current_];
+      DataType* out = reinterpret_cast<DataType*> (page.area.get() + page.pointer);
+      page.pointer += n;
+      pointer_ += n;
+      batch_peak_ = std::max(batch_peak_, pointer_);
       return out;
     }
 
     template <typename DataType = double>
     void release(const size_t size, DataType* p) {
       assert(size * sizeof(DataType) % sizeof(double) == 0);
-      pointer_ -= (size * sizeof(DataType) / sizeof(double));
-      assert(p == reinterpret_cast<DataType*> (stack_area_.get()+pointer_) || size == 0);
+      const size_t n = size * sizeof(DataType) / sizeof(double);
+      Page& page = pages_[current_];
+      assert(page.pointer >= n);
+      page.pointer -= n;
+      pointer_ -= n;
+      assert(p == reinterpret_cast<DataType*> (page.area.get()+page.pointer) || size == 0);
+      while (current_ > 0 && pages_[current_].pointer == 0)
+        --current_;
     }
 
-    void clear() { pointer_ = 0LU; }
+    void clear();
     size_t pointer() const { return pointer_; }
 
+    // bookkeeping of the memory usage. Integral classes call record_peak with the total angular momentum of the batch.
+    void record_peak(const int key);
+    size_t peak() const { return std::max(peak_, batch_peak_); }
+    size_t capacity() const;
+    size_t npages() const { return pages_.size(); }
+    const std::vector<size_t>& highwater() const { return highwater_; }
+
 #ifdef LIBINT_INTERFACE
     Libint_t* libint_t_ptr(const int i) { return &libint_t_[i]; }
 #endif
@@ -85,17 +120,30 @@ class StackMem {
 class Resources {
   private:
     std::shared_ptr<Process> proc_;
-    std::map<std::shared_ptr<StackMem>, std::atomic_flag> stackmem_;
+    // all the stacks ever created, and those that are currently not used by any thread
+    std::vector<std::shared_ptr<StackMem>> stackmem_;
+    std::vector<std::shared_ptr<StackMem>> free_;
+    mutable std::mutex mut_;
+    size_t stack_size_;
     size_t max_num_threads_;
+    std::unique_ptr<ThreadPool> pool_;
 
   public:
-    Resources(const int max);
+    Resources(const int max, const size_t stack_size = 20000000LU);
 
+    // A stack is bound to the thread that first obtains it, and the following get() calls on this thread
+    // return it without locking as long as it is not in use. Other requests are served from a shared pool,
+    // which is extended when exhausted.
     std::shared_ptr<StackMem> get();
     void release(std::shared_ptr<StackMem> o);
 
     size_t max_num_threads() const { return max_num_threads_; }
     std::shared_ptr<Process> proc() { return proc_; }
+    ThreadPool& pool() { return *pool_; }
+
+    // prints the peak usage of the stacks (per total angular momentum of integral batches)
+    void print_stack_usage() const;
+    bool stack_grown() const;
 };
 
 extern Resources* resources__;
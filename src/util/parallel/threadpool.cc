@@ -0,0 +1,130 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: threadpool.cc
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <algorithm>
+#include <src/util/parallel/threadpool.h>
+#include <src/util/parallel/profiler.h>
+
+using namespace std;
+using namespace bagel;
+
+namespace {
+  thread_local bool in_job__ = false;
+}
+
+
+ThreadPool::ThreadPool(const int nthreads) : job_(nullptr), generation_(0LU), nactive_(0), nrunning_(0), stop_(false) {
+  for (int i = 1; i < nthreads; ++i)
+    threads_.emplace_back(&ThreadPool::worker, this, i);
+}
+
+
+ThreadPool::~ThreadPool() {
+  {
+    lock_guard<mutex> lock(mut_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& i : threads_)
+    i.join();
+}
+
+
+bool ThreadPool::in_job() {
+  return in_job__;
+}
+
+
+void ThreadPool::worker(const int id) {
+  in_job__ = true;
+  size_t seen = 0LU;
+  while (true) {
+    const function<void(const int)>* job;
+    string region;
+    {
+      unique_lock<mutex> lock(mut_);
+      start_.wait(lock, [&]{ return stop_ || (generation_ != seen && id < nactive_); });
+      if (stop_) return;
+      seen = generation_;
+      job = job_;
+      region = region_;
+    }
+    exception_ptr error;
+    try {
+      Profiler::Inherit inherit(region);
+      (*job)(id);
+    } catch (...) {
+      error = current_exception();
+    }
+    {
+      lock_guard<mutex> lock(mut_);
+      if (error && !error_)
+        error_ = error;
+      if (--nrunning_ == 0)
+        done_.notify_one();
+    }
+  }
+}
+
+
+void ThreadPool::run(const function<void(const int)>& job, const int n) {
+  // nested call or concurrent call from another (non-pool) thread: the caller does all the work
+  unique_lock<mutex> run_lock(run_mut_, defer_lock);
+  if (in_job__ || n <= 1 || threads_.empty() || !run_lock.try_lock()) {
+    job(0);
+    return;
+  }
+
+  {
+    lock_guard<mutex> lock(mut_);
+    job_ = &job;
+    region_ = Profiler::current_path();
+    nactive_ = min(n, size());
+    nrunning_ = nactive_ - 1;
+    error_ = nullptr;
+    ++generation_;
+  }
+  start_.notify_all();
+
+  exception_ptr error;
+  in_job__ = true;
+  try {
+    job(0);
+  } catch (...) {
+    error = current_exception();
+  }
+  in_job__ = false;
+
+  unique_lock<mutex> lock(mut_);
+  done_.wait(lock, [this]{ return nrunning_ == 0; });
+  nactive_ = 0;
+  job_ = nullptr;
+  if (!error)
+    error = error_;
+  lock.unlock();
+  run_lock.unlock();
+
+  if (error)
+    rethrow_exception(error);
+}
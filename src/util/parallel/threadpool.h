@@ -0,0 +1,86 @@
+//
+// BAGEL - Brilliantly Advanced General Electronic Structure Library
+// Filename: threadpool.h
+// Copyright (C) 2017 Toru Shiozaki
+//
+// Author: Toru Shiozaki <shiozaki@northwestern.edu>
+// Maintainer: Shiozaki group
+//
+// This file is part of the BAGEL package.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef __SRC_PARALLEL_THREADPOOL_H
+#define __SRC_PARALLEL_THREADPOOL_H
+
+// Persistent pool of worker threads. Threads are created once and sleep on a condition variable between jobs,
+// so that TaskQueue does not pay thread creation cost every time it is called.
+
+#include <stddef.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <string>
+#include <exception>
+
+namespace bagel {
+
+class ThreadPool {
+  protected:
+    std::vector<std::thread> threads_;
+
+    // guards the job state below
+    std::mutex mut_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+
+    const std::function<void(const int)>* job_;
+    // profiler region of the thread that called run()
+    std::string region_;
+    size_t generation_;
+    int nactive_;
+    int nrunning_;
+    bool stop_;
+    std::exception_ptr error_;
+
+    // serializes run() calls from different threads
+    std::mutex run_mut_;
+
+    void worker(const int id);
+
+  public:
+    ThreadPool(const int nthreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // including the calling thread
+    int size() const { return threads_.size()+1; }
+
+    // Calls job(i) with i in [0, n) concurrently, i = 0 on the calling thread, and returns when all calls are done.
+    // When called from inside a job, or while the pool is busy with another job, only job(0) is called.
+    // Jobs therefore have to be written such that job(0) alone completes all the work (see TaskQueue).
+    void run(const std::function<void(const int)>& job, const int n);
+
+    // true if the current thread is executing a job of any pool
+    static bool in_job();
+};
+
+}
+
+#endif
@@ -27,12 +27,12 @@
 #define __SRC_UTIL_TASKQUEUE_H
 
 #include <stddef.h>
-#include <list>
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <stdexcept>
 #include <utility>
-#include <thread>
 #include <algorithm>
 
 #include <vector>
@@ -44,6 +44,9 @@
 
 namespace bagel {
 
+// Tasks are distributed over per-thread ranges; each thread executes its own range from the front and,
+// once it runs dry, steals the back half of another thread's range. When tasks provide a member
+// "double cost() const", they are sorted so that the most expensive ones are started first.
 template<typename T>
 class TaskQueue {
 
@@ -65,14 +68,95 @@ class TaskQueue {
     template<typename U> void call_compute(U& task)                  { call<U, has_compute<U>::value>::compute(task); }
     template<typename U> void call_compute(std::shared_ptr<U>& task) { call<U, has_compute<U>::value>::compute(*task); }
 
+    template <class U>
+    struct has_cost {
+      protected:
+        template<class V> static auto __cost(V* p) -> decltype(p->cost(), std::true_type());
+        template<class  > static std::false_type __cost(...);
+      public:
+        static constexpr const bool value = std::is_same<std::true_type, decltype(__cost<U>(0))>::value;
+    };
+    template<typename U, bool>
+    struct cost       { static double get(const U& task) { return 0.0; } };
+    template<typename U>
+    struct cost<U, true> { static double get(const U& task) { return task.cost(); } };
+    template<typename U> static double get_cost(const U& task)                  { return cost<U, has_cost<U>::value>::get(task); }
+    template<typename U> static double get_cost(const std::shared_ptr<U>& task) { return cost<U, has_cost<U>::value>::get(*task); }
+
+    // half-open range of positions in order_ owned by one thread
+    struct Range {
+      std::mutex mut;
+      size_t begin;
+      size_t end;
+    };
+
   protected:
     std::vector<T> task_;
-    std::list<std::atomic_flag> flag_;
-    static const int chunck_ = 12;
+    std::vector<size_t> order_;
+    std::unique_ptr<Range[]> range_;
+    int nrange_;
+
+    // sets up order_ and range_; with cost hints, thread i receives the i-th, (i+n)-th, ... most expensive tasks
+    void distribute(const int n) {
+      const size_t ntask = task_.size();
+      nrange_ = std::max(1, std::min(n, static_cast<int>(ntask)));
+      range_ = std::unique_ptr<Range[]>(new Range[nrange_]);
+      order_.resize(ntask);
+
+      std::vector<double> costs(ntask);
+      std::transform(task_.begin(), task_.end(), costs.begin(), [](const T& t) { return get_cost(t); });
+      if (std::any_of(costs.begin(), costs.end(), [](const double c) { return c != 0.0; })) {
+        std::vector<size_t> sorted(ntask);
+        std::iota(sorted.begin(), sorted.end(), 0);
+        std::stable_sort(sorted.begin(), sorted.end(), [&costs](const size_t i, const size_t j) { return costs[i] > costs[j]; });
+        size_t pos = 0;
+        for (int i = 0; i != nrange_; ++i) {
+          range_[i].begin = pos;
+          for (size_t j = i; j < ntask; j += nrange_)
+            order_[pos++] = sorted[j];
+          range_[i].end = pos;
+        }
+      } else {
+        std::iota(order_.begin(), order_.end(), 0);
+        for (int i = 0; i != nrange_; ++i) {
+          range_[i].begin = ntask * i / nrange_;
+          range_[i].end   = ntask * (i+1) / nrange_;
+        }
+      }
+    }
+
+    // takes one position from the front of own range
+    bool pop(const int id, size_t& pos) {
+      std::lock_guard<std::mutex> lock(range_[id].mut);
+      if (range_[id].begin == range_[id].end) return false;
+      pos = range_[id].begin++;
+      return true;
+    }
+
+    // moves the back half of another thread's range into own (empty) range
+    bool steal(const int id) {
+      for (int k = 1; k < nrange_; ++k) {
+        Range& victim = range_[(id+k) % nrange_];
+        size_t begin, end;
+        {
+          std::lock_guard<std::mutex> lock(victim.mut);
+          const size_t n = victim.end - victim.begin;
+          if (n == 0) continue;
+          end = victim.end;
+          begin = end - (n+1)/2;
+          victim.end = begin;
+        }
+        std::lock_guard<std::mutex> lock(range_[id].mut);
+        range_[id].begin = begin;
+        range_[id].end = end;
+        return true;
+      }
+      return false;
+    }
 
   public:
-    TaskQueue(size_t expected = 0) { task_.reserve(expected); }
-    TaskQueue(std::vector<T>&& t) : task_(std::move(t)) { }
+    TaskQueue(size_t expected = 0) : nrange_(0) { task_.reserve(expected); }
+    TaskQueue(std::vector<T>&& t) : task_(std::move(t)), nrange_(0) { }
 
     template<typename ...args>
     void emplace_back(args&&... a) { task_.emplace_back(std::forward<args>(a)...); }
@@ -84,31 +168,27 @@ class TaskQueue {
       mkl_set_num_threads(1);
 #endif
 #ifndef _OPENMP
-      flag_.resize((task_.size()-1)/chunck_+1);
-      std::for_each(flag_.begin(), flag_.end(), [](std::atomic_flag& i){ i.clear(); });
-      std::list<std::thread> threads;
-      for (int i = 0; i != num_threads; ++i)
-        threads.emplace_back(&TaskQueue<T>::compute_one_thread, this);
-      std::for_each(threads.begin(), threads.end(), [](std::thread& i){ i.join(); });
+      distribute(num_threads);
+      resources__->pool().run([this](const int id) { compute_one_thread(id); }, nrange_);
 #else
+      distribute(1);
       const size_t n = task_.size();
-      #pragma omp parallel for schedule(dynamic,chunck_)
+      #pragma omp parallel for schedule(dynamic) num_threads(num_threads)
       for (size_t i = 0; i < n; ++i)
-        call_compute(task_[i]);
+        call_compute(task_[order_[i]]);
 #endif
 #ifdef HAVE_MKL_H
       mkl_set_num_threads(mkl_num);
 #endif
     }
 
-    void compute_one_thread() {
-      int j = 0;
-      for (auto i = flag_.begin(); i != flag_.end(); ++i, j += chunck_)
-        if (!i->test_and_set()) {
-          call_compute(task_[j]);
-          for (int k = 1; k < chunck_; ++k)
-            if (j+k < task_.size()) call_compute(task_[j+k]);
-        }
+    // drains own range first, and then steals until all the ranges are empty
+    void compute_one_thread(const int id) {
+      size_t pos;
+      do {
+        while (pop(id, pos))
+          call_compute(task_[order_[pos]]);
+      } while (steal(id));
     }
 };
 
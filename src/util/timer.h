@@ -31,6 +31,7 @@
 #include <string>
 #include <algorithm>
 #include <src/util/string.h>
+#include <src/util/parallel/profiler.h>
 #include <bagel_config.h>
 
 namespace bagel {
@@ -51,19 +52,21 @@ class Timer {
       return out;
     }
 
-    // print out timing
+    // print out timing. The interval is also recorded as a region nested in the current profiler region.
     void tick_print(std::string title) {
+      const double time = tick();
+      Profiler::record(title, time);
       if (level_ == 0) {
         // top level printout
-        std::cout << "       - " << std::left << std::setw(36) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << tick() << std::endl;
+        std::cout << "       - " << std::left << std::setw(36) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << time << std::endl;
       } else if (level_ == -1) {
         title = to_upper(title);
-        std::cout << "    * " << std::left << std::setw(39) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << tick() << std::endl;
+        std::cout << "    * " << std::left << std::setw(39) << title << std::right << std::setw(10) << std::fixed << std::setprecision(2) << time << std::endl;
 #ifdef HAVE_MPI_H
       } else if (level_ >= 1 && level_ < 3) { // TODO for the time being suppressing the level 3 output
         const std::string indent(13+2*level_, ' ');
         const std::string mark = (level_ == 1 ? "o" : (level_ == 2 ? "*" : "-"));
-        std::cout << indent << std::left << mark << " " << std::setw(35) << title << std::right << std::setw(13) << std::fixed << std::setprecision(2) << tick() << std::endl;
+        std::cout << indent << std::left << mark << " " << std::setw(35) << title << std::right << std::setw(13) << std::fixed << std::setprecision(2) << time << std::endl;
 #endif
       }
     }
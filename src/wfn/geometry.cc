@@ -49,6 +49,7 @@ Geometry::Geometry(shared_ptr<const PTree> geominfo) : magnetism_(false), do_per
 
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", 1.0e-12);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", 1.0e-8);
+  df_schwarz_thresh_ = geominfo->get<double>("df_schwarz_thresh", 0.0);
 
   // skip self interaction between the charges.
   skip_self_interaction_ = geominfo->get<bool>("skip_self_interaction", true);
@@ -177,7 +178,7 @@ void Geometry::common_init2(const bool print, const double thresh, const bool no
 
 // suitable for geometry updates in optimization
 Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr<const PTree> geominfo, const bool rotate, const bool nodf)
-  : Molecule(o, displ, rotate), schwarz_thresh_(o.schwarz_thresh_), magnetism_(false), london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
+  : Molecule(o, displ, rotate), schwarz_thresh_(o.schwarz_thresh_), df_schwarz_thresh_(o.df_schwarz_thresh_), magnetism_(false), london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
 
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", 1.0e-8);
   set_london(geominfo);
@@ -188,7 +189,7 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const Matrix> displ, shared_ptr
 
 
 Geometry::Geometry(const Geometry& o, const array<double,3> displ)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_),  magnetism_(false),
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), df_schwarz_thresh_(o.df_schwarz_thresh_), magnetism_(false),
     london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
 
   // members of Molecule
@@ -218,7 +219,7 @@ Geometry::Geometry(const Geometry& o, const array<double,3> displ)
 
 // used when a new Geometry block is provided in input
 Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bool discard)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), magnetism_(false),
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), df_schwarz_thresh_(o.df_schwarz_thresh_), magnetism_(false),
     london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_), fmm_(o.fmm_) {
 
   // members of Molecule
@@ -234,6 +235,7 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bo
   // check all the options
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", schwarz_thresh_);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", overlap_thresh_);
+  df_schwarz_thresh_ = geominfo->get<double>("df_schwarz_thresh", df_schwarz_thresh_);
 
   spherical_ = !geominfo->get<bool>("cartesian", !spherical_);
 
@@ -312,7 +314,7 @@ Geometry::Geometry(const Geometry& o, shared_ptr<const PTree> geominfo, const bo
 *  supergeometry                                            *
 ************************************************************/
 Geometry::Geometry(vector<shared_ptr<const Geometry>> nmer, const bool nodf) :
-  schwarz_thresh_(nmer.front()->schwarz_thresh_), overlap_thresh_(nmer.front()->overlap_thresh_), magnetism_(false), london_(nmer.front()->london_),
+  schwarz_thresh_(nmer.front()->schwarz_thresh_), overlap_thresh_(nmer.front()->overlap_thresh_), df_schwarz_thresh_(nmer.front()->df_schwarz_thresh_), magnetism_(false), london_(nmer.front()->london_),
   use_finite_(nmer.front()->use_finite_), do_periodic_df_(false), hcoreinfo_(nmer.front()->hcoreinfo()), fmm_(nmer.front()->fmm()) {
 
   // A member of Molecule
@@ -358,6 +360,7 @@ Geometry::Geometry(vector<shared_ptr<const Geometry>> nmer, const bool nodf) :
   for (auto& inmer : nmer) {
     schwarz_thresh_ = min(schwarz_thresh_, inmer->schwarz_thresh_);
     overlap_thresh_ = min(overlap_thresh_, inmer->overlap_thresh_);
+    df_schwarz_thresh_ = min(df_schwarz_thresh_, inmer->df_schwarz_thresh_);
   }
 
   /* Data is merged (crossed fingers), now finish */
@@ -389,6 +392,7 @@ Geometry::Geometry(const vector<shared_ptr<const Atom>> atoms, shared_ptr<const
 
   schwarz_thresh_ = geominfo->get<double>("schwarz_thresh", 1.0e-12);
   overlap_thresh_ = geominfo->get<double>("thresh_overlap", 1.0e-8);
+  df_schwarz_thresh_ = geominfo->get<double>("df_schwarz_thresh", 0.0);
   skip_self_interaction_ = geominfo->get<bool>("skip_self_interaction", true);
 
   // cartesian or not. Look in the atoms info to find out
@@ -597,12 +601,13 @@ void Geometry::set_london(shared_ptr<const PTree>& geominfo) {
 
 
 void Geometry::compute_integrals(const double thresh) const {
+  // true means we construct J^-1/2; shell pairs that are negligible with respect to df_schwarz_thresh are screened out (off when 0)
 #ifdef LIBINT_INTERFACE
   if (!magnetism_)
-    df_ = form_fit<DFDist_ints<Libint>>(thresh, true); // true means we construct J^-1/2
+    df_ = make_shared<DFDist_ints<Libint>>(nbasis(), naux(), atoms(), aux_atoms(), thresh, true, 0.0, false, nullptr, false, df_schwarz_thresh_);
 #else
   if (!magnetism_)
-    df_ = form_fit<DFDist_ints<ERIBatch>>(thresh, true); // true means we construct J^-1/2
+    df_ = make_shared<DFDist_ints<ERIBatch>>(nbasis(), naux(), atoms(), aux_atoms(), thresh, true, 0.0, false, nullptr, false, df_schwarz_thresh_);
 #endif
   else
     df_ = form_fit<ComplexDFDist_ints<ComplexERIBatch>>(thresh, true); // true means we construct J^-1/2
@@ -634,7 +639,7 @@ void Geometry::init_magnetism() {
 
 
 Geometry::Geometry(const Geometry& o, const string type)
-  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), magnetism_(false),
+  : schwarz_thresh_(o.schwarz_thresh_), overlap_thresh_(o.overlap_thresh_), df_schwarz_thresh_(o.df_schwarz_thresh_), magnetism_(false),
     london_(o.london_), use_finite_(o.use_finite_), do_periodic_df_(o.do_periodic_df_), hcoreinfo_(o.hcoreinfo_) {
 
   if (!o.fmm_)
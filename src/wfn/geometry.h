@@ -39,6 +39,8 @@ class Geometry : public Molecule {
     // integral screening
     double schwarz_thresh_;
     double overlap_thresh_;
+    // shell-pair screening of the DF 3-index integrals (0 turns it off)
+    double df_schwarz_thresh_;
 
     // for DF calculations
     mutable std::shared_ptr<DFDist> df_;
@@ -76,7 +78,7 @@ class Geometry : public Molecule {
     template<class Archive>
     void save(Archive& ar, const unsigned int) const {
       ar << boost::serialization::base_object<Molecule>(*this);
-      ar << schwarz_thresh_ << overlap_thresh_ << magnetism_ << london_ << use_finite_ << do_periodic_df_ << hcoreinfo_ << fmm_;
+      ar << schwarz_thresh_ << overlap_thresh_ << df_schwarz_thresh_ << magnetism_ << london_ << use_finite_ << do_periodic_df_ << hcoreinfo_ << fmm_;
       const size_t dfindex = !df_ ? 0 : std::hash<DFDist*>()(df_.get());
       ar << dfindex;
       const bool do_rel   = !!dfs_;
@@ -87,7 +89,7 @@ class Geometry : public Molecule {
     template<class Archive>
     void load(Archive& ar, const unsigned int) {
       ar >> boost::serialization::base_object<Molecule>(*this);
-      ar >> schwarz_thresh_ >> overlap_thresh_ >> magnetism_ >> london_ >> use_finite_ >> do_periodic_df_ >> hcoreinfo_ >> fmm_;
+      ar >> schwarz_thresh_ >> overlap_thresh_ >> df_schwarz_thresh_ >> magnetism_ >> london_ >> use_finite_ >> do_periodic_df_ >> hcoreinfo_ >> fmm_;
       size_t dfindex;
       ar >> dfindex;
       static std::map<size_t, std::weak_ptr<DFDist>> dfmap;
@@ -127,6 +129,7 @@ class Geometry : public Molecule {
     // Thresholds
     double schwarz_thresh() const { return schwarz_thresh_; }
     double overlap_thresh() const { return overlap_thresh_; }
+    double df_schwarz_thresh() const { return df_schwarz_thresh_; }
     bool london() const { return london_; }
     bool magnetism() const { return magnetism_; }
 